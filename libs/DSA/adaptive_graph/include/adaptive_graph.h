@@ -0,0 +1,219 @@
+/**
+ * @file adaptive_graph.h
+ *
+ * @brief A graph that switches between an adjacency list and an adjacency
+ * matrix as its edge density changes.
+ *
+ * Sparse graphs are cheapest as adjacency lists, whose memory and traversal
+ * time grow with the number of edges. Dense graphs are cheapest as matrices,
+ * which spend a few bytes per cell on any number of edges and scan rows a
+ * word at a time. The adaptive graph measures its density, the fraction of
+ * the V^2 matrix cells its edges fill, after every change. It moves to a
+ * matrix when the density reaches `to_matrix_density` and back to a list when
+ * it falls to `to_list_density`, copying everything with matrix_from_graph()
+ * or matrix_to_graph(). The gap between the two thresholds keeps a graph near
+ * one of them from moving back and forth, and graphs of fewer than
+ * ADAPTIVE_GRAPH_MIN_NODES nodes stay where they are.
+ *
+ * Nodes are identified by their data pointer, as in adjacency_list.h, and
+ * there is at most one edge from one node to another: adding it again
+ * replaces its weight. In an undirected graph every edge is two-way and fills
+ * two cells.
+ */
+#ifndef _ADAPTIVE_GRAPH_H
+#define _ADAPTIVE_GRAPH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "adjacency_list.h"
+#include "adjacency_matrix.h"
+#include "callback_types.h"
+#include "linked_list.h"
+#include "pointer_map.h"
+
+// Default density at which a graph moves to a matrix
+#define ADAPTIVE_GRAPH_TO_MATRIX_DENSITY 0.125
+
+// Default density at which a graph moves back to a list
+#define ADAPTIVE_GRAPH_TO_LIST_DENSITY 0.0625
+
+// Graphs with fewer nodes never change layout
+#define ADAPTIVE_GRAPH_MIN_NODES 16
+
+/**
+ * @brief The layout a graph is currently stored in.
+ */
+typedef enum
+{
+    ADAPTIVE_GRAPH_LIST,   // Stored in a graph_t
+    ADAPTIVE_GRAPH_MATRIX, // Stored in a matrix_t
+} adaptive_graph_layout_t;
+
+/**
+ * @brief Structure representing an adaptive graph.
+ */
+typedef struct
+{
+    adaptive_graph_layout_t layout;            // Current layout
+    bool                    is_directed;       // Whether edges are one-way
+    graph_t *               list;              // Graph in the list layout
+    matrix_t *              matrix;            // Graph in the matrix layout
+    pointer_map_t *         indices;           // Data -> matrix index + 1
+    size_t                  node_count;        // Number of nodes
+    size_t                  edge_count;        // Number of edges
+    double                  to_matrix_density; // Density that moves to matrix
+    double                  to_list_density;   // Density that moves to list
+    FREE_F                  custom_free;       // Custom free function
+    CMP_F                   custom_compare;    // Custom compare function
+} adaptive_graph_t;
+
+/**
+ * @brief Creates a new, empty graph in the list layout with the default
+ * thresholds.
+ *
+ * @param is_directed Whether edges are one-way.
+ * @param custom_free Function pointer to the custom free function.
+ * @param custom_compare Function pointer to the custom compare function.
+ * @return Pointer to the new graph, or NULL on failure.
+ */
+adaptive_graph_t * adaptive_graph_create(bool   is_directed,
+                                         FREE_F custom_free,
+                                         CMP_F  custom_compare);
+
+/**
+ * @brief Changes the densities at which the graph changes layout, and moves
+ * it at once if its density is already past one of them.
+ *
+ * @param graph Pointer to the graph.
+ * @param to_matrix_density Density at which the graph moves to a matrix.
+ * Values above 1 keep it a list.
+ * @param to_list_density Density at which the graph moves to a list, below
+ * to_matrix_density. Negative values keep it a matrix.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_set_thresholds(adaptive_graph_t * graph,
+                                  double             to_matrix_density,
+                                  double             to_list_density);
+
+/**
+ * @brief Gets the fraction of the graph's V^2 matrix cells that hold an
+ * edge.
+ *
+ * @param graph Pointer to the graph.
+ * @return The density, or 0 for a NULL or empty graph.
+ */
+double adaptive_graph_density(const adaptive_graph_t * graph);
+
+/**
+ * @brief Adds a node to the graph. The graph frees the data with
+ * custom_free when the node is removed.
+ *
+ * @param graph Pointer to the graph.
+ * @param data Pointer to the node's data, not already in the graph.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_add_node(adaptive_graph_t * graph, void * data);
+
+/**
+ * @brief Removes a node and its edges from the graph, and frees its data.
+ *
+ * @param graph Pointer to the graph.
+ * @param data Pointer to the node's data.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_remove_node(adaptive_graph_t * graph, void * data);
+
+/**
+ * @brief Adds an edge between two nodes, or replaces the weight of the edge
+ * that is already there.
+ *
+ * @param graph Pointer to the graph.
+ * @param data_1 Pointer to the data of the first node.
+ * @param data_2 Pointer to the data of the second node.
+ * @param weight Weight of the edge.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_add_edge(adaptive_graph_t * graph,
+                            void *             data_1,
+                            void *             data_2,
+                            size_t             weight);
+
+/**
+ * @brief Removes the edge between two nodes.
+ *
+ * @param graph Pointer to the graph.
+ * @param data_1 Pointer to the data of the first node.
+ * @param data_2 Pointer to the data of the second node.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_remove_edge(adaptive_graph_t * graph,
+                               void *             data_1,
+                               void *             data_2);
+
+/**
+ * @brief Gets the weight of the edge between two nodes.
+ *
+ * @param graph Pointer to the graph.
+ * @param data_1 Pointer to the data of the first node.
+ * @param data_2 Pointer to the data of the second node.
+ * @return Weight of the edge, or GRAPH_DISTANCE_INFINITY if there is none.
+ */
+size_t adaptive_graph_get_edge_weight(adaptive_graph_t * graph,
+                                      void *             data_1,
+                                      void *             data_2);
+
+/**
+ * @brief Performs breadth-first search (BFS) on the graph.
+ *
+ * @param graph Pointer to the graph.
+ * @param start_data Pointer to the data of the starting node.
+ * @param action Function pointer to the custom action function.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_bfs(adaptive_graph_t * graph,
+                       void *             start_data,
+                       ACTION_F           action);
+
+/**
+ * @brief Performs depth-first search (DFS) on the graph.
+ *
+ * @param graph Pointer to the graph.
+ * @param start_data Pointer to the data of the starting node.
+ * @param action Function pointer to the custom action function.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_dfs(adaptive_graph_t * graph,
+                       void *             start_data,
+                       ACTION_F           action);
+
+/**
+ * @brief Finds the shortest path between two nodes with Dijkstra's
+ * algorithm: graph_dijkstra() in the list layout, and the O(V^2) kernel of
+ * matrix_dijkstra_by_index() in the matrix layout.
+ *
+ * The path list holds the node data from start to end and does not own it;
+ * delete it with list_delete().
+ *
+ * @param graph Pointer to the graph.
+ * @param start_data Pointer to the data of the starting node.
+ * @param end_data Pointer to the data of the ending node.
+ * @param path Pointer to the list to store the path.
+ * @return E_SUCCESS on success, or E_FAILURE on failure or if no path exists.
+ */
+int adaptive_graph_shortest_path(adaptive_graph_t * graph,
+                                 void *             start_data,
+                                 void *             end_data,
+                                 list_t **          path);
+
+/**
+ * @brief Destroys the graph, freeing every node's data.
+ *
+ * @param graph Pointer to the pointer to the graph.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int adaptive_graph_destroy(adaptive_graph_t ** graph);
+
+#endif /* _ADAPTIVE_GRAPH_H */
+
+/*** end of file ***/
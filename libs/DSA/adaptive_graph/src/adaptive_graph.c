@@ -0,0 +1,764 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "adaptive_graph.h"
+#include "utilities.h"
+
+/**
+ * @brief Free function for the inner list or matrix, which do not own the
+ * node data; the adaptive graph frees it itself.
+ */
+static void keep_data(void * data);
+
+/**
+ * @brief Checks if a node is in the graph, in either layout.
+ */
+static bool has_node(const adaptive_graph_t * graph, const void * data);
+
+/**
+ * @brief Finds the matrix index of a node in the matrix layout.
+ *
+ * @return E_SUCCESS if found, E_FAILURE otherwise.
+ */
+static int find_index(const adaptive_graph_t * graph,
+                      const void *             data,
+                      size_t *                 index);
+
+/**
+ * @brief Checks if there is an edge from one node to another, in either
+ * layout.
+ */
+static bool has_edge(adaptive_graph_t * graph, void * data_1, void * data_2);
+
+/**
+ * @brief Counts the edges into and out of a node in the matrix layout, in
+ * O(V) expected.
+ */
+static size_t count_incident_edges(adaptive_graph_t * graph, void * data);
+
+/**
+ * @brief Counts the two-way edges of a node in the list layout, each once,
+ * in O(degree).
+ */
+static size_t count_two_way_edges(adaptive_graph_t * graph, void * data);
+
+/**
+ * @brief Moves the graph from the list layout to the matrix layout.
+ *
+ * @return E_SUCCESS on success, or E_FAILURE on failure, in which case the
+ * graph is unchanged.
+ */
+static int move_to_matrix(adaptive_graph_t * graph);
+
+/**
+ * @brief Moves the graph from the matrix layout to the list layout.
+ *
+ * @return E_SUCCESS on success, or E_FAILURE on failure, in which case the
+ * graph is unchanged.
+ */
+static int move_to_list(adaptive_graph_t * graph);
+
+/**
+ * @brief Moves the graph to the other layout if its density has crossed the
+ * threshold for it. A graph that cannot be moved stays valid in its current
+ * layout.
+ */
+static void rebalance(adaptive_graph_t * graph);
+
+adaptive_graph_t * adaptive_graph_create(bool   is_directed,
+                                         FREE_F custom_free,
+                                         CMP_F  custom_compare)
+{
+    adaptive_graph_t * graph = NULL;
+
+    if ((NULL == custom_free) || (NULL == custom_compare))
+    {
+        PRINT_DEBUG("adaptive_graph_create(): NULL argument passed.");
+        goto END;
+    }
+
+    graph = calloc(1, sizeof(adaptive_graph_t));
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("adaptive_graph_create(): CMR failure.");
+        goto END;
+    }
+
+    graph->list = graph_create(keep_data, custom_compare);
+    if (NULL == graph->list)
+    {
+        PRINT_DEBUG("adaptive_graph_create(): Unable to create list.");
+        free(graph);
+        graph = NULL;
+        goto END;
+    }
+
+    graph->layout            = ADAPTIVE_GRAPH_LIST;
+    graph->is_directed       = is_directed;
+    graph->to_matrix_density = ADAPTIVE_GRAPH_TO_MATRIX_DENSITY;
+    graph->to_list_density   = ADAPTIVE_GRAPH_TO_LIST_DENSITY;
+    graph->custom_free       = custom_free;
+    graph->custom_compare    = custom_compare;
+
+END:
+    return graph;
+}
+
+int adaptive_graph_set_thresholds(adaptive_graph_t * graph,
+                                  double             to_matrix_density,
+                                  double             to_list_density)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("adaptive_graph_set_thresholds(): NULL argument passed.");
+        goto END;
+    }
+
+    // Written so that NaN thresholds are rejected too
+    if (!(to_list_density < to_matrix_density))
+    {
+        PRINT_DEBUG("adaptive_graph_set_thresholds(): Invalid thresholds.");
+        goto END;
+    }
+
+    graph->to_matrix_density = to_matrix_density;
+    graph->to_list_density   = to_list_density;
+    rebalance(graph);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+double adaptive_graph_density(const adaptive_graph_t * graph)
+{
+    double density = 0;
+    double cells   = 0;
+
+    if ((NULL == graph) || (0 == graph->node_count))
+    {
+        goto END;
+    }
+
+    cells   = (double)graph->node_count * (double)graph->node_count;
+    density = (double)graph->edge_count / cells;
+    if (!graph->is_directed)
+    {
+        density *= 2;
+    }
+
+END:
+    return density;
+}
+
+int adaptive_graph_add_node(adaptive_graph_t * graph, void * data)
+{
+    int    exit_code = E_FAILURE;
+    size_t index     = 0;
+
+    if ((NULL == graph) || (NULL == data))
+    {
+        PRINT_DEBUG("adaptive_graph_add_node(): NULL argument passed.");
+        goto END;
+    }
+
+    if (has_node(graph, data))
+    {
+        PRINT_DEBUG("adaptive_graph_add_node(): Node already exists.");
+        goto END;
+    }
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        exit_code = graph_add_node(graph->list, data);
+    }
+    else
+    {
+        exit_code = matrix_add_node_by_index(graph->matrix, data, &index);
+        if ((E_SUCCESS == exit_code) &&
+            (E_SUCCESS != pointer_map_insert(graph->indices,
+                                             data,
+                                             (void *)(uintptr_t)(index + 1))))
+        {
+            matrix_remove_node_by_index(graph->matrix, index);
+            exit_code = E_FAILURE;
+        }
+    }
+
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("adaptive_graph_add_node(): Unable to add node.");
+        goto END;
+    }
+
+    graph->node_count += 1;
+    rebalance(graph);
+
+END:
+    return exit_code;
+}
+
+int adaptive_graph_remove_node(adaptive_graph_t * graph, void * data)
+{
+    int    exit_code = E_FAILURE;
+    size_t index     = 0;
+    size_t edges     = 0;
+    size_t one_way   = 0;
+
+    if ((NULL == graph) || (NULL == data))
+    {
+        PRINT_DEBUG("adaptive_graph_remove_node(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!has_node(graph, data))
+    {
+        PRINT_DEBUG("adaptive_graph_remove_node(): Node does not exist.");
+        goto END;
+    }
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        // One-way edges into the node sit in other nodes' lists, so they are
+        // counted by how far graph_t's total of one-way edges drops
+        edges     = count_two_way_edges(graph, data);
+        one_way   = graph->list->directed_edge_count;
+        exit_code = graph_remove_node(graph->list, data);
+        edges += one_way - graph->list->directed_edge_count;
+    }
+    else
+    {
+        edges = count_incident_edges(graph, data);
+        find_index(graph, data, &index);
+        exit_code = matrix_remove_node_by_index(graph->matrix, index);
+        if (E_SUCCESS == exit_code)
+        {
+            pointer_map_remove(graph->indices, data, NULL);
+        }
+    }
+
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("adaptive_graph_remove_node(): Unable to remove node.");
+        goto END;
+    }
+
+    graph->custom_free(data);
+    graph->node_count -= 1;
+    graph->edge_count -= edges;
+    rebalance(graph);
+
+END:
+    return exit_code;
+}
+
+int adaptive_graph_add_edge(adaptive_graph_t * graph,
+                            void *             data_1,
+                            void *             data_2,
+                            size_t             weight)
+{
+    int    exit_code = E_FAILURE;
+    bool   is_new    = false;
+    size_t index_1   = 0;
+    size_t index_2   = 0;
+
+    if ((NULL == graph) || (NULL == data_1) || (NULL == data_2))
+    {
+        PRINT_DEBUG("adaptive_graph_add_edge(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!has_node(graph, data_1) || !has_node(graph, data_2))
+    {
+        PRINT_DEBUG("adaptive_graph_add_edge(): Node does not exist.");
+        goto END;
+    }
+
+    is_new = !has_edge(graph, data_1, data_2);
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        // A list keeps parallel edges, so the old edge makes way for the new
+        if (!is_new)
+        {
+            graph_remove_edge(graph->list, data_1, data_2);
+        }
+        exit_code = graph_add_edge(
+            graph->list, data_1, data_2, weight, !graph->is_directed);
+        if ((E_SUCCESS != exit_code) && !is_new)
+        {
+            graph->edge_count -= 1;
+        }
+    }
+    else
+    {
+        find_index(graph, data_1, &index_1);
+        find_index(graph, data_2, &index_2);
+        exit_code =
+            matrix_add_edge_by_index(graph->matrix, index_1, index_2, weight);
+    }
+
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("adaptive_graph_add_edge(): Unable to add edge.");
+        goto END;
+    }
+
+    if (is_new)
+    {
+        graph->edge_count += 1;
+    }
+    rebalance(graph);
+
+END:
+    return exit_code;
+}
+
+int adaptive_graph_remove_edge(adaptive_graph_t * graph,
+                               void *             data_1,
+                               void *             data_2)
+{
+    int    exit_code = E_FAILURE;
+    size_t index_1   = 0;
+    size_t index_2   = 0;
+
+    if ((NULL == graph) || (NULL == data_1) || (NULL == data_2))
+    {
+        PRINT_DEBUG("adaptive_graph_remove_edge(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!has_edge(graph, data_1, data_2))
+    {
+        PRINT_DEBUG("adaptive_graph_remove_edge(): Edge does not exist.");
+        goto END;
+    }
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        exit_code = graph_remove_edge(graph->list, data_1, data_2);
+    }
+    else
+    {
+        find_index(graph, data_1, &index_1);
+        find_index(graph, data_2, &index_2);
+        exit_code =
+            matrix_remove_edge_by_index(graph->matrix, index_1, index_2);
+    }
+
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("adaptive_graph_remove_edge(): Unable to remove edge.");
+        goto END;
+    }
+
+    graph->edge_count -= 1;
+    rebalance(graph);
+
+END:
+    return exit_code;
+}
+
+size_t adaptive_graph_get_edge_weight(adaptive_graph_t * graph,
+                                      void *             data_1,
+                                      void *             data_2)
+{
+    size_t weight  = GRAPH_DISTANCE_INFINITY;
+    size_t index_1 = 0;
+    size_t index_2 = 0;
+
+    if ((NULL == graph) || (NULL == data_1) || (NULL == data_2))
+    {
+        PRINT_DEBUG("adaptive_graph_get_edge_weight(): NULL argument passed.");
+        goto END;
+    }
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        weight = graph_get_edge_weight(graph->list, data_1, data_2);
+    }
+    else if ((E_SUCCESS == find_index(graph, data_1, &index_1)) &&
+             (E_SUCCESS == find_index(graph, data_2, &index_2)) &&
+             (E_SUCCESS != matrix_get_edge_weight_by_index(
+                               graph->matrix, index_1, index_2, &weight)))
+    {
+        weight = GRAPH_DISTANCE_INFINITY;
+    }
+
+END:
+    return weight;
+}
+
+int adaptive_graph_bfs(adaptive_graph_t * graph,
+                       void *             start_data,
+                       ACTION_F           action)
+{
+    int    exit_code = E_FAILURE;
+    size_t index     = 0;
+
+    if ((NULL == graph) || (NULL == start_data) || (NULL == action))
+    {
+        PRINT_DEBUG("adaptive_graph_bfs(): NULL argument passed.");
+        goto END;
+    }
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        exit_code = graph_bfs(graph->list, start_data, action);
+    }
+    else if (E_SUCCESS == find_index(graph, start_data, &index))
+    {
+        exit_code = matrix_bfs_by_index(graph->matrix, index, action);
+    }
+
+END:
+    return exit_code;
+}
+
+int adaptive_graph_dfs(adaptive_graph_t * graph,
+                       void *             start_data,
+                       ACTION_F           action)
+{
+    int    exit_code = E_FAILURE;
+    size_t index     = 0;
+
+    if ((NULL == graph) || (NULL == start_data) || (NULL == action))
+    {
+        PRINT_DEBUG("adaptive_graph_dfs(): NULL argument passed.");
+        goto END;
+    }
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        exit_code = graph_dfs(graph->list, start_data, action);
+    }
+    else if (E_SUCCESS == find_index(graph, start_data, &index))
+    {
+        exit_code = matrix_dfs_by_index(graph->matrix, index, action);
+    }
+
+END:
+    return exit_code;
+}
+
+int adaptive_graph_shortest_path(adaptive_graph_t * graph,
+                                 void *             start_data,
+                                 void *             end_data,
+                                 list_t **          path)
+{
+    int      exit_code   = E_FAILURE;
+    size_t   start       = 0;
+    size_t   end         = 0;
+    size_t * indices     = NULL;
+    size_t   path_length = 0;
+    size_t   weight      = 0;
+    void *   data        = NULL;
+    list_t * nodes       = NULL;
+
+    if ((NULL == graph) || (NULL == start_data) || (NULL == end_data) ||
+        (NULL == path))
+    {
+        PRINT_DEBUG("adaptive_graph_shortest_path(): NULL argument passed.");
+        goto END;
+    }
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        exit_code = graph_dijkstra(graph->list, start_data, end_data, path);
+        goto END;
+    }
+
+    if ((E_SUCCESS != find_index(graph, start_data, &start)) ||
+        (E_SUCCESS != find_index(graph, end_data, &end)))
+    {
+        PRINT_DEBUG("adaptive_graph_shortest_path(): Node does not exist.");
+        goto END;
+    }
+
+    exit_code = matrix_dijkstra_by_index(
+        graph->matrix, start, end, &indices, &path_length, &weight);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("adaptive_graph_shortest_path(): No path found.");
+        goto END;
+    }
+
+    exit_code = E_FAILURE;
+    nodes     = list_new(keep_data, graph->custom_compare);
+    if (NULL == nodes)
+    {
+        PRINT_DEBUG("adaptive_graph_shortest_path(): CMR failure.");
+        goto CLEANUP_INDICES;
+    }
+
+    for (size_t idx = 0; idx < path_length; idx++)
+    {
+        matrix_get_node_data_by_index(graph->matrix, indices[idx], &data);
+        if (E_SUCCESS != list_push_tail(nodes, data))
+        {
+            PRINT_DEBUG("adaptive_graph_shortest_path(): CMR failure.");
+            list_delete(&nodes);
+            goto CLEANUP_INDICES;
+        }
+    }
+
+    *path     = nodes;
+    exit_code = E_SUCCESS;
+    goto CLEANUP_INDICES;
+
+CLEANUP_INDICES:
+    free(indices);
+END:
+    return exit_code;
+}
+
+int adaptive_graph_destroy(adaptive_graph_t ** graph)
+{
+    int           exit_code = E_FAILURE;
+    list_node_t * current   = NULL;
+    void *        data      = NULL;
+    size_t        count     = 0;
+
+    if ((NULL == graph) || (NULL == *graph))
+    {
+        PRINT_DEBUG("adaptive_graph_destroy(): NULL argument passed.");
+        goto END;
+    }
+
+    // The inner graph never reads node data, so it can be freed first
+    if (ADAPTIVE_GRAPH_LIST == (*graph)->layout)
+    {
+        current = (*graph)->list->node_list->head;
+        while (NULL != current)
+        {
+            (*graph)->custom_free(((node_t *)current->data)->data);
+            current = current->next;
+        }
+        graph_destroy(&(*graph)->list);
+    }
+    else
+    {
+        count = matrix_get_node_count((*graph)->matrix);
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            matrix_get_node_data_by_index((*graph)->matrix, idx, &data);
+            if (NULL != data)
+            {
+                (*graph)->custom_free(data);
+            }
+        }
+        matrix_destroy(&(*graph)->matrix);
+        pointer_map_delete(&(*graph)->indices);
+    }
+
+    free(*graph);
+    *graph = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static void keep_data(void * data)
+{
+    (void)data;
+}
+
+static bool has_node(const adaptive_graph_t * graph, const void * data)
+{
+    const pointer_map_t * index = (ADAPTIVE_GRAPH_LIST == graph->layout)
+                                      ? graph->list->node_index
+                                      : graph->indices;
+
+    return NULL != pointer_map_get(index, data);
+}
+
+static int find_index(const adaptive_graph_t * graph,
+                      const void *             data,
+                      size_t *                 index)
+{
+    int    exit_code = E_FAILURE;
+    void * value     = pointer_map_get(graph->indices, data);
+
+    // Indices are stored plus one, since the map has no NULL values
+    if (NULL != value)
+    {
+        *index    = (size_t)(uintptr_t)value - 1;
+        exit_code = E_SUCCESS;
+    }
+
+    return exit_code;
+}
+
+static bool has_edge(adaptive_graph_t * graph, void * data_1, void * data_2)
+{
+    bool   is_present = false;
+    size_t index_1    = 0;
+    size_t index_2    = 0;
+
+    if (ADAPTIVE_GRAPH_LIST == graph->layout)
+    {
+        is_present = graph_edge_exists(graph->list, data_1, data_2);
+    }
+    else if ((E_SUCCESS == find_index(graph, data_1, &index_1)) &&
+             (E_SUCCESS == find_index(graph, data_2, &index_2)))
+    {
+        is_present = matrix_has_edge_by_index(graph->matrix, index_1, index_2);
+    }
+
+    return is_present;
+}
+
+static size_t count_incident_edges(adaptive_graph_t * graph, void * data)
+{
+    size_t edges = 0;
+    size_t count = matrix_get_node_count(graph->matrix);
+    void * other = NULL;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if ((E_SUCCESS !=
+             matrix_get_node_data_by_index(graph->matrix, idx, &other)) ||
+            (NULL == other))
+        {
+            continue;
+        }
+
+        // A directed graph may have a separate edge each way
+        edges += has_edge(graph, data, other) ? 1 : 0;
+        if (graph->is_directed && (data != other))
+        {
+            edges += has_edge(graph, other, data) ? 1 : 0;
+        }
+    }
+
+    return edges;
+}
+
+static size_t count_two_way_edges(adaptive_graph_t * graph, void * data)
+{
+    size_t        halves    = 0;
+    node_t *      node      = pointer_map_get(graph->list->node_index, data);
+    list_node_t * edge_node = NULL;
+    edge_t *      edge      = NULL;
+
+    // A two-way self-loop sits in the list twice, so count in halves
+    for (edge_node = node->edge_list->head; NULL != edge_node;
+         edge_node = edge_node->next)
+    {
+        edge = (edge_t *)edge_node->data;
+        if (!edge->is_directed)
+        {
+            halves += (edge->id_1 == edge->id_2) ? 1 : 2;
+        }
+    }
+
+    return halves / 2;
+}
+
+static int move_to_matrix(adaptive_graph_t * graph)
+{
+    int             exit_code = E_FAILURE;
+    matrix_t *      matrix    = NULL;
+    pointer_map_t * indices   = NULL;
+    list_node_t *   current   = NULL;
+    node_t *        node      = NULL;
+
+    matrix = matrix_from_graph(
+        graph->list, graph->is_directed, MATRIX_WEIGHT_SIZE_T);
+    indices = pointer_map_new(graph->node_count);
+    if ((NULL == matrix) || (NULL == indices))
+    {
+        goto CLEANUP;
+    }
+
+    // matrix_from_graph() puts each node at the index of its ID
+    current = graph->list->node_list->head;
+    while (NULL != current)
+    {
+        node = (node_t *)current->data;
+        if (E_SUCCESS != pointer_map_insert(indices,
+                                            node->data,
+                                            (void *)(uintptr_t)(node->id + 1)))
+        {
+            goto CLEANUP;
+        }
+        current = current->next;
+    }
+
+    graph_destroy(&graph->list);
+    graph->matrix  = matrix;
+    graph->indices = indices;
+    graph->layout  = ADAPTIVE_GRAPH_MATRIX;
+
+    exit_code = E_SUCCESS;
+    goto END;
+
+CLEANUP:
+    if (NULL != matrix)
+    {
+        matrix_destroy(&matrix);
+    }
+    if (NULL != indices)
+    {
+        pointer_map_delete(&indices);
+    }
+END:
+    return exit_code;
+}
+
+static int move_to_list(adaptive_graph_t * graph)
+{
+    int       exit_code = E_FAILURE;
+    graph_t * list      = NULL;
+
+    list = matrix_to_graph(graph->matrix);
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    // Neither layout owns the data, so nothing is freed here
+    matrix_destroy(&graph->matrix);
+    pointer_map_delete(&graph->indices);
+    graph->list   = list;
+    graph->layout = ADAPTIVE_GRAPH_LIST;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void rebalance(adaptive_graph_t * graph)
+{
+    double density = adaptive_graph_density(graph);
+
+    if (ADAPTIVE_GRAPH_MIN_NODES > graph->node_count)
+    {
+        goto END;
+    }
+
+    if ((ADAPTIVE_GRAPH_LIST == graph->layout) &&
+        (density >= graph->to_matrix_density) &&
+        (E_SUCCESS != move_to_matrix(graph)))
+    {
+        PRINT_DEBUG("rebalance(): Unable to move to a matrix.");
+    }
+    else if ((ADAPTIVE_GRAPH_MATRIX == graph->layout) &&
+             (density <= graph->to_list_density) &&
+             (E_SUCCESS != move_to_list(graph)))
+    {
+        PRINT_DEBUG("rebalance(): Unable to move to a list.");
+    }
+
+END:
+    return;
+}
+
+/*** end of file ***/
@@ -0,0 +1,367 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "adaptive_graph.h"
+#include "comparisons.h"
+#include "utilities.h"
+
+#define NODE_COUNT  64
+#define PATH_COUNT  40
+#define MAX_WEIGHT  50
+#define DENSE_EVERY 3 // One in this many pairs gets an edge in dense graphs
+
+adaptive_graph_t * test_graph = NULL;
+
+int    node_data[NODE_COUNT];
+int    free_count  = 0;
+size_t visit_count = 0;
+
+void count_free(void * data)
+{
+    (void)data;
+    free_count++;
+}
+
+void record_visit(const void * data)
+{
+    (void)data;
+    visit_count++;
+}
+
+// Adds NODE_COUNT nodes and a ring of edges, which stays sparse
+static void build_ring(void)
+{
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        node_data[idx] = idx;
+        adaptive_graph_add_node(test_graph, &node_data[idx]);
+    }
+
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        adaptive_graph_add_edge(test_graph,
+                                &node_data[idx],
+                                &node_data[(idx + 1) % NODE_COUNT],
+                                1);
+    }
+}
+
+// Sums the weights along a path, checking that each step is an edge
+static size_t path_weight(list_t * path)
+{
+    size_t        total   = 0;
+    size_t        weight  = 0;
+    list_node_t * current = path->head;
+
+    while ((NULL != current) && (NULL != current->next))
+    {
+        weight = adaptive_graph_get_edge_weight(
+            test_graph, current->data, current->next->data);
+        CU_ASSERT_NOT_EQUAL(weight, GRAPH_DISTANCE_INFINITY);
+        total += weight;
+        current = current->next;
+    }
+
+    return total;
+}
+
+void setup(void)
+{
+    free_count = 0;
+    test_graph = adaptive_graph_create(false, count_free, int_comp);
+}
+
+void teardown(void)
+{
+    if (NULL != test_graph)
+    {
+        adaptive_graph_destroy(&test_graph);
+    }
+}
+
+void test_adaptive_graph_create(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_graph);
+    CU_ASSERT_EQUAL(test_graph->layout, ADAPTIVE_GRAPH_LIST);
+    CU_ASSERT_EQUAL(test_graph->node_count, 0);
+    CU_ASSERT_EQUAL(test_graph->edge_count, 0);
+    CU_ASSERT_EQUAL(adaptive_graph_density(test_graph), 0);
+
+    CU_ASSERT_PTR_NULL(adaptive_graph_create(true, NULL, int_comp));
+    CU_ASSERT_PTR_NULL(adaptive_graph_create(true, count_free, NULL));
+    CU_ASSERT_EQUAL(adaptive_graph_set_thresholds(test_graph, 0.1, 0.2),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(adaptive_graph_set_thresholds(NULL, 0.2, 0.1),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(adaptive_graph_destroy(NULL), E_FAILURE);
+}
+
+void test_adaptive_graph_edges(void)
+{
+    build_ring();
+    CU_ASSERT_EQUAL(test_graph->node_count, NODE_COUNT);
+    CU_ASSERT_EQUAL(test_graph->edge_count, NODE_COUNT);
+    CU_ASSERT_EQUAL(test_graph->layout, ADAPTIVE_GRAPH_LIST);
+    CU_ASSERT_DOUBLE_EQUAL(adaptive_graph_density(test_graph),
+                           2.0 / NODE_COUNT,
+                           1e-9);
+
+    // Adding an edge again replaces its weight, either way round
+    CU_ASSERT_EQUAL(
+        adaptive_graph_add_edge(test_graph, &node_data[1], &node_data[0], 7),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(test_graph->edge_count, NODE_COUNT);
+    CU_ASSERT_EQUAL(adaptive_graph_get_edge_weight(
+                        test_graph, &node_data[0], &node_data[1]),
+                    7);
+
+    CU_ASSERT_EQUAL(
+        adaptive_graph_remove_edge(test_graph, &node_data[1], &node_data[2]),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        adaptive_graph_remove_edge(test_graph, &node_data[2], &node_data[1]),
+        E_FAILURE);
+    CU_ASSERT_EQUAL(test_graph->edge_count, NODE_COUNT - 1);
+
+    CU_ASSERT_EQUAL(adaptive_graph_add_node(test_graph, &node_data[3]),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(
+        adaptive_graph_add_edge(test_graph, &node_data[3], &free_count, 1),
+        E_FAILURE);
+    CU_ASSERT_EQUAL(adaptive_graph_get_edge_weight(
+                        test_graph, &node_data[3], &node_data[9]),
+                    GRAPH_DISTANCE_INFINITY);
+
+    adaptive_graph_destroy(&test_graph);
+    CU_ASSERT_EQUAL(free_count, NODE_COUNT);
+}
+
+void test_adaptive_graph_migration(void)
+{
+    size_t        added   = 0;
+    size_t        ends    = 0;
+    list_node_t * current = NULL;
+
+    build_ring();
+
+    // Filling in chords moves the graph to a matrix once it is dense enough
+    for (int src = 0; src < NODE_COUNT; src++)
+    {
+        for (int dst = src + 2; dst < NODE_COUNT; dst += DENSE_EVERY)
+        {
+            if (ADAPTIVE_GRAPH_MATRIX == test_graph->layout)
+            {
+                break;
+            }
+            adaptive_graph_add_edge(
+                test_graph, &node_data[src], &node_data[dst], dst - src);
+            added++;
+        }
+    }
+    CU_ASSERT_EQUAL_FATAL(test_graph->layout, ADAPTIVE_GRAPH_MATRIX);
+    CU_ASSERT_EQUAL(test_graph->edge_count, NODE_COUNT + added);
+    CU_ASSERT(adaptive_graph_density(test_graph) >=
+              ADAPTIVE_GRAPH_TO_MATRIX_DENSITY);
+    CU_ASSERT_EQUAL(test_graph->node_count, NODE_COUNT);
+
+    // Every edge survives the move
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        CU_ASSERT_EQUAL(adaptive_graph_get_edge_weight(
+                            test_graph,
+                            &node_data[(idx + 1) % NODE_COUNT],
+                            &node_data[idx]),
+                        1);
+    }
+    CU_ASSERT_EQUAL(adaptive_graph_get_edge_weight(
+                        test_graph, &node_data[5], &node_data[0]),
+                    5);
+
+    // Between the thresholds, the graph stays where it is
+    CU_ASSERT_EQUAL(
+        adaptive_graph_remove_edge(test_graph, &node_data[0], &node_data[5]),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(test_graph->layout, ADAPTIVE_GRAPH_MATRIX);
+
+    // Removing nodes from the matrix drops their edges from the count
+    for (int idx = 0; idx < 8; idx++)
+    {
+        CU_ASSERT_EQUAL(adaptive_graph_remove_node(test_graph, &node_data[idx]),
+                        E_SUCCESS);
+    }
+    CU_ASSERT_EQUAL(free_count, 8);
+    CU_ASSERT_EQUAL(adaptive_graph_remove_node(test_graph, &node_data[0]),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(adaptive_graph_add_node(test_graph, &node_data[0]),
+                    E_SUCCESS);
+
+    // Lowering the threshold moves the graph back to a list at once
+    CU_ASSERT_EQUAL(adaptive_graph_set_thresholds(test_graph, 0.9, 0.8),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(test_graph->layout, ADAPTIVE_GRAPH_LIST);
+    CU_ASSERT_EQUAL(test_graph->list->node_count, NODE_COUNT - 7);
+    CU_ASSERT_EQUAL(adaptive_graph_get_edge_weight(
+                        test_graph, &node_data[9], &node_data[8]),
+                    1);
+    CU_ASSERT_FALSE(
+        graph_edge_exists(test_graph->list, &node_data[7], &node_data[8]));
+    CU_ASSERT_EQUAL(adaptive_graph_add_edge(
+                        test_graph, &node_data[0], &node_data[8], 1),
+                    E_SUCCESS);
+
+    // The edge count kept through all of that still matches the list
+    adaptive_graph_set_thresholds(test_graph, 0, -1);
+    CU_ASSERT_EQUAL(test_graph->layout, ADAPTIVE_GRAPH_MATRIX);
+    adaptive_graph_set_thresholds(test_graph, 2, 1);
+    CU_ASSERT_EQUAL_FATAL(test_graph->layout, ADAPTIVE_GRAPH_LIST);
+    CU_ASSERT_EQUAL(test_graph->list->directed_edge_count, 0);
+    for (current = test_graph->list->node_list->head; NULL != current;
+         current = current->next)
+    {
+        ends += ((node_t *)current->data)->edge_count;
+    }
+    CU_ASSERT_EQUAL(ends, 2 * test_graph->edge_count);
+
+    adaptive_graph_destroy(&test_graph);
+    CU_ASSERT_EQUAL(free_count, NODE_COUNT + 1);
+}
+
+void test_adaptive_graph_directed(void)
+{
+    adaptive_graph_t * graph = NULL;
+
+    graph = adaptive_graph_create(true, count_free, int_comp);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    adaptive_graph_set_thresholds(graph, 0, -1);
+
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        node_data[idx] = idx;
+        adaptive_graph_add_node(graph, &node_data[idx]);
+    }
+    CU_ASSERT_EQUAL_FATAL(graph->layout, ADAPTIVE_GRAPH_MATRIX);
+
+    // Edges each way between two nodes are separate
+    adaptive_graph_add_edge(graph, &node_data[1], &node_data[2], 4);
+    adaptive_graph_add_edge(graph, &node_data[2], &node_data[1], 6);
+    adaptive_graph_add_edge(graph, &node_data[2], &node_data[2], 1);
+    adaptive_graph_add_edge(graph, &node_data[3], &node_data[2], 1);
+    adaptive_graph_add_edge(graph, &node_data[3], &node_data[4], 1);
+    CU_ASSERT_EQUAL(graph->edge_count, 5);
+    CU_ASSERT_DOUBLE_EQUAL(adaptive_graph_density(graph),
+                           5.0 / (NODE_COUNT * NODE_COUNT),
+                           1e-9);
+    CU_ASSERT_EQUAL(
+        adaptive_graph_get_edge_weight(graph, &node_data[2], &node_data[1]), 6);
+    CU_ASSERT_EQUAL(adaptive_graph_get_edge_weight(
+                        graph, &node_data[4], &node_data[3]),
+                    GRAPH_DISTANCE_INFINITY);
+
+    CU_ASSERT_EQUAL(adaptive_graph_remove_node(graph, &node_data[2]),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(graph->edge_count, 1);
+
+    // One-way edges stay one-way in the list
+    adaptive_graph_set_thresholds(graph, 2, 1);
+    CU_ASSERT_EQUAL_FATAL(graph->layout, ADAPTIVE_GRAPH_LIST);
+    CU_ASSERT_EQUAL(graph->list->directed_edge_count, 1);
+    CU_ASSERT_EQUAL(adaptive_graph_remove_node(graph, &node_data[4]),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(graph->edge_count, 0);
+
+    adaptive_graph_destroy(&graph);
+    CU_ASSERT_EQUAL(free_count, NODE_COUNT);
+}
+
+void test_adaptive_graph_shortest_path(void)
+{
+    list_t * path       = NULL;
+    size_t   weights[2] = { 0 };
+    size_t   lengths[2] = { 0 };
+    size_t   visits[2]  = { 0 };
+    unsigned seed       = 7;
+
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        node_data[idx] = idx;
+        adaptive_graph_add_node(test_graph, &node_data[idx]);
+    }
+    for (int src = 0; src < NODE_COUNT; src++)
+    {
+        for (int dst = src + 1; dst < NODE_COUNT; dst++)
+        {
+            seed = (seed * 1103515245) + 12345;
+            if (0 == ((seed >> 16) % DENSE_EVERY))
+            {
+                adaptive_graph_add_edge(test_graph,
+                                        &node_data[src],
+                                        &node_data[dst],
+                                        1 + ((seed >> 8) % MAX_WEIGHT));
+            }
+        }
+    }
+
+    // The same queries give the same answers in both layouts
+    for (size_t pass = 0; pass < 2; pass++)
+    {
+        adaptive_graph_set_thresholds(
+            test_graph, (0 == pass) ? 2 : 0, (0 == pass) ? 1 : -1);
+        CU_ASSERT_EQUAL(test_graph->layout,
+                        (0 == pass) ? ADAPTIVE_GRAPH_LIST
+                                    : ADAPTIVE_GRAPH_MATRIX);
+
+        for (int idx = 1; idx < PATH_COUNT; idx++)
+        {
+            CU_ASSERT_EQUAL_FATAL(
+                adaptive_graph_shortest_path(
+                    test_graph, &node_data[0], &node_data[idx], &path),
+                E_SUCCESS);
+            CU_ASSERT_PTR_EQUAL(path->head->data, &node_data[0]);
+            CU_ASSERT_PTR_EQUAL(path->tail->data, &node_data[idx]);
+            weights[pass] += path_weight(path);
+            lengths[pass] += path->size;
+            list_delete(&path);
+        }
+
+        visit_count = 0;
+        CU_ASSERT_EQUAL(
+            adaptive_graph_bfs(test_graph, &node_data[5], record_visit),
+            E_SUCCESS);
+        CU_ASSERT_EQUAL(
+            adaptive_graph_dfs(test_graph, &node_data[5], record_visit),
+            E_SUCCESS);
+        visits[pass] = visit_count;
+    }
+    CU_ASSERT_EQUAL(weights[0], weights[1]);
+    CU_ASSERT(lengths[0] >= PATH_COUNT);
+    CU_ASSERT_EQUAL(visits[0], 2 * NODE_COUNT);
+    CU_ASSERT_EQUAL(visits[1], 2 * NODE_COUNT);
+
+    CU_ASSERT_EQUAL(adaptive_graph_shortest_path(
+                        test_graph, &node_data[0], &free_count, &path),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(adaptive_graph_bfs(test_graph, &free_count, record_visit),
+                    E_FAILURE);
+}
+
+static CU_TestInfo adaptive_graph_tests[] = {
+    { "create", test_adaptive_graph_create },
+    { "edges", test_adaptive_graph_edges },
+    { "migration", test_adaptive_graph_migration },
+    { "directed", test_adaptive_graph_directed },
+    { "shortest_path", test_adaptive_graph_shortest_path },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo adaptive_graph_test_suite = {
+    "adaptive_graph Tests",
+    NULL,                // Suite initialization function
+    NULL,                // Suite cleanup function
+    setup,               // Suite setup function
+    teardown,            // Suite teardown function
+    adaptive_graph_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -1,44 +1,118 @@
 #ifndef _ADJACENCY_LIST_H
 #define _ADJACENCY_LIST_H
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdint.h>
 
 #include "callback_types.h"
+#include "disjoint_set.h"
 #include "linked_list.h"
+#include "pointer_map.h"
+
+// Distance reported between nodes that are not connected
+#define GRAPH_DISTANCE_INFINITY SIZE_MAX
+
+// Edge count above which a node indexes its edges by neighbour
+#define GRAPH_NEIGHBOR_INDEX_DEGREE 8
 
 /**
  * @brief Structure representing a node in the graph.
+ *
+ * A node and its edge lists may be shared by a graph and its clones. The
+ * reference count says how many ID tables hold it, and a graph copies the
+ * node before changing it while another table still does.
  */
 typedef struct
 {
-    void *   data;       // Pointer to the data stored in the node
-    size_t   edge_count; // Number of edges connected to the node
-    list_t * edge_list;  // List of edges connected to the node
+    void *          data;         // Pointer to the data stored in the node
+    size_t          edge_count;   // Number of edges connected to the node
+    list_t *        edge_list;    // List of edges connected to the node
+    list_t *        in_edge_list; // One-way edges into the node, or NULL
+    uint32_t        id;           // Dense index, reassigned on removal
+    pointer_map_t * neighbors;    // Neighbour data -> edge_list entry
+    pointer_map_t * in_neighbors; // Source data -> in_edge_list entry
+    atomic_size_t   references;   // ID tables holding the node
 } node_t;
 
 /**
  * @brief Structure representing an edge in the graph.
+ *
+ * Every list holds its own copy of an edge: a two-way edge sits in both
+ * endpoints' edge lists, a one-way edge in its source's edge list and its
+ * target's in_edge_list. Endpoints are node IDs rather than pointers, so a
+ * list shared with clones stays valid when one of the nodes it leads to is
+ * copied.
  */
 typedef struct
 {
-    node_t * node_1;      // Pointer to the first node of the edge
-    node_t * node_2;      // Pointer to the second node of the edge
+    uint32_t id_1;        // ID of the first node of the edge
+    uint32_t id_2;        // ID of the second node of the edge
     size_t   weight;      // Weight of the edge
     bool     is_directed; // Flag indicating if the edge is directed
 } edge_t;
 
+/**
+ * @brief Reference count on an ID table shared by clones.
+ */
+typedef struct graph_share graph_share_t;
+
+/**
+ * @brief A graph, its clones and their clones, which share node data and
+ * defer freeing it until one of them is left.
+ */
+typedef struct graph_family graph_family_t;
+
+/**
+ * @brief Shortest paths from a few sources, repaired as the graph changes.
+ */
+typedef struct graph_paths graph_paths_t;
+
 /**
  * @brief Structure representing a graph.
+ *
+ * The node list, node index, nodes and links together form the graph's ID
+ * table, which clones share until one of them is modified.
  */
 typedef struct
 {
-    size_t   node_count;     // Number of nodes in the graph
-    list_t * node_list;      // List of nodes in the graph
-    FREE_F   custom_free;    // Custom free function
-    CMP_F    custom_compare; // Custom compare function
+    size_t           node_count;          // Number of nodes in the graph
+    size_t           directed_edge_count; // Number of one-way edges
+    list_t *         node_list;           // List of nodes in the graph
+    FREE_F           custom_free;         // Custom free function
+    CMP_F            custom_compare;      // Custom compare function
+    disjoint_set_t * components;          // Weak components, or NULL
+    pointer_map_t *  node_index;          // Node data -> node
+    node_t **        nodes;               // Node by ID, node_count entries
+    list_node_t **   links;               // Node list entry by ID
+    size_t           node_capacity;       // Entries allocated in nodes
+    graph_share_t *  share;               // Set while clones share the table
+    graph_family_t * family;              // Set once the graph is cloned
+    graph_paths_t *  paths;               // Paths repaired on changes
 } graph_t;
 
+/**
+ * @brief Function pointer type for A* heuristics. Returns a lower bound on
+ * the path weight from the node holding 'data' to the node holding
+ * 'goal_data'.
+ */
+typedef size_t (*HEURISTIC_F)(const void * data, const void * goal_data);
+
+/**
+ * @brief Reusable scratch space for graph traversals.
+ *
+ * A node counts as visited when its stamp equals the current epoch, so
+ * starting a new traversal only increments the epoch instead of clearing the
+ * array. The frontier holds the DFS stack or the BFS queue.
+ */
+typedef struct
+{
+    size_t     capacity; // Number of node IDs the workspace can track
+    uint32_t   epoch;    // Stamp value that marks a node as visited
+    uint32_t * stamps;   // Per-ID visit stamps
+    node_t **  frontier; // Stack or queue storage, capacity entries
+} graph_workspace_t;
+
 /**
  * @brief Creates a new graph.
  *
@@ -51,6 +125,10 @@ graph_t * graph_create(FREE_F custom_free, CMP_F custom_compare);
 /**
  * @brief Adds a node to the graph.
  *
+ * The node is indexed by the address in 'data'. Later calls that pass the
+ * same pointer find it in O(1) expected; any other pointer falls back to a
+ * linear search with the graph's compare function.
+ *
  * @param graph Pointer to the graph.
  * @param data Pointer to the data to be added.
  * @return E_SUCCESS on success, or E_FAILURE on failure.
@@ -58,7 +136,12 @@ graph_t * graph_create(FREE_F custom_free, CMP_F custom_compare);
 int graph_add_node(graph_t * graph, void * data);
 
 /**
- * @brief Removes a node from the graph.
+ * @brief Removes a node from the graph, with every edge into or out of it, in
+ * O(degree) expected.
+ *
+ * The node holding the last ID moves into the freed one, so its edges are
+ * rewritten as well. Attached paths route around the node, which adds the
+ * cost of their repairs.
  *
  * @param graph Pointer to the graph.
  * @param data Pointer to the data of the node to be removed.
@@ -144,91 +227,342 @@ int graph_dfs(graph_t * graph, void * start_data, ACTION_F action);
  */
 int graph_bfs(graph_t * graph, void * start_data, ACTION_F action);
 
+/**
+ * @brief Creates a traversal workspace for graphs of up to 'capacity' nodes.
+ *
+ * @param capacity Number of nodes the workspace must handle.
+ * @return Pointer to the new workspace, or NULL on failure.
+ */
+graph_workspace_t * graph_workspace_create(size_t capacity);
+
+/**
+ * @brief Grows a workspace so it can handle at least 'capacity' nodes. Does
+ * nothing if it is already large enough.
+ *
+ * @param workspace Pointer to the workspace.
+ * @param capacity Number of nodes the workspace must handle.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_workspace_reserve(graph_workspace_t * workspace, size_t capacity);
+
+/**
+ * @brief Destroys a traversal workspace.
+ *
+ * @param workspace Pointer to the pointer to the workspace.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_workspace_destroy(graph_workspace_t ** workspace);
+
+/**
+ * @brief Performs depth-first search (DFS) using a caller-provided workspace.
+ * Does not allocate.
+ *
+ * @param graph Pointer to the graph.
+ * @param workspace Workspace with capacity for at least the graph's nodes.
+ * @param start_data Pointer to the data of the starting node.
+ * @param action Function pointer to the custom action function.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_dfs_workspace(graph_t *           graph,
+                        graph_workspace_t * workspace,
+                        void *              start_data,
+                        ACTION_F            action);
+
+/**
+ * @brief Performs breadth-first search (BFS) using a caller-provided
+ * workspace. Does not allocate.
+ *
+ * @param graph Pointer to the graph.
+ * @param workspace Workspace with capacity for at least the graph's nodes.
+ * @param start_data Pointer to the data of the starting node.
+ * @param action Function pointer to the custom action function.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_bfs_workspace(graph_t *           graph,
+                        graph_workspace_t * workspace,
+                        void *              start_data,
+                        ACTION_F            action);
+
 /**
  * @brief Finds the shortest path between two nodes using Dijkstra's algorithm.
  *
+ * The search stops as soon as the end node is settled. The path list holds
+ * the node data from start to end and does not own it; delete it with
+ * list_delete().
+ *
  * @param graph Pointer to the graph.
  * @param start_data Pointer to the data of the starting node.
  * @param end_data Pointer to the data of the ending node.
  * @param path Pointer to the list to store the path.
- * @return E_SUCCESS on success, or E_FAILURE on failure.
+ * @return E_SUCCESS on success, or E_FAILURE on failure or if no path exists.
  */
 int graph_dijkstra(graph_t * graph,
                    void *    start_data,
                    void *    end_data,
                    list_t ** path);
 
+/**
+ * @brief Finds the shortest path between two nodes by searching forwards
+ * from the start and backwards from the end at the same time.
+ *
+ * Usually settles far fewer nodes than graph_dijkstra() on large graphs. If
+ * the graph has one-way edges, an incoming-edge index is built first.
+ *
+ * @param graph Pointer to the graph.
+ * @param start_data Pointer to the data of the starting node.
+ * @param end_data Pointer to the data of the ending node.
+ * @param path Pointer to the list to store the path.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_dijkstra_bidirectional(graph_t * graph,
+                                 void *    start_data,
+                                 void *    end_data,
+                                 list_t ** path);
+
 /**
  * @brief Finds the shortest path between two nodes using A* algorithm.
  *
  * @param graph Pointer to the graph.
  * @param start_data Pointer to the data of the starting node.
  * @param end_data Pointer to the data of the ending node.
+ * @param heuristic Lower bound on the remaining path weight; NULL behaves
+ * like graph_dijkstra().
  * @param path Pointer to the list to store the path.
  * @return E_SUCCESS on success, or E_FAILURE on failure.
  */
-int graph_a_star(graph_t * graph,
-                 void *    start_data,
-                 void *    end_data,
-                 list_t ** path);
+int graph_a_star(graph_t *   graph,
+                 void *      start_data,
+                 void *      end_data,
+                 HEURISTIC_F heuristic,
+                 list_t **   path);
+
+/**
+ * @brief Builds the direct-edge distance matrix of the graph.
+ *
+ * The matrix is a single node_count x node_count array in row-major order,
+ * indexed by node ID: the entry for the edge from node 'i' to node 'j' is
+ * (*distances)[(i * node_count) + j]. The diagonal is 0, the lightest edge
+ * is kept when nodes are joined more than once, and unconnected pairs hold
+ * GRAPH_DISTANCE_INFINITY. The caller frees the matrix with free().
+ *
+ * @param graph Pointer to the graph.
+ * @param distances Set to the new matrix.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_distance_matrix(graph_t * graph, size_t ** distances);
 
 /**
  * @brief Computes the shortest paths between all pairs of nodes using
- * Floyd-Warshall algorithm.
+ * Floyd-Warshall algorithm, in the calling thread.
+ *
+ * See graph_distance_matrix() for the layout of the result. This is the
+ * plain O(V^3) triple loop and stays serial on purpose: the DSA libraries
+ * do not link against Threading or Parallel. For more than a few hundred
+ * nodes use parallel_graph_floyd_warshall() from the Parallel library, which
+ * computes the same matrix with a blocked, vectorised kernel and is several
+ * times faster even with a NULL pool.
  *
  * @param graph Pointer to the graph.
- * @param distances Pointer to the 2D array to store the distances.
+ * @param distances Set to the new distance matrix.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_floyd_warshall(graph_t * graph, size_t ** distances);
+
+/**
+ * @brief Starts tracking shortest paths in a graph as it changes.
+ *
+ * Each registered source keeps a cached distance and parent array, indexed by
+ * node ID. The paths are attached to the graph, and graph_add_edge(),
+ * graph_remove_edge() and graph_remove_node() repair every source in place
+ * instead of running Dijkstra's algorithm again. Removing a source's node
+ * unregisters it, and graph_clear() unregisters every source.
+ *
+ * Follows Ramalingam and Reps. A new edge is relaxed and the improvement
+ * spreads Dijkstra-style through the nodes it shortens. A removed edge or
+ * node only matters to the nodes below it in a source's shortest path tree;
+ * those that still have another parent at the same distance keep it, and
+ * only the rest are recomputed, from their unaffected neighbours inward.
+ *
+ * graph_add_node() extends every source with the new, unreachable node. If
+ * that runs out of memory the paths need graph_paths_refresh(): until then
+ * changes skip them, and they refuse new sources and queries.
+ *
+ * Only the graph itself is tracked, not its clones.
+ *
+ * @param graph Pointer to the graph, which must outlive the paths.
+ * @return Pointer to the new paths with no sources, or NULL on failure.
+ */
+graph_paths_t * graph_paths_create(graph_t * graph);
+
+/**
+ * @brief Registers a source and computes its shortest paths.
+ *
+ * @param paths Pointer to the paths.
+ * @param data Pointer to the data of the source node, not yet registered.
  * @return E_SUCCESS on success, or E_FAILURE on failure.
  */
-int graph_floyd_warshall(graph_t * graph, size_t *** distances);
+int graph_paths_add_source(graph_paths_t * paths, void * data);
+
+/**
+ * @brief Stops tracking a source and frees its cached arrays.
+ *
+ * @param paths Pointer to the paths.
+ * @param data Pointer to the data of the source node.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_paths_remove_source(graph_paths_t * paths, void * data);
+
+/**
+ * @brief Recomputes every source from scratch, after graph_add_node() ran out
+ * of memory.
+ *
+ * @param paths Pointer to the paths.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_paths_refresh(graph_paths_t * paths);
+
+/**
+ * @brief Reads a cached distance.
+ *
+ * @param paths Pointer to the paths.
+ * @param source_data Pointer to the data of the source node.
+ * @param target_data Pointer to the data of the target node.
+ * @return Weight of the shortest path from source to target, or
+ * GRAPH_DISTANCE_INFINITY if there is none, the source is not registered or
+ * the paths need a refresh.
+ */
+size_t graph_paths_get_distance(const graph_paths_t * paths,
+                                void *                source_data,
+                                void *                target_data);
 
 /**
- * @brief Checks if the graph is connected.
+ * @brief Reads a shortest path from the cached parents of a source.
+ *
+ * The path list holds the node data from source to target and does not own
+ * it; delete it with list_delete().
+ *
+ * @param paths Pointer to the paths.
+ * @param source_data Pointer to the data of the source node.
+ * @param target_data Pointer to the data of the target node.
+ * @param path Pointer to the list to store the path.
+ * @param total_weight Pointer to the size_t to store the path's weight.
+ * @return E_SUCCESS on success, or E_FAILURE on failure, including when the
+ * target cannot be reached or the paths need a refresh.
+ */
+int graph_paths_get_path(const graph_paths_t * paths,
+                         void *                source_data,
+                         void *                target_data,
+                         list_t **             path,
+                         size_t *              total_weight);
+
+/**
+ * @brief Frees the paths and sets the caller's pointer to NULL. The graph is
+ * left as it is.
+ *
+ * @param paths_address Pointer to the paths.
+ */
+void graph_paths_destroy(graph_paths_t ** paths_address);
+
+/**
+ * @brief Checks if the graph is weakly connected, i.e. connected when every
+ * edge is treated as two-way. A graph with no nodes counts as connected.
+ *
+ * The first call builds a union-find forest of the graph's components in
+ * O(V + E α(V)). graph_add_node() and graph_add_edge() keep it up to date,
+ * so later calls are O(1) until an edge or node is removed.
  *
  * @param graph Pointer to the graph.
  * @param is_connected Pointer to the boolean to store the result.
  * @return E_SUCCESS on success, or E_FAILURE on failure.
  */
-int graph_is_connected(graph_t * graph, const bool * is_connected);
+int graph_is_connected(graph_t * graph, bool * is_connected);
+
+/**
+ * @brief Checks if two nodes are in the same weakly connected component.
+ *
+ * Shares the component forest of graph_is_connected(), so each call costs
+ * the two node lookups plus near O(1).
+ *
+ * @param graph Pointer to the graph.
+ * @param data_1 Pointer to the data of the first node.
+ * @param data_2 Pointer to the data of the second node.
+ * @param is_connected Pointer to the boolean to store the result.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_in_same_component(graph_t * graph,
+                            void *    data_1,
+                            void *    data_2,
+                            bool *    is_connected);
 
 /**
  * @brief Checks if the graph contains a cycle.
  *
+ * One-way edges must be followed in their direction and two-way edges may be
+ * followed either way, but a cycle never uses the same edge twice. A
+ * self-loop or two parallel two-way edges therefore count as cycles, while a
+ * single two-way edge does not. Runs in O(V + E α(V)).
+ *
  * @param graph Pointer to the graph.
  * @param is_cyclic Pointer to the boolean to store the result.
  * @return E_SUCCESS on success, or E_FAILURE on failure.
  */
-int graph_is_cyclic(graph_t * graph, const bool * is_cyclic);
+int graph_is_cyclic(graph_t * graph, bool * is_cyclic);
 
 /**
- * @brief Finds the connected components in the graph.
+ * @brief Finds the weakly connected components of the graph.
+ *
+ * Each entry of the returned list is a list_t of the data of the nodes in
+ * one component. Deleting the returned list with list_delete() also deletes
+ * the inner lists; the node data stays owned by the graph.
  *
  * @param graph Pointer to the graph.
- * @return Pointer to the list of connected components.
+ * @return Pointer to the list of connected components, or NULL on failure.
  */
 list_t * graph_find_connected_components(graph_t * graph);
 
 /**
- * @brief Gets the degree of a node in the graph.
+ * @brief Finds the strongly connected components of the graph with an
+ * iterative Tarjan search in O(V + E).
+ *
+ * Two-way edges join both of their nodes into one component. The result has
+ * the same layout as graph_find_connected_components(), with components in
+ * reverse topological order: no component has an edge into a later one.
+ *
+ * @param graph Pointer to the graph.
+ * @return Pointer to the list of components, or NULL on failure.
+ */
+list_t * graph_find_strongly_connected_components(graph_t * graph);
+
+/**
+ * @brief Gets the degree of a node in the graph: the number of two-way edges
+ * it touches plus the one-way edges leaving it.
  *
  * @param graph Pointer to the graph.
  * @param data Pointer to the data of the node.
  * @param degree Pointer to the size_t to store the degree.
  * @return E_SUCCESS on success, or E_FAILURE on failure.
  */
-int graph_node_degree(graph_t * graph, void * data, const size_t * degree);
+int graph_node_degree(graph_t * graph, void * data, size_t * degree);
 
 /**
- * @brief Gets the adjacent nodes of a given node in the graph.
+ * @brief Gets the nodes that can be reached from a given node over one edge.
+ *
+ * Each neighbour appears once, however many edges lead to it. The returned
+ * list holds node data owned by the graph; delete it with list_delete().
  *
  * @param graph Pointer to the graph.
  * @param data Pointer to the data of the node.
- * @return Pointer to the list of adjacent nodes.
+ * @return Pointer to the list of adjacent node data, or NULL on failure.
  */
 list_t * graph_get_adjacent_nodes(graph_t * graph, void * data);
 
 /**
- * @brief Checks if an edge exists between two nodes in the graph.
+ * @brief Checks if an edge can be followed from one node to another: a
+ * one-way edge from the first node or a two-way edge between them.
+ *
+ * Nodes are found through the graph's node index, and nodes with more than
+ * GRAPH_NEIGHBOR_INDEX_DEGREE edges index those edges by neighbour, so the
+ * check is O(1) expected.
  *
  * @param graph Pointer to the graph.
  * @param data_1 Pointer to the data of the first node.
@@ -238,20 +572,38 @@ list_t * graph_get_adjacent_nodes(graph_t * graph, void * data);
 bool graph_edge_exists(graph_t * graph, void * data_1, void * data_2);
 
 /**
- * @brief Gets the weight of an edge between two nodes in the graph.
+ * @brief Gets the weight of an edge between two nodes in the graph, as
+ * matched by graph_edge_exists(). With parallel edges, any one of their
+ * weights may be returned.
  *
  * @param graph Pointer to the graph.
  * @param data_1 Pointer to the data of the first node.
  * @param data_2 Pointer to the data of the second node.
- * @return Weight of the edge.
+ * @return Weight of the edge, or GRAPH_DISTANCE_INFINITY if there is none.
  */
 size_t graph_get_edge_weight(graph_t * graph, void * data_1, void * data_2);
 
 /**
- * @brief Creates a clone of the graph.
+ * @brief Creates a copy-on-write clone of the graph in O(1).
+ *
+ * The clone and the graph share their ID table, nodes and edge lists. The
+ * first change to either one copies the ID table for that graph in O(V).
+ * Beyond that, a change copies only the nodes whose edge lists it touches and
+ * leaves the other holders on the old version: adding or removing an edge
+ * copies its two endpoints, and removing a node copies its neighbours and the
+ * node that takes over its ID. A clone can therefore be read from one thread
+ * while the graph it came from is modified from another, as long as each
+ * graph_t is only used by one thread at a time.
+ *
+ * Node data is shared, never copied, and every graph cloned from the same
+ * original frees it with the original's custom_free exactly once. While more
+ * than one of them is alive, data a graph lets go of by removing a node,
+ * clearing or being destroyed is only queued, since another may still read
+ * it; the queue is freed once a single graph is left, on its next release of
+ * data or when it is destroyed.
  *
  * @param graph Pointer to the graph.
- * @return Pointer to the cloned graph.
+ * @return Pointer to the cloned graph, or NULL on failure.
  */
 graph_t * graph_clone(graph_t * graph);
 
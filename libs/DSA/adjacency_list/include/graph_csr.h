@@ -0,0 +1,131 @@
+/**
+ * @file graph_csr.h
+ *
+ * @brief An immutable compressed sparse row (CSR) snapshot of a graph_t.
+ *
+ * `graph_t` keeps its nodes and each node's edges in linked lists, so every
+ * traversal step chases several pointers. `graph_freeze()` copies the graph
+ * into three flat arrays instead: the neighbours of node `i` are
+ * `neighbors[offsets[i]]` up to `neighbors[offsets[i + 1]]`, with matching
+ * entries in `weights`. Nodes are referred to by their index, and a
+ * bidirectional edge appears once in each endpoint's row.
+ *
+ * The snapshot does not track later changes to the graph, and it does not own
+ * the node data it points to; the graph must outlive it. Snapshots built
+ * without a graph (such as by parallel_graph_load()) keep their node data in
+ * `owned_data` instead, which graph_csr_destroy() frees.
+ */
+#ifndef _GRAPH_CSR_H
+#define _GRAPH_CSR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "adjacency_list.h"
+
+// Index returned for nodes that are not in the snapshot
+#define GRAPH_CSR_NO_NODE UINT32_MAX
+
+// Distance reported for nodes that cannot be reached
+#define GRAPH_CSR_INFINITY SIZE_MAX
+
+/**
+ * @brief Structure representing a frozen graph.
+ */
+typedef struct
+{
+    uint32_t   node_count; // Number of nodes
+    size_t     edge_count; // Number of entries in neighbors and weights
+    size_t *   offsets;    // Start of each node's row; node_count + 1 entries
+    uint32_t * neighbors;  // Target node index of each edge
+    size_t *   weights;    // Weight of each edge
+    void **    node_data;  // Data pointer of each node, by index
+    void **    data_keys;  // Node data pointers sorted by address
+    uint32_t * data_index; // Node index matching each entry of data_keys
+    void *     owned_data; // Node data freed with the snapshot, or NULL
+} graph_csr_t;
+
+/**
+ * @brief Builds a CSR snapshot of the graph in O(V log V + E log V).
+ *
+ * @param graph Pointer to the graph.
+ * @return Pointer to the new snapshot, or NULL on failure.
+ */
+graph_csr_t * graph_freeze(graph_t * graph);
+
+/**
+ * @brief Destroys a snapshot. Node data is left untouched unless the snapshot
+ * owns it.
+ *
+ * @param csr Pointer to the pointer to the snapshot.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_csr_destroy(graph_csr_t ** csr);
+
+/**
+ * @brief Looks up the index of a node by its data pointer in O(log V).
+ *
+ * @param csr Pointer to the snapshot.
+ * @param data Pointer to the data of the node, as passed to graph_add_node().
+ * @return The node's index, or GRAPH_CSR_NO_NODE if it is not present.
+ */
+uint32_t graph_csr_node_index(const graph_csr_t * csr, const void * data);
+
+/**
+ * @brief Performs depth-first search (DFS) on the snapshot.
+ *
+ * Nodes are visited in preorder, following each node's edges in the order
+ * they appear in its row of 'neighbors'.
+ *
+ * @param csr Pointer to the snapshot.
+ * @param start_data Pointer to the data of the starting node.
+ * @param action Function pointer to the custom action function.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_csr_dfs(const graph_csr_t * csr, void * start_data, ACTION_F action);
+
+/**
+ * @brief Performs breadth-first search (BFS) on the snapshot.
+ *
+ * @param csr Pointer to the snapshot.
+ * @param start_data Pointer to the data of the starting node.
+ * @param action Function pointer to the custom action function.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_csr_bfs(const graph_csr_t * csr, void * start_data, ACTION_F action);
+
+/**
+ * @brief Computes the number of edges from one node to every other node.
+ *
+ * @param csr Pointer to the snapshot.
+ * @param start Index of the starting node.
+ * @param hops Array of node_count entries; unreachable nodes get UINT32_MAX.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+int graph_csr_bfs_hops(const graph_csr_t * csr,
+                       uint32_t            start,
+                       uint32_t *          hops);
+
+/**
+ * @brief Finds the shortest weighted path between two nodes using
+ * Dijkstra's algorithm.
+ *
+ * @param csr Pointer to the snapshot.
+ * @param start_data Pointer to the data of the starting node.
+ * @param end_data Pointer to the data of the ending node.
+ * @param path Set to a new list of node data from start to end. The caller
+ * deletes it with list_delete(); the node data is not freed.
+ * @param distance Set to the total weight of the path. May be NULL.
+ * @return E_SUCCESS on success, or E_FAILURE if there is no path or on
+ * failure.
+ */
+int graph_csr_shortest_path(const graph_csr_t * csr,
+                            void *              start_data,
+                            void *              end_data,
+                            list_t **           path,
+                            size_t *            distance);
+
+#endif /* _GRAPH_CSR_H */
+
+/*** end of file ***/
@@ -1,14 +1,64 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h> // memset()
+
 #include "adjacency_list.h"
-#include "default_free.h"
-#include "queue.h"
-#include "stack.h"
+#include "priority_queue.h"
 #include "utilities.h"
 
-#define MAX_STACK_SIZE 2000
+// Nodes the ID array holds before its first growth
+#define GRAPH_INITIAL_NODE_CAPACITY 16
+
+struct graph_share
+{
+    atomic_size_t references; // Graphs holding the shared ID table
+};
+
+struct graph_family
+{
+    pthread_mutex_t lock;    // Guards members and pending
+    size_t          members; // Live graphs in the family
+    pointer_map_t * pending; // Node data whose free is deferred, as a set
+};
+
+/**
+ * @brief Cached shortest path tree of one source
+ */
+typedef struct graph_source
+{
+    uint32_t   id;        // ID of the source node
+    size_t *   distances; // Distance from the source to every node
+    uint32_t * parents;   // Previous node ID on each shortest path
+} graph_source_t;
+
+struct graph_paths
+{
+    graph_t *          graph;    // The graph being tracked
+    size_t             slots;    // Node IDs every array has room for
+    bool               is_stale; // Set when a new node could not be added
+    graph_source_t *   sources;  // Array of registered sources
+    size_t             count;    // Number of registered sources
+    size_t             capacity; // Number of sources allocated
+    priority_queue_t * queue;    // Queue shared by every repair
+    uint32_t *         scratch;  // Child lists and subtree of a repair
+    uint8_t *          marks;    // State of each node during a repair
+    graph_paths_t *    next;     // Next paths attached to the graph
+};
+
+/**
+ * @brief What a repair after a removed edge knows about a node
+ */
+enum repair_mark
+{
+    REPAIR_UNTOUCHED = 0, // Outside the subtree below the edge
+    REPAIR_PENDING,       // In the subtree, not yet checked
+    REPAIR_KEPT,          // In the subtree, distance unchanged
+    REPAIR_AFFECTED,      // In the subtree, distance to recompute
+};
 
 void edge_list_free(void * data)
 {
-    (void)data;
+    free(data);
 }
 
 comp_rtns_t edge_compare(void * edge_ptr_a, void * edge_ptr_b)
@@ -17,10 +67,9 @@ comp_rtns_t edge_compare(void * edge_ptr_a, void * edge_ptr_b)
     const edge_t * edge_a = (const edge_t *)edge_ptr_a;
     const edge_t * edge_b = (const edge_t *)edge_ptr_b;
 
-    if (((edge_a->node_1 == edge_b->node_1) &&
-         (edge_a->node_2 == edge_b->node_2)) ||
-        ((edge_a->node_1 == edge_b->node_2) &&
-         (edge_a->node_2 == edge_b->node_1) && (!edge_a->is_directed)))
+    if (((edge_a->id_1 == edge_b->id_1) && (edge_a->id_2 == edge_b->id_2)) ||
+        ((edge_a->id_1 == edge_b->id_2) && (edge_a->id_2 == edge_b->id_1) &&
+         (!edge_a->is_directed)))
     {
         result = EQUAL;
         goto END;
@@ -42,6 +91,10 @@ static node_t * graph_create_node(void * data);
 /**
  * @brief Finds a node in the graph with the given data.
  *
+ * Data pointers are looked up in the node index first. Only a pointer that
+ * was never added falls back to comparing against every node with the
+ * graph's compare function.
+ *
  * @param graph A pointer to the graph.
  * @param data A pointer to the data of the node to find.
  * @return node_t* A pointer to the found node or NULL if not found.
@@ -49,7 +102,8 @@ static node_t * graph_create_node(void * data);
 static node_t * graph_find_node(graph_t * graph, void * data);
 
 /**
- * @brief Finds an edge between two nodes in the graph.
+ * @brief Finds an edge that can be followed from node_1 to node_2. With
+ * parallel edges, any one of them may be returned.
  *
  * @param graph A pointer to the graph.
  * @param node_1 A pointer to the first node.
@@ -61,40 +115,495 @@ static edge_t * graph_find_edge(graph_t * graph,
                                 node_t *  node_2);
 
 /**
- * @brief Collects all edges connected to a given node.
+ * @brief Finds the entry of an edge to or from 'other' in one of a node's
+ * lists, through the node's neighbour index when it has one.
+ *
+ * @param node A pointer to the node whose list is searched.
+ * @param is_incoming true to search the in_edge_list, false the edge_list.
+ * @param other A pointer to the node at the other end of the edge.
+ * @param match The edge to find an identical copy of, or NULL for any edge
+ * between the two nodes.
+ * @return list_node_t* The entry, or NULL if there is none.
+ */
+static list_node_t * find_entry(node_t *       node,
+                                bool           is_incoming,
+                                const node_t * other,
+                                const edge_t * match);
+
+/**
+ * @brief Adds a copy of an edge at the head of one of a node's lists and
+ * records it in the matching neighbour index.
+ *
+ * @param graph A pointer to the graph.
+ * @param node A pointer to the node, which the graph must own.
+ * @param is_incoming true to add to the in_edge_list, false the edge_list.
+ * @param edge The edge to copy.
+ * @return int E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int push_edge(graph_t *      graph,
+                     node_t *       node,
+                     bool           is_incoming,
+                     const edge_t * edge);
+
+/**
+ * @brief Removes and frees one entry of a node's lists, in O(1).
+ *
+ * @param graph A pointer to the graph.
+ * @param node A pointer to the node, which the graph must own.
+ * @param is_incoming true if the entry is in the in_edge_list.
+ * @param entry The entry to remove.
+ */
+static void pop_edge(graph_t *     graph,
+                     node_t *      node,
+                     bool          is_incoming,
+                     list_node_t * entry);
+
+/**
+ * @brief Removes the copy of an edge that its other endpoint holds.
+ *
+ * @param graph A pointer to the graph.
+ * @param node A pointer to the other endpoint, which the graph must own.
+ * @param from A pointer to the endpoint whose list holds 'edge'.
+ * @param edge The edge as stored by 'from'.
+ * @param is_incoming true if 'edge' is in from's in_edge_list.
+ */
+static void drop_twin(graph_t *      graph,
+                      node_t *       node,
+                      const node_t * from,
+                      const edge_t * edge,
+                      bool           is_incoming);
+
+/**
+ * @brief Records an entry just added to one of a node's lists in the
+ * matching neighbour index, building the index once the list holds more than
+ * GRAPH_NEIGHBOR_INDEX_DEGREE edges.
+ *
+ * Entries are keyed by the data of the node at the other end, which stays
+ * the same when that node is copied or renumbered. If the index cannot grow
+ * it is dropped, and lookups fall back to scanning the list.
+ *
+ * @param graph A pointer to the graph.
+ * @param node A pointer to the node whose list holds the entry.
+ * @param is_incoming true if the entry is in the in_edge_list.
+ * @param entry The entry.
+ */
+static void index_edge(graph_t *     graph,
+                       node_t *      node,
+                       bool          is_incoming,
+                       list_node_t * entry);
+
+/**
+ * @brief Removes an entry from a node's neighbour index, if it has one.
+ *
+ * @param graph A pointer to the graph.
+ * @param node A pointer to the node whose list holds the entry.
+ * @param is_incoming true if the entry is in the in_edge_list.
+ * @param entry The entry.
+ */
+static void unindex_edge(graph_t *     graph,
+                         node_t *      node,
+                         bool          is_incoming,
+                         list_node_t * entry);
+
+/**
+ * @brief Returns the ID of the node at the other end of an edge.
+ *
+ * Bidirectional edges sit in both endpoints' edge lists, so the neighbor is
+ * not always id_2.
+ *
+ * @param edge A pointer to the edge.
+ * @param id The ID of the node whose list holds the edge.
+ * @return uint32_t The ID of the neighboring node.
+ */
+static uint32_t edge_neighbor(const edge_t * edge, uint32_t id);
+
+/**
+ * @brief Checks that two edges join the same nodes the same way with the
+ * same weight.
+ */
+static bool same_edge(const edge_t * edge_a, const edge_t * edge_b);
+
+/**
+ * @brief Checks that a workspace fits the graph, starts a new epoch and finds
+ * the start node.
+ *
+ * @param graph A pointer to the graph.
+ * @param workspace A pointer to the workspace.
+ * @param start_data A pointer to the data of the starting node.
+ * @return node_t* A pointer to the start node or NULL on failure.
+ */
+static node_t * begin_traversal(graph_t *           graph,
+                                graph_workspace_t * workspace,
+                                void *              start_data);
+
+/**
+ * @brief State of one direction of a shortest-path search, indexed by node ID.
+ */
+typedef struct
+{
+    size_t *           distance; // Best known distance, SIZE_MAX if unseen
+    uint32_t *         parent;   // Previous node ID on the best path
+    priority_queue_t * frontier; // Nodes waiting to be settled
+} search_side_t;
+
+/**
+ * @brief Incoming edges of every node, used to search backwards across
+ * one-way edges.
+ */
+typedef struct
+{
+    size_t *   offsets; // Start of each node's incoming edges
+    uint32_t * sources; // Node ID each incoming edge starts from
+    size_t *   weights; // Weight of each incoming edge
+} reverse_index_t;
+
+/**
+ * @brief One level of the explicit call stack of the Tarjan search.
+ */
+typedef struct
+{
+    uint32_t      node;      // ID of the node being expanded
+    list_node_t * next_edge; // Next entry of its edge list to follow
+} tarjan_frame_t;
+
+/**
+ * @brief Adds two distances, clamping at SIZE_MAX instead of wrapping.
+ */
+static size_t add_saturated(size_t value_a, size_t value_b);
+
+/**
+ * @brief Builds an array of the graph's nodes indexed by node ID.
+ *
+ * @param graph A pointer to the graph.
+ * @return node_t** The array, or NULL on failure.
+ */
+static node_t ** collect_nodes(graph_t * graph);
+
+/**
+ * @brief Allocates one search direction with every distance unset.
+ *
+ * @return int E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int search_side_init(search_side_t * side, size_t node_count);
+
+/**
+ * @brief Frees one search direction.
+ */
+static void search_side_destroy(search_side_t * side);
+
+/**
+ * @brief Runs Dijkstra's algorithm, or A* when a heuristic is given, and
+ * stops as soon as the end node is settled.
+ *
+ * @return int E_SUCCESS on success, E_FAILURE if no path exists or on
+ * failure.
+ */
+static int search_path(graph_t *   graph,
+                       void *      start_data,
+                       void *      end_data,
+                       HEURISTIC_F heuristic,
+                       list_t **   path);
+
+/**
+ * @brief Relaxes the edge from 'from' to 'to' for one search direction and
+ * records a new best meeting point with the other direction.
+ */
+static void relax(search_side_t *       side,
+                  const search_side_t * other,
+                  uint32_t              from,
+                  uint32_t              to,
+                  size_t                weight,
+                  size_t *              best,
+                  uint32_t *            meet);
+
+/**
+ * @brief Relaxes every outgoing edge of a node.
+ */
+static void expand_forward(search_side_t *       forward,
+                           const search_side_t * backward,
+                           node_t *              node,
+                           size_t *              best,
+                           uint32_t *            meet);
+
+/**
+ * @brief Relaxes every incoming edge of a node.
+ */
+static void expand_backward(search_side_t *         backward,
+                            const search_side_t *   forward,
+                            node_t **               nodes,
+                            uint32_t                current,
+                            const reverse_index_t * reverse,
+                            size_t *                best,
+                            uint32_t *              meet);
+
+/**
+ * @brief Indexes the incoming edges of every node.
+ *
+ * @return reverse_index_t* The index, or NULL on failure.
+ */
+static reverse_index_t * reverse_index_create(graph_t * graph,
+                                              node_t ** nodes);
+
+/**
+ * @brief Frees an incoming edge index. Does nothing if it is NULL.
+ */
+static void reverse_index_destroy(reverse_index_t ** reverse);
+
+/**
+ * @brief Builds the list of node data along a path.
+ *
+ * @param nodes Nodes indexed by ID.
+ * @param parents Previous node ID of each node, back to the start.
+ * @param successors Next node ID of each node, on to the end; may be NULL.
+ * @param meet ID of the node where the two halves join.
+ * @return list_t* The path, or NULL on failure.
+ */
+static list_t * build_node_path(node_t **        nodes,
+                                const uint32_t * parents,
+                                const uint32_t * successors,
+                                uint32_t         meet);
+
+/**
+ * @brief Free function for path lists, which do not own the node data.
+ */
+static void path_free(void * data);
+
+/**
+ * @brief Free function for lists of components, each an owned list_t.
+ */
+static void component_list_free(void * data);
+
+/**
+ * @brief Returns the graph's component forest, building it from the current
+ * edges if it was dropped or never built.
+ *
+ * @param graph A pointer to the graph.
+ * @return disjoint_set_t* The forest, or NULL on failure.
+ */
+static disjoint_set_t * graph_components(graph_t * graph);
+
+/**
+ * @brief Discards the component forest after a change it cannot follow, such
+ * as removing an edge. The next query rebuilds it.
+ */
+static void drop_components(graph_t * graph);
+
+/**
+ * @brief Checks the one-way edges for a cycle once every tree of two-way
+ * edges in 'forest' has been contracted to a single node.
+ *
+ * @param graph A pointer to the graph.
+ * @param forest Trees of two-way edges, by node ID.
+ * @param is_cyclic Pointer to the boolean to store the result.
+ * @return int E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int contracted_is_cyclic(graph_t *        graph,
+                                disjoint_set_t * forest,
+                                bool *           is_cyclic);
+
+/**
+ * @brief Frees node data the graph no longer holds. While other graphs of
+ * its clone family are alive they may still hold it, so the free is deferred
+ * until only one graph is left.
+ *
+ * @param graph A pointer to the graph letting go of the data.
+ * @param data The node data.
+ */
+static void release_data(graph_t * graph, void * data);
+
+/**
+ * @brief Frees the deferred data of a family the graph does not hold itself.
+ * The caller holds the family lock and the graph is its last member.
+ *
+ * @param graph A pointer to the last graph of the family.
+ */
+static void flush_pending(graph_t * graph);
+
+/**
+ * @brief Removes a cleared graph from its clone family, freeing the family
+ * and the data still deferred when it was the last member.
+ *
+ * @param graph A pointer to the cleared graph.
+ */
+static void leave_family(graph_t * graph);
+
+/**
+ * @brief Gives the graph its own copy of an ID table it shares with clones,
+ * in O(V). The nodes themselves stay shared. Does nothing if the graph is not
+ * shared.
+ *
+ * @param graph A pointer to the graph about to be modified.
+ * @return int E_SUCCESS on success, E_FAILURE on failure. The graph is
+ * unchanged on failure.
+ */
+static int unshare_graph(graph_t * graph);
+
+/**
+ * @brief Returns the node with the given ID, first copying it if another ID
+ * table holds it too. The graph must own its ID table.
+ *
+ * @param graph A pointer to the graph about to change the node.
+ * @param id The ID of the node.
+ * @return node_t* The node the graph now owns, or NULL on failure. The graph
+ * is unchanged on failure.
+ */
+static node_t * own_node(graph_t * graph, uint32_t id);
+
+/**
+ * @brief Copies a node with its edge lists, keeping the order of every list.
+ * The copy has the node's ID and data pointer and a reference count of one.
+ *
+ * @param graph A pointer to the graph.
+ * @param node A pointer to the node.
+ * @return node_t* The copy, or NULL on failure.
+ */
+static node_t * copy_node(graph_t * graph, node_t * node);
+
+/**
+ * @brief Owns every node that 'node' has an edge to or from, other than
+ * itself and the node with ID 'skip'.
+ *
+ * @param graph A pointer to the graph.
+ * @param node A pointer to the node.
+ * @param skip The ID of a node to leave shared.
+ * @return int E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int own_neighbors(graph_t * graph, node_t * node, uint32_t skip);
+
+/**
+ * @brief Moves a node to another ID, rewriting its edges and the copies of
+ * them its neighbours hold. The graph must own the node and its neighbours.
  *
- * This function is static and intended for internal use only.
+ * @param graph A pointer to the graph.
+ * @param from The node's current ID.
+ * @param to The ID to move it to, which must be free.
+ */
+static void renumber_node(graph_t * graph, uint32_t from, uint32_t to);
+
+/**
+ * @brief Drops one ID table's hold on a node, freeing the node and its edge
+ * lists once no table holds it. The node data is left alone.
+ *
+ * @param node A pointer to the node.
+ */
+static void release_node(node_t * node);
+
+/**
+ * @brief Frees an ID table and releases every node it holds.
  *
- * @param node A pointer to the node whose edges are to be collected.
- * @param num_edges A pointer to size_t to store the number of edges found.
- * @return edge_t** A pointer to an array of pointers to the collected edges.
+ * @param node_list The node list, or NULL.
+ * @param node_index The node index, or NULL.
+ * @param nodes The array of nodes by ID, or NULL.
+ * @param links The array of node list entries by ID, or NULL.
  */
-static edge_t ** collect_edges(node_t * node, uint32_t * num_edges);
+static void free_table(list_t *        node_list,
+                       pointer_map_t * node_index,
+                       node_t **       nodes,
+                       list_node_t **  links);
 
 /**
- * @brief Removes a set of edges from a graph.
+ * @brief Drops the graph's hold on its shared ID table.
  *
- * This function is static and intended for internal use only.
+ * @param graph A pointer to the shared graph.
+ * @return bool true if no other graph held it, so the caller now owns it.
+ */
+static bool release_share(graph_t * graph);
+
+/**
+ * @brief Finds the cached tree of a registered source.
  *
- * @param graph A pointer to the graph from which edges are to be removed.
- * @param edges_to_remove A pointer to an array of pointers to edges to be
- * removed.
- * @param num_edges The number of edges to remove.
- * @return int An integer indicating success (E_SUCCESS) or failure (E_FAILURE).
+ * @return graph_source_t* The source, or NULL if it is not registered.
  */
-static int remove_edges(graph_t * graph,
-                        edge_t ** edges_to_remove,
-                        size_t    num_edges);
+static graph_source_t * find_source(const graph_paths_t * paths, uint32_t id);
 
 /**
- * @brief Cleans up and frees a node from a graph.
+ * @brief Grows every source's arrays, and the scratch space shared by the
+ * repairs, to hold 'slots' node IDs.
  *
- * This function is static and intended for internal use only.
+ * @return int E_SUCCESS on success, E_FAILURE on failure, which keeps the old
+ * scratch space and leaves every source usable.
+ */
+static int resize_paths(graph_paths_t * paths, size_t slots);
+
+/**
+ * @brief Computes the shortest paths of a source from scratch.
+ */
+static void compute_source(graph_paths_t * paths, graph_source_t * source);
+
+/**
+ * @brief Relaxes the edge from 'from' to 'to' and queues 'to' if it got
+ * closer.
+ */
+static void lower_edge(graph_paths_t *  paths,
+                       graph_source_t * source,
+                       uint32_t         from,
+                       uint32_t         to,
+                       size_t           weight);
+
+/**
+ * @brief Repairs the subtree below 'root' after an edge into it went away.
+ * With is_removed set, the root is a node being removed, whose neighbours no
+ * longer lead to it, and it is left unreachable.
+ */
+static void raise_edge(graph_paths_t *  paths,
+                       graph_source_t * source,
+                       uint32_t         root,
+                       bool             is_removed);
+
+/**
+ * @brief Finds the in-neighbour outside the affected subtree that leads to a
+ * node most cheaply.
  *
- * @param graph A pointer to the graph containing the node.
- * @param node A pointer to the node to clean up.
+ * @return uint32_t Its ID, or PRIORITY_QUEUE_ABSENT if there is none.
+ */
+static uint32_t best_parent(const graph_paths_t *  paths,
+                            const graph_source_t * source,
+                            uint32_t               id,
+                            size_t *               distance);
+
+/**
+ * @brief Runs Dijkstra's algorithm from the queued nodes. With only_affected
+ * set, only nodes marked REPAIR_AFFECTED are relaxed.
+ */
+static void settle_paths(graph_paths_t *  paths,
+                         graph_source_t * source,
+                         bool             only_affected);
+
+/**
+ * @brief Repairs every paths attached to the graph after an edge was added.
+ * Paths waiting for a refresh are skipped.
+ */
+static void notify_edge_added(graph_t * graph, const edge_t * edge);
+
+/**
+ * @brief Repairs every paths attached to the graph after an edge was removed.
+ * Paths waiting for a refresh are skipped.
  */
-static void cleanup_node(graph_t * graph, node_t * node);
+static void notify_edge_removed(graph_t * graph, const edge_t * edge);
+
+/**
+ * @brief Extends every paths attached to the graph with its newest node, or
+ * marks them stale if that runs out of memory.
+ */
+static void notify_node_added(graph_t * graph);
+
+/**
+ * @brief Unregisters the sources at a node being removed and repairs the
+ * rest. Must run once no neighbour leads to the node, before its ID is
+ * reused.
+ */
+static void notify_node_removed(graph_t * graph, uint32_t id);
+
+/**
+ * @brief Moves the cached entries of the node at ID 'from' to ID 'to', after
+ * renumber_node() moved the node.
+ */
+static void renumber_paths(graph_t * graph, uint32_t from, uint32_t to);
+
+/**
+ * @brief Unregisters every source of the paths attached to the graph.
+ */
+static void clear_paths(graph_t * graph);
 
 graph_t * graph_create(FREE_F custom_free, CMP_F custom_compare)
 {
@@ -113,13 +622,26 @@ graph_t * graph_create(FREE_F custom_free, CMP_F custom_compare)
         goto END;
     }
 
-    graph->node_count     = 0;
-    graph->custom_free    = custom_free;
-    graph->custom_compare = custom_compare;
-    graph->node_list      = list_new(graph->custom_free, graph->custom_compare);
-    if (NULL == graph->node_list)
+    graph->node_count          = 0;
+    graph->directed_edge_count = 0;
+    graph->custom_free         = custom_free;
+    graph->custom_compare      = custom_compare;
+    graph->components          = NULL;
+
+    // release_node() frees the nodes, so the list must not free its entries
+    graph->node_list  = list_new(path_free, graph->custom_compare);
+    graph->node_index = pointer_map_new(0);
+    if ((NULL == graph->node_list) || (NULL == graph->node_index))
     {
         PRINT_DEBUG("graph_add_node(): Unable to create node list.");
+        if (NULL != graph->node_list)
+        {
+            list_delete(&(graph->node_list));
+        }
+        if (NULL != graph->node_index)
+        {
+            pointer_map_delete(&(graph->node_index));
+        }
         free(graph);
         graph = NULL;
         goto END;
@@ -131,8 +653,11 @@ END:
 
 int graph_add_node(graph_t * graph, void * data)
 {
-    int      exit_code = E_FAILURE;
-    node_t * node      = NULL;
+    int            exit_code = E_FAILURE;
+    node_t *       node      = NULL;
+    node_t **      nodes     = NULL;
+    list_node_t ** links     = NULL;
+    size_t         capacity  = 0;
 
     if ((NULL == graph) || (NULL == data))
     {
@@ -140,6 +665,40 @@ int graph_add_node(graph_t * graph, void * data)
         goto END;
     }
 
+    if (UINT32_MAX <= graph->node_count)
+    {
+        PRINT_DEBUG("graph_add_node(): Graph is full.");
+        goto END;
+    }
+
+    if (E_SUCCESS != unshare_graph(graph))
+    {
+        PRINT_DEBUG("graph_add_node(): Unable to copy shared graph.");
+        goto END;
+    }
+
+    if (graph->node_count == graph->node_capacity)
+    {
+        capacity = (0 == graph->node_capacity) ? GRAPH_INITIAL_NODE_CAPACITY
+                                               : (graph->node_capacity * 2);
+        nodes    = realloc(graph->nodes, capacity * sizeof(node_t *));
+        if (NULL == nodes)
+        {
+            PRINT_DEBUG("graph_add_node(): CMR failure.");
+            goto END;
+        }
+        graph->nodes = nodes;
+
+        links = realloc(graph->links, capacity * sizeof(list_node_t *));
+        if (NULL == links)
+        {
+            PRINT_DEBUG("graph_add_node(): CMR failure.");
+            goto END;
+        }
+        graph->links         = links;
+        graph->node_capacity = capacity;
+    }
+
     node = graph_create_node(data);
     if (NULL == node)
     {
@@ -147,21 +706,40 @@ int graph_add_node(graph_t * graph, void * data)
         goto END;
     }
 
+    exit_code = pointer_map_insert(graph->node_index, data, node);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("graph_add_node(): Unable to index new node.");
+        goto END;
+    }
+
     // Add the new node to the list
     exit_code = list_push_head(graph->node_list, node);
     if (E_SUCCESS != exit_code)
     {
         PRINT_DEBUG("graph_add_node(): Unable to add new node to the list.");
+        pointer_map_remove(graph->node_index, data, node);
         goto END;
     }
 
+    node->id               = (uint32_t)graph->node_count;
+    graph->nodes[node->id] = node;
+    graph->links[node->id] = graph->node_list->head;
     graph->node_count += 1;
 
+    // The new node is a component of its own, with ID node->id
+    if ((NULL != graph->components) &&
+        (E_SUCCESS != disjoint_set_add(graph->components, NULL)))
+    {
+        drop_components(graph);
+    }
+    notify_node_added(graph);
+
     exit_code = E_SUCCESS;
 END:
-    if (E_SUCCESS != exit_code)
+    if ((E_SUCCESS != exit_code) && (NULL != node))
     {
-        free(node);
+        release_node(node);
         node = NULL;
     }
     return exit_code;
@@ -169,10 +747,12 @@ END:
 
 int graph_remove_node(graph_t * graph, void * data)
 {
-    int       exit_code       = E_FAILURE;
-    node_t *  node            = NULL;
-    uint32_t  num_edges       = 0;
-    edge_t ** edges_to_remove = NULL;
+    int           exit_code = E_FAILURE;
+    node_t *      node      = NULL;
+    node_t *      last      = NULL;
+    list_node_t * edge_node = NULL;
+    edge_t *      edge      = NULL;
+    uint32_t      neighbor  = 0;
 
     if ((NULL == graph) || (NULL == data))
     {
@@ -180,6 +760,12 @@ int graph_remove_node(graph_t * graph, void * data)
         goto END;
     }
 
+    if (E_SUCCESS != unshare_graph(graph))
+    {
+        PRINT_DEBUG("graph_remove_node(): Unable to copy shared graph.");
+        goto END;
+    }
+
     node = graph_find_node(graph, data);
     if (NULL == node)
     {
@@ -187,37 +773,78 @@ int graph_remove_node(graph_t * graph, void * data)
         goto END;
     }
 
-    edges_to_remove = collect_edges(node, &num_edges);
-    if (NULL == edges_to_remove)
+    // Copy every node the removal changes before changing any, so that a
+    // failure leaves the graph as it was. The node itself is only released.
+    if (E_SUCCESS != own_neighbors(graph, node, node->id))
     {
-        PRINT_DEBUG("graph_remove_node(): Unable to collect edges.");
+        PRINT_DEBUG("graph_remove_node(): Unable to copy shared neighbours.");
         goto END;
     }
-
-    exit_code = remove_edges(graph, edges_to_remove, num_edges);
-    if (E_SUCCESS != exit_code)
+    if ((node->id + 1) != graph->node_count)
     {
-        PRINT_DEBUG("graph_remove_node(): Unable to remove edges.");
-        goto END;
+        last = own_node(graph, (uint32_t)(graph->node_count - 1));
+        if ((NULL == last) ||
+            (E_SUCCESS != own_neighbors(graph, last, node->id)))
+        {
+            PRINT_DEBUG("graph_remove_node(): Unable to copy the last node.");
+            goto END;
+        }
     }
 
-    // Remove the node from the list of nodes
-    exit_code = list_remove_data(graph->node_list, &(node->data));
-    if (E_SUCCESS != exit_code)
+    for (edge_node = node->edge_list->head; NULL != edge_node;
+         edge_node = edge_node->next)
     {
-        PRINT_DEBUG(
-            "graph_remove_node(): Unable to remove node from node list.");
-        goto END;
+        edge     = (edge_t *)edge_node->data;
+        neighbor = edge_neighbor(edge, node->id);
+        if (neighbor != node->id)
+        {
+            drop_twin(graph, graph->nodes[neighbor], node, edge, false);
+        }
+        if (edge->is_directed)
+        {
+            graph->directed_edge_count -= 1;
+        }
+    }
+    edge_node = (NULL != node->in_edge_list) ? node->in_edge_list->head : NULL;
+    for (; NULL != edge_node; edge_node = edge_node->next)
+    {
+        edge     = (edge_t *)edge_node->data;
+        neighbor = edge_neighbor(edge, node->id);
+        if (neighbor != node->id)
+        {
+            drop_twin(graph, graph->nodes[neighbor], node, edge, true);
+            graph->directed_edge_count -= 1;
+        }
     }
+    notify_node_removed(graph, node->id);
+
+    // Remove the node from the list of nodes and the index
+    exit_code = list_remove_node(graph->node_list, graph->links[node->id]);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG(
+            "graph_remove_node(): Unable to remove node from node list.");
+        goto END;
+    }
+    pointer_map_remove(graph->node_index, node->data, node);
 
     graph->node_count -= 1;
+    drop_components(graph);
+
+    // Keep IDs dense by handing the removed ID to the node holding the last
+    if (node->id != graph->node_count)
+    {
+        renumber_node(graph, (uint32_t)graph->node_count, node->id);
+        renumber_paths(graph, (uint32_t)graph->node_count, node->id);
+    }
+    graph->nodes[graph->node_count] = NULL;
+    graph->links[graph->node_count] = NULL;
 
-    cleanup_node(graph, node);
+    release_data(graph, node->data);
+    release_node(node);
 
     exit_code = E_SUCCESS;
 END:
-    free(edges_to_remove);
-    edges_to_remove = NULL;
     return exit_code;
 }
 
@@ -230,7 +857,7 @@ int graph_add_edge(graph_t * graph,
     int      exit_code = E_FAILURE;
     node_t * node_1    = NULL;
     node_t * node_2    = NULL;
-    edge_t * edge      = NULL;
+    edge_t   edge      = { 0 };
 
     if ((NULL == graph) || (NULL == data_1) || (NULL == data_2))
     {
@@ -238,6 +865,12 @@ int graph_add_edge(graph_t * graph,
         goto END;
     }
 
+    if (E_SUCCESS != unshare_graph(graph))
+    {
+        PRINT_DEBUG("graph_add_edge(): Unable to copy shared graph.");
+        goto END;
+    }
+
     node_1 = graph_find_node(graph, data_1);
     if (NULL == node_1)
     {
@@ -252,44 +885,49 @@ int graph_add_edge(graph_t * graph,
         goto END;
     }
 
-    edge = calloc(1, sizeof(edge_t));
-    if (NULL == edge)
+    edge.id_1        = node_1->id;
+    edge.id_2        = node_2->id;
+    edge.weight      = weight;
+    edge.is_directed = !is_bidirectional;
+
+    // Only the two endpoints' lists change, so only they are copied
+    node_1 = own_node(graph, edge.id_1);
+    node_2 = (NULL == node_1) ? NULL : own_node(graph, edge.id_2);
+    if (NULL == node_2)
     {
-        PRINT_DEBUG("graph_add_edge(): CMR failure.");
+        PRINT_DEBUG("graph_add_edge(): Unable to copy shared nodes.");
         goto END;
     }
 
-    edge->node_1      = node_1;
-    edge->node_2      = node_2;
-    edge->weight      = weight;
-    edge->is_directed = !is_bidirectional;
-
-    exit_code = list_push_head(node_1->edge_list, edge);
+    exit_code = push_edge(graph, node_1, false, &edge);
     if (E_SUCCESS != exit_code)
     {
         PRINT_DEBUG(
             "graph_add_edge(): Unable to add edge to node 1's edge list.");
-        free(edge);
         goto END;
     }
-    node_1->edge_count += 1;
 
-    if (true == is_bidirectional)
+    // Node 2 tracks its incoming one-way edges so removing it is O(degree)
+    exit_code = push_edge(graph, node_2, edge.is_directed, &edge);
+    if (E_SUCCESS != exit_code)
     {
-        exit_code = list_push_head(node_2->edge_list, edge);
-        if (E_SUCCESS != exit_code)
-        {
-            PRINT_DEBUG(
-                "graph_add_edge(): Unable to add edge to node 2's edge list.");
-            // Rollback
-            list_remove_data(node_1->edge_list, edge);
-            node_1->edge_count -= 1;
-            free(edge);
-            goto END;
-        }
-        node_2->edge_count += 1;
+        PRINT_DEBUG("graph_add_edge(): Unable to add edge to node 2's lists.");
+        // Rollback
+        pop_edge(graph, node_1, false, node_1->edge_list->head);
+        goto END;
     }
 
+    if (edge.is_directed)
+    {
+        graph->directed_edge_count += 1;
+    }
+
+    if (NULL != graph->components)
+    {
+        disjoint_set_union(graph->components, edge.id_1, edge.id_2, NULL);
+    }
+    notify_edge_added(graph, &edge);
+
     exit_code = E_SUCCESS;
 END:
     return exit_code;
@@ -297,10 +935,11 @@ END:
 
 int graph_remove_edge(graph_t * graph, void * data_1, void * data_2)
 {
-    int      exit_code = E_FAILURE;
-    node_t * node_1    = NULL;
-    node_t * node_2    = NULL;
-    edge_t * edge      = NULL;
+    int           exit_code = E_FAILURE;
+    node_t *      node_1    = NULL;
+    node_t *      node_2    = NULL;
+    list_node_t * entry     = NULL;
+    edge_t        edge      = { 0 };
 
     if ((NULL == graph) || (NULL == data_1) || (NULL == data_2))
     {
@@ -308,6 +947,12 @@ int graph_remove_edge(graph_t * graph, void * data_1, void * data_2)
         goto END;
     }
 
+    if (E_SUCCESS != unshare_graph(graph))
+    {
+        PRINT_DEBUG("graph_remove_edge(): Unable to copy shared graph.");
+        goto END;
+    }
+
     node_1 = graph_find_node(graph, data_1);
     if (NULL == node_1)
     {
@@ -322,44 +967,34 @@ int graph_remove_edge(graph_t * graph, void * data_1, void * data_2)
         goto END;
     }
 
-    edge = graph_find_edge(graph, node_1, node_2);
-    if (NULL == edge)
+    if (NULL == graph_find_edge(graph, node_1, node_2))
     {
         PRINT_DEBUG("graph_remove_edge(): Unable to find edge.");
         goto END;
     }
 
-    // Remove the edge from node 1's edge list
-    exit_code = list_remove_data(node_1->edge_list, edge);
-    if (E_SUCCESS != exit_code)
+    // Only the two endpoints' lists change, so only they are copied
+    edge.id_1 = node_1->id;
+    edge.id_2 = node_2->id;
+    node_1    = own_node(graph, edge.id_1);
+    node_2    = (NULL == node_1) ? NULL : own_node(graph, edge.id_2);
+    if (NULL == node_2)
     {
-        PRINT_DEBUG(
-            "graph_remove_edge(): Unable to remove edge from node 1's edge "
-            "list.");
+        PRINT_DEBUG("graph_remove_edge(): Unable to copy shared nodes.");
         goto END;
     }
-    node_1->edge_count -= 1;
 
-    // Remove the edge from node 2's edge list if the edge is bidirectional
-    if (!edge->is_directed)
+    entry = find_entry(node_1, false, node_2, NULL);
+    edge  = *(edge_t *)entry->data;
+    pop_edge(graph, node_1, false, entry);
+    drop_twin(graph, node_2, node_1, &edge, false);
+
+    if (edge.is_directed)
     {
-        exit_code = list_remove_data(node_2->edge_list, edge);
-        if (E_SUCCESS != exit_code)
-        {
-            PRINT_DEBUG(
-                "graph_remove_edge(): Unable to remove edge from node 2's edge "
-                "list.");
-            // Rollback previous removal from node 1's list
-            list_push_head(node_1->edge_list, edge);
-            node_1->edge_count += 1;
-            goto END;
-        }
-        node_2->edge_count -= 1;
+        graph->directed_edge_count -= 1;
     }
-
-    // Free the edge memory
-    free(edge);
-    edge = NULL;
+    drop_components(graph);
+    notify_edge_removed(graph, &edge);
 
     exit_code = E_SUCCESS;
 END:
@@ -412,8 +1047,6 @@ int graph_clear(graph_t * graph)
 {
     int           exit_code = E_FAILURE;
     list_node_t * current   = NULL;
-    list_node_t * next      = NULL;
-    node_t *      node      = NULL;
 
     if (NULL == graph)
     {
@@ -424,23 +1057,27 @@ int graph_clear(graph_t * graph)
     current = graph->node_list->head;
     while (NULL != current)
     {
-        node = (node_t *)current->data;
-        next = current->next;
-
-        cleanup_node(graph, node);
-
-        current = next;
+        release_data(graph, ((node_t *)current->data)->data);
+        current = current->next;
     }
 
-    exit_code = list_delete(&(graph->node_list));
-    if (E_SUCCESS != exit_code)
+    // Clones keep reading a shared table and the nodes it holds; whichever
+    // graph lets go of each last frees it
+    if ((NULL == graph->share) || release_share(graph))
     {
-        PRINT_DEBUG("graph_clear(): Unable to reset graph's node list.");
-        goto END;
+        free_table(
+            graph->node_list, graph->node_index, graph->nodes, graph->links);
     }
 
-    graph->node_list  = NULL;
-    graph->node_count = 0;
+    graph->node_list           = NULL;
+    graph->node_index          = NULL;
+    graph->nodes               = NULL;
+    graph->links               = NULL;
+    graph->node_capacity       = 0;
+    graph->node_count          = 0;
+    graph->directed_edge_count = 0;
+    drop_components(graph);
+    clear_paths(graph);
 
     exit_code = E_SUCCESS;
 END:
@@ -463,6 +1100,7 @@ int graph_destroy(graph_t ** graph)
         PRINT_DEBUG("graph_destroy(): Unable to clear graph.");
         goto END;
     }
+    leave_family(*graph);
 
     // Finally, free the graph structure
     free(*graph);
@@ -472,115 +1110,194 @@ END:
     return exit_code;
 }
 
-static int initialize_dfs(graph_t *  graph,
-                          void *     start_data,
-                          list_t **  visited_list,
-                          stack_t ** stack,
-                          node_t **  start_node)
+graph_workspace_t * graph_workspace_create(size_t capacity)
 {
-    int exit_code = E_FAILURE;
+    graph_workspace_t * workspace = NULL;
+
+    workspace = calloc(1, sizeof(graph_workspace_t));
+    if (NULL == workspace)
+    {
+        PRINT_DEBUG("graph_workspace_create(): CMR failure.");
+        goto END;
+    }
 
-    if ((NULL == graph) || (NULL == start_data) || (NULL == visited_list) ||
-        (NULL == stack) || (NULL == start_node))
+    if (E_SUCCESS != graph_workspace_reserve(workspace, capacity))
     {
-        PRINT_DEBUG("initialize_dfs(): NULL argument passed.");
+        PRINT_DEBUG("graph_workspace_create(): Unable to reserve capacity.");
+        graph_workspace_destroy(&workspace);
         goto END;
     }
 
-    *start_node = graph_find_node(graph, start_data);
-    if (NULL == *start_node)
+END:
+    return workspace;
+}
+
+int graph_workspace_reserve(graph_workspace_t * workspace, size_t capacity)
+{
+    int        exit_code = E_FAILURE;
+    uint32_t * stamps    = NULL;
+    node_t **  frontier  = NULL;
+
+    if (NULL == workspace)
     {
-        PRINT_DEBUG("initialize_dfs(): Unable to find start node.");
+        PRINT_DEBUG("graph_workspace_reserve(): NULL argument passed.");
         goto END;
     }
 
-    *visited_list = list_new(default_free, node_ptr_comp);
-    if (NULL == *visited_list)
+    // Reserve at least one slot so an empty graph still gets valid arrays
+    if (0 == capacity)
+    {
+        capacity = 1;
+    }
+
+    if (capacity <= workspace->capacity)
     {
-        PRINT_DEBUG("initialize_dfs(): Failed to create visited list.");
+        exit_code = E_SUCCESS;
         goto END;
     }
 
-    *stack = stack_init(MAX_STACK_SIZE, free);
-    if (NULL == *stack)
+    stamps   = calloc(capacity, sizeof(uint32_t));
+    frontier = calloc(capacity, sizeof(node_t *));
+    if ((NULL == stamps) || (NULL == frontier))
     {
-        PRINT_DEBUG("initialize_dfs(): Failed to create stack.");
-        list_delete(visited_list);
+        PRINT_DEBUG("graph_workspace_reserve(): CMR failure.");
+        free(stamps);
+        free(frontier);
         goto END;
     }
 
+    free(workspace->stamps);
+    free(workspace->frontier);
+    workspace->stamps   = stamps;
+    workspace->frontier = frontier;
+    workspace->capacity = capacity;
+    workspace->epoch    = 0;
+
     exit_code = E_SUCCESS;
 END:
     return exit_code;
 }
 
-static int dfs_visit_node(stack_t * stack, list_t * visited_list, node_t * node)
+int graph_workspace_destroy(graph_workspace_t ** workspace)
 {
     int exit_code = E_FAILURE;
 
-    if ((NULL == stack) || (NULL == visited_list) || (NULL == node))
+    if ((NULL == workspace) || (NULL == *workspace))
     {
-        PRINT_DEBUG("dfs_visit_node(): NULL argument passed.");
+        PRINT_DEBUG("graph_workspace_destroy(): NULL argument passed.");
         goto END;
     }
 
-    exit_code = stack_push(stack, node);
-    if (E_SUCCESS != exit_code)
+    free((*workspace)->stamps);
+    free((*workspace)->frontier);
+    free(*workspace);
+    *workspace = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int graph_dfs_workspace(graph_t *           graph,
+                        graph_workspace_t * workspace,
+                        void *              start_data,
+                        ACTION_F            action)
+{
+    int           exit_code   = E_FAILURE;
+    node_t *      start_node  = NULL;
+    node_t *      current     = NULL;
+    node_t *      neighbor    = NULL;
+    list_node_t * edge_node   = NULL;
+    size_t        stack_count = 0;
+
+    if ((NULL == graph) || (NULL == workspace) || (NULL == start_data) ||
+        (NULL == action))
     {
-        PRINT_DEBUG("dfs_visit_node(): Unable to push node onto stack.");
+        PRINT_DEBUG("graph_dfs_workspace(): NULL argument passed.");
         goto END;
     }
 
-    exit_code = list_push_tail(visited_list, node);
-    if (E_SUCCESS != exit_code)
+    start_node = begin_traversal(graph, workspace, start_data);
+    if (NULL == start_node)
     {
-        PRINT_DEBUG("dfs_visit_node(): Unable to push node onto visited list.");
+        PRINT_DEBUG("graph_dfs_workspace(): Unable to begin traversal.");
         goto END;
     }
 
+    // Nodes are marked when pushed, so the stack never exceeds node_count
+    workspace->stamps[start_node->id]   = workspace->epoch;
+    workspace->frontier[stack_count++] = start_node;
+
+    while (0 != stack_count)
+    {
+        current = workspace->frontier[--stack_count];
+        action(current->data);
+
+        edge_node = current->edge_list->head;
+        while (NULL != edge_node)
+        {
+            neighbor = graph->nodes[edge_neighbor(
+                (edge_t *)edge_node->data, current->id)];
+            if (workspace->epoch != workspace->stamps[neighbor->id])
+            {
+                workspace->stamps[neighbor->id]    = workspace->epoch;
+                workspace->frontier[stack_count++] = neighbor;
+            }
+
+            edge_node = edge_node->next;
+        }
+    }
+
     exit_code = E_SUCCESS;
 END:
     return exit_code;
 }
 
-static int traverse_dfs(stack_t * stack, list_t * visited_list, ACTION_F action)
+int graph_bfs_workspace(graph_t *           graph,
+                        graph_workspace_t * workspace,
+                        void *              start_data,
+                        ACTION_F            action)
 {
-    int           exit_code = E_FAILURE;
-    node_t *      current   = NULL;
-    list_node_t * edge_node = NULL;
-    edge_t *      edge      = NULL;
-    node_t *      neighbor  = NULL;
-
-    if ((NULL == stack) || (NULL == visited_list) || (NULL == action))
+    int           exit_code  = E_FAILURE;
+    node_t *      start_node = NULL;
+    node_t *      current    = NULL;
+    node_t *      neighbor   = NULL;
+    list_node_t * edge_node  = NULL;
+    size_t        head       = 0;
+    size_t        tail       = 0;
+
+    if ((NULL == graph) || (NULL == workspace) || (NULL == start_data) ||
+        (NULL == action))
     {
-        PRINT_DEBUG("traverse_dfs(): NULL argument passed.");
+        PRINT_DEBUG("graph_bfs_workspace(): NULL argument passed.");
         goto END;
     }
 
-    while (E_FAILURE == stack_is_empty(stack))
+    start_node = begin_traversal(graph, workspace, start_data);
+    if (NULL == start_node)
     {
-        current = (node_t *)stack_pop(stack);
-        if (NULL == current)
-        {
-            PRINT_DEBUG("traverse_dfs(): NULL data popped from stack.");
-            goto END;
-        }
+        PRINT_DEBUG("graph_bfs_workspace(): Unable to begin traversal.");
+        goto END;
+    }
+
+    // Every node is enqueued at most once, so the queue never wraps
+    workspace->stamps[start_node->id] = workspace->epoch;
+    workspace->frontier[tail++]       = start_node;
 
+    while (head != tail)
+    {
+        current = workspace->frontier[head++];
         action(current->data);
 
         edge_node = current->edge_list->head;
         while (NULL != edge_node)
         {
-            edge     = (edge_t *)edge_node->data;
-            neighbor = edge->node_2;
-
-            if (false == list_contains(visited_list, neighbor))
+            neighbor = graph->nodes[edge_neighbor(
+                (edge_t *)edge_node->data, current->id)];
+            if (workspace->epoch != workspace->stamps[neighbor->id])
             {
-                if (E_SUCCESS != dfs_visit_node(stack, visited_list, neighbor))
-                {
-                    PRINT_DEBUG("traverse_dfs(): Unable to visit neighbor.");
-                    goto END;
-                }
+                workspace->stamps[neighbor->id] = workspace->epoch;
+                workspace->frontier[tail++]     = neighbor;
             }
 
             edge_node = edge_node->next;
@@ -594,10 +1311,8 @@ END:
 
 int graph_dfs(graph_t * graph, void * start_data, ACTION_F action)
 {
-    int       exit_code    = E_FAILURE;
-    list_t *  visited_list = NULL;
-    stack_t * stack        = NULL;
-    node_t *  start_node   = NULL;
+    int                 exit_code = E_FAILURE;
+    graph_workspace_t * workspace = NULL;
 
     if ((NULL == graph) || (NULL == start_data) || (NULL == action))
     {
@@ -605,22 +1320,14 @@ int graph_dfs(graph_t * graph, void * start_data, ACTION_F action)
         goto END;
     }
 
-    exit_code =
-        initialize_dfs(graph, start_data, &visited_list, &stack, &start_node);
-    if (E_SUCCESS != exit_code)
-    {
-        PRINT_DEBUG("graph_dfs(): Unable to initialize DFS.");
-        goto END;
-    }
-
-    exit_code = dfs_visit_node(stack, visited_list, start_node);
-    if (E_SUCCESS != exit_code)
+    workspace = graph_workspace_create(graph->node_count);
+    if (NULL == workspace)
     {
-        PRINT_DEBUG("graph_dfs(): Unable to visit node.");
+        PRINT_DEBUG("graph_dfs(): Unable to create workspace.");
         goto END;
     }
 
-    exit_code = traverse_dfs(stack, visited_list, action);
+    exit_code = graph_dfs_workspace(graph, workspace, start_data, action);
     if (E_SUCCESS != exit_code)
     {
         PRINT_DEBUG("graph_dfs(): Unable to perform DFS traversal.");
@@ -628,476 +1335,2878 @@ int graph_dfs(graph_t * graph, void * start_data, ACTION_F action)
     }
 
 END:
-    stack_destroy(&stack);
-    list_delete(&visited_list);
+    if (NULL != workspace)
+    {
+        graph_workspace_destroy(&workspace);
+    }
     return exit_code;
 }
 
-static int bfs_visit_node(queue_t * queue, list_t * visited_list, node_t * node)
+int graph_bfs(graph_t * graph, void * start_data, ACTION_F action)
 {
-    int exit_code = E_FAILURE;
+    int                 exit_code = E_FAILURE;
+    graph_workspace_t * workspace = NULL;
 
-    if ((NULL == queue) || (NULL == visited_list) || (NULL == node))
+    if ((NULL == graph) || (NULL == start_data) || (NULL == action))
     {
-        PRINT_DEBUG("bfs_visit_node(): NULL argument passed.");
+        PRINT_DEBUG("graph_bfs(): NULL argument passed.");
         goto END;
     }
 
-    exit_code = queue_enqueue(queue, node);
-    if (E_SUCCESS != exit_code)
+    workspace = graph_workspace_create(graph->node_count);
+    if (NULL == workspace)
     {
-        PRINT_DEBUG("bfs_visit_node(): Unable to enqueue node.");
+        PRINT_DEBUG("graph_bfs(): Unable to create workspace.");
         goto END;
     }
 
-    exit_code = list_push_tail(visited_list, node);
+    exit_code = graph_bfs_workspace(graph, workspace, start_data, action);
     if (E_SUCCESS != exit_code)
     {
-        PRINT_DEBUG("bfs_visit_node(): Unable to push node onto visited list.");
+        PRINT_DEBUG("graph_bfs(): Unable to perform BFS traversal.");
         goto END;
     }
 
-    exit_code = E_SUCCESS;
 END:
+    if (NULL != workspace)
+    {
+        graph_workspace_destroy(&workspace);
+    }
     return exit_code;
 }
 
-static int initialize_bfs(graph_t *  graph,
-                          void *     start_data,
-                          list_t **  visited_list,
-                          queue_t ** queue,
-                          node_t **  start_node)
+int graph_dijkstra(graph_t * graph,
+                   void *    start_data,
+                   void *    end_data,
+                   list_t ** path)
 {
     int exit_code = E_FAILURE;
 
-    if ((NULL == graph) || (NULL == start_data) || (NULL == visited_list) ||
-        (NULL == queue) || (NULL == start_node))
+    if ((NULL == graph) || (NULL == start_data) || (NULL == end_data) ||
+        (NULL == path))
     {
-        PRINT_DEBUG("initialize_bfs(): NULL argument passed.");
+        PRINT_DEBUG("graph_dijkstra(): NULL argument passed.");
         goto END;
     }
 
-    *visited_list = list_new(default_free, node_ptr_comp);
-    if (NULL == *visited_list)
+    exit_code = search_path(graph, start_data, end_data, NULL, path);
+    if (E_SUCCESS != exit_code)
     {
-        PRINT_DEBUG("initialize_dfs(): Failed to create visited list.");
+        PRINT_DEBUG("graph_dijkstra(): No path found.");
         goto END;
     }
 
-    *start_node = graph_find_node(graph, start_data);
-    if (NULL == *start_node)
+END:
+    return exit_code;
+}
+
+int graph_dijkstra_bidirectional(graph_t * graph,
+                                 void *    start_data,
+                                 void *    end_data,
+                                 list_t ** path)
+{
+    int               exit_code  = E_FAILURE;
+    node_t **         nodes      = NULL;
+    node_t *          start_node = NULL;
+    node_t *          end_node   = NULL;
+    search_side_t     forward    = { 0 };
+    search_side_t     backward   = { 0 };
+    reverse_index_t * reverse    = NULL;
+    size_t            best       = SIZE_MAX;
+    uint32_t          meet       = PRIORITY_QUEUE_ABSENT;
+    size_t            top_f      = 0;
+    size_t            top_b      = 0;
+    uint32_t          current    = 0;
+
+    if ((NULL == graph) || (NULL == start_data) || (NULL == end_data) ||
+        (NULL == path))
     {
-        PRINT_DEBUG("initialize_bfs(): Unable to find start node.");
+        PRINT_DEBUG("graph_dijkstra_bidirectional(): NULL argument passed.");
         goto END;
     }
 
-    *queue = queue_init(free, QUEUE_UNBOUNDED);
-    if (NULL == *queue)
+    *path = NULL;
+
+    start_node = graph_find_node(graph, start_data);
+    end_node   = graph_find_node(graph, end_data);
+    if ((NULL == start_node) || (NULL == end_node))
     {
-        PRINT_DEBUG("initialize_bfs(): Failed to create queue.");
+        PRINT_DEBUG("graph_dijkstra_bidirectional(): Unable to find node.");
         goto END;
     }
 
-    exit_code = E_SUCCESS;
-END:
-    return exit_code;
-}
-
-static int traverse_bfs(queue_t * queue, list_t * visited_list, ACTION_F action)
-{
-    int           exit_code = E_FAILURE;
-    node_t *      current   = NULL;
-    list_node_t * edge_node = NULL;
-    edge_t *      edge      = NULL;
-    node_t *      neighbor  = NULL;
-
-    if ((NULL == queue) || (NULL == visited_list) || (NULL == action))
+    nodes = collect_nodes(graph);
+    if ((NULL == nodes) ||
+        (E_SUCCESS != search_side_init(&forward, graph->node_count)) ||
+        (E_SUCCESS != search_side_init(&backward, graph->node_count)))
     {
-        PRINT_DEBUG("traverse_bfs(): NULL argument passed.");
+        PRINT_DEBUG("graph_dijkstra_bidirectional(): CMR failure.");
         goto END;
     }
 
-    while (false == queue_is_empty(queue))
+    // Undirected edges sit in both endpoints' lists, so only one-way edges
+    // need a separate index to be walked backwards
+    if (0 != graph->directed_edge_count)
     {
-        current = (node_t *)queue_dequeue(queue);
-        if (NULL == current)
+        reverse = reverse_index_create(graph, nodes);
+        if (NULL == reverse)
         {
-            PRINT_DEBUG("traverse_bfs(): NULL data dequeued.");
+            PRINT_DEBUG(
+                "graph_dijkstra_bidirectional(): Unable to index edges.");
             goto END;
         }
+    }
 
-        action(current->data);
+    forward.distance[start_node->id] = 0;
+    backward.distance[end_node->id]  = 0;
+    priority_queue_push(forward.frontier, start_node->id, 0);
+    priority_queue_push(backward.frontier, end_node->id, 0);
+    if (start_node == end_node)
+    {
+        best = 0;
+        meet = start_node->id;
+    }
 
-        edge_node = current->edge_list->head;
-        while (NULL != edge_node)
+    // Once the two frontiers' minimums sum to at least the best meeting
+    // point found so far, no shorter path can exist
+    while (!priority_queue_is_empty(forward.frontier) &&
+           !priority_queue_is_empty(backward.frontier))
+    {
+        priority_queue_peek(forward.frontier, &current, &top_f);
+        priority_queue_peek(backward.frontier, &current, &top_b);
+        if (add_saturated(top_f, top_b) >= best)
         {
-            edge     = (edge_t *)edge_node->data;
-            neighbor = edge->node_2;
-
-            if (false == list_contains(visited_list, neighbor))
-            {
-                if (E_SUCCESS != bfs_visit_node(queue, visited_list, neighbor))
-                {
-                    PRINT_DEBUG("traverse_bfs(): Unable to visit neighbor.");
-                    goto END;
-                }
-            }
+            break;
+        }
 
-            edge_node = edge_node->next;
+        // Grow whichever side has the smaller frontier
+        if (forward.frontier->size <= backward.frontier->size)
+        {
+            priority_queue_pop(forward.frontier, &current, NULL);
+            expand_forward(&forward, &backward, nodes[current], &best, &meet);
+        }
+        else
+        {
+            priority_queue_pop(backward.frontier, &current, NULL);
+            expand_backward(
+                &backward, &forward, nodes, current, reverse, &best, &meet);
         }
     }
 
+    if (PRIORITY_QUEUE_ABSENT == meet)
+    {
+        PRINT_DEBUG("graph_dijkstra_bidirectional(): No path found.");
+        goto END;
+    }
+
+    *path = build_node_path(nodes, forward.parent, backward.parent, meet);
+    if (NULL == *path)
+    {
+        PRINT_DEBUG("graph_dijkstra_bidirectional(): Unable to build path.");
+        goto END;
+    }
+
     exit_code = E_SUCCESS;
 END:
+    reverse_index_destroy(&reverse);
+    search_side_destroy(&forward);
+    search_side_destroy(&backward);
+    free(nodes);
     return exit_code;
 }
 
-int graph_bfs(graph_t * graph, void * start_data, ACTION_F action)
+int graph_a_star(graph_t *   graph,
+                 void *      start_data,
+                 void *      end_data,
+                 HEURISTIC_F heuristic,
+                 list_t **   path)
 {
-    int       exit_code    = E_FAILURE;
-    list_t *  visited_list = NULL;
-    queue_t * queue        = NULL;
-    node_t *  start_node   = NULL;
+    int exit_code = E_FAILURE;
 
-    if ((NULL == graph) || (NULL == start_data) || (NULL == action))
+    if ((NULL == graph) || (NULL == start_data) || (NULL == end_data) ||
+        (NULL == path))
     {
-        PRINT_DEBUG("graph_bfs(): NULL argument passed.");
+        PRINT_DEBUG("graph_a_star(): NULL argument passed.");
         goto END;
     }
 
-    exit_code =
-        initialize_bfs(graph, start_data, &visited_list, &queue, &start_node);
+    exit_code = search_path(graph, start_data, end_data, heuristic, path);
     if (E_SUCCESS != exit_code)
     {
-        PRINT_DEBUG("graph_bfs(): Unable to initialize BFS.");
+        PRINT_DEBUG("graph_a_star(): No path found.");
         goto END;
     }
 
-    exit_code = bfs_visit_node(queue, visited_list, start_node);
-    if (E_SUCCESS != exit_code)
+END:
+    return exit_code;
+}
+
+int graph_distance_matrix(graph_t * graph, size_t ** distances)
+{
+    int           exit_code = E_FAILURE;
+    size_t *      matrix    = NULL;
+    size_t *      row       = NULL;
+    size_t        count     = 0;
+    list_node_t * current   = NULL;
+    list_node_t * edge_node = NULL;
+    node_t *      node      = NULL;
+    edge_t *      edge      = NULL;
+    size_t        column    = 0;
+
+    if ((NULL == graph) || (NULL == distances))
     {
-        PRINT_DEBUG("graph_bfs(): Unable to visit node.");
+        PRINT_DEBUG("graph_distance_matrix(): NULL argument passed.");
         goto END;
     }
 
-    exit_code = traverse_bfs(queue, visited_list, action);
-    if (E_SUCCESS != exit_code)
+    count = graph->node_count;
+    if ((0 != count) && (count > (SIZE_MAX / sizeof(size_t) / count)))
     {
-        PRINT_DEBUG("graph_bfs(): Unable to perform BFS traversal.");
+        PRINT_DEBUG("graph_distance_matrix(): Graph is too large.");
         goto END;
     }
 
-    exit_code = E_SUCCESS;
+    // One spare entry so an empty graph still gets a freeable matrix
+    matrix = malloc(((count * count) + 1) * sizeof(size_t));
+    if (NULL == matrix)
+    {
+        PRINT_DEBUG("graph_distance_matrix(): CMR failure.");
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < (count * count); idx++)
+    {
+        matrix[idx] = GRAPH_DISTANCE_INFINITY;
+    }
+
+    current = graph->node_list->head;
+    while (NULL != current)
+    {
+        node          = (node_t *)current->data;
+        row           = &matrix[(size_t)node->id * count];
+        row[node->id] = 0;
+
+        edge_node = node->edge_list->head;
+        while (NULL != edge_node)
+        {
+            edge   = (edge_t *)edge_node->data;
+            column = edge_neighbor(edge, node->id);
+            if (edge->weight < row[column])
+            {
+                row[column] = edge->weight;
+            }
+            edge_node = edge_node->next;
+        }
+
+        current = current->next;
+    }
+
+    *distances = matrix;
+    exit_code  = E_SUCCESS;
 END:
-    queue_destroy(&queue);
-    list_delete(&visited_list);
     return exit_code;
 }
 
-int graph_dijkstra(graph_t * graph,
-                   void *    start_data,
-                   void *    end_data,
-                   list_t ** path)
+int graph_floyd_warshall(graph_t * graph, size_t ** distances)
 {
-    (void)graph;
-    (void)start_data;
-    (void)end_data;
-    (void)path;
-    return -1;
-}
+    int      exit_code = E_FAILURE;
+    size_t * matrix    = NULL;
+    size_t * row       = NULL;
+    size_t * via_row   = NULL;
+    size_t   count     = 0;
+    size_t   via_dist  = 0;
 
-int graph_a_star(graph_t * graph,
-                 void *    start_data,
-                 void *    end_data,
-                 list_t ** path)
-{
-    (void)graph;
-    (void)start_data;
-    (void)end_data;
-    (void)path;
-    return -1;
-}
+    if ((NULL == graph) || (NULL == distances))
+    {
+        PRINT_DEBUG("graph_floyd_warshall(): NULL argument passed.");
+        goto END;
+    }
 
-int graph_floyd_warshall(graph_t * graph, size_t *** distances)
-{
-    (void)graph;
-    (void)distances;
-    return -1;
-}
+    exit_code = graph_distance_matrix(graph, &matrix);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("graph_floyd_warshall(): Unable to build matrix.");
+        goto END;
+    }
 
-int graph_is_connected(graph_t * graph, const bool * is_connected)
-{
-    int exit_code = E_FAILURE;
+    // k-i-j order keeps the inner loop on two contiguous rows
+    count = graph->node_count;
+    for (size_t via = 0; via < count; via++)
+    {
+        via_row = &matrix[via * count];
+        for (size_t from = 0; from < count; from++)
+        {
+            row      = &matrix[from * count];
+            via_dist = row[via];
+            if (GRAPH_DISTANCE_INFINITY == via_dist)
+            {
+                continue;
+            }
 
-    (void)graph;
-    (void)is_connected;
+            for (size_t to = 0; to < count; to++)
+            {
+                size_t candidate = add_saturated(via_dist, via_row[to]);
+                if (candidate < row[to])
+                {
+                    row[to] = candidate;
+                }
+            }
+        }
+    }
 
+    *distances = matrix;
+END:
     return exit_code;
 }
 
-int graph_is_cyclic(graph_t * graph, const bool * is_cyclic)
+graph_paths_t * graph_paths_create(graph_t * graph)
 {
-    int exit_code = E_FAILURE;
+    graph_paths_t * paths = NULL;
 
-    (void)graph;
-    (void)is_cyclic;
-
-    return exit_code;
-}
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("graph_paths_create(): NULL argument passed.");
+        goto END;
+    }
 
-list_t * graph_find_connected_components(graph_t * graph)
-{
-    list_t * connected_components = NULL;
+    paths = calloc(1, sizeof(graph_paths_t));
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("graph_paths_create(): CMR failure.");
+        goto END;
+    }
+
+    paths->graph = graph;
+    if (E_SUCCESS != resize_paths(paths, graph->node_capacity))
+    {
+        PRINT_DEBUG("graph_paths_create(): CMR failure.");
+        free(paths);
+        paths = NULL;
+        goto END;
+    }
 
-    (void)graph;
+    paths->next  = graph->paths;
+    graph->paths = paths;
 
-    return connected_components;
+END:
+    return paths;
 }
 
-int graph_node_degree(graph_t * graph, void * data, const size_t * degree)
+int graph_paths_add_source(graph_paths_t * paths, void * data)
 {
-    int exit_code = E_FAILURE;
+    int              exit_code = E_FAILURE;
+    node_t *         node      = NULL;
+    graph_source_t * sources   = NULL;
+    graph_source_t   source    = { 0 };
+    size_t           capacity  = 0;
 
-    (void)graph;
-    (void)data;
-    (void)degree;
+    if ((NULL == paths) || (NULL == data))
+    {
+        PRINT_DEBUG("graph_paths_add_source(): NULL argument passed.");
+        goto END;
+    }
+
+    if (paths->is_stale)
+    {
+        PRINT_DEBUG("graph_paths_add_source(): Paths need a refresh.");
+        goto END;
+    }
+
+    node = graph_find_node(paths->graph, data);
+    if (NULL == node)
+    {
+        PRINT_DEBUG("graph_paths_add_source(): Unable to find node.");
+        goto END;
+    }
+
+    if (NULL != find_source(paths, node->id))
+    {
+        PRINT_DEBUG("graph_paths_add_source(): Source already registered.");
+        goto END;
+    }
+
+    if (paths->count == paths->capacity)
+    {
+        capacity = (0 == paths->capacity) ? 4 : (paths->capacity * 2);
+        sources = realloc(paths->sources, capacity * sizeof(graph_source_t));
+        if (NULL == sources)
+        {
+            PRINT_DEBUG("graph_paths_add_source(): CMR failure.");
+            goto END;
+        }
+        paths->sources  = sources;
+        paths->capacity = capacity;
+    }
+
+    source.id        = node->id;
+    source.distances = calloc(paths->slots, sizeof(size_t));
+    source.parents   = calloc(paths->slots, sizeof(uint32_t));
+    if ((NULL == source.distances) || (NULL == source.parents))
+    {
+        PRINT_DEBUG("graph_paths_add_source(): CMR failure.");
+        free(source.distances);
+        free(source.parents);
+        goto END;
+    }
+
+    compute_source(paths, &source);
+    paths->sources[paths->count++] = source;
 
+    exit_code = E_SUCCESS;
+END:
     return exit_code;
 }
 
-list_t * graph_get_adjacent_nodes(graph_t * graph, void * data)
+int graph_paths_remove_source(graph_paths_t * paths, void * data)
 {
-    (void)graph;
-    (void)data;
-    return NULL;
-}
+    int              exit_code = E_FAILURE;
+    node_t *         node      = NULL;
+    graph_source_t * source    = NULL;
 
-bool graph_edge_exists(graph_t * graph, void * data_1, void * data_2)
-{
-    (void)graph;
-    (void)data_1;
-    (void)data_2;
-    return false;
-}
+    if ((NULL == paths) || (NULL == data))
+    {
+        PRINT_DEBUG("graph_paths_remove_source(): NULL argument passed.");
+        goto END;
+    }
 
-size_t graph_get_edge_weight(graph_t * graph, void * data_1, void * data_2)
-{
-    (void)graph;
-    (void)data_1;
-    (void)data_2;
-    return -1;
-}
+    node   = graph_find_node(paths->graph, data);
+    source = (NULL == node) ? NULL : find_source(paths, node->id);
+    if (NULL == source)
+    {
+        PRINT_DEBUG("graph_paths_remove_source(): Source not registered.");
+        goto END;
+    }
 
-graph_t * graph_clone(graph_t * graph)
-{
-    (void)graph;
-    return NULL;
-}
+    // The last source fills the gap
+    free(source->distances);
+    free(source->parents);
+    *source = paths->sources[--paths->count];
 
-// STATIC FUNCTIONS
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
 
-static node_t * graph_create_node(void * data)
+int graph_paths_refresh(graph_paths_t * paths)
 {
-    node_t * new_node = NULL;
+    int exit_code = E_FAILURE;
 
-    if (NULL == data)
+    if (NULL == paths)
     {
-        PRINT_DEBUG("graph_create_node(): NULL data passed.");
+        PRINT_DEBUG("graph_paths_refresh(): NULL argument passed.");
         goto END;
     }
 
-    new_node = calloc(1, sizeof(node_t));
-    if (NULL == new_node)
+    if ((paths->graph->node_count > paths->slots) &&
+        (E_SUCCESS != resize_paths(paths, paths->graph->node_capacity)))
     {
-        PRINT_DEBUG("graph_create_node(): CMR failure.");
+        PRINT_DEBUG("graph_paths_refresh(): CMR failure.");
         goto END;
     }
 
-    new_node->data       = data;
-    new_node->edge_count = 0;
-    new_node->edge_list  = list_new(edge_list_free, edge_compare);
-    if (NULL == new_node->edge_list)
+    for (size_t idx = 0; idx < paths->count; idx++)
     {
-        PRINT_DEBUG("graph_create_node(): CMR failure.");
-        free(new_node);
-        new_node = NULL;
-        goto END;
+        compute_source(paths, &paths->sources[idx]);
     }
+    paths->is_stale = false;
 
+    exit_code = E_SUCCESS;
 END:
-    return new_node;
+    return exit_code;
 }
 
-static node_t * graph_find_node(graph_t * graph, void * data)
+size_t graph_paths_get_distance(const graph_paths_t * paths,
+                                void *                source_data,
+                                void *                target_data)
 {
-    list_node_t * list_node = NULL;
-    node_t *      node      = NULL;
+    size_t           distance = GRAPH_DISTANCE_INFINITY;
+    node_t *         source   = NULL;
+    node_t *         target   = NULL;
+    graph_source_t * tree     = NULL;
 
-    if ((NULL == graph) || (NULL == data))
+    if ((NULL == paths) || (NULL == source_data) || (NULL == target_data))
     {
-        PRINT_DEBUG("graph_find_node(): NULL argument passed.");
+        PRINT_DEBUG("graph_paths_get_distance(): NULL argument passed.");
         goto END;
     }
 
-    list_node = list_find_first_occurrence(graph->node_list, &data);
-    if (NULL == list_node)
+    if (paths->is_stale)
     {
-        PRINT_DEBUG("graph_find_node(): Unable to find first occurrence.");
+        PRINT_DEBUG("graph_paths_get_distance(): Paths need a refresh.");
         goto END;
     }
 
-    node = ((node_t *)list_node->data);
+    source = graph_find_node(paths->graph, source_data);
+    target = graph_find_node(paths->graph, target_data);
+    tree   = (NULL == source) ? NULL : find_source(paths, source->id);
+    if ((NULL == tree) || (NULL == target))
+    {
+        PRINT_DEBUG("graph_paths_get_distance(): Source not registered.");
+        goto END;
+    }
+
+    distance = tree->distances[target->id];
 
 END:
-    return node;
+    return distance;
 }
 
-static edge_t * graph_find_edge(graph_t * graph,
-                                node_t *  node_1,
-                                node_t *  node_2)
+int graph_paths_get_path(const graph_paths_t * paths,
+                         void *                source_data,
+                         void *                target_data,
+                         list_t **             path,
+                         size_t *              total_weight)
 {
-    edge_t *      edge      = NULL;
-    list_t *      edge_list = NULL;
-    list_node_t * current   = NULL;
+    int              exit_code = E_FAILURE;
+    node_t *         source    = NULL;
+    node_t *         target    = NULL;
+    graph_source_t * tree      = NULL;
 
-    if ((NULL == graph) || (NULL == node_1) || (NULL == node_2))
+    if ((NULL == paths) || (NULL == source_data) || (NULL == target_data) ||
+        (NULL == path) || (NULL == total_weight))
     {
-        PRINT_DEBUG("graph_find_edge(): NULL argument passed.");
+        PRINT_DEBUG("graph_paths_get_path(): NULL argument passed.");
         goto END;
     }
 
-    edge_list = node_1->edge_list;
-    if (NULL == edge_list)
+    *path = NULL;
+    if (paths->is_stale)
     {
-        PRINT_DEBUG("graph_find_edge(): Node 1 does not have an edge list.");
+        PRINT_DEBUG("graph_paths_get_path(): Paths need a refresh.");
         goto END;
     }
 
-    // Find the edge that connects to node 2
-    current = edge_list->head;
-    while (NULL != current)
+    source = graph_find_node(paths->graph, source_data);
+    target = graph_find_node(paths->graph, target_data);
+    tree   = (NULL == source) ? NULL : find_source(paths, source->id);
+    if ((NULL == tree) || (NULL == target))
     {
-        edge = (edge_t *)current->data;
+        PRINT_DEBUG("graph_paths_get_path(): Source not registered.");
+        goto END;
+    }
 
-        // Check if the current edge connects to node 2
-        if (((edge->node_1 == node_1) && (edge->node_2 == node_2)) ||
-            ((edge->node_1 == node_2) && (edge->node_2 == node_1) &&
-             false == edge->is_directed))
-        {
-            // Found the edge
-            goto END;
-        }
+    if (GRAPH_DISTANCE_INFINITY == tree->distances[target->id])
+    {
+        PRINT_DEBUG("graph_paths_get_path(): No path found.");
+        goto END;
+    }
 
-        current = current->next;
+    *path =
+        build_node_path(paths->graph->nodes, tree->parents, NULL, target->id);
+    if (NULL == *path)
+    {
+        PRINT_DEBUG("graph_paths_get_path(): Unable to build path.");
+        goto END;
     }
 
+    *total_weight = tree->distances[target->id];
+
+    exit_code = E_SUCCESS;
 END:
-    return edge;
+    return exit_code;
 }
 
-static edge_t ** collect_edges(node_t * node, uint32_t * num_edges)
+void graph_paths_destroy(graph_paths_t ** paths_address)
 {
-    edge_t **     edge_list = NULL;
-    list_node_t * current   = NULL;
-    size_t        index     = 0;
+    graph_paths_t ** link = NULL;
+
+    if ((NULL == paths_address) || (NULL == *paths_address))
+    {
+        goto END;
+    }
+
+    link = &(*paths_address)->graph->paths;
+    while (*link != *paths_address)
+    {
+        link = &(*link)->next;
+    }
+    *link = (*paths_address)->next;
+
+    for (size_t idx = 0; idx < (*paths_address)->count; idx++)
+    {
+        free((*paths_address)->sources[idx].distances);
+        free((*paths_address)->sources[idx].parents);
+    }
+    free((*paths_address)->sources);
+    priority_queue_delete(&(*paths_address)->queue);
+    free((*paths_address)->scratch);
+    free((*paths_address)->marks);
+    free(*paths_address);
+    *paths_address = NULL;
 
-    if ((NULL == node) || (NULL == num_edges))
+END:
+    return;
+}
+
+int graph_is_connected(graph_t * graph, bool * is_connected)
+{
+    int              exit_code = E_FAILURE;
+    disjoint_set_t * forest    = NULL;
+
+    if ((NULL == graph) || (NULL == is_connected))
     {
-        PRINT_DEBUG("collect_edges(): NULL argument passed.");
+        PRINT_DEBUG("graph_is_connected(): NULL argument passed.");
         goto END;
     }
 
-    if (NULL == node->edge_list)
+    forest = graph_components(graph);
+    if (NULL == forest)
     {
-        PRINT_DEBUG("collect_edges(): NULL edge list.");
+        PRINT_DEBUG("graph_is_connected(): Unable to build components.");
         goto END;
     }
 
-    *num_edges = node->edge_list->size;
+    *is_connected = (1 >= forest->set_count);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int graph_in_same_component(graph_t * graph,
+                            void *    data_1,
+                            void *    data_2,
+                            bool *    is_connected)
+{
+    int              exit_code = E_FAILURE;
+    node_t *         node_1    = NULL;
+    node_t *         node_2    = NULL;
+    disjoint_set_t * forest    = NULL;
+
+    if ((NULL == graph) || (NULL == data_1) || (NULL == data_2) ||
+        (NULL == is_connected))
+    {
+        PRINT_DEBUG("graph_in_same_component(): NULL argument passed.");
+        goto END;
+    }
 
-    edge_list = calloc(*num_edges, sizeof(edge_t *));
-    if (NULL == edge_list)
+    node_1 = graph_find_node(graph, data_1);
+    node_2 = graph_find_node(graph, data_2);
+    if ((NULL == node_1) || (NULL == node_2))
     {
-        PRINT_DEBUG("collect_edges(): CMR failure.");
+        PRINT_DEBUG("graph_in_same_component(): Unable to find node.");
         goto END;
     }
 
-    current = node->edge_list->head;
-    while ((NULL != current) && (index < *num_edges))
+    forest = graph_components(graph);
+    if (NULL == forest)
     {
-        edge_list[index++] = (edge_t *)current->data;
-        current            = current->next;
+        PRINT_DEBUG("graph_in_same_component(): Unable to build components.");
+        goto END;
     }
 
+    *is_connected = disjoint_set_same(forest, node_1->id, node_2->id);
+
+    exit_code = E_SUCCESS;
 END:
-    return edge_list;
+    return exit_code;
 }
 
-static int remove_edges(graph_t * graph,
-                        edge_t ** edges_to_remove,
-                        size_t    num_edges)
+int graph_is_cyclic(graph_t * graph, bool * is_cyclic)
 {
-    int exit_code = E_FAILURE;
+    int              exit_code = E_FAILURE;
+    disjoint_set_t * forest    = NULL;
+    list_node_t *    current   = NULL;
+    list_node_t *    edge_node = NULL;
+    node_t *         node      = NULL;
+    edge_t *         edge      = NULL;
+    bool             merged    = false;
+
+    if ((NULL == graph) || (NULL == is_cyclic))
+    {
+        PRINT_DEBUG("graph_is_cyclic(): NULL argument passed.");
+        goto END;
+    }
 
-    if ((NULL == graph) || (NULL == edges_to_remove))
+    forest = disjoint_set_new((uint32_t)graph->node_count);
+    if (NULL == forest)
     {
-        PRINT_DEBUG("remove_edges(): NULL argument passed.");
+        PRINT_DEBUG("graph_is_cyclic(): Unable to create forest.");
         goto END;
     }
 
-    for (size_t idx = 0; idx < num_edges; ++idx)
+    // A two-way edge whose ends are already joined closes a cycle
+    *is_cyclic = false;
+    current    = graph->node_list->head;
+    while ((NULL != current) && (!*is_cyclic))
     {
-        if (NULL == edges_to_remove[idx])
+        node      = (node_t *)current->data;
+        edge_node = node->edge_list->head;
+        while ((NULL != edge_node) && (!*is_cyclic))
         {
-            PRINT_DEBUG("remove_edges(): NULL edge pointer encountered.");
-            goto END;
+            edge = (edge_t *)edge_node->data;
+            if ((!edge->is_directed) && (node->id == edge->id_1))
+            {
+                disjoint_set_union(forest, edge->id_1, edge->id_2, &merged);
+                *is_cyclic = !merged;
+            }
+            edge_node = edge_node->next;
         }
+        current = current->next;
+    }
+
+    exit_code = E_SUCCESS;
+    if (!*is_cyclic)
+    {
+        exit_code = contracted_is_cyclic(graph, forest, is_cyclic);
+    }
+
+END:
+    if (NULL != forest)
+    {
+        disjoint_set_delete(&forest);
+    }
+    return exit_code;
+}
+
+list_t * graph_find_connected_components(graph_t * graph)
+{
+    list_t *         components = NULL;
+    list_t **        members    = NULL;
+    disjoint_set_t * forest     = NULL;
+    list_node_t *    current    = NULL;
+    node_t *         node       = NULL;
+    uint32_t         root       = 0;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("graph_find_connected_components(): NULL argument passed.");
+        goto END;
+    }
+
+    forest     = graph_components(graph);
+    members    = calloc(graph->node_count + 1, sizeof(list_t *));
+    components = list_new(component_list_free, node_ptr_comp);
+    if ((NULL == forest) || (NULL == members) || (NULL == components))
+    {
+        PRINT_DEBUG("graph_find_connected_components(): CMR failure.");
+        goto CLEANUP_COMPONENTS;
+    }
 
-        if ((NULL == edges_to_remove[idx]->node_1) ||
-            (NULL == edges_to_remove[idx]->node_2))
+    // The outer list takes ownership of each member list as it is created
+    current = graph->node_list->head;
+    while (NULL != current)
+    {
+        node = (node_t *)current->data;
+        root = disjoint_set_find(forest, node->id);
+        if (NULL == members[root])
         {
-            PRINT_DEBUG("remove_edges(): NULL node encountered in edge.");
-            goto END;
+            members[root] = list_new(path_free, node_ptr_comp);
+            if ((NULL == members[root]) ||
+                (E_SUCCESS != list_push_tail(components, members[root])))
+            {
+                PRINT_DEBUG(
+                    "graph_find_connected_components(): CMR failure.");
+                if (NULL != members[root])
+                {
+                    list_delete(&members[root]);
+                }
+                goto CLEANUP_COMPONENTS;
+            }
         }
 
-        exit_code = graph_remove_edge(graph,
-                                      edges_to_remove[idx]->node_1->data,
-                                      edges_to_remove[idx]->node_2->data);
-        if (E_SUCCESS != exit_code)
+        if (E_SUCCESS != list_push_tail(members[root], node->data))
         {
-            PRINT_DEBUG("remove_edges(): Unable to remove edge.");
-            goto END;
+            PRINT_DEBUG("graph_find_connected_components(): CMR failure.");
+            goto CLEANUP_COMPONENTS;
         }
+        current = current->next;
     }
 
-    exit_code = E_SUCCESS;
+    goto END;
+
+CLEANUP_COMPONENTS:
+    if (NULL != components)
+    {
+        list_delete(&components);
+    }
 END:
-    return exit_code;
+    free(members);
+    members = NULL;
+    return components;
 }
 
-static void cleanup_node(graph_t * graph, node_t * node)
+list_t * graph_find_strongly_connected_components(graph_t * graph)
 {
-    int exit_code = E_FAILURE;
+    list_t *         components = NULL;
+    list_t *         members    = NULL;
+    node_t **        nodes      = NULL;
+    uint32_t *       order      = NULL;
+    uint32_t *       low        = NULL;
+    uint32_t *       stack      = NULL;
+    bool *           on_stack   = NULL;
+    tarjan_frame_t * frames     = NULL;
+    size_t           count      = 0;
+    size_t           depth      = 0;
+    size_t           stack_size = 0;
+    uint32_t         visited    = 0;
+    uint32_t         node       = 0;
+    uint32_t         neighbor   = 0;
+    uint32_t         member     = 0;
 
-    if ((NULL == graph) || (NULL == node))
+    if (NULL == graph)
     {
-        PRINT_DEBUG("cleanup_node(): NULL argument passed.");
+        PRINT_DEBUG(
+            "graph_find_strongly_connected_components(): NULL argument "
+            "passed.");
         goto END;
     }
 
-    // Free the nodes data and the node itself, and remove the edge list
-    graph->custom_free(node->data);
-    node->data = NULL;
+    count      = graph->node_count;
+    nodes      = collect_nodes(graph);
+    order      = calloc(count + 1, sizeof(uint32_t));
+    low        = calloc(count + 1, sizeof(uint32_t));
+    stack      = calloc(count + 1, sizeof(uint32_t));
+    on_stack   = calloc(count + 1, sizeof(bool));
+    frames     = calloc(count + 1, sizeof(tarjan_frame_t));
+    components = list_new(component_list_free, node_ptr_comp);
+    if ((NULL == nodes) || (NULL == order) || (NULL == low) ||
+        (NULL == stack) || (NULL == on_stack) || (NULL == frames) ||
+        (NULL == components))
+    {
+        PRINT_DEBUG("graph_find_strongly_connected_components(): CMR failure.");
+        goto CLEANUP_COMPONENTS;
+    }
 
-    node->edge_count = 0;
+    // order[] holds 1 + the visit number, so 0 marks an unvisited node
+    for (uint32_t root = 0; root < count; root++)
+    {
+        if (0 != order[root])
+        {
+            continue;
+        }
 
-    list_delete(&(node->edge_list));
-    free(node);
-    node = NULL;
+        frames[0].node      = root;
+        frames[0].next_edge = nodes[root]->edge_list->head;
+        depth               = 1;
+        order[root] = low[root] = ++visited;
+        stack[stack_size++]     = root;
+        on_stack[root]          = true;
+
+        while (0 != depth)
+        {
+            tarjan_frame_t * frame = &frames[depth - 1];
+
+            node = frame->node;
+            if (NULL != frame->next_edge)
+            {
+                neighbor =
+                    edge_neighbor((edge_t *)frame->next_edge->data, node);
+                frame->next_edge = frame->next_edge->next;
+
+                if (0 == order[neighbor])
+                {
+                    // Descend, as the recursive version would
+                    frames[depth].node      = neighbor;
+                    frames[depth].next_edge = nodes[neighbor]->edge_list->head;
+                    depth++;
+                    order[neighbor] = low[neighbor] = ++visited;
+                    stack[stack_size++]             = neighbor;
+                    on_stack[neighbor]              = true;
+                }
+                else if (on_stack[neighbor] && (order[neighbor] < low[node]))
+                {
+                    low[node] = order[neighbor];
+                }
+                continue;
+            }
+
+            // Every edge is done: return to the caller's frame
+            depth--;
+            if (0 != depth)
+            {
+                neighbor = frames[depth - 1].node;
+                if (low[node] < low[neighbor])
+                {
+                    low[neighbor] = low[node];
+                }
+            }
+
+            if (low[node] != order[node])
+            {
+                continue;
+            }
+
+            // 'node' roots a component made of everything above it
+            members = list_new(path_free, node_ptr_comp);
+            if ((NULL == members) ||
+                (E_SUCCESS != list_push_tail(components, members)))
+            {
+                PRINT_DEBUG(
+                    "graph_find_strongly_connected_components(): CMR "
+                    "failure.");
+                if (NULL != members)
+                {
+                    list_delete(&members);
+                }
+                goto CLEANUP_COMPONENTS;
+            }
+
+            do
+            {
+                member           = stack[--stack_size];
+                on_stack[member] = false;
+                if (E_SUCCESS != list_push_tail(members, nodes[member]->data))
+                {
+                    PRINT_DEBUG(
+                        "graph_find_strongly_connected_components(): CMR "
+                        "failure.");
+                    goto CLEANUP_COMPONENTS;
+                }
+            } while (member != node);
+        }
+    }
+
+    goto END;
 
-    (void)exit_code;
+CLEANUP_COMPONENTS:
+    if (NULL != components)
+    {
+        list_delete(&components);
+    }
 END:
-    return;
+    free(nodes);
+    free(order);
+    free(low);
+    free(stack);
+    free(on_stack);
+    free(frames);
+    return components;
+}
+
+int graph_node_degree(graph_t * graph, void * data, size_t * degree)
+{
+    int      exit_code = E_FAILURE;
+    node_t * node      = NULL;
+
+    if ((NULL == graph) || (NULL == data) || (NULL == degree))
+    {
+        PRINT_DEBUG("graph_node_degree(): NULL argument passed.");
+        goto END;
+    }
+
+    node = graph_find_node(graph, data);
+    if (NULL == node)
+    {
+        PRINT_DEBUG("graph_node_degree(): Unable to find node.");
+        goto END;
+    }
+
+    *degree = node->edge_count;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+list_t * graph_get_adjacent_nodes(graph_t * graph, void * data)
+{
+    list_t *      adjacent  = NULL;
+    uint64_t *    seen      = NULL;
+    node_t *      node      = NULL;
+    node_t *      neighbor  = NULL;
+    list_node_t * edge_node = NULL;
+    uint64_t      bit       = 0;
+
+    if ((NULL == graph) || (NULL == data))
+    {
+        PRINT_DEBUG("graph_get_adjacent_nodes(): NULL argument passed.");
+        goto END;
+    }
+
+    node = graph_find_node(graph, data);
+    if (NULL == node)
+    {
+        PRINT_DEBUG("graph_get_adjacent_nodes(): Unable to find node.");
+        goto END;
+    }
+
+    // One bit per node ID filters out neighbours reached by parallel edges
+    seen     = calloc((graph->node_count / 64) + 1, sizeof(uint64_t));
+    adjacent = list_new(path_free, node_ptr_comp);
+    if ((NULL == seen) || (NULL == adjacent))
+    {
+        PRINT_DEBUG("graph_get_adjacent_nodes(): CMR failure.");
+        goto CLEANUP_ADJACENT;
+    }
+
+    edge_node = node->edge_list->head;
+    while (NULL != edge_node)
+    {
+        neighbor =
+            graph->nodes[edge_neighbor((edge_t *)edge_node->data, node->id)];
+        bit      = UINT64_C(1) << (neighbor->id % 64);
+        if (0 == (seen[neighbor->id / 64] & bit))
+        {
+            seen[neighbor->id / 64] |= bit;
+            if (E_SUCCESS != list_push_tail(adjacent, neighbor->data))
+            {
+                PRINT_DEBUG("graph_get_adjacent_nodes(): CMR failure.");
+                goto CLEANUP_ADJACENT;
+            }
+        }
+        edge_node = edge_node->next;
+    }
+
+    goto END;
+
+CLEANUP_ADJACENT:
+    if (NULL != adjacent)
+    {
+        list_delete(&adjacent);
+    }
+END:
+    free(seen);
+    seen = NULL;
+    return adjacent;
+}
+
+bool graph_edge_exists(graph_t * graph, void * data_1, void * data_2)
+{
+    bool     exists = false;
+    node_t * node_1 = NULL;
+    node_t * node_2 = NULL;
+
+    if ((NULL == graph) || (NULL == data_1) || (NULL == data_2))
+    {
+        PRINT_DEBUG("graph_edge_exists(): NULL argument passed.");
+        goto END;
+    }
+
+    node_1 = graph_find_node(graph, data_1);
+    node_2 = graph_find_node(graph, data_2);
+    if ((NULL == node_1) || (NULL == node_2))
+    {
+        goto END;
+    }
+
+    exists = (NULL != graph_find_edge(graph, node_1, node_2));
+
+END:
+    return exists;
+}
+
+size_t graph_get_edge_weight(graph_t * graph, void * data_1, void * data_2)
+{
+    size_t   weight = GRAPH_DISTANCE_INFINITY;
+    node_t * node_1 = NULL;
+    node_t * node_2 = NULL;
+    edge_t * edge   = NULL;
+
+    if ((NULL == graph) || (NULL == data_1) || (NULL == data_2))
+    {
+        PRINT_DEBUG("graph_get_edge_weight(): NULL argument passed.");
+        goto END;
+    }
+
+    node_1 = graph_find_node(graph, data_1);
+    node_2 = graph_find_node(graph, data_2);
+    if ((NULL == node_1) || (NULL == node_2))
+    {
+        PRINT_DEBUG("graph_get_edge_weight(): Unable to find node.");
+        goto END;
+    }
+
+    edge = graph_find_edge(graph, node_1, node_2);
+    if (NULL == edge)
+    {
+        PRINT_DEBUG("graph_get_edge_weight(): Unable to find edge.");
+        goto END;
+    }
+
+    weight = edge->weight;
+
+END:
+    return weight;
+}
+
+graph_t * graph_clone(graph_t * graph)
+{
+    graph_t * clone = NULL;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("graph_clone(): NULL argument passed.");
+        goto END;
+    }
+
+    clone = calloc(1, sizeof(graph_t));
+    if (NULL == clone)
+    {
+        PRINT_DEBUG("graph_clone(): CMR failure.");
+        goto END;
+    }
+
+    if (NULL == graph->family)
+    {
+        graph->family = calloc(1, sizeof(graph_family_t));
+        if (NULL == graph->family)
+        {
+            PRINT_DEBUG("graph_clone(): CMR failure.");
+            free(clone);
+            clone = NULL;
+            goto END;
+        }
+
+        graph->family->members = 1;
+        graph->family->pending = pointer_map_new(0);
+        if ((NULL == graph->family->pending) ||
+            (0 != pthread_mutex_init(&(graph->family->lock), NULL)))
+        {
+            PRINT_DEBUG("graph_clone(): Unable to create clone family.");
+            pointer_map_delete(&(graph->family->pending));
+            free(graph->family);
+            graph->family = NULL;
+            free(clone);
+            clone = NULL;
+            goto END;
+        }
+    }
+
+    if (NULL == graph->share)
+    {
+        graph->share = calloc(1, sizeof(graph_share_t));
+        if (NULL == graph->share)
+        {
+            PRINT_DEBUG("graph_clone(): CMR failure.");
+            free(clone);
+            clone = NULL;
+            goto END;
+        }
+        atomic_init(&(graph->share->references), 1);
+    }
+
+    atomic_fetch_add(&(graph->share->references), 1);
+
+    pthread_mutex_lock(&(graph->family->lock));
+    graph->family->members++;
+    pthread_mutex_unlock(&(graph->family->lock));
+
+    // The component forest is rebuilt on demand rather than shared, since
+    // queries compress its paths
+    clone->node_count          = graph->node_count;
+    clone->directed_edge_count = graph->directed_edge_count;
+    clone->node_list           = graph->node_list;
+    clone->custom_free         = graph->custom_free;
+    clone->custom_compare      = graph->custom_compare;
+    clone->components          = NULL;
+    clone->node_index          = graph->node_index;
+    clone->nodes               = graph->nodes;
+    clone->links               = graph->links;
+    clone->node_capacity       = graph->node_capacity;
+    clone->share               = graph->share;
+    clone->family              = graph->family;
+
+END:
+    return clone;
+}
+
+// STATIC FUNCTIONS
+
+static node_t * graph_create_node(void * data)
+{
+    node_t * new_node = NULL;
+
+    if (NULL == data)
+    {
+        PRINT_DEBUG("graph_create_node(): NULL data passed.");
+        goto END;
+    }
+
+    new_node = calloc(1, sizeof(node_t));
+    if (NULL == new_node)
+    {
+        PRINT_DEBUG("graph_create_node(): CMR failure.");
+        goto END;
+    }
+
+    new_node->data       = data;
+    new_node->edge_count = 0;
+    atomic_init(&(new_node->references), 1);
+    new_node->edge_list  = list_new(edge_list_free, edge_compare);
+    if (NULL == new_node->edge_list)
+    {
+        PRINT_DEBUG("graph_create_node(): CMR failure.");
+        free(new_node);
+        new_node = NULL;
+        goto END;
+    }
+
+END:
+    return new_node;
+}
+
+static node_t * graph_find_node(graph_t * graph, void * data)
+{
+    list_node_t * list_node = NULL;
+    node_t *      node      = NULL;
+
+    if ((NULL == graph) || (NULL == data))
+    {
+        PRINT_DEBUG("graph_find_node(): NULL argument passed.");
+        goto END;
+    }
+
+    node = (node_t *)pointer_map_get(graph->node_index, data);
+    if (NULL != node)
+    {
+        goto END;
+    }
+
+    list_node = list_find_first_occurrence(graph->node_list, &data);
+    if (NULL == list_node)
+    {
+        PRINT_DEBUG("graph_find_node(): Unable to find first occurrence.");
+        goto END;
+    }
+
+    node = ((node_t *)list_node->data);
+
+END:
+    return node;
+}
+
+static edge_t * graph_find_edge(graph_t * graph,
+                                node_t *  node_1,
+                                node_t *  node_2)
+{
+    edge_t *      edge  = NULL;
+    list_node_t * entry = NULL;
+
+    if ((NULL == graph) || (NULL == node_1) || (NULL == node_2))
+    {
+        PRINT_DEBUG("graph_find_edge(): NULL argument passed.");
+        goto END;
+    }
+
+    // Every edge in node 1's edge list can be followed away from it
+    entry = find_entry(node_1, false, node_2, NULL);
+    if (NULL != entry)
+    {
+        edge = (edge_t *)entry->data;
+    }
+
+END:
+    return edge;
+}
+
+static list_node_t * find_entry(node_t *       node,
+                                bool           is_incoming,
+                                const node_t * other,
+                                const edge_t * match)
+{
+    list_t *        list  = is_incoming ? node->in_edge_list : node->edge_list;
+    pointer_map_t * index = is_incoming ? node->in_neighbors : node->neighbors;
+    list_node_t *   entry = NULL;
+    edge_t *        edge  = NULL;
+
+    if (NULL == list)
+    {
+        goto END;
+    }
+
+    if (NULL != index)
+    {
+        entry = (list_node_t *)pointer_map_get(index, other->data);
+        if ((NULL == entry) || (NULL == match) ||
+            same_edge((edge_t *)entry->data, match))
+        {
+            goto END;
+        }
+        // A parallel edge with another weight; only the list tells them apart
+    }
+
+    for (entry = list->head; NULL != entry; entry = entry->next)
+    {
+        edge = (edge_t *)entry->data;
+        if ((other->id == edge_neighbor(edge, node->id)) &&
+            ((NULL == match) || same_edge(edge, match)))
+        {
+            goto END;
+        }
+    }
+
+END:
+    return entry;
+}
+
+static int push_edge(graph_t *      graph,
+                     node_t *       node,
+                     bool           is_incoming,
+                     const edge_t * edge)
+{
+    int       exit_code = E_FAILURE;
+    list_t ** list      = NULL;
+    edge_t *  copy      = NULL;
+
+    list = is_incoming ? &(node->in_edge_list) : &(node->edge_list);
+    if (NULL == *list)
+    {
+        *list = list_new(edge_list_free, edge_compare);
+        if (NULL == *list)
+        {
+            PRINT_DEBUG("push_edge(): Unable to create edge list.");
+            goto END;
+        }
+    }
+
+    copy = malloc(sizeof(edge_t));
+    if (NULL == copy)
+    {
+        PRINT_DEBUG("push_edge(): CMR failure.");
+        goto END;
+    }
+    *copy = *edge;
+
+    if (E_SUCCESS != list_push_head(*list, copy))
+    {
+        PRINT_DEBUG("push_edge(): Unable to add edge to the list.");
+        free(copy);
+        goto END;
+    }
+
+    if (!is_incoming)
+    {
+        node->edge_count += 1;
+    }
+    index_edge(graph, node, is_incoming, (*list)->head);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void pop_edge(graph_t *     graph,
+                     node_t *      node,
+                     bool          is_incoming,
+                     list_node_t * entry)
+{
+    unindex_edge(graph, node, is_incoming, entry);
+
+    // The list frees the edge along with the entry
+    if (is_incoming)
+    {
+        list_remove_node(node->in_edge_list, entry);
+    }
+    else
+    {
+        list_remove_node(node->edge_list, entry);
+        node->edge_count -= 1;
+    }
+}
+
+static void drop_twin(graph_t *      graph,
+                      node_t *       node,
+                      const node_t * from,
+                      const edge_t * edge,
+                      bool           is_incoming)
+{
+    list_node_t * entry      = NULL;
+    bool          is_twin_in = (!is_incoming) && edge->is_directed;
+
+    // A one-way edge pairs a source's edge list with a target's in-edges
+    entry = find_entry(node, is_twin_in, from, edge);
+    if (NULL != entry)
+    {
+        pop_edge(graph, node, is_twin_in, entry);
+    }
+}
+
+static void index_edge(graph_t *     graph,
+                       node_t *      node,
+                       bool          is_incoming,
+                       list_node_t * entry)
+{
+    pointer_map_t ** index   = NULL;
+    list_t *         list    = NULL;
+    list_node_t *    current = NULL;
+    node_t *         other   = NULL;
+
+    index = is_incoming ? &(node->in_neighbors) : &(node->neighbors);
+    list  = is_incoming ? node->in_edge_list : node->edge_list;
+
+    if (NULL != *index)
+    {
+        other = graph->nodes[edge_neighbor((edge_t *)entry->data, node->id)];
+        if (E_SUCCESS != pointer_map_insert(*index, other->data, entry))
+        {
+            pointer_map_delete(index);
+        }
+        goto END;
+    }
+
+    if (GRAPH_NEIGHBOR_INDEX_DEGREE >= list->size)
+    {
+        goto END;
+    }
+
+    // Crossing the threshold: index every entry, including this one
+    *index  = pointer_map_new(list->size * 2);
+    current = list->head;
+    while ((NULL != *index) && (NULL != current))
+    {
+        other =
+            graph->nodes[edge_neighbor((edge_t *)current->data, node->id)];
+        if (E_SUCCESS != pointer_map_insert(*index, other->data, current))
+        {
+            pointer_map_delete(index);
+        }
+        current = current->next;
+    }
+
+END:
+    return;
+}
+
+static void unindex_edge(graph_t *     graph,
+                         node_t *      node,
+                         bool          is_incoming,
+                         list_node_t * entry)
+{
+    pointer_map_t * index = is_incoming ? node->in_neighbors : node->neighbors;
+    node_t *        other = NULL;
+
+    if (NULL != index)
+    {
+        other = graph->nodes[edge_neighbor((edge_t *)entry->data, node->id)];
+        pointer_map_remove(index, other->data, entry);
+    }
+}
+
+static uint32_t edge_neighbor(const edge_t * edge, uint32_t id)
+{
+    return (edge->id_1 == id) ? edge->id_2 : edge->id_1;
+}
+
+static bool same_edge(const edge_t * edge_a, const edge_t * edge_b)
+{
+    return (edge_a->id_1 == edge_b->id_1) && (edge_a->id_2 == edge_b->id_2) &&
+           (edge_a->weight == edge_b->weight) &&
+           (edge_a->is_directed == edge_b->is_directed);
+}
+
+static node_t * begin_traversal(graph_t *           graph,
+                                graph_workspace_t * workspace,
+                                void *              start_data)
+{
+    node_t * start_node = NULL;
+
+    if (workspace->capacity < graph->node_count)
+    {
+        PRINT_DEBUG("begin_traversal(): Workspace is too small for graph.");
+        goto END;
+    }
+
+    start_node = graph_find_node(graph, start_data);
+    if (NULL == start_node)
+    {
+        PRINT_DEBUG("begin_traversal(): Unable to find start node.");
+        goto END;
+    }
+
+    // Stamps from every earlier traversal become stale by moving the epoch on
+    workspace->epoch += 1;
+    if (0 == workspace->epoch)
+    {
+        memset(workspace->stamps, 0, workspace->capacity * sizeof(uint32_t));
+        workspace->epoch = 1;
+    }
+
+END:
+    return start_node;
+}
+
+static size_t add_saturated(size_t value_a, size_t value_b)
+{
+    return (value_a > (SIZE_MAX - value_b)) ? SIZE_MAX : (value_a + value_b);
+}
+
+static node_t ** collect_nodes(graph_t * graph)
+{
+    node_t **     nodes   = NULL;
+    list_node_t * current = NULL;
+    node_t *      node    = NULL;
+
+    nodes = calloc(graph->node_count + 1, sizeof(node_t *));
+    if (NULL == nodes)
+    {
+        PRINT_DEBUG("collect_nodes(): CMR failure.");
+        goto END;
+    }
+
+    current = graph->node_list->head;
+    while (NULL != current)
+    {
+        node            = (node_t *)current->data;
+        nodes[node->id] = node;
+        current         = current->next;
+    }
+
+END:
+    return nodes;
+}
+
+static int search_side_init(search_side_t * side, size_t node_count)
+{
+    int exit_code = E_FAILURE;
+
+    side->distance = calloc(node_count + 1, sizeof(size_t));
+    side->parent   = calloc(node_count + 1, sizeof(uint32_t));
+    side->frontier = priority_queue_new((uint32_t)node_count);
+    if ((NULL == side->distance) || (NULL == side->parent) ||
+        (NULL == side->frontier))
+    {
+        PRINT_DEBUG("search_side_init(): CMR failure.");
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < node_count; idx++)
+    {
+        side->distance[idx] = SIZE_MAX;
+        side->parent[idx]   = PRIORITY_QUEUE_ABSENT;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void search_side_destroy(search_side_t * side)
+{
+    free(side->distance);
+    free(side->parent);
+    if (NULL != side->frontier)
+    {
+        priority_queue_delete(&(side->frontier));
+    }
+    side->distance = NULL;
+    side->parent   = NULL;
+}
+
+static int search_path(graph_t *   graph,
+                       void *      start_data,
+                       void *      end_data,
+                       HEURISTIC_F heuristic,
+                       list_t **   path)
+{
+    int           exit_code  = E_FAILURE;
+    node_t **     nodes      = NULL;
+    node_t *      start_node = NULL;
+    node_t *      end_node   = NULL;
+    node_t *      neighbor   = NULL;
+    list_node_t * edge_node  = NULL;
+    edge_t *      edge       = NULL;
+    search_side_t side       = { 0 };
+    uint32_t      current    = 0;
+    size_t        candidate  = 0;
+    size_t        estimate   = 0;
+
+    *path = NULL;
+
+    start_node = graph_find_node(graph, start_data);
+    end_node   = graph_find_node(graph, end_data);
+    if ((NULL == start_node) || (NULL == end_node))
+    {
+        PRINT_DEBUG("search_path(): Unable to find node.");
+        goto END;
+    }
+
+    nodes = collect_nodes(graph);
+    if ((NULL == nodes) ||
+        (E_SUCCESS != search_side_init(&side, graph->node_count)))
+    {
+        PRINT_DEBUG("search_path(): CMR failure.");
+        goto END;
+    }
+
+    // The queue is keyed on distance plus heuristic; side.distance keeps the
+    // exact distance from the start
+    side.distance[start_node->id] = 0;
+    priority_queue_push(side.frontier, start_node->id, 0);
+
+    while (E_SUCCESS == priority_queue_pop(side.frontier, &current, NULL))
+    {
+        if (current == end_node->id)
+        {
+            break;
+        }
+
+        edge_node = nodes[current]->edge_list->head;
+        while (NULL != edge_node)
+        {
+            edge      = (edge_t *)edge_node->data;
+            neighbor  = nodes[edge_neighbor(edge, current)];
+            candidate = add_saturated(side.distance[current], edge->weight);
+
+            if (candidate < side.distance[neighbor->id])
+            {
+                side.distance[neighbor->id] = candidate;
+                side.parent[neighbor->id]   = current;
+
+                estimate = candidate;
+                if (NULL != heuristic)
+                {
+                    estimate = add_saturated(
+                        candidate, heuristic(neighbor->data, end_node->data));
+                }
+
+                // A node popped earlier re-enters the queue if the
+                // heuristic was not consistent
+                priority_queue_update(side.frontier, neighbor->id, estimate);
+            }
+
+            edge_node = edge_node->next;
+        }
+    }
+
+    if (SIZE_MAX == side.distance[end_node->id])
+    {
+        PRINT_DEBUG("search_path(): End node is unreachable.");
+        goto END;
+    }
+
+    *path = build_node_path(nodes, side.parent, NULL, end_node->id);
+    if (NULL == *path)
+    {
+        PRINT_DEBUG("search_path(): Unable to build path.");
+        goto END;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    search_side_destroy(&side);
+    free(nodes);
+    return exit_code;
+}
+
+static void relax(search_side_t *       side,
+                  const search_side_t * other,
+                  uint32_t              from,
+                  uint32_t              to,
+                  size_t                weight,
+                  size_t *              best,
+                  uint32_t *            meet)
+{
+    size_t candidate = add_saturated(side->distance[from], weight);
+    size_t total     = 0;
+
+    if (candidate < side->distance[to])
+    {
+        side->distance[to] = candidate;
+        side->parent[to]   = from;
+        priority_queue_update(side->frontier, to, candidate);
+    }
+
+    total = add_saturated(side->distance[to], other->distance[to]);
+    if (total < *best)
+    {
+        *best = total;
+        *meet = to;
+    }
+}
+
+static void expand_forward(search_side_t *       forward,
+                           const search_side_t * backward,
+                           node_t *              node,
+                           size_t *              best,
+                           uint32_t *            meet)
+{
+    list_node_t * edge_node = node->edge_list->head;
+    edge_t *      edge      = NULL;
+
+    while (NULL != edge_node)
+    {
+        edge = (edge_t *)edge_node->data;
+        relax(forward,
+              backward,
+              node->id,
+              edge_neighbor(edge, node->id),
+              edge->weight,
+              best,
+              meet);
+        edge_node = edge_node->next;
+    }
+}
+
+static void expand_backward(search_side_t *         backward,
+                            const search_side_t *   forward,
+                            node_t **               nodes,
+                            uint32_t                current,
+                            const reverse_index_t * reverse,
+                            size_t *                best,
+                            uint32_t *              meet)
+{
+    if (NULL == reverse)
+    {
+        // Every edge is undirected, so incoming and outgoing edges match
+        expand_forward(backward, forward, nodes[current], best, meet);
+        goto END;
+    }
+
+    for (size_t idx = reverse->offsets[current];
+         idx < reverse->offsets[current + 1];
+         idx++)
+    {
+        relax(backward,
+              forward,
+              current,
+              reverse->sources[idx],
+              reverse->weights[idx],
+              best,
+              meet);
+    }
+
+END:
+    return;
+}
+
+static reverse_index_t * reverse_index_create(graph_t * graph,
+                                              node_t ** nodes)
+{
+    reverse_index_t * reverse   = NULL;
+    list_node_t *     edge_node = NULL;
+    edge_t *          edge      = NULL;
+    uint32_t          target    = 0;
+    size_t            edges     = 0;
+    size_t *          cursor    = NULL;
+
+    reverse = calloc(1, sizeof(reverse_index_t));
+    if (NULL == reverse)
+    {
+        PRINT_DEBUG("reverse_index_create(): CMR failure.");
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < graph->node_count; idx++)
+    {
+        edges += nodes[idx]->edge_list->size;
+    }
+
+    reverse->offsets = calloc(graph->node_count + 1, sizeof(size_t));
+    reverse->sources = calloc(edges + 1, sizeof(uint32_t));
+    reverse->weights = calloc(edges + 1, sizeof(size_t));
+    cursor           = calloc(graph->node_count + 1, sizeof(size_t));
+    if ((NULL == reverse->offsets) || (NULL == reverse->sources) ||
+        (NULL == reverse->weights) || (NULL == cursor))
+    {
+        PRINT_DEBUG("reverse_index_create(): CMR failure.");
+        reverse_index_destroy(&reverse);
+        goto END;
+    }
+
+    // Count incoming edges per node, then bucket each edge under its target
+    for (size_t idx = 0; idx < graph->node_count; idx++)
+    {
+        for (edge_node = nodes[idx]->edge_list->head; NULL != edge_node;
+             edge_node = edge_node->next)
+        {
+            edge   = (edge_t *)edge_node->data;
+            target = edge_neighbor(edge, (uint32_t)idx);
+            reverse->offsets[target + 1]++;
+        }
+    }
+
+    for (size_t idx = 0; idx < graph->node_count; idx++)
+    {
+        reverse->offsets[idx + 1] += reverse->offsets[idx];
+        cursor[idx] = reverse->offsets[idx];
+    }
+
+    for (size_t idx = 0; idx < graph->node_count; idx++)
+    {
+        for (edge_node = nodes[idx]->edge_list->head; NULL != edge_node;
+             edge_node = edge_node->next)
+        {
+            edge   = (edge_t *)edge_node->data;
+            target = edge_neighbor(edge, (uint32_t)idx);
+            reverse->sources[cursor[target]] = (uint32_t)idx;
+            reverse->weights[cursor[target]] = edge->weight;
+            cursor[target]++;
+        }
+    }
+
+END:
+    free(cursor);
+    return reverse;
+}
+
+static void reverse_index_destroy(reverse_index_t ** reverse)
+{
+    if (NULL == *reverse)
+    {
+        goto END;
+    }
+
+    free((*reverse)->offsets);
+    free((*reverse)->sources);
+    free((*reverse)->weights);
+    free(*reverse);
+    *reverse = NULL;
+
+END:
+    return;
+}
+
+static list_t * build_node_path(node_t **        nodes,
+                                const uint32_t * parents,
+                                const uint32_t * successors,
+                                uint32_t         meet)
+{
+    list_t * path    = NULL;
+    uint32_t current = meet;
+
+    path = list_new(path_free, node_ptr_comp);
+    if (NULL == path)
+    {
+        PRINT_DEBUG("build_node_path(): Unable to create path list.");
+        goto END;
+    }
+
+    while (PRIORITY_QUEUE_ABSENT != current)
+    {
+        if (E_SUCCESS != list_push_head(path, nodes[current]->data))
+        {
+            PRINT_DEBUG("build_node_path(): Unable to extend path.");
+            list_delete(&path);
+            goto END;
+        }
+        current = parents[current];
+    }
+
+    current = (NULL == successors) ? PRIORITY_QUEUE_ABSENT : successors[meet];
+    while (PRIORITY_QUEUE_ABSENT != current)
+    {
+        if (E_SUCCESS != list_push_tail(path, nodes[current]->data))
+        {
+            PRINT_DEBUG("build_node_path(): Unable to extend path.");
+            list_delete(&path);
+            goto END;
+        }
+        current = successors[current];
+    }
+
+END:
+    return path;
+}
+
+static void path_free(void * data)
+{
+    (void)data;
+}
+
+static void component_list_free(void * data)
+{
+    list_t * members = (list_t *)data;
+
+    list_delete(&members);
+}
+
+static disjoint_set_t * graph_components(graph_t * graph)
+{
+    list_node_t * current   = NULL;
+    list_node_t * edge_node = NULL;
+    node_t *      node      = NULL;
+    edge_t *      edge      = NULL;
+
+    if (NULL != graph->components)
+    {
+        goto END;
+    }
+
+    graph->components = disjoint_set_new((uint32_t)graph->node_count);
+    if (NULL == graph->components)
+    {
+        PRINT_DEBUG("graph_components(): Unable to create forest.");
+        goto END;
+    }
+
+    // Every edge is in its first node's list, whatever its direction
+    current = graph->node_list->head;
+    while (NULL != current)
+    {
+        node      = (node_t *)current->data;
+        edge_node = node->edge_list->head;
+        while (NULL != edge_node)
+        {
+            edge = (edge_t *)edge_node->data;
+            if (node->id == edge->id_1)
+            {
+                disjoint_set_union(
+                    graph->components, edge->id_1, edge->id_2, NULL);
+            }
+            edge_node = edge_node->next;
+        }
+        current = current->next;
+    }
+
+END:
+    return graph->components;
+}
+
+static void drop_components(graph_t * graph)
+{
+    if (NULL != graph->components)
+    {
+        disjoint_set_delete(&(graph->components));
+    }
+}
+
+static int contracted_is_cyclic(graph_t *        graph,
+                                disjoint_set_t * forest,
+                                bool *           is_cyclic)
+{
+    int           exit_code = E_FAILURE;
+    size_t        count     = graph->node_count;
+    size_t *      offsets   = NULL;
+    uint32_t *    targets   = NULL;
+    uint32_t *    in_degree = NULL;
+    uint32_t *    queue     = NULL;
+    list_node_t * current   = NULL;
+    list_node_t * edge_node = NULL;
+    edge_t *      edge      = NULL;
+    uint32_t      from      = 0;
+    uint32_t      to        = 0;
+    size_t        head      = 0;
+    size_t        tail      = 0;
+    size_t        roots     = 0;
+
+    offsets   = calloc(count + 1, sizeof(size_t));
+    targets   = calloc(graph->directed_edge_count + 1, sizeof(uint32_t));
+    in_degree = calloc(count + 1, sizeof(uint32_t));
+    queue     = calloc(count + 1, sizeof(uint32_t));
+    if ((NULL == offsets) || (NULL == targets) || (NULL == in_degree) ||
+        (NULL == queue))
+    {
+        PRINT_DEBUG("contracted_is_cyclic(): CMR failure.");
+        goto END;
+    }
+
+    // Count one-way edges per tree, keyed by the tree's root
+    *is_cyclic = false;
+    current    = graph->node_list->head;
+    while (NULL != current)
+    {
+        edge_node = ((node_t *)current->data)->edge_list->head;
+        while (NULL != edge_node)
+        {
+            edge = (edge_t *)edge_node->data;
+            if (edge->is_directed)
+            {
+                from = disjoint_set_find(forest, edge->id_1);
+                to   = disjoint_set_find(forest, edge->id_2);
+                if (from == to)
+                {
+                    // Back to its own tree, which leads back to the start
+                    *is_cyclic = true;
+                    exit_code  = E_SUCCESS;
+                    goto END;
+                }
+                offsets[from]++;
+                in_degree[to]++;
+            }
+            edge_node = edge_node->next;
+        }
+        current = current->next;
+    }
+
+    /*
+     * Inclusive prefix sums leave offsets[root] at the end of the root's
+     * range; filling backwards then moves it to the start, so offsets[root]
+     * to offsets[root + 1] ends up spanning the root's targets.
+     */
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        offsets[idx + 1] += offsets[idx];
+    }
+
+    current = graph->node_list->head;
+    while (NULL != current)
+    {
+        edge_node = ((node_t *)current->data)->edge_list->head;
+        while (NULL != edge_node)
+        {
+            edge = (edge_t *)edge_node->data;
+            if (edge->is_directed)
+            {
+                from = disjoint_set_find(forest, edge->id_1);
+                to   = disjoint_set_find(forest, edge->id_2);
+                targets[--offsets[from]] = to;
+            }
+            edge_node = edge_node->next;
+        }
+        current = current->next;
+    }
+
+    // Kahn's algorithm: the trees can be ordered iff no cycle links them
+    for (uint32_t node = 0; node < count; node++)
+    {
+        if (node == disjoint_set_find(forest, node))
+        {
+            roots++;
+            if (0 == in_degree[node])
+            {
+                queue[tail++] = node;
+            }
+        }
+    }
+
+    while (head < tail)
+    {
+        from = queue[head++];
+        for (size_t idx = offsets[from]; idx < offsets[from + 1]; idx++)
+        {
+            to = targets[idx];
+            in_degree[to]--;
+            if (0 == in_degree[to])
+            {
+                queue[tail++] = to;
+            }
+        }
+    }
+
+    *is_cyclic = (tail < roots);
+
+    exit_code = E_SUCCESS;
+END:
+    free(offsets);
+    free(targets);
+    free(in_degree);
+    free(queue);
+    return exit_code;
+}
+
+static void release_data(graph_t * graph, void * data)
+{
+    if (NULL == graph->family)
+    {
+        graph->custom_free(data);
+        goto END;
+    }
+
+    pthread_mutex_lock(&(graph->family->lock));
+    if (1 < graph->family->members)
+    {
+        if ((NULL == pointer_map_get(graph->family->pending, data)) &&
+            (0 != pointer_map_insert(graph->family->pending, data, data)))
+        {
+            PRINT_DEBUG("release_data(): Unable to defer free, leaking.");
+        }
+    }
+    else
+    {
+        // Take it out first so the flush cannot free it a second time
+        pointer_map_remove(graph->family->pending, data, NULL);
+        flush_pending(graph);
+        graph->custom_free(data);
+    }
+    pthread_mutex_unlock(&(graph->family->lock));
+
+END:
+    return;
+}
+
+static void flush_pending(graph_t * graph)
+{
+    pointer_map_t * pending = graph->family->pending;
+    void *          data    = NULL;
+    bool            is_held = false;
+
+    if (0 == pending->size)
+    {
+        goto END;
+    }
+
+    // Data the graph still holds is its own again and is freed with its node
+    for (size_t slot = 0; slot < pending->capacity; slot++)
+    {
+        data = (void *)pending->entries[slot].key;
+        if (NULL == data)
+        {
+            continue;
+        }
+
+        is_held = (NULL != graph->node_index) &&
+                  (NULL != pointer_map_get(graph->node_index, data));
+        if (!is_held)
+        {
+            graph->custom_free(data);
+        }
+    }
+    pointer_map_clear(pending);
+
+END:
+    return;
+}
+
+static void leave_family(graph_t * graph)
+{
+    graph_family_t * family  = graph->family;
+    bool             is_last = false;
+
+    if (NULL == family)
+    {
+        goto END;
+    }
+
+    pthread_mutex_lock(&(family->lock));
+    family->members--;
+    is_last = (0 == family->members);
+    if (is_last)
+    {
+        flush_pending(graph);
+    }
+    pthread_mutex_unlock(&(family->lock));
+
+    if (is_last)
+    {
+        pointer_map_delete(&(family->pending));
+        pthread_mutex_destroy(&(family->lock));
+        free(family);
+    }
+    graph->family = NULL;
+
+END:
+    return;
+}
+
+static int unshare_graph(graph_t * graph)
+{
+    int             exit_code  = E_FAILURE;
+    list_t *        node_list  = NULL;
+    pointer_map_t * node_index = NULL;
+    node_t **       nodes      = NULL;
+    list_node_t **  links      = NULL;
+    list_node_t *   current    = NULL;
+    node_t *        node       = NULL;
+
+    if (NULL == graph->share)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    // Every other holder has already let go, so the table is ours
+    if (1 == atomic_load(&(graph->share->references)))
+    {
+        free(graph->share);
+        graph->share = NULL;
+        exit_code    = E_SUCCESS;
+        goto END;
+    }
+
+    node_list  = list_new(path_free, graph->custom_compare);
+    node_index = pointer_map_new(graph->node_count);
+    nodes      = calloc(graph->node_count + 1, sizeof(node_t *));
+    links      = calloc(graph->node_count + 1, sizeof(list_node_t *));
+    if ((NULL == node_list) || (NULL == node_index) || (NULL == nodes) ||
+        (NULL == links))
+    {
+        PRINT_DEBUG("unshare_graph(): CMR failure.");
+        goto CLEANUP_TABLE;
+    }
+
+    // Same order and IDs; the nodes themselves stay shared until changed
+    current = graph->node_list->head;
+    while (NULL != current)
+    {
+        node = (node_t *)current->data;
+        if ((E_SUCCESS != list_push_tail(node_list, node)) ||
+            (E_SUCCESS != pointer_map_insert(node_index, node->data, node)))
+        {
+            PRINT_DEBUG("unshare_graph(): Unable to copy the ID table.");
+            goto CLEANUP_TABLE;
+        }
+        nodes[node->id] = node;
+        links[node->id] = node_list->tail;
+        current         = current->next;
+    }
+
+    for (size_t idx = 0; idx < graph->node_count; idx++)
+    {
+        atomic_fetch_add(&(nodes[idx]->references), 1);
+    }
+
+    // The copy keeps the node IDs, so the component forest is still valid
+    if (release_share(graph))
+    {
+        free_table(
+            graph->node_list, graph->node_index, graph->nodes, graph->links);
+    }
+    graph->node_list     = node_list;
+    graph->node_index    = node_index;
+    graph->nodes         = nodes;
+    graph->links         = links;
+    graph->node_capacity = graph->node_count;
+
+    exit_code = E_SUCCESS;
+    goto END;
+
+CLEANUP_TABLE:
+    if (NULL != node_list)
+    {
+        list_delete(&node_list);
+    }
+    if (NULL != node_index)
+    {
+        pointer_map_delete(&node_index);
+    }
+    free(nodes);
+    free(links);
+END:
+    return exit_code;
+}
+
+static node_t * own_node(graph_t * graph, uint32_t id)
+{
+    node_t * node = graph->nodes[id];
+    node_t * copy = node;
+
+    // Only this graph's table holds the node, so no clone can see a change
+    if (1 == atomic_load(&(node->references)))
+    {
+        goto END;
+    }
+
+    copy = copy_node(graph, node);
+    if (NULL == copy)
+    {
+        goto END;
+    }
+
+    if (E_SUCCESS != pointer_map_insert(graph->node_index, copy->data, copy))
+    {
+        PRINT_DEBUG("own_node(): Unable to index copied node.");
+        release_node(copy);
+        copy = NULL;
+        goto END;
+    }
+    pointer_map_remove(graph->node_index, node->data, node);
+
+    graph->nodes[id]       = copy;
+    graph->links[id]->data = copy;
+    release_node(node);
+
+END:
+    return copy;
+}
+
+static node_t * copy_node(graph_t * graph, node_t * node)
+{
+    node_t *      copy    = NULL;
+    list_node_t * current = NULL;
+
+    copy = graph_create_node(node->data);
+    if (NULL == copy)
+    {
+        PRINT_DEBUG("copy_node(): Unable to create node.");
+        goto END;
+    }
+    copy->id = node->id;
+
+    // Pushing each list's entries from the tail keeps their order
+    for (current = node->edge_list->tail; NULL != current;
+         current = current->prev)
+    {
+        if (E_SUCCESS != push_edge(graph, copy, false, current->data))
+        {
+            PRINT_DEBUG("copy_node(): Unable to copy edge list.");
+            goto CLEANUP_COPY;
+        }
+    }
+
+    current = (NULL != node->in_edge_list) ? node->in_edge_list->tail : NULL;
+    for (; NULL != current; current = current->prev)
+    {
+        if (E_SUCCESS != push_edge(graph, copy, true, current->data))
+        {
+            PRINT_DEBUG("copy_node(): Unable to copy in-edges.");
+            goto CLEANUP_COPY;
+        }
+    }
+
+    goto END;
+
+CLEANUP_COPY:
+    release_node(copy);
+    copy = NULL;
+END:
+    return copy;
+}
+
+static int own_neighbors(graph_t * graph, node_t * node, uint32_t skip)
+{
+    int           exit_code = E_FAILURE;
+    list_t *      lists[2]  = { node->edge_list, node->in_edge_list };
+    list_node_t * current   = NULL;
+    uint32_t      neighbor  = 0;
+
+    for (size_t idx = 0; idx < 2; idx++)
+    {
+        current = (NULL != lists[idx]) ? lists[idx]->head : NULL;
+        for (; NULL != current; current = current->next)
+        {
+            neighbor = edge_neighbor((edge_t *)current->data, node->id);
+            if ((neighbor != node->id) && (neighbor != skip) &&
+                (NULL == own_node(graph, neighbor)))
+            {
+                goto END;
+            }
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void renumber_node(graph_t * graph, uint32_t from, uint32_t to)
+{
+    node_t *      node     = graph->nodes[from];
+    list_t *      lists[2] = { node->edge_list, node->in_edge_list };
+    list_node_t * current  = NULL;
+    list_node_t * twin     = NULL;
+    edge_t *      edge     = NULL;
+    uint32_t      neighbor = 0;
+
+    for (size_t idx = 0; idx < 2; idx++)
+    {
+        current = (NULL != lists[idx]) ? lists[idx]->head : NULL;
+        for (; NULL != current; current = current->next)
+        {
+            edge     = (edge_t *)current->data;
+            neighbor = edge_neighbor(edge, from);
+
+            // Find the neighbour's copy while both still carry the old ID
+            if (neighbor != from)
+            {
+                twin = find_entry(graph->nodes[neighbor],
+                                  (0 == idx) && edge->is_directed,
+                                  node,
+                                  edge);
+                if (NULL != twin)
+                {
+                    ((edge_t *)twin->data)->id_1 =
+                        (edge->id_1 == from) ? to : edge->id_1;
+                    ((edge_t *)twin->data)->id_2 =
+                        (edge->id_2 == from) ? to : edge->id_2;
+                }
+            }
+
+            edge->id_1 = (edge->id_1 == from) ? to : edge->id_1;
+            edge->id_2 = (edge->id_2 == from) ? to : edge->id_2;
+        }
+    }
+
+    // Neighbour indexes are keyed by node data, so they need no change
+    node->id           = to;
+    graph->nodes[to]   = node;
+    graph->links[to]   = graph->links[from];
+    graph->nodes[from] = NULL;
+    graph->links[from] = NULL;
+}
+
+static void release_node(node_t * node)
+{
+    if (1 != atomic_fetch_sub(&(node->references), 1))
+    {
+        goto END;
+    }
+
+    if (NULL != node->neighbors)
+    {
+        pointer_map_delete(&(node->neighbors));
+    }
+    if (NULL != node->in_neighbors)
+    {
+        pointer_map_delete(&(node->in_neighbors));
+    }
+    list_delete(&(node->edge_list));
+    if (NULL != node->in_edge_list)
+    {
+        list_delete(&(node->in_edge_list));
+    }
+    free(node);
+
+END:
+    return;
+}
+
+static void free_table(list_t *        node_list,
+                       pointer_map_t * node_index,
+                       node_t **       nodes,
+                       list_node_t **  links)
+{
+    list_node_t * current = NULL;
+
+    if (NULL != node_list)
+    {
+        current = node_list->head;
+        while (NULL != current)
+        {
+            release_node((node_t *)current->data);
+            current = current->next;
+        }
+        list_delete(&node_list);
+    }
+
+    if (NULL != node_index)
+    {
+        pointer_map_delete(&node_index);
+    }
+    free(nodes);
+    free(links);
+}
+
+static bool release_share(graph_t * graph)
+{
+    bool is_last = (1 == atomic_fetch_sub(&(graph->share->references), 1));
+
+    if (is_last)
+    {
+        free(graph->share);
+    }
+    graph->share = NULL;
+
+    return is_last;
+}
+
+static graph_source_t * find_source(const graph_paths_t * paths, uint32_t id)
+{
+    graph_source_t * source = NULL;
+
+    for (size_t idx = 0; idx < paths->count; idx++)
+    {
+        if (id == paths->sources[idx].id)
+        {
+            source = &paths->sources[idx];
+            break;
+        }
+    }
+
+    return source;
+}
+
+static int resize_paths(graph_paths_t * paths, size_t slots)
+{
+    int                exit_code = E_FAILURE;
+    graph_source_t *   source    = NULL;
+    size_t *           distances = NULL;
+    uint32_t *         parents   = NULL;
+    priority_queue_t * queue     = NULL;
+    uint32_t *         scratch   = NULL;
+    uint8_t *          marks     = NULL;
+
+    // Arrays only grow, so a failure part way leaves every source usable
+    for (size_t idx = 0; idx < paths->count; idx++)
+    {
+        source    = &paths->sources[idx];
+        distances = realloc(source->distances, slots * sizeof(size_t));
+        if (NULL != distances)
+        {
+            source->distances = distances;
+        }
+        parents = realloc(source->parents, slots * sizeof(uint32_t));
+        if (NULL != parents)
+        {
+            source->parents = parents;
+        }
+        if ((NULL == distances) || (NULL == parents))
+        {
+            goto END;
+        }
+    }
+
+    // One entry more than needed keeps an empty graph's arrays valid
+    queue   = priority_queue_new((uint32_t)slots);
+    scratch = calloc((3 * slots) + 1, sizeof(uint32_t));
+    marks   = calloc(slots + 1, sizeof(uint8_t));
+    if ((NULL == queue) || (NULL == scratch) || (NULL == marks))
+    {
+        priority_queue_delete(&queue);
+        free(scratch);
+        free(marks);
+        goto END;
+    }
+
+    priority_queue_delete(&paths->queue);
+    free(paths->scratch);
+    free(paths->marks);
+    paths->queue   = queue;
+    paths->scratch = scratch;
+    paths->marks   = marks;
+    paths->slots   = slots;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void compute_source(graph_paths_t * paths, graph_source_t * source)
+{
+    for (size_t idx = 0; idx < paths->graph->node_count; idx++)
+    {
+        source->distances[idx] = GRAPH_DISTANCE_INFINITY;
+        source->parents[idx]   = PRIORITY_QUEUE_ABSENT;
+    }
+
+    source->distances[source->id] = 0;
+    priority_queue_push(paths->queue, source->id, 0);
+    settle_paths(paths, source, false);
+}
+
+static void lower_edge(graph_paths_t *  paths,
+                       graph_source_t * source,
+                       uint32_t         from,
+                       uint32_t         to,
+                       size_t           weight)
+{
+    size_t sum = add_saturated(source->distances[from], weight);
+
+    if (sum < source->distances[to])
+    {
+        source->distances[to] = sum;
+        source->parents[to]   = from;
+        priority_queue_update(paths->queue, to, sum);
+    }
+}
+
+static void raise_edge(graph_paths_t *  paths,
+                       graph_source_t * source,
+                       uint32_t         root,
+                       bool             is_removed)
+{
+    size_t     node_count   = paths->graph->node_count;
+    uint32_t * first_child  = paths->scratch;
+    uint32_t * next_sibling = &paths->scratch[paths->slots];
+    uint32_t * subtree      = &paths->scratch[2 * paths->slots];
+    size_t *   distances    = source->distances;
+    uint32_t * parents      = source->parents;
+    uint8_t *  marks        = paths->marks;
+    size_t     size         = 0;
+    size_t     distance     = 0;
+    uint32_t   node         = 0;
+    uint32_t   parent       = 0;
+
+    for (size_t idx = 0; idx < node_count; idx++)
+    {
+        first_child[idx] = PRIORITY_QUEUE_ABSENT;
+    }
+    for (size_t idx = 0; idx < node_count; idx++)
+    {
+        parent = parents[idx];
+        if (PRIORITY_QUEUE_ABSENT != parent)
+        {
+            next_sibling[idx]   = first_child[parent];
+            first_child[parent] = (uint32_t)idx;
+        }
+    }
+
+    // Every node whose path can lengthen is in the subtree below the edge
+    subtree[size++] = root;
+    marks[root]     = REPAIR_PENDING;
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        for (node = first_child[subtree[idx]]; PRIORITY_QUEUE_ABSENT != node;
+             node = next_sibling[node])
+        {
+            subtree[size++] = node;
+            marks[node]     = REPAIR_PENDING;
+        }
+    }
+
+    // A node being removed keeps no path and lends none to the others
+    if (is_removed)
+    {
+        marks[root] = REPAIR_AFFECTED;
+    }
+
+    // Nearest first, a node keeps its distance when a node outside the
+    // subtree, or one that kept its own, still reaches it as cheaply
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        node = subtree[idx];
+        if (REPAIR_PENDING == marks[node])
+        {
+            priority_queue_push(paths->queue, node, distances[node]);
+        }
+    }
+    while (E_SUCCESS == priority_queue_pop(paths->queue, &node, NULL))
+    {
+        parent = best_parent(paths, source, node, &distance);
+        if ((PRIORITY_QUEUE_ABSENT != parent) && (distance == distances[node]))
+        {
+            parents[node] = parent;
+            marks[node]   = REPAIR_KEPT;
+        }
+        else
+        {
+            marks[node] = REPAIR_AFFECTED;
+        }
+    }
+
+    // The rest start from their best neighbour outside the affected region,
+    // then settle among themselves
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        node = subtree[idx];
+        if (REPAIR_AFFECTED == marks[node])
+        {
+            distances[node] = GRAPH_DISTANCE_INFINITY;
+            parents[node]   = PRIORITY_QUEUE_ABSENT;
+        }
+    }
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        node = subtree[idx];
+        if ((REPAIR_AFFECTED != marks[node]) || (is_removed && (root == node)))
+        {
+            continue;
+        }
+        parent = best_parent(paths, source, node, &distance);
+        if (PRIORITY_QUEUE_ABSENT != parent)
+        {
+            distances[node] = distance;
+            parents[node]   = parent;
+            priority_queue_push(paths->queue, node, distance);
+        }
+    }
+    settle_paths(paths, source, true);
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        marks[subtree[idx]] = REPAIR_UNTOUCHED;
+    }
+}
+
+static uint32_t best_parent(const graph_paths_t *  paths,
+                            const graph_source_t * source,
+                            uint32_t               id,
+                            size_t *               distance)
+{
+    const node_t * node     = paths->graph->nodes[id];
+    list_t *       lists[2] = { node->edge_list, node->in_edge_list };
+    list_node_t *  current  = NULL;
+    const edge_t * edge     = NULL;
+    uint32_t       best     = PRIORITY_QUEUE_ABSENT;
+    uint32_t       from     = 0;
+    size_t         sum      = 0;
+
+    *distance = GRAPH_DISTANCE_INFINITY;
+    for (size_t idx = 0; idx < 2; idx++)
+    {
+        current = (NULL != lists[idx]) ? lists[idx]->head : NULL;
+        for (; NULL != current; current = current->next)
+        {
+            edge = (const edge_t *)current->data;
+            from = edge_neighbor(edge, id);
+
+            // One-way edges in the node's own edge list lead out of it
+            if (((0 == idx) && edge->is_directed) || (from == id) ||
+                (REPAIR_PENDING == paths->marks[from]) ||
+                (REPAIR_AFFECTED == paths->marks[from]))
+            {
+                continue;
+            }
+
+            sum = add_saturated(source->distances[from], edge->weight);
+            if (sum < *distance)
+            {
+                *distance = sum;
+                best      = from;
+            }
+        }
+    }
+
+    return best;
+}
+
+static void settle_paths(graph_paths_t *  paths,
+                         graph_source_t * source,
+                         bool             only_affected)
+{
+    node_t **      nodes     = paths->graph->nodes;
+    size_t *       distances = source->distances;
+    list_node_t *  current   = NULL;
+    const edge_t * edge      = NULL;
+    uint32_t       item      = 0;
+    uint32_t       next      = 0;
+    size_t         sum       = 0;
+
+    while (E_SUCCESS == priority_queue_pop(paths->queue, &item, NULL))
+    {
+        for (current = nodes[item]->edge_list->head; NULL != current;
+             current = current->next)
+        {
+            edge = (const edge_t *)current->data;
+            next = edge_neighbor(edge, item);
+            if (only_affected && (REPAIR_AFFECTED != paths->marks[next]))
+            {
+                continue;
+            }
+
+            sum = add_saturated(distances[item], edge->weight);
+            if (sum >= distances[next])
+            {
+                continue;
+            }
+            distances[next]       = sum;
+            source->parents[next] = item;
+            priority_queue_update(paths->queue, next, sum);
+        }
+    }
+}
+
+static void notify_edge_added(graph_t * graph, const edge_t * edge)
+{
+    graph_paths_t *  paths  = graph->paths;
+    graph_source_t * source = NULL;
+
+    while (NULL != paths)
+    {
+        for (size_t idx = 0; (!paths->is_stale) && (idx < paths->count); idx++)
+        {
+            source = &paths->sources[idx];
+            lower_edge(paths, source, edge->id_1, edge->id_2, edge->weight);
+            if (!edge->is_directed)
+            {
+                lower_edge(
+                    paths, source, edge->id_2, edge->id_1, edge->weight);
+            }
+            settle_paths(paths, source, false);
+        }
+        paths = paths->next;
+    }
+}
+
+static void notify_edge_removed(graph_t * graph, const edge_t * edge)
+{
+    graph_paths_t *  paths  = graph->paths;
+    graph_source_t * source = NULL;
+
+    while (NULL != paths)
+    {
+        for (size_t idx = 0; (!paths->is_stale) && (idx < paths->count); idx++)
+        {
+            // Only an edge of the shortest path tree can lengthen a path
+            source = &paths->sources[idx];
+            if (edge->id_1 == source->parents[edge->id_2])
+            {
+                raise_edge(paths, source, edge->id_2, false);
+            }
+            else if ((!edge->is_directed) &&
+                     (edge->id_2 == source->parents[edge->id_1]))
+            {
+                raise_edge(paths, source, edge->id_1, false);
+            }
+        }
+        paths = paths->next;
+    }
+}
+
+static void notify_node_added(graph_t * graph)
+{
+    graph_paths_t * paths = graph->paths;
+    uint32_t        id    = (uint32_t)(graph->node_count - 1);
+
+    while (NULL != paths)
+    {
+        if ((!paths->is_stale) && (graph->node_count > paths->slots) &&
+            (E_SUCCESS != resize_paths(paths, graph->node_capacity)))
+        {
+            PRINT_DEBUG("notify_node_added(): CMR failure, paths now stale.");
+            paths->is_stale = true;
+        }
+
+        // The new node has no edges yet, so no other path changes
+        for (size_t idx = 0; (!paths->is_stale) && (idx < paths->count); idx++)
+        {
+            paths->sources[idx].distances[id] = GRAPH_DISTANCE_INFINITY;
+            paths->sources[idx].parents[id]   = PRIORITY_QUEUE_ABSENT;
+        }
+        paths = paths->next;
+    }
+}
+
+static void notify_node_removed(graph_t * graph, uint32_t id)
+{
+    graph_paths_t *  paths  = graph->paths;
+    graph_source_t * source = NULL;
+
+    while (NULL != paths)
+    {
+        // A source at the node goes with it; the last source fills the gap
+        source = find_source(paths, id);
+        if (NULL != source)
+        {
+            free(source->distances);
+            free(source->parents);
+            *source = paths->sources[--paths->count];
+        }
+
+        // Only the nodes reached through it lose their paths
+        for (size_t idx = 0; (!paths->is_stale) && (idx < paths->count); idx++)
+        {
+            source = &paths->sources[idx];
+            if (GRAPH_DISTANCE_INFINITY != source->distances[id])
+            {
+                raise_edge(paths, source, id, true);
+            }
+        }
+        paths = paths->next;
+    }
+}
+
+static void renumber_paths(graph_t * graph, uint32_t from, uint32_t to)
+{
+    graph_paths_t *  paths   = graph->paths;
+    graph_source_t * source  = NULL;
+    list_node_t *    current = NULL;
+    uint32_t         next    = 0;
+
+    while (NULL != paths)
+    {
+        for (size_t idx = 0; idx < paths->count; idx++)
+        {
+            source     = &paths->sources[idx];
+            source->id = (from == source->id) ? to : source->id;
+            if (paths->is_stale)
+            {
+                continue;
+            }
+
+            source->distances[to] = source->distances[from];
+            source->parents[to]   = source->parents[from];
+
+            // Only the node's out-neighbours can have it as their parent
+            for (current = graph->nodes[to]->edge_list->head; NULL != current;
+                 current = current->next)
+            {
+                next = edge_neighbor((const edge_t *)current->data, to);
+                if (from == source->parents[next])
+                {
+                    source->parents[next] = to;
+                }
+            }
+        }
+        paths = paths->next;
+    }
+}
+
+static void clear_paths(graph_t * graph)
+{
+    graph_paths_t * paths = graph->paths;
+
+    while (NULL != paths)
+    {
+        for (size_t idx = 0; idx < paths->count; idx++)
+        {
+            free(paths->sources[idx].distances);
+            free(paths->sources[idx].parents);
+        }
+        paths->count    = 0;
+        paths->is_stale = false;
+        paths           = paths->next;
+    }
 }
 
 /*** end of file ***/
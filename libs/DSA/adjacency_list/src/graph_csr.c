@@ -0,0 +1,660 @@
+#include <stdlib.h>
+
+#include "graph_csr.h"
+#include "priority_queue.h"
+#include "utilities.h"
+
+#define BITS_PER_WORD 64
+
+/**
+ * @brief Pairs an address with the index of the node it belongs to.
+ */
+typedef struct
+{
+    const void * address;
+    uint32_t     index;
+} address_entry_t;
+
+/**
+ * @brief Orders address entries by address, for qsort() and bsearch().
+ */
+static int address_compare(const void * entry_a, const void * entry_b);
+
+/**
+ * @brief Finds the index paired with 'address' in a sorted entry array.
+ *
+ * @return The index, or GRAPH_CSR_NO_NODE if it is not present.
+ */
+static uint32_t address_lookup(const address_entry_t * entries,
+                               uint32_t                count,
+                               const void *            address);
+
+/**
+ * @brief Fills the offsets, neighbors and weights arrays of the snapshot.
+ *
+ * @param csr The snapshot, with node_count and edge_count already set.
+ * @param graph The graph, whose node IDs the edges refer to.
+ * @param nodes The graph's nodes, by index.
+ * @param node_entries Node pointers paired with their index, sorted.
+ * @return E_SUCCESS on success, or E_FAILURE on failure.
+ */
+static int fill_rows(graph_csr_t *           csr,
+                     graph_t *               graph,
+                     node_t **               nodes,
+                     const address_entry_t * node_entries);
+
+/**
+ * @brief Fills the sorted data lookup arrays of the snapshot.
+ *
+ * @param csr The snapshot, with node_data already set.
+ * @param entries Scratch space for node_count entries.
+ */
+static void fill_data_lookup(graph_csr_t * csr, address_entry_t * entries);
+
+/**
+ * @brief Tests and sets a node's bit in a visited bitset.
+ *
+ * @return true if the bit was already set, false otherwise.
+ */
+static bool test_and_set(uint64_t * visited, uint32_t node);
+
+/**
+ * @brief Checks a node's bit in a visited bitset.
+ */
+static bool is_visited(const uint64_t * visited, uint32_t node);
+
+/**
+ * @brief Builds the list of node data from 'start' to 'end' by following
+ * parent links.
+ *
+ * @return Pointer to the new list, or NULL on failure.
+ */
+static list_t * build_path(const graph_csr_t * csr,
+                           const uint32_t *    parents,
+                           uint32_t            end);
+
+/**
+ * @brief Free function for path lists, which do not own the node data.
+ */
+static void path_free(void * data);
+
+graph_csr_t * graph_freeze(graph_t * graph)
+{
+    int               exit_code    = E_FAILURE;
+    graph_csr_t *     csr          = NULL;
+    node_t **         nodes        = NULL;
+    address_entry_t * node_entries = NULL;
+    list_node_t *     current      = NULL;
+    uint32_t          index        = 0;
+
+    if ((NULL == graph) || (NULL == graph->node_list))
+    {
+        PRINT_DEBUG("graph_freeze(): NULL argument passed.");
+        goto END;
+    }
+
+    if (UINT32_MAX <= graph->node_list->size)
+    {
+        PRINT_DEBUG("graph_freeze(): Too many nodes.");
+        goto END;
+    }
+
+    csr = calloc(1, sizeof(graph_csr_t));
+    if (NULL == csr)
+    {
+        PRINT_DEBUG("graph_freeze(): CMR failure.");
+        goto END;
+    }
+
+    csr->node_count = graph->node_list->size;
+
+    // Allocate at least one entry so empty graphs need no special cases
+    nodes        = calloc(csr->node_count + 1, sizeof(node_t *));
+    node_entries = calloc(csr->node_count + 1, sizeof(address_entry_t));
+    csr->offsets = calloc(csr->node_count + 1, sizeof(size_t));
+    csr->node_data  = calloc(csr->node_count + 1, sizeof(void *));
+    csr->data_keys  = calloc(csr->node_count + 1, sizeof(void *));
+    csr->data_index = calloc(csr->node_count + 1, sizeof(uint32_t));
+    if ((NULL == nodes) || (NULL == node_entries) || (NULL == csr->offsets) ||
+        (NULL == csr->node_data) || (NULL == csr->data_keys) ||
+        (NULL == csr->data_index))
+    {
+        PRINT_DEBUG("graph_freeze(): CMR failure.");
+        goto END;
+    }
+
+    // Number the nodes in list order and count the edges
+    current = graph->node_list->head;
+    for (index = 0; index < csr->node_count; index++)
+    {
+        nodes[index]                = (node_t *)current->data;
+        node_entries[index].address = nodes[index];
+        node_entries[index].index   = index;
+        csr->node_data[index]       = nodes[index]->data;
+        csr->edge_count += nodes[index]->edge_list->size;
+        current = current->next;
+    }
+
+    csr->neighbors = calloc(csr->edge_count + 1, sizeof(uint32_t));
+    csr->weights   = calloc(csr->edge_count + 1, sizeof(size_t));
+    if ((NULL == csr->neighbors) || (NULL == csr->weights))
+    {
+        PRINT_DEBUG("graph_freeze(): CMR failure.");
+        goto END;
+    }
+
+    qsort(node_entries,
+          csr->node_count,
+          sizeof(address_entry_t),
+          address_compare);
+
+    exit_code = fill_rows(csr, graph, nodes, node_entries);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("graph_freeze(): Unable to fill rows.");
+        goto END;
+    }
+
+    fill_data_lookup(csr, node_entries);
+
+    exit_code = E_SUCCESS;
+END:
+    if ((E_SUCCESS != exit_code) && (NULL != csr))
+    {
+        graph_csr_destroy(&csr);
+    }
+    free(nodes);
+    free(node_entries);
+    return csr;
+}
+
+int graph_csr_destroy(graph_csr_t ** csr)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == csr) || (NULL == *csr))
+    {
+        PRINT_DEBUG("graph_csr_destroy(): NULL argument passed.");
+        goto END;
+    }
+
+    free((*csr)->offsets);
+    free((*csr)->neighbors);
+    free((*csr)->weights);
+    free((*csr)->node_data);
+    free((*csr)->data_keys);
+    free((*csr)->data_index);
+    free((*csr)->owned_data);
+    free(*csr);
+    *csr = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+uint32_t graph_csr_node_index(const graph_csr_t * csr, const void * data)
+{
+    uint32_t index = GRAPH_CSR_NO_NODE;
+    uint32_t low   = 0;
+    uint32_t high  = 0;
+    uint32_t mid   = 0;
+
+    if ((NULL == csr) || (NULL == data))
+    {
+        PRINT_DEBUG("graph_csr_node_index(): NULL argument passed.");
+        goto END;
+    }
+
+    high = csr->node_count;
+    while (low < high)
+    {
+        mid = low + ((high - low) / 2);
+        if ((uintptr_t)csr->data_keys[mid] < (uintptr_t)data)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if ((low < csr->node_count) && (csr->data_keys[low] == data))
+    {
+        index = csr->data_index[low];
+    }
+
+END:
+    return index;
+}
+
+int graph_csr_dfs(const graph_csr_t * csr, void * start_data, ACTION_F action)
+{
+    int        exit_code   = E_FAILURE;
+    uint64_t * visited     = NULL;
+    uint32_t * stack       = NULL;
+    uint32_t   stack_count = 0;
+    uint32_t   start       = GRAPH_CSR_NO_NODE;
+    uint32_t   current     = 0;
+
+    if ((NULL == csr) || (NULL == start_data) || (NULL == action))
+    {
+        PRINT_DEBUG("graph_csr_dfs(): NULL argument passed.");
+        goto END;
+    }
+
+    start = graph_csr_node_index(csr, start_data);
+    if (GRAPH_CSR_NO_NODE == start)
+    {
+        PRINT_DEBUG("graph_csr_dfs(): Unable to find start node.");
+        goto END;
+    }
+
+    // Nodes are marked when popped, which gives true preorder; a node is
+    // pushed once per edge into it, so the stack holds at most E + 1 entries
+    visited = calloc((csr->node_count / BITS_PER_WORD) + 1, sizeof(uint64_t));
+    stack   = calloc(csr->edge_count + 1, sizeof(uint32_t));
+    if ((NULL == visited) || (NULL == stack))
+    {
+        PRINT_DEBUG("graph_csr_dfs(): CMR failure.");
+        goto END;
+    }
+
+    stack[stack_count++] = start;
+
+    while (0 != stack_count)
+    {
+        current = stack[--stack_count];
+        if (test_and_set(visited, current))
+        {
+            continue;
+        }
+        action(csr->node_data[current]);
+
+        // Pushed in reverse, so the first neighbour is explored first
+        for (size_t edge = csr->offsets[current + 1];
+             edge > csr->offsets[current];
+             edge--)
+        {
+            if (!is_visited(visited, csr->neighbors[edge - 1]))
+            {
+                stack[stack_count++] = csr->neighbors[edge - 1];
+            }
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(visited);
+    free(stack);
+    return exit_code;
+}
+
+int graph_csr_bfs(const graph_csr_t * csr, void * start_data, ACTION_F action)
+{
+    int        exit_code = E_FAILURE;
+    uint64_t * visited   = NULL;
+    uint32_t * queue     = NULL;
+    uint32_t   head      = 0;
+    uint32_t   tail      = 0;
+    uint32_t   start     = GRAPH_CSR_NO_NODE;
+    uint32_t   current   = 0;
+
+    if ((NULL == csr) || (NULL == start_data) || (NULL == action))
+    {
+        PRINT_DEBUG("graph_csr_bfs(): NULL argument passed.");
+        goto END;
+    }
+
+    start = graph_csr_node_index(csr, start_data);
+    if (GRAPH_CSR_NO_NODE == start)
+    {
+        PRINT_DEBUG("graph_csr_bfs(): Unable to find start node.");
+        goto END;
+    }
+
+    // Every node is enqueued at most once, so a flat array is enough
+    visited = calloc((csr->node_count / BITS_PER_WORD) + 1, sizeof(uint64_t));
+    queue   = calloc(csr->node_count, sizeof(uint32_t));
+    if ((NULL == visited) || (NULL == queue))
+    {
+        PRINT_DEBUG("graph_csr_bfs(): CMR failure.");
+        goto END;
+    }
+
+    test_and_set(visited, start);
+    queue[tail++] = start;
+
+    while (head != tail)
+    {
+        current = queue[head++];
+        action(csr->node_data[current]);
+
+        for (size_t edge = csr->offsets[current];
+             edge < csr->offsets[current + 1];
+             edge++)
+        {
+            if (!test_and_set(visited, csr->neighbors[edge]))
+            {
+                queue[tail++] = csr->neighbors[edge];
+            }
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(visited);
+    free(queue);
+    return exit_code;
+}
+
+int graph_csr_bfs_hops(const graph_csr_t * csr,
+                       uint32_t            start,
+                       uint32_t *          hops)
+{
+    int        exit_code = E_FAILURE;
+    uint32_t * queue     = NULL;
+    uint32_t   head      = 0;
+    uint32_t   tail      = 0;
+    uint32_t   current   = 0;
+    uint32_t   neighbor  = 0;
+
+    if ((NULL == csr) || (NULL == hops))
+    {
+        PRINT_DEBUG("graph_csr_bfs_hops(): NULL argument passed.");
+        goto END;
+    }
+
+    if (start >= csr->node_count)
+    {
+        PRINT_DEBUG("graph_csr_bfs_hops(): Start node out of range.");
+        goto END;
+    }
+
+    queue = calloc(csr->node_count, sizeof(uint32_t));
+    if (NULL == queue)
+    {
+        PRINT_DEBUG("graph_csr_bfs_hops(): CMR failure.");
+        goto END;
+    }
+
+    for (uint32_t idx = 0; idx < csr->node_count; idx++)
+    {
+        hops[idx] = UINT32_MAX;
+    }
+
+    hops[start]   = 0;
+    queue[tail++] = start;
+
+    while (head != tail)
+    {
+        current = queue[head++];
+
+        for (size_t edge = csr->offsets[current];
+             edge < csr->offsets[current + 1];
+             edge++)
+        {
+            neighbor = csr->neighbors[edge];
+            if (UINT32_MAX == hops[neighbor])
+            {
+                hops[neighbor] = hops[current] + 1;
+                queue[tail++]  = neighbor;
+            }
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(queue);
+    return exit_code;
+}
+
+int graph_csr_shortest_path(const graph_csr_t * csr,
+                            void *              start_data,
+                            void *              end_data,
+                            list_t **           path,
+                            size_t *            distance)
+{
+    int                exit_code = E_FAILURE;
+    size_t *           distances = NULL;
+    uint32_t *         parents   = NULL;
+    priority_queue_t * frontier  = NULL;
+    uint32_t           start     = GRAPH_CSR_NO_NODE;
+    uint32_t           end       = GRAPH_CSR_NO_NODE;
+    uint32_t           current   = 0;
+    uint32_t           neighbor  = 0;
+    size_t             candidate = 0;
+
+    if ((NULL == csr) || (NULL == start_data) || (NULL == end_data) ||
+        (NULL == path))
+    {
+        PRINT_DEBUG("graph_csr_shortest_path(): NULL argument passed.");
+        goto END;
+    }
+
+    *path = NULL;
+
+    start = graph_csr_node_index(csr, start_data);
+    end   = graph_csr_node_index(csr, end_data);
+    if ((GRAPH_CSR_NO_NODE == start) || (GRAPH_CSR_NO_NODE == end))
+    {
+        PRINT_DEBUG("graph_csr_shortest_path(): Unable to find node.");
+        goto END;
+    }
+
+    distances = calloc(csr->node_count, sizeof(size_t));
+    parents   = calloc(csr->node_count, sizeof(uint32_t));
+    frontier  = priority_queue_new(csr->node_count);
+    if ((NULL == distances) || (NULL == parents) || (NULL == frontier))
+    {
+        PRINT_DEBUG("graph_csr_shortest_path(): CMR failure.");
+        goto END;
+    }
+
+    for (uint32_t idx = 0; idx < csr->node_count; idx++)
+    {
+        distances[idx] = GRAPH_CSR_INFINITY;
+        parents[idx]   = GRAPH_CSR_NO_NODE;
+    }
+
+    distances[start] = 0;
+    priority_queue_push(frontier, start, 0);
+
+    while (E_SUCCESS == priority_queue_pop(frontier, &current, NULL))
+    {
+        if (end == current)
+        {
+            break;
+        }
+
+        for (size_t edge = csr->offsets[current];
+             edge < csr->offsets[current + 1];
+             edge++)
+        {
+            neighbor  = csr->neighbors[edge];
+            candidate = distances[current] + csr->weights[edge];
+            if (candidate < distances[current])
+            {
+                candidate = GRAPH_CSR_INFINITY; // Saturate on overflow
+            }
+
+            if (candidate < distances[neighbor])
+            {
+                distances[neighbor] = candidate;
+                parents[neighbor]   = current;
+                priority_queue_update(frontier, neighbor, candidate);
+            }
+        }
+    }
+
+    if (GRAPH_CSR_INFINITY == distances[end])
+    {
+        PRINT_DEBUG("graph_csr_shortest_path(): No path between nodes.");
+        goto END;
+    }
+
+    *path = build_path(csr, parents, end);
+    if (NULL == *path)
+    {
+        PRINT_DEBUG("graph_csr_shortest_path(): Unable to build path.");
+        goto END;
+    }
+
+    if (NULL != distance)
+    {
+        *distance = distances[end];
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(distances);
+    free(parents);
+    if (NULL != frontier)
+    {
+        priority_queue_delete(&frontier);
+    }
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static int address_compare(const void * entry_a, const void * entry_b)
+{
+    uintptr_t address_a =
+        (uintptr_t)((const address_entry_t *)entry_a)->address;
+    uintptr_t address_b =
+        (uintptr_t)((const address_entry_t *)entry_b)->address;
+
+    return (address_a > address_b) - (address_a < address_b);
+}
+
+static uint32_t address_lookup(const address_entry_t * entries,
+                               uint32_t                count,
+                               const void *            address)
+{
+    address_entry_t         key   = { address, 0 };
+    const address_entry_t * found = NULL;
+
+    found = bsearch(
+        &key, entries, count, sizeof(address_entry_t), address_compare);
+
+    return (NULL == found) ? GRAPH_CSR_NO_NODE : found->index;
+}
+
+static int fill_rows(graph_csr_t *           csr,
+                     graph_t *               graph,
+                     node_t **               nodes,
+                     const address_entry_t * node_entries)
+{
+    int           exit_code = E_FAILURE;
+    list_node_t * current   = NULL;
+    edge_t *      edge      = NULL;
+    node_t *      other     = NULL;
+    size_t        position  = 0;
+    uint32_t      neighbor  = 0;
+
+    for (uint32_t index = 0; index < csr->node_count; index++)
+    {
+        csr->offsets[index] = position;
+
+        current = nodes[index]->edge_list->head;
+        while (NULL != current)
+        {
+            edge = (edge_t *)current->data;
+
+            // Bidirectional edges sit in both endpoints' lists
+            other = graph->nodes[(edge->id_1 == nodes[index]->id)
+                                     ? edge->id_2
+                                     : edge->id_1];
+
+            neighbor = address_lookup(node_entries, csr->node_count, other);
+            if (GRAPH_CSR_NO_NODE == neighbor)
+            {
+                PRINT_DEBUG("fill_rows(): Edge points outside the graph.");
+                goto END;
+            }
+
+            csr->neighbors[position] = neighbor;
+            csr->weights[position]   = edge->weight;
+            position++;
+
+            current = current->next;
+        }
+    }
+    csr->offsets[csr->node_count] = position;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void fill_data_lookup(graph_csr_t * csr, address_entry_t * entries)
+{
+    for (uint32_t index = 0; index < csr->node_count; index++)
+    {
+        entries[index].address = csr->node_data[index];
+        entries[index].index   = index;
+    }
+
+    qsort(entries, csr->node_count, sizeof(address_entry_t), address_compare);
+
+    for (uint32_t idx = 0; idx < csr->node_count; idx++)
+    {
+        csr->data_keys[idx]  = (void *)entries[idx].address;
+        csr->data_index[idx] = entries[idx].index;
+    }
+}
+
+static bool test_and_set(uint64_t * visited, uint32_t node)
+{
+    uint64_t mask   = (uint64_t)1 << (node % BITS_PER_WORD);
+    bool     is_set = (0 != (visited[node / BITS_PER_WORD] & mask));
+
+    visited[node / BITS_PER_WORD] |= mask;
+    return is_set;
+}
+
+static bool is_visited(const uint64_t * visited, uint32_t node)
+{
+    return (0 != (visited[node / BITS_PER_WORD] &
+                  ((uint64_t)1 << (node % BITS_PER_WORD))));
+}
+
+static list_t * build_path(const graph_csr_t * csr,
+                           const uint32_t *    parents,
+                           uint32_t            end)
+{
+    list_t * path    = NULL;
+    uint32_t current = end;
+
+    path = list_new(path_free, node_ptr_comp);
+    if (NULL == path)
+    {
+        PRINT_DEBUG("build_path(): Unable to create path list.");
+        goto END;
+    }
+
+    while (GRAPH_CSR_NO_NODE != current)
+    {
+        if (E_SUCCESS != list_push_head(path, csr->node_data[current]))
+        {
+            PRINT_DEBUG("build_path(): Unable to extend path.");
+            list_delete(&path);
+            goto END;
+        }
+        current = parents[current];
+    }
+
+END:
+    return path;
+}
+
+static void path_free(void * data)
+{
+    (void)data;
+}
+
+/*** end of file ***/
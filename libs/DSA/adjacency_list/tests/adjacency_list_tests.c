@@ -6,21 +6,119 @@
 
 #include "adjacency_list.h"
 #include "comparisons.h"
+#include "graph_csr.h"
 #include "utilities.h"
 
+#define CSR_NODE_COUNT     6
+#define GRID_SIDE          40
+#define CHAIN_LENGTH       5000
+#define PATH_GRID_SIDE     30
+#define BULK_NODE_COUNT    100000
+#define CLONE_SPOKES       (GRAPH_NEIGHBOR_INDEX_DEGREE * 2)
+#define DYNAMIC_NODE_COUNT 40
+#define DYNAMIC_SOURCES    4
+#define DYNAMIC_CHANGES    400
+#define DYNAMIC_WEIGHTS    10
+
 graph_t * test_graph = NULL;
 
+int csr_data[CSR_NODE_COUNT] = { 0, 1, 2, 3, 4, 5 };
+int visit_total              = 0;
+int visit_count              = 0;
+int free_count               = 0;
+
 void custom_free(void * data)
 {
     (void)data;
 }
 
+void count_free(void * data)
+{
+    (void)data;
+    free_count++;
+}
+
 void custom_print(const void * data)
 {
     int * int_data = (int *)data;
     printf("%d ", *int_data);
 }
 
+void count_visit(const void * data)
+{
+    visit_total += *(const int *)data;
+    visit_count++;
+}
+
+const void * visit_order[GRID_SIDE * GRID_SIDE];
+
+void record_visit(const void * data)
+{
+    visit_order[visit_count++] = data;
+}
+
+// Checks that visit_order is a DFS preorder: each node hangs off the deepest
+// node on the current path with an edge to it, and every node left behind on
+// the way back up had no unvisited neighbours
+static void check_preorder(const graph_csr_t * csr)
+{
+    uint32_t path[GRID_SIDE * GRID_SIDE];
+    bool     visited[GRID_SIDE * GRID_SIDE] = { false };
+    size_t   depth                          = 0;
+    uint32_t node                           = 0;
+    bool     linked                         = false;
+
+    for (int visit = 0; visit < visit_count; visit++)
+    {
+        node = graph_csr_node_index(csr, visit_order[visit]);
+        CU_ASSERT_FALSE_FATAL(visited[node]);
+        while (0 != depth)
+        {
+            linked = false;
+            for (size_t edge = csr->offsets[path[depth - 1]];
+                 edge < csr->offsets[path[depth - 1] + 1];
+                 edge++)
+            {
+                linked = linked || (node == csr->neighbors[edge]);
+            }
+            if (linked)
+            {
+                break;
+            }
+
+            for (size_t edge = csr->offsets[path[depth - 1]];
+                 edge < csr->offsets[path[depth - 1] + 1];
+                 edge++)
+            {
+                CU_ASSERT_TRUE(visited[csr->neighbors[edge]]);
+            }
+            depth--;
+        }
+        CU_ASSERT_TRUE((0 != depth) || (0 == visit));
+        visited[node] = true;
+        path[depth++] = node;
+    }
+}
+
+/*
+ * Builds:  0 -> 1 (4), 0 -> 2 (1), 2 -> 1 (2), 1 <-> 3 (5), 2 <-> 3 (8),
+ *          3 -> 4 (3); node 5 is isolated.
+ */
+void build_csr_graph(void)
+{
+    for (int idx = 0; idx < CSR_NODE_COUNT; idx++)
+    {
+        graph_add_node(test_graph, &csr_data[idx]);
+    }
+
+    graph_add_edge(test_graph, &csr_data[0], &csr_data[1], 4, false);
+    graph_add_edge(test_graph, &csr_data[0], &csr_data[2], 1, false);
+    graph_add_edge(test_graph, &csr_data[2], &csr_data[1], 2, false);
+    graph_add_edge(test_graph, &csr_data[1], &csr_data[3], 5, true);
+    graph_add_edge(test_graph, &csr_data[2], &csr_data[3], 8, true);
+    graph_add_edge(test_graph, &csr_data[3], &csr_data[4], 3, false);
+}
+
 void setup(void)
 {
     test_graph = graph_create(custom_free, int_comp);
@@ -195,6 +293,161 @@ void test_graph_get_adjacent_nodes(void)
     list_delete(&adjacent_nodes);
 }
 
+void test_graph_adjacent_nodes_distinct(void)
+{
+    list_t * adjacent = NULL;
+    size_t   degree   = 0;
+    int      missing  = 42;
+
+    build_csr_graph();
+    graph_add_edge(test_graph, &csr_data[2], &csr_data[1], 7, false);
+
+    // Two edges 2 -> 1 and one 2 <-> 3, but only two neighbours
+    CU_ASSERT_EQUAL(graph_node_degree(test_graph, &csr_data[2], &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 3);
+
+    adjacent = graph_get_adjacent_nodes(test_graph, &csr_data[2]);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(adjacent);
+    CU_ASSERT_EQUAL(adjacent->size, 2);
+    list_delete(&adjacent);
+
+    // Incoming one-way edges do not count
+    adjacent = graph_get_adjacent_nodes(test_graph, &csr_data[1]);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(adjacent);
+    CU_ASSERT_EQUAL(adjacent->size, 1);
+    CU_ASSERT_EQUAL(*(int *)adjacent->head->data, 3);
+    list_delete(&adjacent);
+
+    CU_ASSERT_PTR_NULL(graph_get_adjacent_nodes(test_graph, &missing));
+}
+
+void test_graph_connected_components(void)
+{
+    list_t * components   = NULL;
+    list_t * members      = NULL;
+    bool     is_connected = true;
+
+    build_csr_graph();
+
+    CU_ASSERT_EQUAL(graph_is_connected(test_graph, &is_connected), E_SUCCESS);
+    CU_ASSERT_FALSE(is_connected);
+    CU_ASSERT_EQUAL(graph_in_same_component(
+                        test_graph, &csr_data[0], &csr_data[4], &is_connected),
+                    E_SUCCESS);
+    CU_ASSERT_TRUE(is_connected);
+    CU_ASSERT_EQUAL(graph_in_same_component(
+                        test_graph, &csr_data[0], &csr_data[5], &is_connected),
+                    E_SUCCESS);
+    CU_ASSERT_FALSE(is_connected);
+
+    components = graph_find_connected_components(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(components);
+    CU_ASSERT_EQUAL(components->size, 2);
+    members = (list_t *)components->head->data;
+    CU_ASSERT_EQUAL(members->size + ((list_t *)components->tail->data)->size,
+                    CSR_NODE_COUNT);
+    list_delete(&components);
+
+    // Added edges are merged into the existing components
+    graph_add_edge(test_graph, &csr_data[5], &csr_data[4], 1, false);
+    CU_ASSERT_EQUAL(graph_is_connected(test_graph, &is_connected), E_SUCCESS);
+    CU_ASSERT_TRUE(is_connected);
+
+    // Removals force a rebuild
+    graph_remove_edge(test_graph, &csr_data[5], &csr_data[4]);
+    CU_ASSERT_EQUAL(graph_is_connected(test_graph, &is_connected), E_SUCCESS);
+    CU_ASSERT_FALSE(is_connected);
+
+    graph_remove_node(test_graph, &csr_data[5]);
+    CU_ASSERT_EQUAL(graph_is_connected(test_graph, &is_connected), E_SUCCESS);
+    CU_ASSERT_TRUE(is_connected);
+    graph_add_node(test_graph, &csr_data[5]);
+    CU_ASSERT_EQUAL(graph_is_connected(test_graph, &is_connected), E_SUCCESS);
+    CU_ASSERT_FALSE(is_connected);
+
+    CU_ASSERT_EQUAL(graph_is_connected(test_graph, NULL), E_FAILURE);
+    CU_ASSERT_PTR_NULL(graph_find_connected_components(NULL));
+}
+
+void test_graph_cycle_kinds(void)
+{
+    bool is_cyclic = true;
+
+    for (int idx = 0; idx < 5; idx++)
+    {
+        graph_add_node(test_graph, &csr_data[idx]);
+    }
+
+    // A two-way path 0 - 1 - 2 feeding a one-way chain 2 -> 3 -> 4
+    graph_add_edge(test_graph, &csr_data[0], &csr_data[1], 1, true);
+    graph_add_edge(test_graph, &csr_data[1], &csr_data[2], 1, true);
+    graph_add_edge(test_graph, &csr_data[2], &csr_data[3], 1, false);
+    graph_add_edge(test_graph, &csr_data[3], &csr_data[4], 1, false);
+    CU_ASSERT_EQUAL(graph_is_cyclic(test_graph, &is_cyclic), E_SUCCESS);
+    CU_ASSERT_FALSE(is_cyclic);
+
+    // 4 -> 0 closes a loop back through the two-way edges
+    graph_add_edge(test_graph, &csr_data[4], &csr_data[0], 1, false);
+    CU_ASSERT_EQUAL(graph_is_cyclic(test_graph, &is_cyclic), E_SUCCESS);
+    CU_ASSERT_TRUE(is_cyclic);
+    graph_remove_edge(test_graph, &csr_data[4], &csr_data[0]);
+
+    // So does a one-way edge between two nodes already joined both ways
+    graph_add_edge(test_graph, &csr_data[0], &csr_data[2], 1, false);
+    CU_ASSERT_EQUAL(graph_is_cyclic(test_graph, &is_cyclic), E_SUCCESS);
+    CU_ASSERT_TRUE(is_cyclic);
+    graph_remove_edge(test_graph, &csr_data[0], &csr_data[2]);
+
+    // And a second two-way edge alongside an existing one
+    graph_add_edge(test_graph, &csr_data[0], &csr_data[1], 2, true);
+    CU_ASSERT_EQUAL(graph_is_cyclic(test_graph, &is_cyclic), E_SUCCESS);
+    CU_ASSERT_TRUE(is_cyclic);
+
+    CU_ASSERT_EQUAL(graph_is_cyclic(test_graph, NULL), E_FAILURE);
+}
+
+void test_graph_strongly_connected_components(void)
+{
+    list_t *      components = NULL;
+    list_node_t * current    = NULL;
+    list_t *      members    = NULL;
+    int           position[CSR_NODE_COUNT];
+    int           index = 0;
+
+    build_csr_graph();
+
+    // {1, 2, 3} are joined by two-way edges; 0, 4 and 5 stand alone
+    components = graph_find_strongly_connected_components(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(components);
+    CU_ASSERT_EQUAL(components->size, 4);
+
+    current = components->head;
+    while (NULL != current)
+    {
+        members = (list_t *)current->data;
+        for (list_node_t * member = members->head; NULL != member;
+             member               = member->next)
+        {
+            position[*(int *)member->data] = index;
+        }
+        index++;
+        current = current->next;
+    }
+
+    CU_ASSERT_EQUAL(position[1], position[2]);
+    CU_ASSERT_EQUAL(position[1], position[3]);
+    CU_ASSERT_NOT_EQUAL(position[0], position[1]);
+    CU_ASSERT_NOT_EQUAL(position[4], position[3]);
+
+    // Reverse topological order: 4 before {1, 2, 3} before 0
+    CU_ASSERT(position[4] < position[1]);
+    CU_ASSERT(position[1] < position[0]);
+
+    list_delete(&components);
+    CU_ASSERT_PTR_NULL(graph_find_strongly_connected_components(NULL));
+}
+
 void test_graph_edge_exists(void)
 {
     int exit_code = E_FAILURE;
@@ -230,6 +483,110 @@ void test_graph_get_edge_weight(void)
     CU_ASSERT_EQUAL(graph_get_edge_weight(test_graph, &data1, &data2), 10);
 }
 
+void test_graph_edge_index(void)
+{
+    int    hub = 0;
+    int    spokes[4 * GRAPH_NEIGHBOR_INDEX_DEGREE];
+    int    count  = 4 * GRAPH_NEIGHBOR_INDEX_DEGREE;
+    size_t degree = 0;
+
+    // Enough edges for the hub to switch to its neighbour index
+    graph_add_node(test_graph, &hub);
+    for (int idx = 0; idx < count; idx++)
+    {
+        spokes[idx] = idx + 1;
+        graph_add_node(test_graph, &spokes[idx]);
+        graph_add_edge(
+            test_graph, &hub, &spokes[idx], (size_t)idx, (0 == (idx % 2)));
+    }
+
+    for (int idx = 0; idx < count; idx++)
+    {
+        CU_ASSERT_TRUE(graph_edge_exists(test_graph, &hub, &spokes[idx]));
+        CU_ASSERT_EQUAL(graph_edge_exists(test_graph, &spokes[idx], &hub),
+                        (0 == (idx % 2)));
+        CU_ASSERT_EQUAL(graph_get_edge_weight(test_graph, &hub, &spokes[idx]),
+                        (size_t)idx);
+    }
+
+    // Parallel edges come out one at a time
+    graph_add_edge(test_graph, &hub, &spokes[1], 99, false);
+    CU_ASSERT_EQUAL(graph_remove_edge(test_graph, &hub, &spokes[1]), E_SUCCESS);
+    CU_ASSERT_TRUE(graph_edge_exists(test_graph, &hub, &spokes[1]));
+    CU_ASSERT_EQUAL(graph_remove_edge(test_graph, &hub, &spokes[1]), E_SUCCESS);
+    CU_ASSERT_FALSE(graph_edge_exists(test_graph, &hub, &spokes[1]));
+    CU_ASSERT_EQUAL(graph_get_edge_weight(test_graph, &hub, &spokes[1]),
+                    GRAPH_DISTANCE_INFINITY);
+
+    // Removing a spoke takes its two-way edge out of the hub's index
+    CU_ASSERT_EQUAL(graph_remove_node(test_graph, &spokes[0]), E_SUCCESS);
+    CU_ASSERT_FALSE(graph_edge_exists(test_graph, &hub, &spokes[0]));
+    CU_ASSERT_EQUAL(graph_node_degree(test_graph, &hub, &degree), E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, (size_t)(count - 2));
+
+    // Removing the hub leaves the spokes behind with no edges
+    CU_ASSERT_EQUAL(graph_remove_node(test_graph, &hub), E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_node_degree(test_graph, &spokes[2], &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 0);
+    CU_ASSERT_FALSE(graph_edge_exists(test_graph, &spokes[2], &hub));
+}
+
+void test_graph_bulk_build(void)
+{
+    int *    values = calloc(BULK_NODE_COUNT, sizeof(int));
+    list_t * path   = NULL;
+    bool     found  = true;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(values);
+
+    // Linear node and edge lookups would make this take minutes
+    for (int idx = 0; idx < BULK_NODE_COUNT; idx++)
+    {
+        values[idx] = idx;
+        CU_ASSERT_EQUAL(graph_add_node(test_graph, &values[idx]), E_SUCCESS);
+    }
+    for (int idx = 1; idx < BULK_NODE_COUNT; idx++)
+    {
+        graph_add_edge(test_graph, &values[idx - 1], &values[idx], 1, true);
+        graph_add_edge(test_graph, &values[idx / 2], &values[idx], 1, false);
+    }
+
+    for (int idx = 1; idx < BULK_NODE_COUNT; idx++)
+    {
+        found = found &&
+                graph_edge_exists(test_graph, &values[idx], &values[idx - 1]) &&
+                graph_edge_exists(test_graph, &values[idx / 2], &values[idx]);
+    }
+    CU_ASSERT_TRUE(found);
+
+    // The halving edges give a path of about log2(n) hops
+    CU_ASSERT_EQUAL(graph_dijkstra(test_graph,
+                                   &values[0],
+                                   &values[BULK_NODE_COUNT - 1],
+                                   &path),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(path);
+    CU_ASSERT(path->size < 40);
+    list_delete(&path);
+
+    // Removal hands the last ID over in O(1) rather than searching for it
+    for (int idx = 0; idx < BULK_NODE_COUNT; idx += 2)
+    {
+        CU_ASSERT_EQUAL(graph_remove_node(test_graph, &values[idx]),
+                        E_SUCCESS);
+    }
+    CU_ASSERT_EQUAL(test_graph->node_count, BULK_NODE_COUNT / 2);
+    for (size_t id = 0; id < test_graph->node_count; id++)
+    {
+        found = found && (id == test_graph->nodes[id]->id);
+    }
+    CU_ASSERT_TRUE(found);
+
+    graph_destroy(&test_graph);
+    free(values);
+}
+
 void test_graph_clone(void)
 {
     int exit_code = E_FAILURE;
@@ -253,6 +610,167 @@ void test_graph_clone(void)
     graph_destroy(&clone);
 }
 
+void test_graph_clone_copy_on_write(void)
+{
+    graph_t * clone  = NULL;
+    graph_t * nested = NULL;
+    list_t *  path   = NULL;
+    int       hub    = 100;
+    int       spokes[CLONE_SPOKES];
+
+    free_count = 0;
+    graph_destroy(&test_graph);
+    test_graph = graph_create(count_free, int_comp);
+    build_csr_graph();
+
+    // A hub with enough edges to be indexed by neighbour
+    graph_add_node(test_graph, &hub);
+    for (int idx = 0; idx < CLONE_SPOKES; idx++)
+    {
+        spokes[idx] = idx + 200;
+        graph_add_node(test_graph, &spokes[idx]);
+        graph_add_edge(test_graph, &hub, &spokes[idx], (size_t)idx, true);
+    }
+
+    clone = graph_clone(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+    CU_ASSERT_PTR_EQUAL(clone->node_list, test_graph->node_list);
+
+    // Changing the original copies it and leaves the clone as it was
+    CU_ASSERT_EQUAL(
+        graph_remove_edge(test_graph, &csr_data[0], &csr_data[2]), E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_remove_node(test_graph, &spokes[3]), E_SUCCESS);
+    CU_ASSERT_PTR_NOT_EQUAL(clone->node_list, test_graph->node_list);
+    CU_ASSERT_EQUAL(free_count, 0);
+
+    CU_ASSERT_FALSE(graph_edge_exists(test_graph, &csr_data[0], &csr_data[2]));
+    CU_ASSERT_TRUE(graph_edge_exists(clone, &csr_data[0], &csr_data[2]));
+    CU_ASSERT_EQUAL(clone->node_count, CSR_NODE_COUNT + CLONE_SPOKES + 1);
+    CU_ASSERT_EQUAL(graph_get_edge_weight(clone, &spokes[5], &hub), 5);
+    CU_ASSERT_EQUAL(graph_get_edge_weight(test_graph, &spokes[5], &hub), 5);
+
+    CU_ASSERT_EQUAL(
+        graph_dijkstra(clone, &csr_data[0], &csr_data[4], &path), E_SUCCESS);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(path);
+    CU_ASSERT_EQUAL(path->size, 5); // 0 -> 2 -> 1 -> 3 -> 4
+    list_delete(&path);
+
+    // Changing a clone leaves the original and the other clones alone
+    nested = graph_clone(clone);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(nested);
+    CU_ASSERT_EQUAL(
+        graph_add_edge(clone, &csr_data[4], &csr_data[5], 7, false),
+        E_SUCCESS);
+    CU_ASSERT_TRUE(graph_edge_exists(clone, &csr_data[4], &csr_data[5]));
+    CU_ASSERT_FALSE(graph_edge_exists(nested, &csr_data[4], &csr_data[5]));
+    CU_ASSERT_FALSE(graph_edge_exists(test_graph, &csr_data[4], &csr_data[5]));
+
+    // Node data is freed once, by the last graph to go, whatever the order
+    graph_destroy(&clone);
+    graph_destroy(&test_graph);
+    CU_ASSERT_EQUAL(free_count, 0);
+    CU_ASSERT_TRUE(graph_edge_exists(nested, &hub, &spokes[3]));
+    graph_destroy(&nested);
+    CU_ASSERT_EQUAL(free_count, CSR_NODE_COUNT + CLONE_SPOKES + 1);
+}
+
+void test_graph_clone_remove_node(void)
+{
+    graph_t * clone = NULL;
+    int *     data[3];
+
+    graph_destroy(&test_graph);
+    test_graph = graph_create(free, int_comp);
+    for (int idx = 0; idx < 3; idx++)
+    {
+        data[idx] = malloc(sizeof(int));
+        CU_ASSERT_PTR_NOT_NULL_FATAL(data[idx]);
+        *data[idx] = idx;
+        graph_add_node(test_graph, data[idx]);
+    }
+    graph_add_edge(test_graph, data[0], data[1], 1, true);
+    graph_add_edge(test_graph, data[1], data[2], 1, true);
+
+    // The clone still reads the removed node's data
+    clone = graph_clone(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+    CU_ASSERT_EQUAL(graph_remove_node(test_graph, data[1]), E_SUCCESS);
+
+    visit_total = 0;
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_bfs(clone, data[0], count_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 3);
+    CU_ASSERT_EQUAL(visit_total, 3);
+
+    graph_destroy(&test_graph);
+    visit_total = 0;
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_bfs(clone, data[0], count_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 3);
+    CU_ASSERT_EQUAL(visit_total, 3);
+
+    // Once alone, the clone frees what it removes straight away
+    CU_ASSERT_EQUAL(graph_remove_node(clone, data[1]), E_SUCCESS);
+    CU_ASSERT_EQUAL(clone->node_count, 2);
+    graph_destroy(&clone);
+}
+
+void test_graph_clone_copies_touched_nodes(void)
+{
+    graph_t * clone  = NULL;
+    node_t *  node   = NULL;
+    size_t    shared = 0;
+
+    build_csr_graph();
+    clone = graph_clone(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(clone);
+
+    // One new edge copies the ID table and its two endpoints, nothing else
+    CU_ASSERT_EQUAL(
+        graph_add_edge(clone, &csr_data[0], &csr_data[5], 3, false),
+        E_SUCCESS);
+    CU_ASSERT_PTR_NOT_EQUAL(clone->nodes, test_graph->nodes);
+    for (uint32_t id = 0; id < CSR_NODE_COUNT; id++)
+    {
+        node = clone->nodes[id];
+        if ((&csr_data[0] == node->data) || (&csr_data[5] == node->data))
+        {
+            CU_ASSERT_PTR_NOT_EQUAL(node->edge_list,
+                                    test_graph->nodes[id]->edge_list);
+        }
+        else
+        {
+            CU_ASSERT_PTR_EQUAL(node->edge_list,
+                                test_graph->nodes[id]->edge_list);
+            shared++;
+        }
+    }
+    CU_ASSERT_EQUAL(shared, CSR_NODE_COUNT - 2);
+    CU_ASSERT_FALSE(graph_edge_exists(test_graph, &csr_data[0], &csr_data[5]));
+
+    // Removing 1 copies its neighbours and moves 5, the last ID, into the
+    // gap; 4 is not next to either and stays shared
+    CU_ASSERT_EQUAL(graph_remove_node(clone, &csr_data[1]), E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(clone->nodes[4], test_graph->nodes[4]);
+    CU_ASSERT_PTR_EQUAL(clone->nodes[1]->data, &csr_data[5]);
+    for (uint32_t id = 0; id < clone->node_count; id++)
+    {
+        CU_ASSERT_EQUAL(clone->nodes[id]->id, id);
+    }
+    CU_ASSERT_EQUAL(
+        graph_get_edge_weight(clone, &csr_data[0], &csr_data[5]), 3);
+    CU_ASSERT_TRUE(graph_edge_exists(clone, &csr_data[3], &csr_data[2]));
+    CU_ASSERT_EQUAL(clone->directed_edge_count, 3);
+
+    // The original still has every edge of node 1
+    CU_ASSERT_TRUE(graph_edge_exists(test_graph, &csr_data[2], &csr_data[1]));
+    CU_ASSERT_TRUE(graph_edge_exists(test_graph, &csr_data[3], &csr_data[1]));
+    CU_ASSERT_EQUAL(test_graph->directed_edge_count, 4);
+    CU_ASSERT_EQUAL(test_graph->nodes[1]->data, &csr_data[1]);
+
+    graph_destroy(&clone);
+}
+
 void test_graph_dfs(void)
 {
     int exit_code = E_FAILURE;
@@ -289,6 +807,726 @@ void test_graph_bfs(void)
     CU_ASSERT_EQUAL(exit_code, E_SUCCESS);
 }
 
+void test_graph_node_ids(void)
+{
+    list_node_t * current              = NULL;
+    bool          seen[CSR_NODE_COUNT] = { false };
+    size_t        degree               = 0;
+
+    build_csr_graph();
+    graph_remove_node(test_graph, &csr_data[1]);
+    graph_remove_node(test_graph, &csr_data[4]);
+
+    CU_ASSERT_EQUAL_FATAL(test_graph->node_count, CSR_NODE_COUNT - 2);
+
+    // One-way edges into the removed nodes go with them; only 0 -> 2 is left
+    CU_ASSERT_EQUAL(test_graph->directed_edge_count, 1);
+    CU_ASSERT_EQUAL(graph_node_degree(test_graph, &csr_data[0], &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 1);
+    CU_ASSERT_EQUAL(graph_node_degree(test_graph, &csr_data[3], &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 1);
+    CU_ASSERT_EQUAL(graph_remove_edge(test_graph, &csr_data[0], &csr_data[2]),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(test_graph->directed_edge_count, 0);
+    for (current = test_graph->node_list->head; NULL != current;
+         current = current->next)
+    {
+        uint32_t id = ((node_t *)current->data)->id;
+        CU_ASSERT_FATAL(id < test_graph->node_count);
+        CU_ASSERT_FALSE(seen[id]);
+        CU_ASSERT_PTR_EQUAL(test_graph->nodes[id], current->data);
+        seen[id] = true;
+    }
+}
+
+void test_graph_traversal_workspace(void)
+{
+    graph_workspace_t * workspace = NULL;
+
+    build_csr_graph();
+
+    workspace = graph_workspace_create(1);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(workspace);
+    CU_ASSERT_EQUAL(
+        graph_bfs_workspace(test_graph, workspace, &csr_data[0], count_visit),
+        E_FAILURE);
+
+    CU_ASSERT_EQUAL(graph_workspace_reserve(workspace, CSR_NODE_COUNT),
+                    E_SUCCESS);
+
+    // Reuse the same workspace; each query must start from a clean slate
+    for (int round = 0; round < 3; round++)
+    {
+        visit_total = 0;
+        visit_count = 0;
+        CU_ASSERT_EQUAL(graph_bfs_workspace(
+                            test_graph, workspace, &csr_data[0], count_visit),
+                        E_SUCCESS);
+        CU_ASSERT_EQUAL(visit_count, 5);
+        CU_ASSERT_EQUAL(visit_total, 0 + 1 + 2 + 3 + 4);
+
+        // 3 reaches 1 and 2 back over bidirectional edges
+        visit_count = 0;
+        CU_ASSERT_EQUAL(graph_dfs_workspace(
+                            test_graph, workspace, &csr_data[3], count_visit),
+                        E_SUCCESS);
+        CU_ASSERT_EQUAL(visit_count, 4);
+    }
+
+    // Stamps must not leak across an epoch wrap
+    workspace->epoch = UINT32_MAX;
+    visit_count      = 0;
+    CU_ASSERT_EQUAL(
+        graph_dfs_workspace(test_graph, workspace, &csr_data[0], count_visit),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 5);
+
+    CU_ASSERT_EQUAL(graph_workspace_destroy(&workspace), E_SUCCESS);
+    CU_ASSERT_PTR_NULL(workspace);
+}
+
+void test_graph_traversal_long_chain(void)
+{
+    static int links[CHAIN_LENGTH];
+
+    for (int idx = 0; idx < CHAIN_LENGTH; idx++)
+    {
+        links[idx] = 1;
+        graph_add_node(test_graph, &links[idx]);
+        if (0 != idx)
+        {
+            graph_add_edge(
+                test_graph, &links[idx - 1], &links[idx], 1, (0 == (idx % 2)));
+        }
+    }
+
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_dfs(test_graph, &links[0], count_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, CHAIN_LENGTH);
+
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_bfs(test_graph, &links[0], count_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, CHAIN_LENGTH);
+}
+
+size_t grid_weight(int cell_a, int cell_b)
+{
+    int low  = (cell_a < cell_b) ? cell_a : cell_b;
+    int high = (cell_a < cell_b) ? cell_b : cell_a;
+
+    return (size_t)(((low * 31) + (high * 17)) % 9) + 1;
+}
+
+size_t grid_heuristic(const void * data, const void * goal_data)
+{
+    int cell = *(const int *)data;
+    int goal = *(const int *)goal_data;
+
+    return (size_t)(abs((cell % PATH_GRID_SIDE) - (goal % PATH_GRID_SIDE)) +
+                    abs((cell / PATH_GRID_SIDE) - (goal / PATH_GRID_SIDE)));
+}
+
+size_t grid_path_weight(list_t * path)
+{
+    size_t        total   = 0;
+    list_node_t * current = path->head;
+
+    while ((NULL != current) && (NULL != current->next))
+    {
+        total += grid_weight(*(int *)current->data,
+                             *(int *)current->next->data);
+        current = current->next;
+    }
+
+    return total;
+}
+
+void check_path(list_t * path, const int * expected, uint32_t length)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(path);
+    CU_ASSERT_EQUAL_FATAL(path->size, length);
+    for (uint32_t idx = 0; idx < length; idx++)
+    {
+        CU_ASSERT_EQUAL(*(int *)list_peek_position(path, idx), expected[idx]);
+    }
+}
+
+void test_graph_dijkstra(void)
+{
+    list_t * path       = NULL;
+    int      expected[] = { 0, 2, 1, 3, 4 };
+
+    build_csr_graph();
+
+    CU_ASSERT_EQUAL(
+        graph_dijkstra(test_graph, &csr_data[0], &csr_data[4], &path),
+        E_SUCCESS);
+    check_path(path, expected, 5);
+    list_delete(&path);
+
+    CU_ASSERT_EQUAL(
+        graph_dijkstra(test_graph, &csr_data[4], &csr_data[0], &path),
+        E_FAILURE);
+    CU_ASSERT_PTR_NULL(path);
+
+    CU_ASSERT_EQUAL(
+        graph_dijkstra(test_graph, &csr_data[3], &csr_data[3], &path),
+        E_SUCCESS);
+    check_path(path, &expected[3], 1);
+    list_delete(&path);
+}
+
+void test_graph_floyd_warshall(void)
+{
+    size_t * distances = NULL;
+    size_t   inf       = GRAPH_DISTANCE_INFINITY;
+    size_t   expected[CSR_NODE_COUNT * CSR_NODE_COUNT] = {
+        0,   3,   1,   8,   11,  inf, // From 0
+        inf, 0,   13,  5,   8,   inf, // From 1
+        inf, 2,   0,   7,   10,  inf, // From 2
+        inf, 5,   8,   0,   3,   inf, // From 3
+        inf, inf, inf, inf, 0,   inf, // From 4
+        inf, inf, inf, inf, inf, 0    // From 5
+    };
+
+    build_csr_graph();
+
+    CU_ASSERT_EQUAL(graph_floyd_warshall(test_graph, &distances), E_SUCCESS);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(distances);
+    for (size_t idx = 0; idx < (CSR_NODE_COUNT * CSR_NODE_COUNT); idx++)
+    {
+        CU_ASSERT_EQUAL(distances[idx], expected[idx]);
+    }
+    free(distances);
+
+    CU_ASSERT_EQUAL(graph_floyd_warshall(NULL, &distances), E_FAILURE);
+    CU_ASSERT_EQUAL(graph_floyd_warshall(test_graph, NULL), E_FAILURE);
+}
+
+void test_graph_dijkstra_bidirectional(void)
+{
+    list_t * path       = NULL;
+    int      expected[] = { 0, 2, 1, 3, 4 };
+    int      back[]     = { 3, 1 };
+
+    build_csr_graph();
+
+    // One-way edges force the search to build an incoming-edge index
+    CU_ASSERT_EQUAL(graph_dijkstra_bidirectional(
+                        test_graph, &csr_data[0], &csr_data[4], &path),
+                    E_SUCCESS);
+    check_path(path, expected, 5);
+    list_delete(&path);
+
+    CU_ASSERT_EQUAL(graph_dijkstra_bidirectional(
+                        test_graph, &csr_data[3], &csr_data[1], &path),
+                    E_SUCCESS);
+    check_path(path, back, 2);
+    list_delete(&path);
+
+    CU_ASSERT_EQUAL(graph_dijkstra_bidirectional(
+                        test_graph, &csr_data[4], &csr_data[0], &path),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(graph_dijkstra_bidirectional(
+                        test_graph, &csr_data[0], &csr_data[5], &path),
+                    E_FAILURE);
+    CU_ASSERT_PTR_NULL(path);
+}
+
+void test_graph_shortest_paths_agree(void)
+{
+    static int    cells[PATH_GRID_SIDE * PATH_GRID_SIDE];
+    int           cell_count = PATH_GRID_SIDE * PATH_GRID_SIDE;
+    graph_csr_t * csr        = NULL;
+    list_t *      path       = NULL;
+    size_t        expected   = 0;
+    int           goals[]    = { 1, 29, 435, 899 };
+
+    for (int cell = 0; cell < cell_count; cell++)
+    {
+        cells[cell] = cell;
+        graph_add_node(test_graph, &cells[cell]);
+    }
+    for (int cell = 0; cell < cell_count; cell++)
+    {
+        if (0 != ((cell + 1) % PATH_GRID_SIDE))
+        {
+            graph_add_edge(test_graph,
+                           &cells[cell],
+                           &cells[cell + 1],
+                           grid_weight(cell, cell + 1),
+                           true);
+        }
+        if ((cell + PATH_GRID_SIDE) < cell_count)
+        {
+            graph_add_edge(test_graph,
+                           &cells[cell],
+                           &cells[cell + PATH_GRID_SIDE],
+                           grid_weight(cell, cell + PATH_GRID_SIDE),
+                           true);
+        }
+    }
+
+    csr = graph_freeze(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+
+    for (size_t idx = 0; idx < (sizeof(goals) / sizeof(goals[0])); idx++)
+    {
+        graph_csr_shortest_path(
+            csr, &cells[0], &cells[goals[idx]], &path, &expected);
+        list_delete(&path);
+
+        CU_ASSERT_EQUAL(
+            graph_dijkstra(test_graph, &cells[0], &cells[goals[idx]], &path),
+            E_SUCCESS);
+        CU_ASSERT_EQUAL(grid_path_weight(path), expected);
+        list_delete(&path);
+
+        CU_ASSERT_EQUAL(graph_dijkstra_bidirectional(
+                            test_graph, &cells[0], &cells[goals[idx]], &path),
+                        E_SUCCESS);
+        CU_ASSERT_EQUAL(grid_path_weight(path), expected);
+        list_delete(&path);
+
+        CU_ASSERT_EQUAL(graph_a_star(test_graph,
+                                     &cells[0],
+                                     &cells[goals[idx]],
+                                     grid_heuristic,
+                                     &path),
+                        E_SUCCESS);
+        CU_ASSERT_EQUAL(grid_path_weight(path), expected);
+        CU_ASSERT_EQUAL(*(int *)list_peek_tail(path), goals[idx]);
+        list_delete(&path);
+    }
+
+    graph_csr_destroy(&csr);
+}
+
+void test_graph_paths(void)
+{
+    graph_paths_t * paths      = NULL;
+    list_t *        path       = NULL;
+    size_t          total      = 0;
+    int             missing    = 99;
+    int             expected[] = { 0, 2, 1, 3, 4 };
+    int             shortcut[] = { 0, 4, 5 };
+
+    build_csr_graph();
+    paths = graph_paths_create(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(paths);
+
+    CU_ASSERT_EQUAL(graph_paths_add_source(paths, &csr_data[0]), E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_paths_add_source(paths, &csr_data[0]), E_FAILURE);
+    CU_ASSERT_EQUAL(graph_paths_add_source(paths, &missing), E_FAILURE);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_path(paths, &csr_data[0], &csr_data[4], &path, &total),
+        E_SUCCESS);
+    check_path(path, expected, 5);
+    CU_ASSERT_EQUAL(total, 11);
+    list_delete(&path);
+
+    // A lighter parallel edge shortens everything below it
+    CU_ASSERT_EQUAL(
+        graph_add_edge(test_graph, &csr_data[2], &csr_data[1], 1, false),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_distance(paths, &csr_data[0], &csr_data[3]), 7);
+    CU_ASSERT_EQUAL(
+        graph_add_edge(test_graph, &csr_data[0], &csr_data[4], 2, false),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_distance(paths, &csr_data[0], &csr_data[4]), 2);
+
+    // Removing a tree edge reroutes its subtree
+    CU_ASSERT_EQUAL(graph_remove_edge(test_graph, &csr_data[0], &csr_data[2]),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_distance(paths, &csr_data[0], &csr_data[1]), 4);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_distance(paths, &csr_data[0], &csr_data[2]), 17);
+
+    // Node 5 takes over the removed node's ID
+    CU_ASSERT_EQUAL(graph_remove_node(test_graph, &csr_data[1]), E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_paths_get_distance(paths, &csr_data[0], &csr_data[3]),
+                    GRAPH_DISTANCE_INFINITY);
+    CU_ASSERT_EQUAL(
+        graph_add_edge(test_graph, &csr_data[4], &csr_data[5], 1, false),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_path(paths, &csr_data[0], &csr_data[5], &path, &total),
+        E_SUCCESS);
+    check_path(path, shortcut, 3);
+    CU_ASSERT_EQUAL(total, 3);
+    list_delete(&path);
+
+    // Removing a source's node unregisters it
+    CU_ASSERT_EQUAL(graph_paths_add_source(paths, &csr_data[3]), E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_remove_node(test_graph, &csr_data[0]), E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_paths_remove_source(paths, &csr_data[0]),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_distance(paths, &csr_data[3], &csr_data[5]), 4);
+    CU_ASSERT_EQUAL(graph_add_node(test_graph, &csr_data[0]), E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_paths_get_distance(paths, &csr_data[3], &csr_data[0]),
+                    GRAPH_DISTANCE_INFINITY);
+    CU_ASSERT_EQUAL(
+        graph_add_edge(test_graph, &csr_data[2], &csr_data[0], 1, true),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_distance(paths, &csr_data[3], &csr_data[0]), 9);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_path(paths, &csr_data[3], &csr_data[1], &path, &total),
+        E_FAILURE);
+    CU_ASSERT_EQUAL(graph_paths_refresh(paths), E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_distance(paths, &csr_data[3], &csr_data[0]), 9);
+
+    CU_ASSERT_EQUAL(graph_paths_remove_source(paths, &csr_data[3]),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(graph_paths_get_distance(paths, &csr_data[3], &csr_data[3]),
+                    GRAPH_DISTANCE_INFINITY);
+
+    CU_ASSERT_PTR_NULL(graph_paths_create(NULL));
+    CU_ASSERT_EQUAL(graph_paths_add_source(NULL, &csr_data[0]), E_FAILURE);
+    CU_ASSERT_EQUAL(graph_paths_refresh(NULL), E_FAILURE);
+    CU_ASSERT_EQUAL(graph_paths_get_distance(NULL, &csr_data[0], &csr_data[0]),
+                    GRAPH_DISTANCE_INFINITY);
+    CU_ASSERT_EQUAL(
+        graph_paths_get_path(paths, &csr_data[0], &csr_data[0], NULL, &total),
+        E_FAILURE);
+
+    graph_paths_destroy(&paths);
+    CU_ASSERT_PTR_NULL(paths);
+    graph_paths_destroy(&paths);
+}
+
+// Checks every registered source, and one path of each, against
+// Floyd-Warshall; returns how many sources were found
+static size_t check_graph_paths(graph_paths_t * paths)
+{
+    size_t * distances  = NULL;
+    size_t   node_count = test_graph->node_count;
+    size_t   found      = 0;
+    size_t   total      = 0;
+    size_t   hops       = 0;
+    list_t * path       = NULL;
+    void *   start      = NULL;
+    void *   target     = NULL;
+    void *   previous   = NULL;
+
+    CU_ASSERT_EQUAL_FATAL(graph_floyd_warshall(test_graph, &distances),
+                          E_SUCCESS);
+    for (size_t src = 0; src < node_count; src++)
+    {
+        start = test_graph->nodes[src]->data;
+        if (0 != graph_paths_get_distance(paths, start, start))
+        {
+            continue;
+        }
+        found++;
+        for (size_t dst = 0; dst < node_count; dst++)
+        {
+            CU_ASSERT_EQUAL(graph_paths_get_distance(
+                                paths, start, test_graph->nodes[dst]->data),
+                            distances[(src * node_count) + dst]);
+        }
+
+        // The cached parents trace a path along existing edges
+        target = test_graph->nodes[(size_t)rand() % node_count]->data;
+        if (E_SUCCESS !=
+            graph_paths_get_path(paths, start, target, &path, &total))
+        {
+            continue;
+        }
+        CU_ASSERT_PTR_EQUAL(list_peek_head(path), start);
+        CU_ASSERT_PTR_EQUAL(list_peek_tail(path), target);
+        hops = 0;
+        for (list_node_t * current = path->head; NULL != current;
+             current = current->next)
+        {
+            if (NULL != previous)
+            {
+                CU_ASSERT_TRUE(
+                    graph_edge_exists(test_graph, previous, current->data));
+            }
+            previous = current->data;
+            hops++;
+        }
+        CU_ASSERT_TRUE(hops <= node_count);
+        previous = NULL;
+        list_delete(&path);
+    }
+
+    free(distances);
+    return found;
+}
+
+void test_graph_paths_agree(void)
+{
+    static int      values[DYNAMIC_NODE_COUNT];
+    bool            present[DYNAMIC_NODE_COUNT] = { false };
+    graph_paths_t * paths                       = NULL;
+    list_t *        path                        = NULL;
+    size_t          total                       = 0;
+    size_t          sources                     = 0;
+    int             src                         = 0;
+    int             dst                         = 0;
+
+    srand(7);
+    for (int idx = 0; idx < DYNAMIC_NODE_COUNT; idx++)
+    {
+        values[idx]  = idx;
+        present[idx] = true;
+        graph_add_node(test_graph, &values[idx]);
+    }
+    for (int idx = 0; idx < (DYNAMIC_NODE_COUNT * 2); idx++)
+    {
+        graph_add_edge(test_graph,
+                       &values[rand() % DYNAMIC_NODE_COUNT],
+                       &values[rand() % DYNAMIC_NODE_COUNT],
+                       (size_t)rand() % DYNAMIC_WEIGHTS,
+                       0 == (rand() % 2));
+    }
+
+    paths = graph_paths_create(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(paths);
+    for (sources = 0; sources < DYNAMIC_SOURCES; sources++)
+    {
+        CU_ASSERT_EQUAL(graph_paths_add_source(paths, &values[sources]),
+                        E_SUCCESS);
+    }
+    CU_ASSERT_EQUAL(check_graph_paths(paths), sources);
+
+    for (int change = 0; change < DYNAMIC_CHANGES; change++)
+    {
+        src = rand() % DYNAMIC_NODE_COUNT;
+        dst = rand() % DYNAMIC_NODE_COUNT;
+        switch (rand() % 8)
+        {
+            case 0:
+            case 1:
+            case 2:
+                if (present[src] && present[dst])
+                {
+                    CU_ASSERT_EQUAL(graph_add_edge(test_graph,
+                                                   &values[src],
+                                                   &values[dst],
+                                                   (size_t)rand() %
+                                                       DYNAMIC_WEIGHTS,
+                                                   0 == (rand() % 2)),
+                                    E_SUCCESS);
+                }
+                break;
+            case 3:
+            case 4:
+            case 5:
+                // Only edges of a shortest path tree need repairs, so take
+                // the last edge of a path from node 0
+                if (E_SUCCESS != graph_paths_get_path(paths,
+                                                      &values[0],
+                                                      &values[dst],
+                                                      &path,
+                                                      &total))
+                {
+                    break;
+                }
+                if (NULL != path->tail->prev)
+                {
+                    CU_ASSERT_EQUAL(
+                        graph_remove_edge(test_graph,
+                                          path->tail->prev->data,
+                                          path->tail->data),
+                        E_SUCCESS);
+                }
+                list_delete(&path);
+                break;
+            case 6:
+                // Node 0 stays, so the tree edges above keep coming
+                if ((0 != src) && present[src])
+                {
+                    CU_ASSERT_EQUAL(graph_remove_node(test_graph, &values[src]),
+                                    E_SUCCESS);
+                    present[src] = false;
+                    sources -= (src < DYNAMIC_SOURCES) ? 1 : 0;
+                }
+                break;
+            default:
+                if (!present[src])
+                {
+                    CU_ASSERT_EQUAL(graph_add_node(test_graph, &values[src]),
+                                    E_SUCCESS);
+                    present[src] = true;
+                    if (src < DYNAMIC_SOURCES)
+                    {
+                        CU_ASSERT_EQUAL(
+                            graph_paths_add_source(paths, &values[src]),
+                            E_SUCCESS);
+                        sources++;
+                    }
+                }
+                break;
+        }
+        CU_ASSERT_EQUAL(check_graph_paths(paths), sources);
+    }
+
+    graph_paths_destroy(&paths);
+}
+
+void test_graph_freeze(void)
+{
+    graph_csr_t * csr   = NULL;
+    uint32_t      index = 0;
+
+    build_csr_graph();
+
+    csr = graph_freeze(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+    CU_ASSERT_EQUAL(csr->node_count, CSR_NODE_COUNT);
+    CU_ASSERT_EQUAL(csr->edge_count, 8);
+    CU_ASSERT_EQUAL(csr->offsets[csr->node_count], csr->edge_count);
+
+    for (int idx = 0; idx < CSR_NODE_COUNT; idx++)
+    {
+        index = graph_csr_node_index(csr, &csr_data[idx]);
+        CU_ASSERT_NOT_EQUAL_FATAL(index, GRAPH_CSR_NO_NODE);
+        CU_ASSERT_PTR_EQUAL(csr->node_data[index], &csr_data[idx]);
+    }
+    CU_ASSERT_EQUAL(graph_csr_node_index(csr, &visit_total),
+                    GRAPH_CSR_NO_NODE);
+
+    // Node 3 reaches 1 and 2 back over the bidirectional edges, and 4
+    index = graph_csr_node_index(csr, &csr_data[3]);
+    CU_ASSERT_EQUAL(csr->offsets[index + 1] - csr->offsets[index], 3);
+
+    CU_ASSERT_EQUAL(graph_csr_destroy(&csr), E_SUCCESS);
+    CU_ASSERT_PTR_NULL(csr);
+    CU_ASSERT_PTR_NULL(graph_freeze(NULL));
+}
+
+void test_graph_csr_traversals(void)
+{
+    graph_csr_t * csr                  = NULL;
+    uint32_t      hops[CSR_NODE_COUNT] = { 0 };
+    uint32_t      start                = 0;
+
+    build_csr_graph();
+    csr = graph_freeze(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+
+    visit_total = 0;
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_csr_bfs(csr, &csr_data[0], count_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 5);
+    CU_ASSERT_EQUAL(visit_total, 0 + 1 + 2 + 3 + 4);
+
+    visit_total = 0;
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_csr_dfs(csr, &csr_data[4], count_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 1);
+
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_csr_dfs(csr, &csr_data[3], count_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 4);
+
+    start = graph_csr_node_index(csr, &csr_data[0]);
+    CU_ASSERT_EQUAL(graph_csr_bfs_hops(csr, start, hops), E_SUCCESS);
+    CU_ASSERT_EQUAL(hops[graph_csr_node_index(csr, &csr_data[1])], 1);
+    CU_ASSERT_EQUAL(hops[graph_csr_node_index(csr, &csr_data[4])], 3);
+    CU_ASSERT_EQUAL(hops[graph_csr_node_index(csr, &csr_data[5])],
+                    UINT32_MAX);
+
+    CU_ASSERT_EQUAL(graph_csr_bfs(csr, &visit_total, count_visit), E_FAILURE);
+    graph_csr_destroy(&csr);
+}
+
+void test_graph_csr_shortest_path(void)
+{
+    graph_csr_t * csr      = NULL;
+    list_t *      path     = NULL;
+    size_t        distance = 0;
+    int           expected[] = { 0, 2, 1, 3, 4 };
+
+    build_csr_graph();
+    csr = graph_freeze(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+
+    CU_ASSERT_EQUAL(graph_csr_shortest_path(
+                        csr, &csr_data[0], &csr_data[4], &path, &distance),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(path);
+    CU_ASSERT_EQUAL(distance, 1 + 2 + 5 + 3);
+    CU_ASSERT_EQUAL(path->size, 5);
+    for (uint32_t idx = 0; idx < path->size; idx++)
+    {
+        CU_ASSERT_EQUAL(*(int *)list_peek_position(path, idx), expected[idx]);
+    }
+    list_delete(&path);
+
+    CU_ASSERT_EQUAL(graph_csr_shortest_path(
+                        csr, &csr_data[4], &csr_data[0], &path, &distance),
+                    E_FAILURE);
+    CU_ASSERT_PTR_NULL(path);
+
+    CU_ASSERT_EQUAL(graph_csr_shortest_path(
+                        csr, &csr_data[5], &csr_data[5], &path, NULL),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(path->size, 1);
+    list_delete(&path);
+
+    graph_csr_destroy(&csr);
+}
+
+void test_graph_csr_grid(void)
+{
+    graph_csr_t * csr                          = NULL;
+    list_t *      path                         = NULL;
+    size_t        distance                     = 0;
+    int           cells[GRID_SIDE * GRID_SIDE] = { 0 };
+    int           cell                         = 0;
+
+    for (cell = 0; cell < (GRID_SIDE * GRID_SIDE); cell++)
+    {
+        cells[cell] = cell;
+        graph_add_node(test_graph, &cells[cell]);
+    }
+
+    for (cell = 0; cell < (GRID_SIDE * GRID_SIDE); cell++)
+    {
+        if (0 != ((cell + 1) % GRID_SIDE))
+        {
+            graph_add_edge(test_graph, &cells[cell], &cells[cell + 1], 1, true);
+        }
+        if ((cell + GRID_SIDE) < (GRID_SIDE * GRID_SIDE))
+        {
+            graph_add_edge(
+                test_graph, &cells[cell], &cells[cell + GRID_SIDE], 1, true);
+        }
+    }
+
+    csr = graph_freeze(test_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+    CU_ASSERT_EQUAL(csr->edge_count, 4 * GRID_SIDE * (GRID_SIDE - 1));
+
+    visit_count = 0;
+    CU_ASSERT_EQUAL(graph_csr_dfs(csr, &cells[0], record_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, GRID_SIDE * GRID_SIDE);
+    check_preorder(csr);
+
+    CU_ASSERT_EQUAL(graph_csr_shortest_path(csr,
+                                            &cells[0],
+                                            &cells[(GRID_SIDE * GRID_SIDE) - 1],
+                                            &path,
+                                            &distance),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(distance, 2 * (GRID_SIDE - 1));
+    CU_ASSERT_EQUAL(path->size, (2 * (GRID_SIDE - 1)) + 1);
+
+    list_delete(&path);
+    graph_csr_destroy(&csr);
+}
+
 static CU_TestInfo adjacency_list_tests[] = {
     { "graph_create", test_graph_create },
     { "graph_add_node", test_graph_add_node },
@@ -299,11 +1537,35 @@ static CU_TestInfo adjacency_list_tests[] = {
     { "graph_is_cyclic", test_graph_is_cyclic },
     { "graph_node_degree", test_graph_node_degree },
     { "graph_get_adjacent_nodes", test_graph_get_adjacent_nodes },
+    { "graph_adjacent_nodes_distinct", test_graph_adjacent_nodes_distinct },
+    { "graph_connected_components", test_graph_connected_components },
+    { "graph_cycle_kinds", test_graph_cycle_kinds },
+    { "graph_strongly_connected_components",
+      test_graph_strongly_connected_components },
     { "graph_edge_exists", test_graph_edge_exists },
     { "graph_get_edge_weight", test_graph_get_edge_weight },
+    { "graph_edge_index", test_graph_edge_index },
+    { "graph_bulk_build", test_graph_bulk_build },
     { "graph_clone", test_graph_clone },
+    { "graph_clone_copy_on_write", test_graph_clone_copy_on_write },
+    { "graph_clone_remove_node", test_graph_clone_remove_node },
+    { "graph_clone_copies_touched_nodes",
+      test_graph_clone_copies_touched_nodes },
     { "graph_dfs", test_graph_dfs },
     { "graph_bfs", test_graph_bfs },
+    { "graph_node_ids", test_graph_node_ids },
+    { "graph_traversal_workspace", test_graph_traversal_workspace },
+    { "graph_traversal_long_chain", test_graph_traversal_long_chain },
+    { "graph_dijkstra", test_graph_dijkstra },
+    { "graph_dijkstra_bidirectional", test_graph_dijkstra_bidirectional },
+    { "graph_shortest_paths_agree", test_graph_shortest_paths_agree },
+    { "graph_floyd_warshall", test_graph_floyd_warshall },
+    { "graph_paths", test_graph_paths },
+    { "graph_paths_agree", test_graph_paths_agree },
+    { "graph_freeze", test_graph_freeze },
+    { "graph_csr_traversals", test_graph_csr_traversals },
+    { "graph_csr_shortest_path", test_graph_csr_shortest_path },
+    { "graph_csr_grid", test_graph_csr_grid },
     CU_TEST_INFO_NULL
 };
 
@@ -1,7 +1,50 @@
 /**
  * @file adjacency_matrix.h
  *
- * @brief
+ * @brief A graph stored as a dense adjacency matrix.
+ *
+ * Edge weights live in one contiguous, cache-line aligned row-major array,
+ * with each row padded to a whole number of cache lines. Whether an edge
+ * exists is tracked separately in a bitset of one bit per cell, so weights of
+ * any value (including 0) can be stored and rows can be scanned a 64-bit word
+ * at a time. Weights can be stored as size_t, or as 32- or 16-bit integers to
+ * shrink large matrices.
+ *
+ * An unweighted graph (MATRIX_WEIGHT_NONE) keeps only the bitset, one bit per
+ * cell. The bitset API below works on any graph: degrees are counted with
+ * popcount, neighbors are enumerated with count-trailing-zeros, and whole rows
+ * are combined with AVX2 AND/OR kernels when the CPU supports them, which is
+ * what BFS frontier expansion and common-neighbor (triangle) counting need.
+ *
+ * Node labels are interned once in a string table that also maps each label
+ * to its node index, so every *_by_label function resolves its nodes in O(1).
+ *
+ * Reachability within k hops, and the transitive closure, are powers of the
+ * adjacency bitset taken by repeated squaring. Each boolean product uses the
+ * Four Russians method: rows of the right matrix are combined eight at a time
+ * into a 256-entry table of ORs, one cache line of columns wide, so each left
+ * row needs one table lookup per eight columns instead of one OR per bit.
+ * Strips of columns are independent, which is how the Parallel library spreads
+ * the product over a thread pool.
+ *
+ * Point-to-point queries run A* over indices with an indexed heap as the open
+ * set. Its heuristic can be a caller's function, a precomputed vector of
+ * bounds, or landmark (ALT) bounds: matrix_landmarks_create() runs one
+ * Dijkstra from and to each of a few far-apart nodes, and every later query
+ * derives its bounds from those distances by the triangle inequality.
+ *
+ * A matrix_paths_t caches the shortest path trees of a few sources. The
+ * matrix repairs every attached one after each edge change, touching only
+ * the nodes whose paths change.
+ *
+ * Nodes keep their index for life. matrix_add_node() first reuses the slots
+ * of removed nodes, then appends; when the allocated slots run out the matrix
+ * doubles, so each append copies O(1) cells amortized.
+ *
+ * matrix_from_graph() and matrix_to_graph() copy a whole graph between this
+ * layout and the adjacency list of adjacency_list.h, writing matrix rows
+ * directly and reading them back a word at a time. The adaptive_graph module
+ * uses them to keep each graph in whichever layout suits its density.
  */
 #ifndef _ADJACENCY_MATRIX_H
 #define _ADJACENCY_MATRIX_H
@@ -11,15 +54,52 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "adjacency_list.h"
 #include "callback_types.h"
 
-typedef void (*FREE_F)(void *);
+#define MATRIX_NO_NODE           SIZE_MAX // Index of a missing node
+#define MATRIX_DISTANCE_INFINITY SIZE_MAX // Distance to an unreachable node
+
 typedef bool (*PREDICATE_F)(const void *, const char *);
-typedef size_t (*HEURISTIC_F)(const char *, const char *);
+typedef size_t (*MATRIX_LABEL_HEURISTIC_F)(const char *, const char *);
 
-typedef struct matrix matrix_t;
-typedef struct node   node_t;
-typedef struct edge   edge_t;
+typedef struct matrix           matrix_t;
+typedef struct matrix_node      matrix_node_t;
+typedef struct matrix_landmarks matrix_landmarks_t;
+typedef struct matrix_paths     matrix_paths_t;
+
+/**
+ * @brief A pointer to a function that bounds the weight of any path from
+ * 'node_index' to 'target_index' from below, for matrix_astar_by_index().
+ * It returns MATRIX_DISTANCE_INFINITY if it knows there is no such path.
+ */
+typedef size_t (*MATRIX_HEURISTIC_F)(size_t node_index,
+                                     size_t target_index,
+                                     void * context);
+
+/**
+ * @brief A pointer to a function that multiplies two square bit matrices over
+ * the boolean semiring, like matrix_bitset_multiply() over every word, for
+ * matrix_reachability_with(). The context is the pointer given to that
+ * function.
+ */
+typedef int (*MATRIX_MULTIPLY_F)(const uint64_t * left,
+                                 const uint64_t * right,
+                                 uint64_t *       product,
+                                 size_t           row_count,
+                                 size_t           row_words,
+                                 void *           context);
+
+/**
+ * @brief How edge weights are stored.
+ */
+typedef enum
+{
+    MATRIX_WEIGHT_SIZE_T, // Any size_t weight
+    MATRIX_WEIGHT_U32,    // Weights up to UINT32_MAX, half the memory
+    MATRIX_WEIGHT_U16,    // Weights up to UINT16_MAX, a quarter of the memory
+    MATRIX_WEIGHT_NONE    // Bits only; any weight is accepted and reads as 1
+} matrix_weight_t;
 
 // Primary API functions
 
@@ -38,6 +118,24 @@ matrix_t * matrix_init(size_t num_nodes,
                        CMP_F  custom_compare,
                        FREE_F custom_free);
 
+/**
+ * @brief Initializes a new graph with a chosen weight storage type.
+ *
+ * @param num_nodes The initial number of nodes in the graph.
+ * @param is_directed Flag indicating whether the graph is directed.
+ * @param weight_type How edge weights are stored. Adding an edge whose weight
+ * does not fit fails.
+ * @param custom_compare Pointer to a custom comparison function for node data.
+ * @param custom_free Pointer to a custom free function for node data.
+ * @return A pointer to the newly created graph, or NULL if initialization
+ * fails.
+ */
+matrix_t * matrix_init_weighted(size_t          num_nodes,
+                                bool            is_directed,
+                                matrix_weight_t weight_type,
+                                CMP_F           custom_compare,
+                                FREE_F          custom_free);
+
 /**
  * @brief Destroys the graph and frees all associated memory.
  *
@@ -51,7 +149,9 @@ void matrix_destroy(matrix_t ** graph_address);
  * @param graph Pointer to the graph.
  * @param index The index of the node to populate.
  * @param data Pointer to the data to assign to the node.
- * @param label The label to assign to the node.
+ * @param label The label to assign to the node, at most MAX_LABEL_SIZE
+ * characters. No other node may have the same label. The graph keeps its own
+ * copy.
  * @return Status code indicating success or failure.
  */
 int matrix_populate_node(matrix_t *   graph,
@@ -71,9 +171,14 @@ int matrix_depopulate_node(matrix_t * graph, size_t index);
 /**
  * @brief Adds a new node to the graph.
  *
+ * The node takes the slot of the most recently removed node if there is one,
+ * and a new slot after the last one otherwise. Its index can be found with
+ * the label. The graph frees the data with custom_free, as for
+ * matrix_populate_node().
+ *
  * @param graph Pointer to the graph.
  * @param data Pointer to the node's data.
- * @param label The label of the node.
+ * @param label The label of the node, unique within the graph.
  * @return Status code indicating success or failure.
  */
 int matrix_add_node(matrix_t * graph, const void * data, char * label);
@@ -81,6 +186,9 @@ int matrix_add_node(matrix_t * graph, const void * data, char * label);
 /**
  * @brief Removes a node and its associated edges from the graph.
  *
+ * The node's data is freed and its slot is kept for the next
+ * matrix_add_node(). Other nodes keep their indices.
+ *
  * @param graph Pointer to the graph.
  * @param label The label of the node to remove.
  * @return Status code indicating success or failure.
@@ -190,11 +298,14 @@ matrix_t * matrix_copy(const matrix_t * graph);
 /**
  * @brief Performs a Breadth-First Search (BFS) starting from a given node.
  *
+ * Nodes are visited level by level, and in ascending index order within a
+ * level. See matrix_bfs_by_index().
+ *
  * @param graph The graph on which to perform the BFS.
  * @param start_label The label of the node from which to start the BFS.
  * @param visit_action Function pointer to a callback function that is called
  *                     for each node as it is visited. The callback receives
- *                     the node's data and its label.
+ *                     the node's data, which is NULL for unpopulated nodes.
  * @return Status code indicating success or failure.
  */
 int matrix_bfs(const matrix_t * graph,
@@ -204,11 +315,14 @@ int matrix_bfs(const matrix_t * graph,
 /**
  * @brief Performs a Depth-First Search (DFS) starting from a given node.
  *
+ * Nodes are visited in preorder, taking neighbors in ascending index order.
+ * See matrix_dfs_by_index().
+ *
  * @param graph The graph on which to perform the DFS.
  * @param start_label The label of the node from which to start the DFS.
  * @param visit_action Function pointer to a callback function that is called
  *                     for each node as it is visited. The callback receives
- *                     the node's data and its label.
+ *                     the node's data, which is NULL for unpopulated nodes.
  * @return Status code indicating success or failure.
  */
 int matrix_dfs(const matrix_t * graph,
@@ -219,6 +333,9 @@ int matrix_dfs(const matrix_t * graph,
  * @brief Performs a flood fill starting from a given node, applying an action
  * to all connected nodes that satisfy a given predicate.
  *
+ * Only paths made entirely of matching nodes are followed. Nothing is filled
+ * if the start node does not match. See matrix_flood_fill_by_index().
+ *
  * @param graph The graph on which to perform the flood fill.
  * @param start_label The label of the node from which to start the fill.
  * @param predicate A function that determines if a node should be filled.
@@ -236,12 +353,16 @@ int matrix_flood_fill(matrix_t *   graph,
  * @brief Finds the shortest path between two nodes in a graph using Dijkstra's
  * algorithm.
  *
+ * The search runs on indices with matrix_dijkstra_by_index(), and labels are
+ * only copied for the nodes on the final path. Callers that can work with
+ * indices should call that function and matrix_get_label_by_index() instead.
+ *
  * @param graph The graph in which to find the shortest path.
  * @param start_label The label of the starting node.
  * @param target_label The label of the target node.
  * @param path An output parameter for storing the path as a dynamically
- * allocated array of node labels. The caller is responsible for freeing each
- * string and the array itself.
+ * allocated array of node labels, NULL for unpopulated nodes. The caller is
+ * responsible for freeing each string and the array itself.
  * @param path_length An output parameter for the number of nodes in the path.
  * @param total_weight An output parameter for the total weight of the path.
  * @return Status code indicating success or failure. Success includes
@@ -259,29 +380,33 @@ int matrix_dijkstra_shortest_path(const matrix_t * graph,
  * @brief Finds the shortest path between two nodes in a graph using the A*
  * algorithm.
  *
+ * The search runs on indices with matrix_astar_by_index(), calling the
+ * heuristic at most once per node reached, with the labels of that node and
+ * of the target. Unlabeled nodes get a bound of 0.
+ *
  * @param graph The graph in which to find the shortest path.
  * @param start_label The label of the starting node.
  * @param target_label The label of the target node.
  * @param heuristic Function pointer to a heuristic function that estimates the
  * cost from the current node to the target node. This function should take two
- * node labels as parameters and return an estimated cost as a size_t.
+ * node labels as parameters and return an estimated cost as a size_t, never
+ * more than the real cost. NULL searches like Dijkstra's algorithm.
  * @param path An output parameter for storing the path as a dynamically
- * allocated array of node labels. The caller is responsible for freeing each
- * string and the array itself.
+ * allocated array of node labels, NULL for unpopulated nodes. The caller is
+ * responsible for freeing each string and the array itself.
  * @param path_length An output parameter for the number of nodes in the path.
- * @param total_weight An output parameter for the total weight of the path,
- * including both the actual path weight and the heuristic estimates.
+ * @param total_weight An output parameter for the total weight of the path.
  * @return Status code indicating success or failure. Success includes
  * populating `path`, `path_length`, and `total_weight` with the shortest path
  * information.
  */
-int matrix_astar_shortest_path(const matrix_t * graph,
-                               const char *     start_label,
-                               const char *     target_label,
-                               HEURISTIC_F      heuristic,
-                               char ***         path,
-                               int *            path_length,
-                               size_t *         total_weight);
+int matrix_astar_shortest_path(const matrix_t *         graph,
+                               const char *             start_label,
+                               const char *             target_label,
+                               MATRIX_LABEL_HEURISTIC_F heuristic,
+                               char ***                 path,
+                               int *                    path_length,
+                               size_t *                 total_weight);
 
 /**
  * @brief Prints the graph's adjacency matrix and node labels to standard
@@ -293,32 +418,658 @@ void matrix_print(const matrix_t * graph);
 
 // Secondary API functions
 
+/**
+ * @brief Adds an edge between two nodes specified by their indices, or
+ * updates its weight if it already exists.
+ *
+ * @param graph Pointer to the graph.
+ * @param src_index The index of the source node.
+ * @param dst_index The index of the destination node.
+ * @param weight The weight of the edge.
+ * @return Status code indicating success or failure.
+ */
 int matrix_add_edge_by_index(matrix_t * graph,
                              size_t     src_index,
                              size_t     dst_index,
                              size_t     weight);
 
+/**
+ * @brief Removes an edge between two nodes specified by their indices.
+ *
+ * @param graph Pointer to the graph.
+ * @param src_index The index of the source node.
+ * @param dst_index The index of the destination node.
+ * @return Status code indicating success or failure.
+ */
 int matrix_remove_edge_by_index(matrix_t * graph,
                                 size_t     src_index,
                                 size_t     dst_index);
 
+/**
+ * @brief Sets the weight of an existing edge between two nodes.
+ *
+ * @param graph Pointer to the graph.
+ * @param src_index The index of the source node.
+ * @param dst_index The index of the destination node.
+ * @param edge_weight The new weight of the edge.
+ * @return Status code indicating success or failure.
+ */
 int matrix_set_edge_weight_by_index(matrix_t * graph,
                                     size_t     src_index,
                                     size_t     dst_index,
                                     size_t     edge_weight);
 
-int matrix_get_edge_weight_by_index(matrix_t * graph,
-                                    size_t     src_index,
-                                    size_t     dst_index,
-                                    size_t *   edge_weight);
+/**
+ * @brief Gets the weight of an edge between two nodes.
+ *
+ * @param graph Pointer to the graph.
+ * @param src_index The index of the source node.
+ * @param dst_index The index of the destination node.
+ * @param edge_weight Out parameter for the weight of the edge.
+ * @return Status code indicating success or failure.
+ */
+int matrix_get_edge_weight_by_index(const matrix_t * graph,
+                                    size_t           src_index,
+                                    size_t           dst_index,
+                                    size_t *         edge_weight);
 
+/**
+ * @brief Checks if there is an edge between two nodes.
+ *
+ * @param graph Pointer to the graph.
+ * @param src_index The index of the source node.
+ * @param dst_index The index of the destination node.
+ * @return 'true' if an edge exists, 'false' otherwise.
+ */
 int matrix_has_edge_by_index(const matrix_t * graph,
                              size_t           src_index,
                              size_t           dst_index);
 
+/**
+ * @brief Retrieves the indices of all neighbors of a node, in ascending order.
+ *
+ * @param graph Pointer to the graph.
+ * @param node_index The index of the node.
+ * @param num_neighbors Out parameter for the number of adjacent neighbors.
+ * @param neighbors Out parameter for an array of indices of neighboring nodes,
+ * or NULL if there are none. The caller frees it.
+ * @return Status code indicating success or failure.
+ */
 int matrix_get_neighbors_by_index(const matrix_t * graph,
                                   size_t           node_index,
+                                  size_t *         num_neighbors,
                                   size_t **        neighbors);
+
+/**
+ * @brief Performs a Breadth-First Search (BFS) starting from a given node.
+ *
+ * Each level is expanded with matrix_expand_frontier(), so the whole search
+ * costs O(V^2 / 64) word operations. Nodes are visited level by level, and in
+ * ascending index order within a level.
+ *
+ * @param graph The graph on which to perform the BFS.
+ * @param start_index The index of the node from which to start the BFS.
+ * @param visit_action Called with the data of each node as it is visited,
+ * which is NULL for unpopulated nodes.
+ * @return Status code indicating success or failure.
+ */
+int matrix_bfs_by_index(const matrix_t * graph,
+                        size_t           start_index,
+                        ACTION_F         visit_action);
+
+/**
+ * @brief Performs a Depth-First Search (DFS) starting from a given node.
+ *
+ * Each node keeps a cursor into its row of unvisited neighbors, so every row
+ * is scanned once and the search costs O(V^2 / 64) word operations. Nodes are
+ * visited in preorder, taking neighbors in ascending index order.
+ *
+ * @param graph The graph on which to perform the DFS.
+ * @param start_index The index of the node from which to start the DFS.
+ * @param visit_action Called with the data of each node as it is visited,
+ * which is NULL for unpopulated nodes.
+ * @return Status code indicating success or failure.
+ */
+int matrix_dfs_by_index(const matrix_t * graph,
+                        size_t           start_index,
+                        ACTION_F         visit_action);
+
+/**
+ * @brief Performs a flood fill starting from a given node.
+ *
+ * The fill advances one BFS level at a time. The predicate is run over every
+ * newly reached node of a level, then the fill action over every match of that
+ * level, and only the matches are expanded further. Each node is tested at
+ * most once.
+ *
+ * @param graph The graph on which to perform the flood fill.
+ * @param start_index The index of the node from which to start the fill.
+ * @param predicate Called with the data and label of each reached node.
+ * Returns true if the node should be filled.
+ * @param fill_action Called with the data of each filled node.
+ * @return Status code indicating success or failure.
+ */
+int matrix_flood_fill_by_index(matrix_t *  graph,
+                               size_t      start_index,
+                               PREDICATE_F predicate,
+                               ACTION_F    fill_action);
+
+/**
+ * @brief Looks up the label of a node without copying it.
+ *
+ * @param graph Pointer to the graph.
+ * @param node_index The index of the node.
+ * @return The label, valid until the node is depopulated or the graph is
+ * destroyed, or NULL if the node has none.
+ */
+const char * matrix_get_label_by_index(const matrix_t * graph,
+                                       size_t           node_index);
+
+/**
+ * @brief Number of node slots in the graph, populated or not.
+ *
+ * Every valid node index is below this count.
+ *
+ * @param graph Pointer to the graph.
+ * @return The number of slots, or 0 if graph is NULL.
+ */
+size_t matrix_get_node_count(const matrix_t * graph);
+
+/**
+ * @brief Adds a new node without a label.
+ *
+ * Takes a slot the same way as matrix_add_node(), and the graph frees the
+ * data with custom_free in the same way.
+ *
+ * @param graph Pointer to the graph.
+ * @param data Pointer to the node's data.
+ * @param node_index Out parameter for the index the node was given.
+ * @return Status code indicating success or failure.
+ */
+int matrix_add_node_by_index(matrix_t *   graph,
+                             const void * data,
+                             size_t *     node_index);
+
+/**
+ * @brief Removes a node and its associated edges from the graph.
+ *
+ * Same as matrix_remove_node(), for nodes with or without a label.
+ *
+ * @param graph Pointer to the graph.
+ * @param node_index The index of the node to remove.
+ * @return Status code indicating success or failure.
+ */
+int matrix_remove_node_by_index(matrix_t * graph, size_t node_index);
+
+/**
+ * @brief Retrieves the data associated with a specific node.
+ *
+ * @param graph Pointer to the graph.
+ * @param node_index The index of the node.
+ * @param data Out parameter for the node's data, NULL for an unpopulated
+ * node.
+ * @return Status code indicating success or failure.
+ */
+int matrix_get_node_data_by_index(const matrix_t * graph,
+                                  size_t           node_index,
+                                  void **          data);
+
+/**
+ * @brief Computes the shortest distance from one node to every node.
+ *
+ * Runs the O(V^2) array form of Dijkstra's algorithm, which beats a heap on
+ * dense graphs: each step picks the closest unsettled node with a vectorized
+ * minimum search, then relaxes its contiguous weight row four columns at a
+ * time, skipping runs of columns with no edge.
+ *
+ * @param graph Pointer to the graph.
+ * @param start_index The index of the source node.
+ * @param distances Out parameter for num_nodes distances, with
+ * MATRIX_DISTANCE_INFINITY for unreachable nodes.
+ * @param parents Out parameter for the previous node on a shortest path to
+ * each node, with MATRIX_NO_NODE for the source and unreachable nodes, or
+ * NULL if not needed.
+ * @return Status code indicating success or failure.
+ */
+int matrix_shortest_distances_by_index(const matrix_t * graph,
+                                       size_t           start_index,
+                                       size_t *         distances,
+                                       size_t *         parents);
+
+/**
+ * @brief Finds the shortest path between two nodes with Dijkstra's algorithm.
+ *
+ * Works like matrix_shortest_distances_by_index(), stopping as soon as the
+ * target is settled.
+ *
+ * @param graph Pointer to the graph.
+ * @param start_index The index of the starting node.
+ * @param target_index The index of the target node.
+ * @param path Out parameter for the indices of the nodes on the path, from
+ * start to target. The caller frees it.
+ * @param path_length Out parameter for the number of nodes in the path.
+ * @param total_weight Out parameter for the total weight of the path.
+ * @return Status code indicating success or failure, including when the
+ * target cannot be reached.
+ */
+int matrix_dijkstra_by_index(const matrix_t * graph,
+                             size_t           start_index,
+                             size_t           target_index,
+                             size_t **        path,
+                             size_t *         path_length,
+                             size_t *         total_weight);
+
+/**
+ * @brief Finds the shortest path between two nodes with the A* algorithm.
+ *
+ * The open set is an indexed heap keyed on distance plus bound, so a node
+ * whose distance improves is moved up in place rather than queued twice. A
+ * node whose bound is MATRIX_DISTANCE_INFINITY is never queued. The path is
+ * shortest whenever the bounds never overestimate; nodes are reopened when
+ * their distance improves, so the bounds need not be consistent.
+ *
+ * @param graph Pointer to the graph.
+ * @param start_index The index of the starting node.
+ * @param target_index The index of the target node.
+ * @param heuristic Bounds the remaining weight from each node, called at most
+ * once per node reached, or NULL to search like Dijkstra's algorithm. See
+ * matrix_vector_heuristic() and matrix_landmark_heuristic().
+ * @param context Passed to every call of the heuristic.
+ * @param path Out parameter for the indices of the nodes on the path, from
+ * start to target. The caller frees it.
+ * @param path_length Out parameter for the number of nodes in the path.
+ * @param total_weight Out parameter for the total weight of the path.
+ * @return Status code indicating success or failure, including when the
+ * target cannot be reached.
+ */
+int matrix_astar_by_index(const matrix_t *   graph,
+                          size_t             start_index,
+                          size_t             target_index,
+                          MATRIX_HEURISTIC_F heuristic,
+                          void *             context,
+                          size_t **          path,
+                          size_t *           path_length,
+                          size_t *           total_weight);
+
+/**
+ * @brief A heuristic that reads precomputed bounds to a fixed target.
+ *
+ * @param node_index The index of the node.
+ * @param target_index Unused; the bounds are all to the same target.
+ * @param context An array holding the bound of every node.
+ * @return The bound of the node.
+ */
+size_t matrix_vector_heuristic(size_t node_index,
+                               size_t target_index,
+                               void * context);
+
+/**
+ * @brief Picks landmarks and computes their distances for ALT bounds.
+ *
+ * Landmarks are picked one at a time as the node farthest from every
+ * landmark picked so far, and each costs one O(V^2) Dijkstra run from it, plus
+ * one to it on a directed graph. The result answers any number of queries on
+ * the same edges; rebuild it after edges are added, removed or lowered.
+ *
+ * @param graph Pointer to the graph.
+ * @param count The number of landmarks wanted. Fewer are picked if the graph
+ * has fewer nodes, or if every node is already covered.
+ * @return The landmarks, or NULL on failure. Free with
+ * matrix_landmarks_destroy().
+ */
+matrix_landmarks_t * matrix_landmarks_create(const matrix_t * graph,
+                                             size_t           count);
+
+/**
+ * @brief Reads the landmarks that were picked.
+ *
+ * @param landmarks The landmarks.
+ * @param count Out parameter for the number of landmarks.
+ * @return The index of each landmark, valid until the landmarks are
+ * destroyed, or NULL on failure.
+ */
+const size_t * matrix_landmarks_get_nodes(const matrix_landmarks_t * landmarks,
+                                          size_t *                   count);
+
+/**
+ * @brief A heuristic that bounds distances with the triangle inequality over
+ * every landmark L:
+ *
+ *     d(v, t) >= d(L, t) - d(L, v)   and   d(v, t) >= d(v, L) - d(t, L)
+ *
+ * It also reports the target unreachable when some landmark proves it. Nodes
+ * added after the landmarks were built get a bound of 0.
+ *
+ * @param node_index The index of the node.
+ * @param target_index The index of the target node.
+ * @param context The matrix_landmarks_t of the graph.
+ * @return The largest of the bounds.
+ */
+size_t matrix_landmark_heuristic(size_t node_index,
+                                 size_t target_index,
+                                 void * context);
+
+/**
+ * @brief Frees landmarks and sets the caller's pointer to NULL.
+ *
+ * @param landmarks_address Pointer to the landmarks.
+ */
+void matrix_landmarks_destroy(matrix_landmarks_t ** landmarks_address);
+
+// Dynamic shortest path API functions
+
+/**
+ * @brief Starts tracking shortest paths in a graph as its edges change.
+ *
+ * Each registered source keeps a cached distance and parent array. The paths
+ * are attached to the graph, and every edge change made to it afterwards,
+ * whether through matrix_paths_set_edge(), the matrix_add_edge,
+ * matrix_set_edge_weight and matrix_remove_edge functions or by removing a
+ * node, repairs every source in place instead of running Dijkstra's
+ * algorithm again.
+ *
+ * Adding a node that grows the graph leaves the paths stale until
+ * matrix_paths_refresh(): in the meantime edge changes skip them, and they
+ * refuse queries and edge changes of their own.
+ *
+ * Only this matrix_t is tracked. For a graph_t, including one made with
+ * matrix_to_graph(), use graph_paths_create() instead.
+ *
+ * @param graph Pointer to the graph, which must outlive the paths.
+ * @return Pointer to the new paths with no sources, or NULL on failure.
+ */
+matrix_paths_t * matrix_paths_create(matrix_t * graph);
+
+/**
+ * @brief Registers a source and computes its shortest paths.
+ *
+ * @param paths Pointer to the paths.
+ * @param source_index The index of the source node, not yet registered.
+ * @return Status code indicating success or failure.
+ */
+int matrix_paths_add_source(matrix_paths_t * paths, size_t source_index);
+
+/**
+ * @brief Stops tracking a source and frees its cached arrays.
+ *
+ * @param paths Pointer to the paths.
+ * @param source_index The index of the source node.
+ * @return Status code indicating success or failure.
+ */
+int matrix_paths_remove_source(matrix_paths_t * paths, size_t source_index);
+
+/**
+ * @brief Adds an edge or changes its weight, and repairs every source. Does
+ * the same as matrix_add_edge_by_index(), but fails while the paths need a
+ * refresh.
+ *
+ * Follows Ramalingam and Reps. A lighter edge is relaxed and the improvement
+ * spreads Dijkstra-style through the nodes it shortens. A heavier edge only
+ * matters to the nodes below it in a source's shortest path tree; those that
+ * still have another parent at the same distance keep it, and only the rest
+ * are recomputed, from their unaffected neighbors inward. In both cases the
+ * work grows with the part of the tree that changes rather than with the
+ * graph.
+ *
+ * @param paths Pointer to the paths.
+ * @param src_index The index of the source node of the edge.
+ * @param dst_index The index of the destination node of the edge.
+ * @param weight The weight of the edge.
+ * @return Status code indicating success or failure.
+ */
+int matrix_paths_set_edge(matrix_paths_t * paths,
+                          size_t           src_index,
+                          size_t           dst_index,
+                          size_t           weight);
+
+/**
+ * @brief Removes an edge and repairs every source, as for an edge whose
+ * weight went up to infinity.
+ *
+ * @param paths Pointer to the paths.
+ * @param src_index The index of the source node of the edge.
+ * @param dst_index The index of the destination node of the edge.
+ * @return Status code indicating success or failure.
+ */
+int matrix_paths_remove_edge(matrix_paths_t * paths,
+                             size_t           src_index,
+                             size_t           dst_index);
+
+/**
+ * @brief Recomputes every source from scratch, after changes made to the
+ * graph directly.
+ *
+ * @param paths Pointer to the paths.
+ * @return Status code indicating success or failure.
+ */
+int matrix_paths_refresh(matrix_paths_t * paths);
+
+/**
+ * @brief Reads the cached distances of a source.
+ *
+ * @param paths Pointer to the paths.
+ * @param source_index The index of the source node.
+ * @return One distance per node slot, laid out as for
+ * matrix_shortest_distances_by_index() and kept up to date by later edge
+ * changes, or NULL if the source is not registered or the paths need a
+ * refresh.
+ */
+const size_t * matrix_paths_get_distances(const matrix_paths_t * paths,
+                                          size_t                 source_index);
+
+/**
+ * @brief Reads a shortest path from the cached parents of a source.
+ *
+ * @param paths Pointer to the paths.
+ * @param source_index The index of the source node.
+ * @param target_index The index of the target node.
+ * @param path Out parameter for the indices of the nodes on the path, from
+ * source to target. The caller frees it.
+ * @param path_length Out parameter for the number of nodes in the path.
+ * @param total_weight Out parameter for the total weight of the path.
+ * @return Status code indicating success or failure, including when the
+ * target cannot be reached or the paths need a refresh.
+ */
+int matrix_paths_get_path(const matrix_paths_t * paths,
+                          size_t                 source_index,
+                          size_t                 target_index,
+                          size_t **              path,
+                          size_t *               path_length,
+                          size_t *               total_weight);
+
+/**
+ * @brief Frees the paths and sets the caller's pointer to NULL. The graph is
+ * left as it is.
+ *
+ * @param paths_address Pointer to the paths.
+ */
+void matrix_paths_destroy(matrix_paths_t ** paths_address);
+
+// Bitset API functions
+
+/**
+ * @brief Counts the edges leaving a node in O(V / 64).
+ *
+ * @param graph Pointer to the graph.
+ * @param node_index The index of the node.
+ * @param degree Out parameter for the number of neighbors.
+ * @return Status code indicating success or failure.
+ */
+int matrix_get_degree_by_index(const matrix_t * graph,
+                               size_t           node_index,
+                               size_t *         degree);
+
+/**
+ * @brief Number of 64-bit words in a node set of the graph.
+ *
+ * Node sets passed to matrix_expand_frontier() hold node `i` in bit `i % 64`
+ * of word `i / 64`. The count is padded to a whole cache line, and the padding
+ * bits must be zero. It grows when matrix_add_node() grows the graph.
+ *
+ * @param graph Pointer to the graph.
+ * @return The number of words, or 0 if graph is NULL.
+ */
+size_t matrix_bitset_words(const matrix_t * graph);
+
+/**
+ * @brief Performs one step of a breadth-first search over whole words.
+ *
+ * Sets `next` to every node reachable over one edge from a node in `frontier`
+ * that is not in `visited`. `next` may not overlap the other two sets.
+ *
+ * @param graph Pointer to the graph.
+ * @param frontier The nodes to expand, matrix_bitset_words() words long.
+ * @param visited The nodes to leave out, matrix_bitset_words() words long.
+ * @param next Out parameter for the new frontier, matrix_bitset_words() words
+ * long.
+ * @return Status code indicating success or failure.
+ */
+int matrix_expand_frontier(const matrix_t * graph,
+                           const uint64_t * frontier,
+                           const uint64_t * visited,
+                           uint64_t *       next);
+
+/**
+ * @brief Counts the nodes that both nodes have an edge to, in O(V / 64).
+ *
+ * @param graph Pointer to the graph.
+ * @param first_index The index of the first node.
+ * @param second_index The index of the second node.
+ * @param count Out parameter for the number of common neighbors.
+ * @return Status code indicating success or failure.
+ */
+int matrix_common_neighbors_by_index(const matrix_t * graph,
+                                     size_t           first_index,
+                                     size_t           second_index,
+                                     size_t *         count);
+
+/**
+ * @brief Counts the triangles of an undirected graph in O(E * V / 64).
+ *
+ * Self-loops are ignored.
+ *
+ * @param graph Pointer to an undirected graph.
+ * @param triangles Out parameter for the number of triangles.
+ * @return Status code indicating success or failure.
+ */
+int matrix_count_triangles(const matrix_t * graph, size_t * triangles);
+
+/**
+ * @brief Multiplies two square bit matrices over the boolean semiring, for a
+ * block of product rows and columns:
+ *
+ *     product[i] = OR of right[j] for every bit j set in left[i]
+ *
+ * Only words [first_word, first_word + word_count) of product rows
+ * [first_row, first_row + block_rows) are written. Blocks made of whole
+ * cache lines can be computed independently, on different threads. Each
+ * call builds its lookup tables from every row of right, so blocks of fewer
+ * rows than a few hundred spend more time on tables than on the product.
+ * Bits of left past row_count must be zero.
+ *
+ * @param left Row-major, row_count rows of row_words words.
+ * @param right Row-major, row_count rows of row_words words.
+ * @param product Out parameter, row_count rows of row_words words. May not
+ * overlap left or right.
+ * @param row_count The number of rows, at most row_words * 64.
+ * @param row_words Words per row, a multiple of eight as returned by
+ * matrix_bitset_words().
+ * @param first_row The first product row to compute.
+ * @param block_rows The number of product rows to compute.
+ * @param first_word The first product word of each row to compute.
+ * @param word_count The number of product words of each row to compute.
+ * @return Status code indicating success or failure.
+ */
+int matrix_bitset_multiply(const uint64_t * left,
+                           const uint64_t * right,
+                           uint64_t *       product,
+                           size_t           row_count,
+                           size_t           row_words,
+                           size_t           first_row,
+                           size_t           block_rows,
+                           size_t           first_word,
+                           size_t           word_count);
+
+/**
+ * @brief Finds which nodes each node reaches within a number of hops.
+ *
+ * Takes (I + A)^hops by repeated squaring, so it costs O(log hops) products
+ * of O(V^3 / (8 * 64)) word operations each, and stops early once the powers
+ * stop changing.
+ *
+ * @param graph Pointer to the graph.
+ * @param hops The most edges on a path. Every node reaches itself in 0 hops.
+ * Counts of num_nodes - 1 or more give the transitive closure.
+ * @param reach Out parameter for num_nodes rows of matrix_bitset_words()
+ * words, where bit j of row i is set if i reaches j. The caller frees it.
+ * @return Status code indicating success or failure.
+ */
+int matrix_reachability(const matrix_t * graph, size_t hops, uint64_t ** reach);
+
+/**
+ * @brief Works like matrix_reachability(), taking every product with the
+ * given function, for example one that spreads strips of columns over
+ * threads.
+ *
+ * @param graph Pointer to the graph.
+ * @param hops The most edges on a path.
+ * @param multiply The product function, or NULL for matrix_bitset_multiply()
+ * over every word.
+ * @param context Passed to every call of the product function.
+ * @param reach Out parameter for the reachability rows. The caller frees it.
+ * @return Status code indicating success or failure.
+ */
+int matrix_reachability_with(const matrix_t *  graph,
+                             size_t            hops,
+                             MATRIX_MULTIPLY_F multiply,
+                             void *            context,
+                             uint64_t **       reach);
+
+/**
+ * @brief Finds every node each node reaches, itself included.
+ *
+ * Same as matrix_reachability() with unlimited hops.
+ *
+ * @param graph Pointer to the graph.
+ * @param closure Out parameter for the closure rows. The caller frees it.
+ * @return Status code indicating success or failure.
+ */
+int matrix_transitive_closure(const matrix_t * graph, uint64_t ** closure);
+
+// Conversion API functions
+
+/**
+ * @brief Copies an adjacency list graph into a new matrix in O(V^2 / 64 + E).
+ *
+ * The node with ID `i` in the list graph becomes the unlabeled node at index
+ * `i`. Nodes joined by more than one edge keep the lightest one. The matrix
+ * shares the node data with the list graph and never frees it, so the data
+ * must outlive the matrix, and it compares data with the list graph's compare
+ * function.
+ *
+ * @param graph Pointer to the list graph.
+ * @param is_directed Whether the matrix keeps one-way edges. An undirected
+ * matrix can only be made from a graph whose edges are all two-way.
+ * @param weight_type How the matrix stores weights; every weight must fit.
+ * @return Pointer to the new matrix, or NULL on failure.
+ */
+matrix_t * matrix_from_graph(const graph_t * graph,
+                             bool            is_directed,
+                             matrix_weight_t weight_type);
+
+/**
+ * @brief Copies a matrix into a new adjacency list graph in O(V^2 / 64 + E).
+ *
+ * Only populated nodes are copied, in index order. A directed matrix gives one
+ * one-way edge per set cell, and an undirected matrix one two-way edge per
+ * pair of nodes. The list graph shares the node data with the matrix and
+ * never frees it, so the data must outlive the list graph.
+ *
+ * @param graph Pointer to the matrix.
+ * @return Pointer to the new list graph, or NULL on failure.
+ */
+graph_t * matrix_to_graph(const matrix_t * graph);
+
 #endif /* _ADJACENCY_MATRIX_H */
 
 /*** end of file ***/
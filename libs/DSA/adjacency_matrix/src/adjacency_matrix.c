@@ -1,28 +1,472 @@
+#include <limits.h> // INT_MAX
+#include <string.h> // memset()
+
 #include "adjacency_matrix.h"
+#include "priority_queue.h"
 #include "string_operations.h"
+#include "string_table.h"
 #include "utilities.h"
 
-struct node
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MATRIX_X86 1
+#include <immintrin.h>
+#endif
+
+#define CACHE_LINE_SIZE  64 // Alignment of the matrix and of every row
+#define BITS_PER_WORD    64
+#define WORDS_PER_LINE   (CACHE_LINE_SIZE / sizeof(uint64_t))
+#define MATRIX_MAX_NODES UINT32_MAX // Far beyond what fits in memory
+#define MIN_CAPACITY     16         // Node slots allocated by the first growth
+#define TRIANGLE_SIDES   3 // Each triangle is found once from each edge
+#define DIJKSTRA_LANES   4 // Distances per AVX2 vector
+
+// Right rows combined per Four Russians table, and entries in the table
+#define FOUR_RUSSIANS_BITS    8
+#define FOUR_RUSSIANS_ENTRIES (1 << FOUR_RUSSIANS_BITS)
+
+/**
+ * @brief One node on the stack of a depth-first search
+ */
+typedef struct dfs_frame
 {
-    void * data;  // Data for the node
-    char * label; // Node label
-};
+    size_t node; // Index of the node
+    size_t word; // First row word that may still hold an unvisited neighbor
+} dfs_frame_t;
+
+/**
+ * @brief A pointer to a kernel that ORs one row into another:
+ *
+ *     destination[i] |= source[i]   for every i in [0, words)
+ */
+typedef void (*ROW_OR_F)(uint64_t *       destination,
+                         const uint64_t * source,
+                         size_t           words);
+
+/**
+ * @brief A pointer to a kernel that counts the bits two rows share:
+ *
+ *     sum of popcount(first[i] & second[i])   for every i in [0, words)
+ */
+typedef size_t (*ROW_AND_COUNT_F)(const uint64_t * first,
+                                  const uint64_t * second,
+                                  size_t           words);
+
+/**
+ * @brief Working arrays of one Dijkstra run, padded to whole AVX2 vectors
+ */
+typedef struct dijkstra_state
+{
+    size_t * distances; // Best known distance to every node
+    size_t * keys;      // Distance of every unsettled node, else infinity
+    size_t * parents;   // Previous node on the best known path
+    size_t   count;     // Entries in each array, a multiple of DIJKSTRA_LANES
+} dijkstra_state_t;
+
+/**
+ * @brief A pointer to a kernel that finds the closest unsettled node:
+ *
+ *     the lowest i in [0, count) minimising keys[i]
+ *
+ * Returns MATRIX_NO_NODE if every key is infinite.
+ */
+typedef size_t (*ARGMIN_F)(const size_t * keys, size_t count);
 
-struct edge
+/**
+ * @brief A pointer to a kernel that relaxes every edge (node, v):
+ *
+ *     if distances[node] + weight < distances[v], lower distances[v] and
+ *     keys[v] to it and set parents[v] to node
+ *
+ * Sums that overflow are ignored. Settled nodes are never lowered, since
+ * weights are unsigned.
+ */
+typedef void (*RELAX_F)(const matrix_t *   graph,
+                        size_t             node,
+                        dijkstra_state_t * state);
+
+struct matrix_node
 {
-    size_t weight; // Weight of the edge
+    void *       data;    // Data for the node
+    const char * label;   // Interned node label, or NULL
+    bool         is_free; // Whether the slot is on the free list
 };
 
 struct matrix
 {
-    edge_t ** edges;          // 2D array to represent the graph's edges
-    node_t *  nodes;          // Array of nodes
-    size_t    num_nodes;      // Number of nodes in the graph
-    bool      is_directed;    // Flag indicating whether the graph is directed
-    CMP_F     custom_compare; // A custom function to compare node data
-    FREE_F    custom_free;    // A custom function to free node data
+    void *           weights;        // Row-major weights, one aligned block
+    uint64_t *       present;        // Row-major edge bits, one aligned block
+    size_t           stride;         // Weights per row, padded to a line
+    size_t           row_words;      // Presence words per row
+    matrix_weight_t  weight_type;    // How each weight is stored
+    size_t           weight_size;    // Bytes per stored weight
+    matrix_node_t *  nodes;          // Array of nodes
+    size_t           num_nodes;      // Number of node slots in use
+    size_t           capacity;       // Number of node slots allocated
+    size_t *         free_slots;     // Slots of removed nodes, to reuse
+    size_t           free_count;     // Number of entries in free_slots
+    bool             is_directed;    // Whether edges go one way only
+    string_table_t * labels;         // Interned labels, bound to node indices
+    CMP_F            custom_compare; // A custom function to compare node data
+    FREE_F           custom_free;    // A custom function to free node data
+    matrix_paths_t * paths;          // Paths repaired on edge changes
+};
+
+struct matrix_landmarks
+{
+    size_t * nodes;      // Index of each landmark
+    size_t   count;      // Number of landmarks
+    size_t   node_count; // Nodes in the graph when the distances were taken
+    size_t * from;       // Row per landmark: distance from it to every node
+    size_t * to;         // Row per landmark: distance from every node to it
+};
+
+/**
+ * @brief Cached shortest path tree of one source
+ */
+typedef struct matrix_source
+{
+    size_t   index;     // Index of the source node
+    size_t * distances; // Distance from the source to every node
+    size_t * parents;   // Previous node on each shortest path
+} matrix_source_t;
+
+struct matrix_paths
+{
+    matrix_t *         graph;      // The graph being tracked
+    size_t             node_count; // Nodes in the graph when last refreshed
+    matrix_source_t *  sources;    // Array of registered sources
+    size_t             count;      // Number of registered sources
+    size_t             capacity;   // Number of sources allocated
+    priority_queue_t * queue;      // Queue shared by every repair
+    size_t *           scratch;    // Child lists and subtree of a repair
+    uint8_t *          marks;      // State of each node during a repair
+    matrix_paths_t *   next;       // Next paths attached to the graph
+};
+
+/**
+ * @brief What a repair after a heavier edge knows about a node
+ */
+enum repair_mark
+{
+    REPAIR_UNTOUCHED = 0, // Outside the subtree below the edge
+    REPAIR_PENDING,       // In the subtree, not yet checked
+    REPAIR_KEPT,          // In the subtree, distance unchanged
+    REPAIR_AFFECTED,      // In the subtree, distance to recompute
 };
 
+/**
+ * @brief Context of the adapter that runs a label heuristic on indices
+ */
+typedef struct label_heuristic
+{
+    const matrix_t *         graph;     // The graph being searched
+    MATRIX_LABEL_HEURISTIC_F heuristic; // The caller's heuristic on labels
+} label_heuristic_t;
+
+/**
+ * @brief Allocates a zeroed block aligned to a cache line.
+ *
+ * @param size Number of bytes needed.
+ * @return Pointer to the block, or NULL on failure. Free with free().
+ */
+static void * aligned_calloc(size_t size);
+
+/**
+ * @brief Reallocates the matrix for a new number of node slots.
+ *
+ * Existing rows keep their indices and contents; only the padding of every
+ * row is widened. Growing by doubling copies each cell O(1) times amortized.
+ *
+ * @return E_SUCCESS on success, E_FAILURE if the capacity is too large or on
+ * allocation failure, in which case the graph is unchanged.
+ */
+static int resize_rows(matrix_t * graph, size_t capacity);
+
+/**
+ * @brief Puts a node in the most recently freed slot, or in a new slot after
+ * the last one, growing the graph if needed.
+ *
+ * @param label The node's label, or NULL to leave it without one.
+ * @param index Out parameter for the node's index.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int insert_node(matrix_t *   graph,
+                       const void * data,
+                       const char * label,
+                       size_t *     index);
+
+/**
+ * @brief Clears every edge into and out of a node.
+ */
+static void clear_node_edges(matrix_t * graph, size_t index);
+
+/**
+ * @brief Checks that both indices name nodes of the graph.
+ */
+static bool valid_indices(const matrix_t * graph,
+                          size_t           src_index,
+                          size_t           dst_index);
+
+/**
+ * @brief Largest weight the graph's weight type can hold.
+ */
+static size_t max_weight(const matrix_t * graph);
+
+/**
+ * @brief Reads the weight stored in one cell.
+ */
+static size_t load_weight(const matrix_t * graph, size_t row, size_t column);
+
+/**
+ * @brief Writes a weight into one cell, and into its mirror if the graph is
+ * undirected. The weight must fit the weight type.
+ */
+static void store_weight(matrix_t * graph,
+                         size_t     row,
+                         size_t     column,
+                         size_t     weight);
+
+/**
+ * @brief Sets or clears the presence bit of one cell, and of its mirror if
+ * the graph is undirected.
+ */
+static void mark_edge(matrix_t * graph, size_t row, size_t column, bool is_set);
+
+/**
+ * @brief Checks the presence bit of one cell.
+ */
+static bool edge_present(const matrix_t * graph, size_t row, size_t column);
+
+/**
+ * @brief Finds the index of the node with the given label in O(1).
+ *
+ * @return E_SUCCESS if found, E_FAILURE otherwise.
+ */
+static int find_label(const matrix_t * graph,
+                      const char *     label,
+                      size_t *         index);
+
+/**
+ * @brief Finds the indices of the nodes at both ends of an edge.
+ *
+ * @return E_SUCCESS if both are found, E_FAILURE otherwise.
+ */
+static int find_labels(const matrix_t * graph,
+                       const char *     src_label,
+                       const char *     dst_label,
+                       size_t *         src_index,
+                       size_t *         dst_index);
+
+/**
+ * @brief Calls the action on the data of every node in a node set, in
+ * ascending index order.
+ */
+static void visit_set(const matrix_t * graph,
+                      const uint64_t * set,
+                      ACTION_F         action);
+
+/**
+ * @brief Allocates the arrays of a Dijkstra run from 'start_index' in one
+ * aligned block. Free it with free(state->distances).
+ */
+static int dijkstra_init(const matrix_t *   graph,
+                         size_t             start_index,
+                         dijkstra_state_t * state);
+
+/**
+ * @brief Settles nodes in order of distance until 'target_index' is settled,
+ * or every reachable node if it is MATRIX_NO_NODE.
+ */
+static void dijkstra_run(const matrix_t *   graph,
+                         size_t             target_index,
+                         dijkstra_state_t * state);
+
+/**
+ * @brief Follows 'parents' back from 'target_index' and stores the path from
+ * the start in a new array.
+ */
+static int trace_path(const size_t * parents,
+                      size_t         target_index,
+                      size_t **      path,
+                      size_t *       path_length);
+
+/**
+ * @brief Copies the labels of the nodes on a path into a new array, NULL for
+ * unlabeled nodes.
+ */
+static int copy_path_labels(const matrix_t * graph,
+                            const size_t *   indices,
+                            size_t           length,
+                            char ***         path,
+                            int *            path_length);
+
+/**
+ * @brief Runs the caller's label heuristic of a label_heuristic_t.
+ */
+static size_t label_heuristic(size_t node_index,
+                              size_t target_index,
+                              void * context);
+
+/**
+ * @brief Returns a copy of the edges with every edge reversed, and no node
+ * data or labels.
+ */
+static matrix_t * transpose(const matrix_t * graph);
+
+/**
+ * @brief Picks the node farthest from every landmark so far, skipping free
+ * slots. Returns MATRIX_NO_NODE if every node is at distance 0.
+ */
+static size_t farthest_node(const matrix_t * graph, const size_t * closest);
+
+/**
+ * @brief Finds the cached tree of a registered source.
+ *
+ * @return Pointer to the source, or NULL if it is not registered.
+ */
+static matrix_source_t * find_source(const matrix_paths_t * paths,
+                                     size_t                 source_index);
+
+/**
+ * @brief Reallocates the queue and scratch arrays shared by every source for
+ * the graph's current number of node slots. The old ones are kept on
+ * failure.
+ */
+static int resize_paths(matrix_paths_t * paths);
+
+/**
+ * @brief Repairs every source after the edge from src_index to dst_index
+ * changed weight, with MATRIX_DISTANCE_INFINITY standing for no edge.
+ */
+static void repair_edge(matrix_paths_t * paths,
+                        size_t           src_index,
+                        size_t           dst_index,
+                        size_t           old_weight,
+                        size_t           new_weight);
+
+/**
+ * @brief Relaxes a lighter edge and queues its destination if it got closer.
+ */
+static void lower_edge(matrix_paths_t *  paths,
+                       matrix_source_t * source,
+                       size_t            src_index,
+                       size_t            dst_index);
+
+/**
+ * @brief Repairs the subtree below root after the edge into it got heavier.
+ */
+static void raise_edge(matrix_paths_t *  paths,
+                       matrix_source_t * source,
+                       size_t            root);
+
+/**
+ * @brief Finds the in-neighbor outside the affected subtree that leads to a
+ * node most cheaply. Returns MATRIX_NO_NODE if there is none.
+ */
+static size_t best_parent(const matrix_paths_t *  paths,
+                          const matrix_source_t * source,
+                          size_t                  node,
+                          size_t *                distance);
+
+/**
+ * @brief Runs Dijkstra's algorithm from the queued nodes. With only_affected
+ * set, only nodes marked REPAIR_AFFECTED are relaxed.
+ */
+static void settle_paths(matrix_paths_t *  paths,
+                         matrix_source_t * source,
+                         bool              only_affected);
+
+/**
+ * @brief Repairs every paths attached to the graph after the edge from
+ * src_index to dst_index changed from old_weight. Paths waiting for a refresh
+ * are skipped.
+ */
+static void notify_paths(matrix_t * graph,
+                         size_t     src_index,
+                         size_t     dst_index,
+                         size_t     old_weight);
+
+/**
+ * @brief Removes an edge that exists and repairs the attached paths.
+ */
+static void drop_edge(matrix_t * graph, size_t src_index, size_t dst_index);
+
+/**
+ * @brief Runs matrix_bitset_multiply() over every word, as a
+ * MATRIX_MULTIPLY_F.
+ */
+static int multiply_serial(const uint64_t * left,
+                           const uint64_t * right,
+                           uint64_t *       product,
+                           size_t           row_count,
+                           size_t           row_words,
+                           void *           context);
+
+/**
+ * @brief Free function for graphs made by conversion, which share their node
+ * data and do not own it.
+ */
+static void keep_data(void * data);
+
+/**
+ * @brief Picks the widest argmin kernel the CPU supports.
+ */
+static ARGMIN_F select_argmin_kernel(void);
+
+/**
+ * @brief Picks the widest relaxation kernel the CPU supports.
+ */
+static RELAX_F select_relax_kernel(void);
+
+/**
+ * @brief Portable argmin kernel.
+ */
+static size_t argmin_scalar(const size_t * keys, size_t count);
+
+/**
+ * @brief Portable relaxation kernel; visits only the set bits of the row.
+ */
+static void relax_scalar(const matrix_t *   graph,
+                         size_t             node,
+                         dijkstra_state_t * state);
+
+/**
+ * @brief Picks the widest row OR kernel the CPU supports.
+ */
+static ROW_OR_F select_or_kernel(void);
+
+/**
+ * @brief Picks the widest row AND-popcount kernel the CPU supports.
+ */
+static ROW_AND_COUNT_F select_count_kernel(void);
+
+/**
+ * @brief Portable row OR kernel.
+ */
+static void row_or_scalar(uint64_t *       destination,
+                          const uint64_t * source,
+                          size_t           words);
+
+/**
+ * @brief Portable row AND-popcount kernel.
+ */
+static size_t row_and_count_scalar(const uint64_t * first,
+                                   const uint64_t * second,
+                                   size_t           words);
+
+#ifdef MATRIX_X86
+static void   row_or_avx2(uint64_t *       destination,
+                          const uint64_t * source,
+                          size_t           words);
+static size_t row_and_count_avx2(const uint64_t * first,
+                                 const uint64_t * second,
+                                 size_t           words);
+static size_t argmin_avx2(const size_t * keys, size_t count);
+static void   relax_avx2(const matrix_t *   graph,
+                         size_t             node,
+                         dijkstra_state_t * state);
+#endif
+
 static void graph_cleanup(matrix_t ** graph)
 {
     if ((NULL == graph) || (NULL == *graph))
@@ -31,23 +475,23 @@ static void graph_cleanup(matrix_t ** graph)
         goto END;
     }
 
-    // Free each edge
-    for (size_t idx = 0; idx < (*graph)->num_nodes; idx++)
-    {
-        if (NULL != (*graph)->edges[idx])
-        {
-            free((*graph)->edges[idx]);
-            (*graph)->edges[idx] = NULL;
-        }
-    }
+    free((*graph)->weights);
+    (*graph)->weights = NULL;
 
-    // Free the edge array
-    free((*graph)->edges);
-    (*graph)->edges = NULL;
+    free((*graph)->present);
+    (*graph)->present = NULL;
 
     free((*graph)->nodes);
     (*graph)->nodes = NULL;
 
+    free((*graph)->free_slots);
+    (*graph)->free_slots = NULL;
+
+    if (NULL != (*graph)->labels)
+    {
+        string_table_delete(&(*graph)->labels);
+    }
+
     free(*graph);
     (*graph) = NULL;
 
@@ -60,47 +504,68 @@ matrix_t * matrix_init(size_t num_nodes,
                        CMP_F  custom_compare,
                        FREE_F custom_free)
 {
-    matrix_t * graph = NULL;
+    return matrix_init_weighted(num_nodes,
+                                is_directed,
+                                MATRIX_WEIGHT_SIZE_T,
+                                custom_compare,
+                                custom_free);
+}
+
+matrix_t * matrix_init_weighted(size_t          num_nodes,
+                                bool            is_directed,
+                                matrix_weight_t weight_type,
+                                CMP_F           custom_compare,
+                                FREE_F          custom_free)
+{
+    matrix_t * graph       = NULL;
+    size_t     weight_size = sizeof(size_t);
 
     if ((NULL == custom_compare) || (NULL == custom_free))
     {
-        PRINT_DEBUG("matrix_init(): NULL argument passed.");
+        PRINT_DEBUG("matrix_init_weighted(): NULL argument passed.");
         goto END;
     }
 
+    switch (weight_type)
+    {
+        case MATRIX_WEIGHT_SIZE_T:
+            weight_size = sizeof(size_t);
+            break;
+        case MATRIX_WEIGHT_U32:
+            weight_size = sizeof(uint32_t);
+            break;
+        case MATRIX_WEIGHT_U16:
+            weight_size = sizeof(uint16_t);
+            break;
+        case MATRIX_WEIGHT_NONE:
+            weight_size = 0;
+            break;
+        default:
+            PRINT_DEBUG("matrix_init_weighted(): Invalid weight type.");
+            goto END;
+    }
+
     graph = calloc(1, sizeof(matrix_t));
     if (NULL == graph)
     {
-        PRINT_DEBUG("matrix_init(): graph - CMR failure.");
-        graph_cleanup(&graph);
+        PRINT_DEBUG("matrix_init_weighted(): graph - CMR failure.");
         goto END;
     }
 
-    // Create an array to hold edges
-    graph->edges = calloc(num_nodes, sizeof(edge_t *));
-    if (NULL == graph->edges)
+    graph->weight_type = weight_type;
+    graph->weight_size = weight_size;
+
+    if (E_SUCCESS != resize_rows(graph, num_nodes))
     {
-        PRINT_DEBUG("matrix_init(): graph->edges - CMR failure.");
+        PRINT_DEBUG("matrix_init_weighted(): Unable to allocate nodes.");
         graph_cleanup(&graph);
         goto END;
     }
 
-    // Allocate space for each initial edge
-    for (size_t idx = 0; idx < num_nodes; idx++)
-    {
-        graph->edges[idx] = calloc(num_nodes, sizeof(edge_t));
-        if (NULL == graph->edges[idx])
-        {
-            PRINT_DEBUG("matrix_init(): graph->edges[idx] - CMR failure.");
-            graph_cleanup(&graph);
-            goto END;
-        }
-    }
-
-    graph->nodes = calloc(num_nodes, sizeof(node_t));
-    if (NULL == graph->nodes)
+    graph->labels = string_table_new(num_nodes);
+    if (NULL == graph->labels)
     {
-        PRINT_DEBUG("matrix_init(): graph->nodes - CMR failure.");
+        PRINT_DEBUG("matrix_init_weighted(): graph->labels - CMR failure.");
         graph_cleanup(&graph);
         goto END;
     }
@@ -114,13 +579,35 @@ END:
     return graph;
 }
 
+void matrix_destroy(matrix_t ** graph_address)
+{
+    if ((NULL == graph_address) || (NULL == *graph_address))
+    {
+        PRINT_DEBUG("matrix_destroy(): NULL argument passed.");
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < (*graph_address)->num_nodes; idx++)
+    {
+        if (NULL != (*graph_address)->nodes[idx].data)
+        {
+            matrix_depopulate_node(*graph_address, idx);
+        }
+    }
+
+    graph_cleanup(graph_address);
+
+END:
+    return;
+}
+
 int matrix_populate_node(matrix_t *   graph,
                          size_t       index,
                          void *       data,
                          const char * label)
 {
-    int    exit_code  = E_FAILURE;
-    char * label_copy = NULL;
+    int    exit_code = E_FAILURE;
+    size_t owner     = 0;
 
     if ((NULL == graph) || (NULL == data) || (NULL == label))
     {
@@ -128,15 +615,42 @@ int matrix_populate_node(matrix_t *   graph,
         goto END;
     }
 
-    // exit_code = copy_string(label, &label_copy, MAX_LABEL_SIZE, false);
-    // if (E_SUCCESS != exit_code)
-    // {
-    //     PRINT_DEBUG("matrix_populate_node(): Unable to copy label.");
-    //     goto END;
-    // }
+    if (index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_populate_node(): Index out of range.");
+        goto END;
+    }
+
+    if (MAX_LABEL_SIZE < strlen(label))
+    {
+        PRINT_DEBUG("matrix_populate_node(): Label too long.");
+        goto END;
+    }
+
+    owner = string_table_get(graph->labels, label);
+    if ((STRING_TABLE_NO_VALUE != owner) && (index != owner))
+    {
+        PRINT_DEBUG("matrix_populate_node(): Label already in use.");
+        goto END;
+    }
+
+    exit_code = string_table_set(graph->labels, label, index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_populate_node(): Unable to intern label.");
+        goto END;
+    }
+
+    // Release the node's previous label, if it had a different one
+    if ((NULL != graph->nodes[index].label) &&
+        (STRING_TABLE_NO_VALUE == owner))
+    {
+        string_table_set(
+            graph->labels, graph->nodes[index].label, STRING_TABLE_NO_VALUE);
+    }
 
     graph->nodes[index].data  = data;
-    graph->nodes[index].label = label_copy;
+    graph->nodes[index].label = string_table_intern(graph->labels, label);
 
     exit_code = E_SUCCESS;
 END:
@@ -153,15 +667,3573 @@ int matrix_depopulate_node(matrix_t * graph, size_t index)
         goto END;
     }
 
+    if (index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_depopulate_node(): Index out of range.");
+        goto END;
+    }
+
     graph->custom_free(graph->nodes[index].data);
     graph->nodes[index].data = NULL;
 
-    free(graph->nodes[index].label);
-    graph->nodes[index].label = NULL;
+    // The interned copy stays in the table for the next node to use it
+    if (NULL != graph->nodes[index].label)
+    {
+        string_table_set(
+            graph->labels, graph->nodes[index].label, STRING_TABLE_NO_VALUE);
+        graph->nodes[index].label = NULL;
+    }
 
     exit_code = E_SUCCESS;
 END:
     return exit_code;
 }
 
+int matrix_add_node(matrix_t * graph, const void * data, char * label)
+{
+    int    exit_code = E_FAILURE;
+    size_t index     = 0;
+
+    if ((NULL == graph) || (NULL == data) || (NULL == label))
+    {
+        PRINT_DEBUG("matrix_add_node(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = insert_node(graph, data, label, &index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_add_node(): Unable to add node.");
+        goto END;
+    }
+
+END:
+    return exit_code;
+}
+
+int matrix_remove_node(matrix_t * graph, char * label)
+{
+    int    exit_code = E_FAILURE;
+    size_t index     = 0;
+
+    if ((NULL == graph) || (NULL == label))
+    {
+        PRINT_DEBUG("matrix_remove_node(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_label(graph, label, &index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_remove_node(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_remove_node_by_index(graph, index);
+
+END:
+    return exit_code;
+}
+
+int matrix_get_node_data(const matrix_t * graph,
+                         const char *     label,
+                         void **          data)
+{
+    int    exit_code = E_FAILURE;
+    size_t index     = 0;
+
+    if ((NULL == graph) || (NULL == label) || (NULL == data))
+    {
+        PRINT_DEBUG("matrix_get_node_data(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_label(graph, label, &index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_get_node_data(): Node not found.");
+        goto END;
+    }
+
+    *data = graph->nodes[index].data;
+
+END:
+    return exit_code;
+}
+
+int matrix_add_edge_by_label(matrix_t *   graph,
+                             const char * src_label,
+                             const char * dst_label,
+                             size_t       weight)
+{
+    int    exit_code = E_FAILURE;
+    size_t src_index = 0;
+    size_t dst_index = 0;
+
+    if ((NULL == graph) || (NULL == src_label) || (NULL == dst_label))
+    {
+        PRINT_DEBUG("matrix_add_edge_by_label(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code =
+        find_labels(graph, src_label, dst_label, &src_index, &dst_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_add_edge_by_label(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_add_edge_by_index(graph, src_index, dst_index, weight);
+
+END:
+    return exit_code;
+}
+
+int matrix_remove_edge_by_label(matrix_t *   graph,
+                                const char * src_label,
+                                const char * dst_label)
+{
+    int    exit_code = E_FAILURE;
+    size_t src_index = 0;
+    size_t dst_index = 0;
+
+    if ((NULL == graph) || (NULL == src_label) || (NULL == dst_label))
+    {
+        PRINT_DEBUG("matrix_remove_edge_by_label(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code =
+        find_labels(graph, src_label, dst_label, &src_index, &dst_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_remove_edge_by_label(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_remove_edge_by_index(graph, src_index, dst_index);
+
+END:
+    return exit_code;
+}
+
+int matrix_set_edge_weight_by_label(matrix_t *   graph,
+                                    const char * src_label,
+                                    const char * dst_label,
+                                    size_t       edge_weight)
+{
+    int    exit_code = E_FAILURE;
+    size_t src_index = 0;
+    size_t dst_index = 0;
+
+    if ((NULL == graph) || (NULL == src_label) || (NULL == dst_label))
+    {
+        PRINT_DEBUG("matrix_set_edge_weight_by_label(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code =
+        find_labels(graph, src_label, dst_label, &src_index, &dst_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_set_edge_weight_by_label(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_set_edge_weight_by_index(
+        graph, src_index, dst_index, edge_weight);
+
+END:
+    return exit_code;
+}
+
+int matrix_get_edge_weight_by_label(const matrix_t * graph,
+                                    const char *     src_label,
+                                    const char *     dst_label,
+                                    size_t *         edge_weight)
+{
+    int    exit_code = E_FAILURE;
+    size_t src_index = 0;
+    size_t dst_index = 0;
+
+    if ((NULL == graph) || (NULL == src_label) || (NULL == dst_label) ||
+        (NULL == edge_weight))
+    {
+        PRINT_DEBUG("matrix_get_edge_weight_by_label(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code =
+        find_labels(graph, src_label, dst_label, &src_index, &dst_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_get_edge_weight_by_label(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_get_edge_weight_by_index(
+        graph, src_index, dst_index, edge_weight);
+
+END:
+    return exit_code;
+}
+
+int matrix_has_edge_by_label(const matrix_t * graph,
+                             const char *     src_label,
+                             const char *     dst_label)
+{
+    bool   has_edge  = false;
+    size_t src_index = 0;
+    size_t dst_index = 0;
+
+    if ((NULL == graph) || (NULL == src_label) || (NULL == dst_label))
+    {
+        PRINT_DEBUG("matrix_has_edge_by_label(): NULL argument passed.");
+        goto END;
+    }
+
+    if (E_SUCCESS ==
+        find_labels(graph, src_label, dst_label, &src_index, &dst_index))
+    {
+        has_edge = matrix_has_edge_by_index(graph, src_index, dst_index);
+    }
+
+END:
+    return has_edge;
+}
+
+int matrix_get_neighbors_by_label(const matrix_t * graph,
+                                  const char *     node_label,
+                                  size_t *         num_neighbors,
+                                  size_t **        neighbors)
+{
+    int    exit_code  = E_FAILURE;
+    size_t node_index = 0;
+
+    if ((NULL == graph) || (NULL == node_label) || (NULL == num_neighbors) ||
+        (NULL == neighbors))
+    {
+        PRINT_DEBUG("matrix_get_neighbors_by_label(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_label(graph, node_label, &node_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_get_neighbors_by_label(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_get_neighbors_by_index(
+        graph, node_index, num_neighbors, neighbors);
+
+END:
+    return exit_code;
+}
+
+int matrix_add_edge_by_index(matrix_t * graph,
+                             size_t     src_index,
+                             size_t     dst_index,
+                             size_t     weight)
+{
+    int    exit_code  = E_FAILURE;
+    size_t old_weight = MATRIX_DISTANCE_INFINITY;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_add_edge_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!valid_indices(graph, src_index, dst_index))
+    {
+        PRINT_DEBUG("matrix_add_edge_by_index(): Index out of range.");
+        goto END;
+    }
+
+    if (weight > max_weight(graph))
+    {
+        PRINT_DEBUG("matrix_add_edge_by_index(): Weight does not fit.");
+        goto END;
+    }
+
+    if (edge_present(graph, src_index, dst_index))
+    {
+        old_weight = load_weight(graph, src_index, dst_index);
+    }
+
+    store_weight(graph, src_index, dst_index, weight);
+    mark_edge(graph, src_index, dst_index, true);
+    notify_paths(graph, src_index, dst_index, old_weight);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_remove_edge_by_index(matrix_t * graph,
+                                size_t     src_index,
+                                size_t     dst_index)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_remove_edge_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!valid_indices(graph, src_index, dst_index))
+    {
+        PRINT_DEBUG("matrix_remove_edge_by_index(): Index out of range.");
+        goto END;
+    }
+
+    if (!edge_present(graph, src_index, dst_index))
+    {
+        PRINT_DEBUG("matrix_remove_edge_by_index(): Edge does not exist.");
+        goto END;
+    }
+
+    drop_edge(graph, src_index, dst_index);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_set_edge_weight_by_index(matrix_t * graph,
+                                    size_t     src_index,
+                                    size_t     dst_index,
+                                    size_t     edge_weight)
+{
+    int    exit_code  = E_FAILURE;
+    size_t old_weight = 0;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_set_edge_weight_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!valid_indices(graph, src_index, dst_index) ||
+        !edge_present(graph, src_index, dst_index))
+    {
+        PRINT_DEBUG("matrix_set_edge_weight_by_index(): Edge does not exist.");
+        goto END;
+    }
+
+    if (edge_weight > max_weight(graph))
+    {
+        PRINT_DEBUG("matrix_set_edge_weight_by_index(): Weight does not fit.");
+        goto END;
+    }
+
+    old_weight = load_weight(graph, src_index, dst_index);
+    store_weight(graph, src_index, dst_index, edge_weight);
+    notify_paths(graph, src_index, dst_index, old_weight);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_get_edge_weight_by_index(const matrix_t * graph,
+                                    size_t           src_index,
+                                    size_t           dst_index,
+                                    size_t *         edge_weight)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == graph) || (NULL == edge_weight))
+    {
+        PRINT_DEBUG("matrix_get_edge_weight_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!valid_indices(graph, src_index, dst_index) ||
+        !edge_present(graph, src_index, dst_index))
+    {
+        PRINT_DEBUG("matrix_get_edge_weight_by_index(): Edge does not exist.");
+        goto END;
+    }
+
+    *edge_weight = load_weight(graph, src_index, dst_index);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_has_edge_by_index(const matrix_t * graph,
+                             size_t           src_index,
+                             size_t           dst_index)
+{
+    bool has_edge = false;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_has_edge_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    has_edge = valid_indices(graph, src_index, dst_index) &&
+               edge_present(graph, src_index, dst_index);
+
+END:
+    return has_edge;
+}
+
+int matrix_get_neighbors_by_index(const matrix_t * graph,
+                                  size_t           node_index,
+                                  size_t *         num_neighbors,
+                                  size_t **        neighbors)
+{
+    int              exit_code = E_FAILURE;
+    const uint64_t * row       = NULL;
+    uint64_t         word      = 0;
+    size_t           count     = 0;
+
+    if ((NULL == graph) || (NULL == num_neighbors) || (NULL == neighbors))
+    {
+        PRINT_DEBUG("matrix_get_neighbors_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    *num_neighbors = 0;
+    *neighbors     = NULL;
+
+    if (node_index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_get_neighbors_by_index(): Index out of range.");
+        goto END;
+    }
+
+    // Size the result first so it needs a single allocation
+    row = &graph->present[node_index * graph->row_words];
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        count += (size_t)__builtin_popcountll(row[idx]);
+    }
+
+    if (0 != count)
+    {
+        *neighbors = calloc(count, sizeof(size_t));
+        if (NULL == *neighbors)
+        {
+            PRINT_DEBUG("matrix_get_neighbors_by_index(): CMR failure.");
+            goto END;
+        }
+    }
+
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        for (word = row[idx]; 0 != word; word &= word - 1)
+        {
+            (*neighbors)[(*num_neighbors)++] =
+                (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_bfs(const matrix_t * graph,
+               const char *     start_label,
+               ACTION_F         visit_action)
+{
+    int    exit_code   = E_FAILURE;
+    size_t start_index = 0;
+
+    if ((NULL == graph) || (NULL == start_label) || (NULL == visit_action))
+    {
+        PRINT_DEBUG("matrix_bfs(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_label(graph, start_label, &start_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_bfs(): Start node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_bfs_by_index(graph, start_index, visit_action);
+
+END:
+    return exit_code;
+}
+
+int matrix_dfs(const matrix_t * graph,
+               const char *     start_label,
+               ACTION_F         visit_action)
+{
+    int    exit_code   = E_FAILURE;
+    size_t start_index = 0;
+
+    if ((NULL == graph) || (NULL == start_label) || (NULL == visit_action))
+    {
+        PRINT_DEBUG("matrix_dfs(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_label(graph, start_label, &start_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_dfs(): Start node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_dfs_by_index(graph, start_index, visit_action);
+
+END:
+    return exit_code;
+}
+
+int matrix_flood_fill(matrix_t *   graph,
+                      const char * start_label,
+                      PREDICATE_F  predicate,
+                      ACTION_F     fill_action)
+{
+    int    exit_code   = E_FAILURE;
+    size_t start_index = 0;
+
+    if ((NULL == graph) || (NULL == start_label) || (NULL == predicate) ||
+        (NULL == fill_action))
+    {
+        PRINT_DEBUG("matrix_flood_fill(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_label(graph, start_label, &start_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_flood_fill(): Start node not found.");
+        goto END;
+    }
+
+    exit_code =
+        matrix_flood_fill_by_index(graph, start_index, predicate, fill_action);
+
+END:
+    return exit_code;
+}
+
+int matrix_bfs_by_index(const matrix_t * graph,
+                        size_t           start_index,
+                        ACTION_F         visit_action)
+{
+    int        exit_code = E_FAILURE;
+    uint64_t * sets      = NULL;
+    uint64_t * frontier  = NULL;
+    uint64_t * visited   = NULL;
+    uint64_t * next      = NULL;
+    uint64_t * swap      = NULL;
+    uint64_t   start_bit = 0;
+    bool       is_empty  = false;
+
+    if ((NULL == graph) || (NULL == visit_action))
+    {
+        PRINT_DEBUG("matrix_bfs_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (start_index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_bfs_by_index(): Index out of range.");
+        goto END;
+    }
+
+    sets = aligned_calloc(3 * graph->row_words * sizeof(uint64_t));
+    if (NULL == sets)
+    {
+        PRINT_DEBUG("matrix_bfs_by_index(): CMR failure.");
+        goto END;
+    }
+
+    frontier = sets;
+    visited  = &sets[graph->row_words];
+    next     = &sets[2 * graph->row_words];
+
+    start_bit = (uint64_t)1 << (start_index % BITS_PER_WORD);
+    frontier[start_index / BITS_PER_WORD] = start_bit;
+    visited[start_index / BITS_PER_WORD]  = start_bit;
+
+    while (!is_empty)
+    {
+        visit_set(graph, frontier, visit_action);
+
+        exit_code = matrix_expand_frontier(graph, frontier, visited, next);
+        if (E_SUCCESS != exit_code)
+        {
+            PRINT_DEBUG("matrix_bfs_by_index(): Unable to expand frontier.");
+            goto END;
+        }
+
+        is_empty = true;
+        for (size_t idx = 0; idx < graph->row_words; idx++)
+        {
+            visited[idx] |= next[idx];
+            is_empty = is_empty && (0 == next[idx]);
+        }
+
+        swap     = frontier;
+        frontier = next;
+        next     = swap;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(sets);
+    return exit_code;
+}
+
+int matrix_dfs_by_index(const matrix_t * graph,
+                        size_t           start_index,
+                        ACTION_F         visit_action)
+{
+    int              exit_code = E_FAILURE;
+    uint64_t *       visited   = NULL;
+    dfs_frame_t *    stack     = NULL;
+    dfs_frame_t *    frame     = NULL;
+    const uint64_t * row       = NULL;
+    uint64_t         word      = 0;
+    size_t           depth     = 0;
+    size_t           child     = 0;
+
+    if ((NULL == graph) || (NULL == visit_action))
+    {
+        PRINT_DEBUG("matrix_dfs_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (start_index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_dfs_by_index(): Index out of range.");
+        goto END;
+    }
+
+    // Nodes are marked when pushed, so the stack never exceeds num_nodes
+    visited = aligned_calloc(graph->row_words * sizeof(uint64_t));
+    stack   = calloc(graph->num_nodes, sizeof(dfs_frame_t));
+    if ((NULL == visited) || (NULL == stack))
+    {
+        PRINT_DEBUG("matrix_dfs_by_index(): CMR failure.");
+        goto END;
+    }
+
+    visited[start_index / BITS_PER_WORD] =
+        (uint64_t)1 << (start_index % BITS_PER_WORD);
+    visit_action(graph->nodes[start_index].data);
+    stack[depth++].node = start_index;
+
+    while (0 != depth)
+    {
+        frame = &stack[depth - 1];
+        row   = &graph->present[frame->node * graph->row_words];
+
+        // Words with no unvisited neighbor never need scanning again
+        for (word = 0; frame->word < graph->row_words; frame->word++)
+        {
+            word = row[frame->word] & ~visited[frame->word];
+            if (0 != word)
+            {
+                break;
+            }
+        }
+
+        if (0 == word)
+        {
+            depth--;
+            continue;
+        }
+
+        child = (frame->word * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+        visited[frame->word] |= word & -word;
+        visit_action(graph->nodes[child].data);
+
+        stack[depth].node   = child;
+        stack[depth++].word = 0;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(visited);
+    free(stack);
+    return exit_code;
+}
+
+int matrix_flood_fill_by_index(matrix_t *  graph,
+                               size_t      start_index,
+                               PREDICATE_F predicate,
+                               ACTION_F    fill_action)
+{
+    int        exit_code = E_FAILURE;
+    uint64_t * sets      = NULL;
+    uint64_t * frontier  = NULL;
+    uint64_t * tested    = NULL;
+    uint64_t * next      = NULL;
+    uint64_t * swap      = NULL;
+    uint64_t   start_bit = 0;
+    uint64_t   word      = 0;
+    size_t     node      = 0;
+    bool       is_empty  = false;
+
+    if ((NULL == graph) || (NULL == predicate) || (NULL == fill_action))
+    {
+        PRINT_DEBUG("matrix_flood_fill_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (start_index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_flood_fill_by_index(): Index out of range.");
+        goto END;
+    }
+
+    sets = aligned_calloc(3 * graph->row_words * sizeof(uint64_t));
+    if (NULL == sets)
+    {
+        PRINT_DEBUG("matrix_flood_fill_by_index(): CMR failure.");
+        goto END;
+    }
+
+    frontier = sets;
+    tested   = &sets[graph->row_words];
+    next     = &sets[2 * graph->row_words];
+
+    start_bit = (uint64_t)1 << (start_index % BITS_PER_WORD);
+    tested[start_index / BITS_PER_WORD] = start_bit;
+    if (predicate(graph->nodes[start_index].data,
+                  graph->nodes[start_index].label))
+    {
+        frontier[start_index / BITS_PER_WORD] = start_bit;
+    }
+    else
+    {
+        is_empty = true;
+    }
+
+    while (!is_empty)
+    {
+        visit_set(graph, frontier, fill_action);
+
+        exit_code = matrix_expand_frontier(graph, frontier, tested, next);
+        if (E_SUCCESS != exit_code)
+        {
+            PRINT_DEBUG(
+                "matrix_flood_fill_by_index(): Unable to expand frontier.");
+            goto END;
+        }
+
+        // Test the whole level, keeping only the matches as the next frontier
+        is_empty = true;
+        for (size_t idx = 0; idx < graph->row_words; idx++)
+        {
+            tested[idx] |= next[idx];
+            for (word = next[idx]; 0 != word; word &= word - 1)
+            {
+                node = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+                if (!predicate(graph->nodes[node].data,
+                               graph->nodes[node].label))
+                {
+                    next[idx] &= ~(word & -word);
+                }
+            }
+            is_empty = is_empty && (0 == next[idx]);
+        }
+
+        swap     = frontier;
+        frontier = next;
+        next     = swap;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(sets);
+    return exit_code;
+}
+
+const char * matrix_get_label_by_index(const matrix_t * graph,
+                                       size_t           node_index)
+{
+    const char * label = NULL;
+
+    if ((NULL == graph) || (node_index >= graph->num_nodes))
+    {
+        PRINT_DEBUG("matrix_get_label_by_index(): Invalid argument passed.");
+        goto END;
+    }
+
+    label = graph->nodes[node_index].label;
+END:
+    return label;
+}
+
+size_t matrix_get_node_count(const matrix_t * graph)
+{
+    return (NULL == graph) ? 0 : graph->num_nodes;
+}
+
+int matrix_add_node_by_index(matrix_t *   graph,
+                             const void * data,
+                             size_t *     node_index)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == graph) || (NULL == data) || (NULL == node_index))
+    {
+        PRINT_DEBUG("matrix_add_node_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = insert_node(graph, data, NULL, node_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_add_node_by_index(): Unable to add node.");
+        goto END;
+    }
+
+END:
+    return exit_code;
+}
+
+int matrix_remove_node_by_index(matrix_t * graph, size_t node_index)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_remove_node_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if ((node_index >= graph->num_nodes) ||
+        (NULL == graph->nodes[node_index].data))
+    {
+        PRINT_DEBUG("matrix_remove_node_by_index(): Node not found.");
+        goto END;
+    }
+
+    // Attached paths are repaired one edge at a time; otherwise the edges
+    // are cleared a word at a time
+    if (NULL != graph->paths)
+    {
+        for (size_t other = 0; other < graph->num_nodes; other++)
+        {
+            if (edge_present(graph, node_index, other))
+            {
+                drop_edge(graph, node_index, other);
+            }
+            if (edge_present(graph, other, node_index))
+            {
+                drop_edge(graph, other, node_index);
+            }
+        }
+    }
+    clear_node_edges(graph, node_index);
+
+    exit_code = matrix_depopulate_node(graph, node_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_remove_node_by_index(): Unable to depopulate.");
+        goto END;
+    }
+
+    // A slot is listed at most once, so the list never outgrows capacity
+    if (!graph->nodes[node_index].is_free)
+    {
+        graph->nodes[node_index].is_free       = true;
+        graph->free_slots[graph->free_count++] = node_index;
+    }
+
+END:
+    return exit_code;
+}
+
+int matrix_get_node_data_by_index(const matrix_t * graph,
+                                  size_t           node_index,
+                                  void **          data)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == graph) || (NULL == data))
+    {
+        PRINT_DEBUG("matrix_get_node_data_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (node_index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_get_node_data_by_index(): Index out of range.");
+        goto END;
+    }
+
+    *data = graph->nodes[node_index].data;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_shortest_distances_by_index(const matrix_t * graph,
+                                       size_t           start_index,
+                                       size_t *         distances,
+                                       size_t *         parents)
+{
+    int              exit_code = E_FAILURE;
+    dijkstra_state_t state     = { 0 };
+
+    if ((NULL == graph) || (NULL == distances))
+    {
+        PRINT_DEBUG(
+            "matrix_shortest_distances_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (start_index >= graph->num_nodes)
+    {
+        PRINT_DEBUG(
+            "matrix_shortest_distances_by_index(): Index out of range.");
+        goto END;
+    }
+
+    exit_code = dijkstra_init(graph, start_index, &state);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_shortest_distances_by_index(): CMR failure.");
+        goto END;
+    }
+
+    dijkstra_run(graph, MATRIX_NO_NODE, &state);
+
+    memcpy(distances, state.distances, graph->num_nodes * sizeof(size_t));
+    if (NULL != parents)
+    {
+        memcpy(parents, state.parents, graph->num_nodes * sizeof(size_t));
+    }
+
+END:
+    free(state.distances);
+    return exit_code;
+}
+
+int matrix_dijkstra_by_index(const matrix_t * graph,
+                             size_t           start_index,
+                             size_t           target_index,
+                             size_t **        path,
+                             size_t *         path_length,
+                             size_t *         total_weight)
+{
+    int              exit_code = E_FAILURE;
+    dijkstra_state_t state     = { 0 };
+
+    if ((NULL == graph) || (NULL == path) || (NULL == path_length) ||
+        (NULL == total_weight))
+    {
+        PRINT_DEBUG("matrix_dijkstra_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!valid_indices(graph, start_index, target_index))
+    {
+        PRINT_DEBUG("matrix_dijkstra_by_index(): Index out of range.");
+        goto END;
+    }
+
+    exit_code = dijkstra_init(graph, start_index, &state);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_dijkstra_by_index(): CMR failure.");
+        goto END;
+    }
+
+    dijkstra_run(graph, target_index, &state);
+
+    if (MATRIX_DISTANCE_INFINITY == state.distances[target_index])
+    {
+        PRINT_DEBUG("matrix_dijkstra_by_index(): Target is unreachable.");
+        exit_code = E_FAILURE;
+        goto END;
+    }
+
+    exit_code = trace_path(state.parents, target_index, path, path_length);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_dijkstra_by_index(): CMR failure.");
+        goto END;
+    }
+
+    *total_weight = state.distances[target_index];
+
+END:
+    free(state.distances);
+    return exit_code;
+}
+
+int matrix_dijkstra_shortest_path(const matrix_t * graph,
+                                  const char *     start_label,
+                                  const char *     target_label,
+                                  char ***         path,
+                                  int *            path_length,
+                                  size_t *         total_weight)
+{
+    int      exit_code    = E_FAILURE;
+    size_t   start_index  = 0;
+    size_t   target_index = 0;
+    size_t * indices      = NULL;
+    size_t   length       = 0;
+
+    if ((NULL == graph) || (NULL == start_label) || (NULL == target_label) ||
+        (NULL == path) || (NULL == path_length) || (NULL == total_weight))
+    {
+        PRINT_DEBUG("matrix_dijkstra_shortest_path(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_labels(
+        graph, start_label, target_label, &start_index, &target_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_dijkstra_shortest_path(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_dijkstra_by_index(
+        graph, start_index, target_index, &indices, &length, total_weight);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_dijkstra_shortest_path(): No path found.");
+        goto END;
+    }
+
+    exit_code = copy_path_labels(graph, indices, length, path, path_length);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_dijkstra_shortest_path(): CMR failure.");
+        goto END;
+    }
+
+END:
+    free(indices);
+    return exit_code;
+}
+
+int matrix_astar_shortest_path(const matrix_t *         graph,
+                               const char *             start_label,
+                               const char *             target_label,
+                               MATRIX_LABEL_HEURISTIC_F heuristic,
+                               char ***                 path,
+                               int *                    path_length,
+                               size_t *                 total_weight)
+{
+    int               exit_code    = E_FAILURE;
+    size_t            start_index  = 0;
+    size_t            target_index = 0;
+    size_t *          indices      = NULL;
+    size_t            length       = 0;
+    label_heuristic_t adapter      = { graph, heuristic };
+
+    if ((NULL == graph) || (NULL == start_label) || (NULL == target_label) ||
+        (NULL == path) || (NULL == path_length) || (NULL == total_weight))
+    {
+        PRINT_DEBUG("matrix_astar_shortest_path(): NULL argument passed.");
+        goto END;
+    }
+
+    exit_code = find_labels(
+        graph, start_label, target_label, &start_index, &target_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_astar_shortest_path(): Node not found.");
+        goto END;
+    }
+
+    exit_code = matrix_astar_by_index(graph,
+                                      start_index,
+                                      target_index,
+                                      (NULL != heuristic) ? label_heuristic
+                                                          : NULL,
+                                      &adapter,
+                                      &indices,
+                                      &length,
+                                      total_weight);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_astar_shortest_path(): No path found.");
+        goto END;
+    }
+
+    exit_code = copy_path_labels(graph, indices, length, path, path_length);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_astar_shortest_path(): CMR failure.");
+        goto END;
+    }
+
+END:
+    free(indices);
+    return exit_code;
+}
+
+int matrix_astar_by_index(const matrix_t *   graph,
+                          size_t             start_index,
+                          size_t             target_index,
+                          MATRIX_HEURISTIC_F heuristic,
+                          void *             context,
+                          size_t **          path,
+                          size_t *           path_length,
+                          size_t *           total_weight)
+{
+    int                exit_code = E_FAILURE;
+    priority_queue_t * open_set  = NULL;
+    size_t *           distances = NULL;
+    size_t *           parents   = NULL;
+    size_t *           bounds    = NULL;
+    const uint64_t *   row       = NULL;
+    uint64_t           word      = 0;
+    uint32_t           item      = 0;
+    size_t             node      = 0;
+    size_t             next      = 0;
+    size_t             sum       = 0;
+    size_t             priority  = 0;
+
+    if ((NULL == graph) || (NULL == path) || (NULL == path_length) ||
+        (NULL == total_weight))
+    {
+        PRINT_DEBUG("matrix_astar_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!valid_indices(graph, start_index, target_index))
+    {
+        PRINT_DEBUG("matrix_astar_by_index(): Index out of range.");
+        goto END;
+    }
+
+    // Node indices fit the heap's item IDs, as num_nodes <= MATRIX_MAX_NODES
+    open_set  = priority_queue_new((uint32_t)graph->num_nodes);
+    distances = calloc(3 * graph->num_nodes, sizeof(size_t));
+    if ((NULL == open_set) || (NULL == distances))
+    {
+        PRINT_DEBUG("matrix_astar_by_index(): CMR failure.");
+        goto END;
+    }
+
+    parents = &distances[graph->num_nodes];
+    bounds  = &distances[2 * graph->num_nodes];
+    for (size_t idx = 0; idx < graph->num_nodes; idx++)
+    {
+        distances[idx] = MATRIX_DISTANCE_INFINITY;
+        parents[idx]   = MATRIX_NO_NODE;
+    }
+
+    distances[start_index] = 0;
+    bounds[start_index] =
+        (NULL != heuristic) ? heuristic(start_index, target_index, context)
+                            : 0;
+    if (MATRIX_DISTANCE_INFINITY != bounds[start_index])
+    {
+        priority_queue_push(
+            open_set, (uint32_t)start_index, bounds[start_index]);
+    }
+
+    while (E_SUCCESS == priority_queue_pop(open_set, &item, NULL))
+    {
+        node = item;
+        if (target_index == node)
+        {
+            break;
+        }
+
+        row = &graph->present[node * graph->row_words];
+        for (size_t idx = 0; idx < graph->row_words; idx++)
+        {
+            for (word = row[idx]; 0 != word; word &= word - 1)
+            {
+                next = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+                sum  = distances[node] + load_weight(graph, node, next);
+                if ((sum < distances[node]) || (sum >= distances[next]))
+                {
+                    continue;
+                }
+
+                // Bounds are taken once, the first time a node is reached
+                if (MATRIX_DISTANCE_INFINITY == distances[next])
+                {
+                    bounds[next] = (NULL != heuristic)
+                                       ? heuristic(next, target_index, context)
+                                       : 0;
+                }
+
+                if (MATRIX_DISTANCE_INFINITY == bounds[next])
+                {
+                    continue;
+                }
+
+                distances[next] = sum;
+                parents[next]   = node;
+                priority        = sum + bounds[next];
+                if (priority < sum)
+                {
+                    priority = MATRIX_DISTANCE_INFINITY;
+                }
+
+                // Reopens the node if it was already expanded
+                priority_queue_update(open_set, (uint32_t)next, priority);
+            }
+        }
+    }
+
+    if (MATRIX_DISTANCE_INFINITY == distances[target_index])
+    {
+        PRINT_DEBUG("matrix_astar_by_index(): Target is unreachable.");
+        goto END;
+    }
+
+    exit_code = trace_path(parents, target_index, path, path_length);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_astar_by_index(): CMR failure.");
+        goto END;
+    }
+
+    *total_weight = distances[target_index];
+
+END:
+    free(distances);
+    if (NULL != open_set)
+    {
+        priority_queue_delete(&open_set);
+    }
+    return exit_code;
+}
+
+size_t matrix_vector_heuristic(size_t node_index,
+                               size_t target_index,
+                               void * context)
+{
+    (void)target_index;
+    return ((const size_t *)context)[node_index];
+}
+
+matrix_landmarks_t * matrix_landmarks_create(const matrix_t * graph,
+                                             size_t           count)
+{
+    matrix_landmarks_t * landmarks = NULL;
+    matrix_t *           reverse   = NULL;
+    size_t *             closest   = NULL;
+    size_t *             from      = NULL;
+    size_t               node      = 0;
+    size_t               picked    = 0;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_landmarks_create(): NULL argument passed.");
+        goto END;
+    }
+
+    if ((0 == count) || (0 == graph->num_nodes))
+    {
+        PRINT_DEBUG("matrix_landmarks_create(): No landmarks to pick.");
+        goto END;
+    }
+
+    count = (count < graph->num_nodes) ? count : graph->num_nodes;
+    if (count > (SIZE_MAX / sizeof(size_t) / graph->num_nodes))
+    {
+        PRINT_DEBUG("matrix_landmarks_create(): Too many landmarks.");
+        goto END;
+    }
+
+    landmarks = calloc(1, sizeof(matrix_landmarks_t));
+    closest   = calloc(graph->num_nodes, sizeof(size_t));
+    if ((NULL == landmarks) || (NULL == closest))
+    {
+        PRINT_DEBUG("matrix_landmarks_create(): CMR failure.");
+        goto CLEANUP_LANDMARKS;
+    }
+
+    landmarks->node_count = graph->num_nodes;
+    landmarks->nodes      = calloc(count, sizeof(size_t));
+    landmarks->from = calloc(count * graph->num_nodes, sizeof(size_t));
+    if ((NULL == landmarks->nodes) || (NULL == landmarks->from))
+    {
+        PRINT_DEBUG("matrix_landmarks_create(): CMR failure.");
+        goto CLEANUP_LANDMARKS;
+    }
+
+    // Distances to a landmark are distances from it on the reversed graph
+    landmarks->to = landmarks->from;
+    if (graph->is_directed)
+    {
+        reverse       = transpose(graph);
+        landmarks->to = calloc(count * graph->num_nodes, sizeof(size_t));
+        if ((NULL == reverse) || (NULL == landmarks->to))
+        {
+            PRINT_DEBUG("matrix_landmarks_create(): CMR failure.");
+            goto CLEANUP_LANDMARKS;
+        }
+    }
+
+    // Seed the search from the node farthest from node 0, which is usually
+    // on the edge of the graph
+    if (E_SUCCESS !=
+        matrix_shortest_distances_by_index(graph, 0, closest, NULL))
+    {
+        goto CLEANUP_LANDMARKS;
+    }
+    node = farthest_node(graph, closest);
+    if (MATRIX_NO_NODE == node)
+    {
+        node = 0;
+    }
+
+    for (size_t idx = 0; idx < graph->num_nodes; idx++)
+    {
+        closest[idx] = MATRIX_DISTANCE_INFINITY;
+    }
+
+    while ((picked < count) && (MATRIX_NO_NODE != node))
+    {
+        from = &landmarks->from[picked * graph->num_nodes];
+        if ((E_SUCCESS !=
+             matrix_shortest_distances_by_index(graph, node, from, NULL)) ||
+            ((NULL != reverse) &&
+             (E_SUCCESS !=
+              matrix_shortest_distances_by_index(
+                  reverse,
+                  node,
+                  &landmarks->to[picked * graph->num_nodes],
+                  NULL))))
+        {
+            PRINT_DEBUG("matrix_landmarks_create(): CMR failure.");
+            goto CLEANUP_LANDMARKS;
+        }
+
+        landmarks->nodes[picked++] = node;
+        for (size_t idx = 0; idx < graph->num_nodes; idx++)
+        {
+            if (from[idx] < closest[idx])
+            {
+                closest[idx] = from[idx];
+            }
+        }
+        node = farthest_node(graph, closest);
+    }
+
+    landmarks->count = picked;
+    goto END;
+
+CLEANUP_LANDMARKS:
+    matrix_landmarks_destroy(&landmarks);
+END:
+    free(closest);
+    if (NULL != reverse)
+    {
+        matrix_destroy(&reverse);
+    }
+    return landmarks;
+}
+
+const size_t * matrix_landmarks_get_nodes(const matrix_landmarks_t * landmarks,
+                                          size_t *                   count)
+{
+    const size_t * nodes = NULL;
+
+    if ((NULL == landmarks) || (NULL == count))
+    {
+        PRINT_DEBUG("matrix_landmarks_get_nodes(): NULL argument passed.");
+        goto END;
+    }
+
+    *count = landmarks->count;
+    nodes  = landmarks->nodes;
+END:
+    return nodes;
+}
+
+size_t matrix_landmark_heuristic(size_t node_index,
+                                 size_t target_index,
+                                 void * context)
+{
+    const matrix_landmarks_t * landmarks = context;
+    const size_t *             from      = NULL;
+    const size_t *             to        = NULL;
+    size_t                     bound     = 0;
+
+    if ((NULL == landmarks) || (node_index >= landmarks->node_count) ||
+        (target_index >= landmarks->node_count))
+    {
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < landmarks->count; idx++)
+    {
+        from = &landmarks->from[idx * landmarks->node_count];
+        to   = &landmarks->to[idx * landmarks->node_count];
+
+        // d(v, t) >= d(L, t) - d(L, v); L reaching v but not t proves that v
+        // cannot reach t either
+        if (MATRIX_DISTANCE_INFINITY != from[node_index])
+        {
+            if (MATRIX_DISTANCE_INFINITY == from[target_index])
+            {
+                bound = MATRIX_DISTANCE_INFINITY;
+                break;
+            }
+            if ((from[target_index] > from[node_index]) &&
+                ((from[target_index] - from[node_index]) > bound))
+            {
+                bound = from[target_index] - from[node_index];
+            }
+        }
+
+        // d(v, t) >= d(v, L) - d(t, L); t reaching L but not v proves the same
+        if (MATRIX_DISTANCE_INFINITY != to[target_index])
+        {
+            if (MATRIX_DISTANCE_INFINITY == to[node_index])
+            {
+                bound = MATRIX_DISTANCE_INFINITY;
+                break;
+            }
+            if ((to[node_index] > to[target_index]) &&
+                ((to[node_index] - to[target_index]) > bound))
+            {
+                bound = to[node_index] - to[target_index];
+            }
+        }
+    }
+
+END:
+    return bound;
+}
+
+void matrix_landmarks_destroy(matrix_landmarks_t ** landmarks_address)
+{
+    if ((NULL == landmarks_address) || (NULL == *landmarks_address))
+    {
+        goto END;
+    }
+
+    if ((*landmarks_address)->to != (*landmarks_address)->from)
+    {
+        free((*landmarks_address)->to);
+    }
+    free((*landmarks_address)->from);
+    free((*landmarks_address)->nodes);
+    free(*landmarks_address);
+    *landmarks_address = NULL;
+
+END:
+    return;
+}
+
+matrix_paths_t * matrix_paths_create(matrix_t * graph)
+{
+    matrix_paths_t * paths = NULL;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_paths_create(): NULL argument passed.");
+        goto END;
+    }
+
+    paths = calloc(1, sizeof(matrix_paths_t));
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("matrix_paths_create(): CMR failure.");
+        goto END;
+    }
+
+    paths->graph = graph;
+    if (E_SUCCESS != resize_paths(paths))
+    {
+        PRINT_DEBUG("matrix_paths_create(): CMR failure.");
+        free(paths);
+        paths = NULL;
+        goto END;
+    }
+
+    paths->node_count = graph->num_nodes;
+    paths->next       = graph->paths;
+    graph->paths      = paths;
+
+END:
+    return paths;
+}
+
+int matrix_paths_add_source(matrix_paths_t * paths, size_t source_index)
+{
+    int               exit_code = E_FAILURE;
+    matrix_source_t * sources   = NULL;
+    matrix_source_t   source    = { 0 };
+    size_t            capacity  = 0;
+
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("matrix_paths_add_source(): NULL argument passed.");
+        goto END;
+    }
+
+    if (source_index >= paths->node_count)
+    {
+        PRINT_DEBUG("matrix_paths_add_source(): Index out of range.");
+        goto END;
+    }
+
+    if (NULL != find_source(paths, source_index))
+    {
+        PRINT_DEBUG("matrix_paths_add_source(): Source already registered.");
+        goto END;
+    }
+
+    if (paths->count == paths->capacity)
+    {
+        capacity = (0 == paths->capacity) ? 4 : (paths->capacity * 2);
+        sources = realloc(paths->sources, capacity * sizeof(matrix_source_t));
+        if (NULL == sources)
+        {
+            PRINT_DEBUG("matrix_paths_add_source(): CMR failure.");
+            goto END;
+        }
+        paths->sources  = sources;
+        paths->capacity = capacity;
+    }
+
+    source.index     = source_index;
+    source.distances = calloc(paths->node_count, sizeof(size_t));
+    source.parents   = calloc(paths->node_count, sizeof(size_t));
+    if ((NULL == source.distances) || (NULL == source.parents))
+    {
+        PRINT_DEBUG("matrix_paths_add_source(): CMR failure.");
+        goto CLEANUP_SOURCE;
+    }
+
+    exit_code = matrix_shortest_distances_by_index(
+        paths->graph, source_index, source.distances, source.parents);
+    if (E_SUCCESS != exit_code)
+    {
+        goto CLEANUP_SOURCE;
+    }
+
+    paths->sources[paths->count++] = source;
+    goto END;
+
+CLEANUP_SOURCE:
+    free(source.distances);
+    free(source.parents);
+END:
+    return exit_code;
+}
+
+int matrix_paths_remove_source(matrix_paths_t * paths, size_t source_index)
+{
+    int               exit_code = E_FAILURE;
+    matrix_source_t * source    = NULL;
+
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("matrix_paths_remove_source(): NULL argument passed.");
+        goto END;
+    }
+
+    source = find_source(paths, source_index);
+    if (NULL == source)
+    {
+        PRINT_DEBUG("matrix_paths_remove_source(): Source not registered.");
+        goto END;
+    }
+
+    // The last source fills the gap
+    free(source->distances);
+    free(source->parents);
+    *source = paths->sources[--paths->count];
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_paths_set_edge(matrix_paths_t * paths,
+                          size_t           src_index,
+                          size_t           dst_index,
+                          size_t           weight)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("matrix_paths_set_edge(): NULL argument passed.");
+        goto END;
+    }
+
+    if ((src_index >= paths->node_count) || (dst_index >= paths->node_count))
+    {
+        PRINT_DEBUG("matrix_paths_set_edge(): Index out of range.");
+        goto END;
+    }
+
+    if (paths->graph->num_nodes != paths->node_count)
+    {
+        PRINT_DEBUG("matrix_paths_set_edge(): Graph resized, not refreshed.");
+        goto END;
+    }
+
+    // The matrix repairs every attached paths itself, and refuses weights
+    // its cells cannot hold before anything changes
+    exit_code =
+        matrix_add_edge_by_index(paths->graph, src_index, dst_index, weight);
+
+END:
+    return exit_code;
+}
+
+int matrix_paths_remove_edge(matrix_paths_t * paths,
+                             size_t           src_index,
+                             size_t           dst_index)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("matrix_paths_remove_edge(): NULL argument passed.");
+        goto END;
+    }
+
+    if ((src_index >= paths->node_count) || (dst_index >= paths->node_count))
+    {
+        PRINT_DEBUG("matrix_paths_remove_edge(): Index out of range.");
+        goto END;
+    }
+
+    if (paths->graph->num_nodes != paths->node_count)
+    {
+        PRINT_DEBUG("matrix_paths_remove_edge(): Graph resized, not "
+                    "refreshed.");
+        goto END;
+    }
+
+    exit_code =
+        matrix_remove_edge_by_index(paths->graph, src_index, dst_index);
+
+END:
+    return exit_code;
+}
+
+int matrix_paths_refresh(matrix_paths_t * paths)
+{
+    int               exit_code  = E_FAILURE;
+    matrix_source_t * source     = NULL;
+    size_t *          distances  = NULL;
+    size_t *          parents    = NULL;
+    size_t            node_count = 0;
+
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("matrix_paths_refresh(): NULL argument passed.");
+        goto END;
+    }
+
+    // Arrays only grow, so a failure part way leaves every source usable
+    node_count = paths->graph->num_nodes;
+    if (node_count > paths->node_count)
+    {
+        for (size_t idx = 0; idx < paths->count; idx++)
+        {
+            source    = &paths->sources[idx];
+            distances = realloc(source->distances, node_count * sizeof(size_t));
+            if (NULL != distances)
+            {
+                source->distances = distances;
+            }
+            parents = realloc(source->parents, node_count * sizeof(size_t));
+            if (NULL != parents)
+            {
+                source->parents = parents;
+            }
+            if ((NULL == distances) || (NULL == parents))
+            {
+                PRINT_DEBUG("matrix_paths_refresh(): CMR failure.");
+                goto END;
+            }
+        }
+
+        if (E_SUCCESS != resize_paths(paths))
+        {
+            PRINT_DEBUG("matrix_paths_refresh(): CMR failure.");
+            goto END;
+        }
+        paths->node_count = node_count;
+    }
+
+    for (size_t idx = 0; idx < paths->count; idx++)
+    {
+        source    = &paths->sources[idx];
+        exit_code = matrix_shortest_distances_by_index(
+            paths->graph, source->index, source->distances, source->parents);
+        if (E_SUCCESS != exit_code)
+        {
+            goto END;
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+const size_t * matrix_paths_get_distances(const matrix_paths_t * paths,
+                                          size_t                 source_index)
+{
+    const size_t *    distances = NULL;
+    matrix_source_t * source    = NULL;
+
+    if (NULL == paths)
+    {
+        PRINT_DEBUG("matrix_paths_get_distances(): NULL argument passed.");
+        goto END;
+    }
+
+    if (paths->graph->num_nodes != paths->node_count)
+    {
+        PRINT_DEBUG("matrix_paths_get_distances(): Graph resized, not "
+                    "refreshed.");
+        goto END;
+    }
+
+    source = find_source(paths, source_index);
+    if (NULL != source)
+    {
+        distances = source->distances;
+    }
+
+END:
+    return distances;
+}
+
+int matrix_paths_get_path(const matrix_paths_t * paths,
+                          size_t                 source_index,
+                          size_t                 target_index,
+                          size_t **              path,
+                          size_t *               path_length,
+                          size_t *               total_weight)
+{
+    int               exit_code = E_FAILURE;
+    matrix_source_t * source    = NULL;
+
+    if ((NULL == paths) || (NULL == path) || (NULL == path_length) ||
+        (NULL == total_weight))
+    {
+        PRINT_DEBUG("matrix_paths_get_path(): NULL argument passed.");
+        goto END;
+    }
+
+    if (paths->graph->num_nodes != paths->node_count)
+    {
+        PRINT_DEBUG("matrix_paths_get_path(): Graph resized, not refreshed.");
+        goto END;
+    }
+
+    source = find_source(paths, source_index);
+    if (NULL == source)
+    {
+        PRINT_DEBUG("matrix_paths_get_path(): Source not registered.");
+        goto END;
+    }
+
+    if (target_index >= paths->node_count)
+    {
+        PRINT_DEBUG("matrix_paths_get_path(): Index out of range.");
+        goto END;
+    }
+
+    if (MATRIX_DISTANCE_INFINITY == source->distances[target_index])
+    {
+        PRINT_DEBUG("matrix_paths_get_path(): No path found.");
+        goto END;
+    }
+
+    exit_code = trace_path(source->parents, target_index, path, path_length);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("matrix_paths_get_path(): CMR failure.");
+        goto END;
+    }
+
+    *total_weight = source->distances[target_index];
+
+END:
+    return exit_code;
+}
+
+void matrix_paths_destroy(matrix_paths_t ** paths_address)
+{
+    matrix_paths_t ** link = NULL;
+
+    if ((NULL == paths_address) || (NULL == *paths_address))
+    {
+        goto END;
+    }
+
+    link = &(*paths_address)->graph->paths;
+    while (*link != *paths_address)
+    {
+        link = &(*link)->next;
+    }
+    *link = (*paths_address)->next;
+
+    for (size_t idx = 0; idx < (*paths_address)->count; idx++)
+    {
+        free((*paths_address)->sources[idx].distances);
+        free((*paths_address)->sources[idx].parents);
+    }
+    free((*paths_address)->sources);
+    priority_queue_delete(&(*paths_address)->queue);
+    free((*paths_address)->scratch);
+    free((*paths_address)->marks);
+    free(*paths_address);
+    *paths_address = NULL;
+
+END:
+    return;
+}
+
+int matrix_get_degree_by_index(const matrix_t * graph,
+                               size_t           node_index,
+                               size_t *         degree)
+{
+    int              exit_code = E_FAILURE;
+    const uint64_t * row       = NULL;
+
+    if ((NULL == graph) || (NULL == degree))
+    {
+        PRINT_DEBUG("matrix_get_degree_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (node_index >= graph->num_nodes)
+    {
+        PRINT_DEBUG("matrix_get_degree_by_index(): Index out of range.");
+        goto END;
+    }
+
+    *degree = 0;
+    row     = &graph->present[node_index * graph->row_words];
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        *degree += (size_t)__builtin_popcountll(row[idx]);
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+size_t matrix_bitset_words(const matrix_t * graph)
+{
+    return (NULL == graph) ? 0 : graph->row_words;
+}
+
+int matrix_expand_frontier(const matrix_t * graph,
+                           const uint64_t * frontier,
+                           const uint64_t * visited,
+                           uint64_t *       next)
+{
+    int      exit_code = E_FAILURE;
+    ROW_OR_F row_or    = NULL;
+    uint64_t word      = 0;
+    size_t   node      = 0;
+
+    if ((NULL == graph) || (NULL == frontier) || (NULL == visited) ||
+        (NULL == next))
+    {
+        PRINT_DEBUG("matrix_expand_frontier(): NULL argument passed.");
+        goto END;
+    }
+
+    row_or = select_or_kernel();
+    memset(next, 0, graph->row_words * sizeof(uint64_t));
+
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        for (word = frontier[idx]; 0 != word; word &= word - 1)
+        {
+            node = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+            if (node >= graph->num_nodes)
+            {
+                PRINT_DEBUG("matrix_expand_frontier(): Index out of range.");
+                goto END;
+            }
+
+            row_or(next,
+                   &graph->present[node * graph->row_words],
+                   graph->row_words);
+        }
+    }
+
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        next[idx] &= ~visited[idx];
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_common_neighbors_by_index(const matrix_t * graph,
+                                     size_t           first_index,
+                                     size_t           second_index,
+                                     size_t *         count)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == graph) || (NULL == count))
+    {
+        PRINT_DEBUG(
+            "matrix_common_neighbors_by_index(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!valid_indices(graph, first_index, second_index))
+    {
+        PRINT_DEBUG("matrix_common_neighbors_by_index(): Index out of range.");
+        goto END;
+    }
+
+    *count = select_count_kernel()(
+        &graph->present[first_index * graph->row_words],
+        &graph->present[second_index * graph->row_words],
+        graph->row_words);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_count_triangles(const matrix_t * graph, size_t * triangles)
+{
+    int              exit_code = E_FAILURE;
+    ROW_AND_COUNT_F  and_count = NULL;
+    const uint64_t * row       = NULL;
+    uint64_t         word      = 0;
+    size_t           other     = 0;
+    size_t           sum       = 0;
+
+    if ((NULL == graph) || (NULL == triangles))
+    {
+        PRINT_DEBUG("matrix_count_triangles(): NULL argument passed.");
+        goto END;
+    }
+
+    if (graph->is_directed)
+    {
+        PRINT_DEBUG("matrix_count_triangles(): Graph is directed.");
+        goto END;
+    }
+
+    and_count = select_count_kernel();
+
+    // For every edge (node, other) with node < other, count the third corners
+    for (size_t node = 0; node < graph->num_nodes; node++)
+    {
+        row = &graph->present[node * graph->row_words];
+        for (size_t idx = (node + 1) / BITS_PER_WORD; idx < graph->row_words;
+             idx++)
+        {
+            word = row[idx];
+            if (idx == ((node + 1) / BITS_PER_WORD))
+            {
+                // Drop the columns up to and including the node itself
+                word &= ~(uint64_t)0 << ((node + 1) % BITS_PER_WORD);
+            }
+
+            for (; 0 != word; word &= word - 1)
+            {
+                other = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+                sum += and_count(
+                    row,
+                    &graph->present[other * graph->row_words],
+                    graph->row_words);
+
+                // A self-loop makes an endpoint look like its own third corner
+                sum -= edge_present(graph, node, node) ? 1 : 0;
+                sum -= edge_present(graph, other, other) ? 1 : 0;
+            }
+        }
+    }
+
+    *triangles = sum / TRIANGLE_SIDES;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int matrix_bitset_multiply(const uint64_t * left,
+                           const uint64_t * right,
+                           uint64_t *       product,
+                           size_t           row_count,
+                           size_t           row_words,
+                           size_t           first_row,
+                           size_t           block_rows,
+                           size_t           first_word,
+                           size_t           word_count)
+{
+    int        exit_code = E_FAILURE;
+    ROW_OR_F   or_rows   = NULL;
+    uint64_t * table     = NULL;
+    uint64_t * entry     = NULL;
+    size_t     last_row  = first_row + block_rows;
+    size_t     last_word = first_word + word_count;
+    size_t     width     = 0;
+    size_t     entries   = 0;
+    size_t     pattern   = 0;
+
+    if ((NULL == left) || (NULL == right) || (NULL == product))
+    {
+        PRINT_DEBUG("matrix_bitset_multiply(): NULL argument passed.");
+        goto END;
+    }
+
+    if ((last_word < first_word) || (last_word > row_words) ||
+        (last_row < first_row) || (last_row > row_count) ||
+        (row_count > (row_words * BITS_PER_WORD)))
+    {
+        PRINT_DEBUG("matrix_bitset_multiply(): Range out of bounds.");
+        goto END;
+    }
+
+    table = aligned_calloc(FOUR_RUSSIANS_ENTRIES * WORDS_PER_LINE *
+                           sizeof(uint64_t));
+    if (NULL == table)
+    {
+        PRINT_DEBUG("matrix_bitset_multiply(): CMR failure.");
+        goto END;
+    }
+
+    or_rows = select_or_kernel();
+
+    // One strip of columns at a time keeps the table within the L1 cache
+    for (size_t strip = first_word; strip < last_word; strip += width)
+    {
+        width = last_word - strip;
+        width = (width > WORDS_PER_LINE) ? WORDS_PER_LINE : width;
+
+        for (size_t row = first_row; row < last_row; row++)
+        {
+            memset(&product[(row * row_words) + strip],
+                   0,
+                   width * sizeof(uint64_t));
+        }
+
+        for (size_t base = 0; base < row_count; base += FOUR_RUSSIANS_BITS)
+        {
+            // Entry p is the OR of the right rows picked by the bits of p,
+            // built from the entry without its lowest bit
+            entries = row_count - base;
+            entries = (size_t)1 << ((entries > FOUR_RUSSIANS_BITS)
+                                        ? FOUR_RUSSIANS_BITS
+                                        : entries);
+            for (pattern = 1; pattern < entries; pattern++)
+            {
+                entry = &table[pattern * width];
+                memcpy(entry,
+                       &table[(pattern & (pattern - 1)) * width],
+                       width * sizeof(uint64_t));
+                or_rows(entry,
+                        &right[((base + (size_t)__builtin_ctzll(pattern)) *
+                                row_words) +
+                               strip],
+                        width);
+            }
+
+            for (size_t row = first_row; row < last_row; row++)
+            {
+                pattern = (size_t)(left[(row * row_words) +
+                                        (base / BITS_PER_WORD)] >>
+                                   (base % BITS_PER_WORD)) &
+                          (FOUR_RUSSIANS_ENTRIES - 1);
+                if (0 != pattern)
+                {
+                    or_rows(&product[(row * row_words) + strip],
+                            &table[pattern * width],
+                            width);
+                }
+            }
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(table);
+    return exit_code;
+}
+
+int matrix_reachability(const matrix_t * graph, size_t hops, uint64_t ** reach)
+{
+    return matrix_reachability_with(graph, hops, NULL, NULL, reach);
+}
+
+int matrix_reachability_with(const matrix_t *  graph,
+                             size_t            hops,
+                             MATRIX_MULTIPLY_F multiply,
+                             void *            context,
+                             uint64_t **       reach)
+{
+    int        exit_code = E_FAILURE;
+    uint64_t * base      = NULL;
+    uint64_t * result    = NULL;
+    uint64_t * scratch   = NULL;
+    uint64_t * swap      = NULL;
+    size_t     size      = 0;
+    bool       is_set    = false;
+
+    if ((NULL == graph) || (NULL == reach))
+    {
+        PRINT_DEBUG("matrix_reachability_with(): NULL argument passed.");
+        goto END;
+    }
+
+    multiply = (NULL != multiply) ? multiply : multiply_serial;
+    size     = graph->num_nodes * graph->row_words * sizeof(uint64_t);
+    base     = aligned_calloc(size);
+    result   = aligned_calloc(size);
+    scratch  = aligned_calloc(size);
+    if ((NULL == base) || (NULL == result) || (NULL == scratch))
+    {
+        PRINT_DEBUG("matrix_reachability_with(): CMR failure.");
+        goto END;
+    }
+
+    // Powers of I + A stop growing after num_nodes - 1 hops
+    if ((0 < graph->num_nodes) && (hops > (graph->num_nodes - 1)))
+    {
+        hops = graph->num_nodes - 1;
+    }
+
+    memcpy(base, graph->present, size);
+    for (size_t node = 0; node < graph->num_nodes; node++)
+    {
+        base[(node * graph->row_words) + (node / BITS_PER_WORD)] |=
+            (uint64_t)1 << (node % BITS_PER_WORD);
+        result[(node * graph->row_words) + (node / BITS_PER_WORD)] |=
+            (uint64_t)1 << (node % BITS_PER_WORD);
+    }
+
+    // Binary powering: 'base' holds (I + A)^(2^i), 'result' the bits so far
+    for (; 0 != hops; hops /= 2)
+    {
+        if (1 == (hops % 2))
+        {
+            if (is_set)
+            {
+                exit_code = multiply(result,
+                                     base,
+                                     scratch,
+                                     graph->num_nodes,
+                                     graph->row_words,
+                                     context);
+                if (E_SUCCESS != exit_code)
+                {
+                    goto END;
+                }
+                swap    = result;
+                result  = scratch;
+                scratch = swap;
+            }
+            else
+            {
+                memcpy(result, base, size);
+                is_set = true;
+            }
+        }
+
+        if (1 < hops)
+        {
+            exit_code = multiply(base,
+                                 base,
+                                 scratch,
+                                 graph->num_nodes,
+                                 graph->row_words,
+                                 context);
+            if (E_SUCCESS != exit_code)
+            {
+                goto END;
+            }
+
+            // A power that squares to itself is the closure, and so is its
+            // product with any earlier power
+            if (0 == memcmp(base, scratch, size))
+            {
+                memcpy(result, base, size);
+                break;
+            }
+            swap    = base;
+            base    = scratch;
+            scratch = swap;
+        }
+    }
+
+    *reach = result;
+    result = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    free(base);
+    free(result);
+    free(scratch);
+    return exit_code;
+}
+
+int matrix_transitive_closure(const matrix_t * graph, uint64_t ** closure)
+{
+    return matrix_reachability_with(graph, SIZE_MAX, NULL, NULL, closure);
+}
+
+matrix_t * matrix_from_graph(const graph_t * graph,
+                             bool            is_directed,
+                             matrix_weight_t weight_type)
+{
+    int           exit_code = E_FAILURE;
+    matrix_t *    matrix    = NULL;
+    list_node_t * current   = NULL;
+    list_node_t * edge_node = NULL;
+    node_t *      node      = NULL;
+    edge_t *      edge      = NULL;
+    size_t        column    = 0;
+
+    if ((NULL == graph) || (NULL == graph->node_list))
+    {
+        PRINT_DEBUG("matrix_from_graph(): NULL argument passed.");
+        goto END;
+    }
+
+    if (!is_directed && (0 != graph->directed_edge_count))
+    {
+        PRINT_DEBUG("matrix_from_graph(): Graph has one-way edges.");
+        goto END;
+    }
+
+    matrix = matrix_init_weighted(graph->node_count,
+                                  is_directed,
+                                  weight_type,
+                                  graph->custom_compare,
+                                  keep_data);
+    if (NULL == matrix)
+    {
+        PRINT_DEBUG("matrix_from_graph(): Unable to create matrix.");
+        goto END;
+    }
+
+    // Node IDs are dense, so they serve as indices as they are
+    current = graph->node_list->head;
+    while (NULL != current)
+    {
+        node                         = (node_t *)current->data;
+        matrix->nodes[node->id].data = node->data;
+
+        edge_node = node->edge_list->head;
+        while (NULL != edge_node)
+        {
+            edge   = (edge_t *)edge_node->data;
+            column = (node->id == edge->id_1) ? edge->id_2 : edge->id_1;
+            if (edge->weight > max_weight(matrix))
+            {
+                PRINT_DEBUG("matrix_from_graph(): Weight does not fit.");
+                goto END;
+            }
+
+            if (!edge_present(matrix, node->id, column) ||
+                (edge->weight < load_weight(matrix, node->id, column)))
+            {
+                store_weight(matrix, node->id, column, edge->weight);
+                mark_edge(matrix, node->id, column, true);
+            }
+            edge_node = edge_node->next;
+        }
+
+        current = current->next;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    if ((E_SUCCESS != exit_code) && (NULL != matrix))
+    {
+        matrix_destroy(&matrix);
+    }
+    return matrix;
+}
+
+graph_t * matrix_to_graph(const matrix_t * graph)
+{
+    int        exit_code = E_FAILURE;
+    graph_t *  list      = NULL;
+    uint64_t * row       = NULL;
+    uint64_t   word      = 0;
+    size_t     first     = 0;
+    size_t     column    = 0;
+    size_t     weight    = 0;
+
+    if (NULL == graph)
+    {
+        PRINT_DEBUG("matrix_to_graph(): NULL argument passed.");
+        goto END;
+    }
+
+    list = graph_create(keep_data, graph->custom_compare);
+    if (NULL == list)
+    {
+        PRINT_DEBUG("matrix_to_graph(): Unable to create graph.");
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < graph->num_nodes; idx++)
+    {
+        if ((NULL != graph->nodes[idx].data) &&
+            (E_SUCCESS != graph_add_node(list, graph->nodes[idx].data)))
+        {
+            PRINT_DEBUG("matrix_to_graph(): Unable to add node.");
+            goto END;
+        }
+    }
+
+    for (size_t src = 0; src < graph->num_nodes; src++)
+    {
+        if (NULL == graph->nodes[src].data)
+        {
+            continue;
+        }
+
+        // An undirected matrix is symmetric, so only its upper half is read
+        row   = &graph->present[src * graph->row_words];
+        first = graph->is_directed ? 0 : src;
+        for (size_t idx = first / BITS_PER_WORD; idx < graph->row_words; idx++)
+        {
+            word = row[idx];
+            if (idx == (first / BITS_PER_WORD))
+            {
+                word &= UINT64_MAX << (first % BITS_PER_WORD);
+            }
+
+            while (0 != word)
+            {
+                column = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+                word &= word - 1;
+                weight = load_weight(graph, src, column);
+
+                // Edges left on unpopulated slots have no node to join
+                if ((NULL != graph->nodes[column].data) &&
+                    (E_SUCCESS != graph_add_edge(list,
+                                                 graph->nodes[src].data,
+                                                 graph->nodes[column].data,
+                                                 weight,
+                                                 !graph->is_directed)))
+                {
+                    PRINT_DEBUG("matrix_to_graph(): Unable to add edge.");
+                    goto END;
+                }
+            }
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    if ((E_SUCCESS != exit_code) && (NULL != list))
+    {
+        graph_destroy(&list);
+    }
+    return list;
+}
+
+/****************************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ****************************************************************************/
+
+static void * aligned_calloc(size_t size)
+{
+    void * block = NULL;
+
+    // aligned_alloc() needs a multiple of the alignment, and at least one
+    size = ((size / CACHE_LINE_SIZE) + 1) * CACHE_LINE_SIZE;
+
+    block = aligned_alloc(CACHE_LINE_SIZE, size);
+    if (NULL != block)
+    {
+        memset(block, 0, size);
+    }
+
+    return block;
+}
+
+static int resize_rows(matrix_t * graph, size_t capacity)
+{
+    int             exit_code  = E_FAILURE;
+    size_t          per_line   = 0;
+    size_t          stride     = 0;
+    size_t          row_words  = 0;
+    size_t          row_bytes  = 0;
+    void *          weights    = NULL;
+    uint64_t *      present    = NULL;
+    matrix_node_t * nodes      = NULL;
+    size_t *        free_slots = NULL;
+
+    if (MATRIX_MAX_NODES < capacity)
+    {
+        PRINT_DEBUG("resize_rows(): Too many nodes.");
+        goto END;
+    }
+
+    // Pad rows to whole cache lines so every row starts aligned
+    per_line  = CACHE_LINE_SIZE /
+                ((0 == graph->weight_size) ? 1 : graph->weight_size);
+    stride    = ((capacity + per_line - 1) / per_line) * per_line;
+    stride    = (0 == graph->weight_size) ? 0 : stride;
+    row_words = (capacity + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    row_words = ((row_words + WORDS_PER_LINE - 1) / WORDS_PER_LINE) *
+                WORDS_PER_LINE;
+
+    row_bytes = (stride * graph->weight_size) + (row_words * sizeof(uint64_t));
+    if ((0 != capacity) && ((SIZE_MAX / capacity) <= row_bytes))
+    {
+        PRINT_DEBUG("resize_rows(): Too many nodes.");
+        goto END;
+    }
+
+    // Unweighted graphs are just the bitset
+    if (0 != graph->weight_size)
+    {
+        weights = aligned_calloc(capacity * stride * graph->weight_size);
+    }
+    present    = aligned_calloc(capacity * row_words * sizeof(uint64_t));
+    nodes      = calloc(capacity + 1, sizeof(matrix_node_t));
+    free_slots = calloc(capacity + 1, sizeof(size_t));
+    if (((0 != graph->weight_size) && (NULL == weights)) ||
+        (NULL == present) || (NULL == nodes) || (NULL == free_slots))
+    {
+        PRINT_DEBUG("resize_rows(): CMR failure.");
+        free(weights);
+        free(present);
+        free(nodes);
+        free(free_slots);
+        goto END;
+    }
+
+    for (size_t row = 0; row < graph->num_nodes; row++)
+    {
+        if (0 != graph->weight_size)
+        {
+            memcpy((char *)weights + (row * stride * graph->weight_size),
+                   (char *)graph->weights +
+                       (row * graph->stride * graph->weight_size),
+                   graph->num_nodes * graph->weight_size);
+        }
+        memcpy(&present[row * row_words],
+               &graph->present[row * graph->row_words],
+               graph->row_words * sizeof(uint64_t));
+    }
+
+    if (0 != graph->num_nodes)
+    {
+        memcpy(nodes, graph->nodes, graph->num_nodes * sizeof(matrix_node_t));
+    }
+    if (0 != graph->free_count)
+    {
+        memcpy(free_slots,
+               graph->free_slots,
+               graph->free_count * sizeof(size_t));
+    }
+
+    free(graph->weights);
+    free(graph->present);
+    free(graph->nodes);
+    free(graph->free_slots);
+
+    graph->weights    = weights;
+    graph->present    = present;
+    graph->nodes      = nodes;
+    graph->free_slots = free_slots;
+    graph->stride     = stride;
+    graph->row_words  = row_words;
+    graph->capacity   = capacity;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static int insert_node(matrix_t *   graph,
+                       const void * data,
+                       const char * label,
+                       size_t *     index)
+{
+    int  exit_code = E_FAILURE;
+    bool is_reused = false;
+
+    // Slots populated by index since their node was removed are skipped
+    while ((0 != graph->free_count) && !is_reused)
+    {
+        *index                       = graph->free_slots[--graph->free_count];
+        graph->nodes[*index].is_free = false;
+        is_reused                    = (NULL == graph->nodes[*index].data);
+    }
+
+    if (!is_reused)
+    {
+        if ((graph->num_nodes == graph->capacity) &&
+            (E_SUCCESS !=
+             resize_rows(graph,
+                         (0 == graph->capacity) ? MIN_CAPACITY
+                                                : (graph->capacity * 2))))
+        {
+            goto END;
+        }
+
+        *index = graph->num_nodes++;
+    }
+
+    // The graph owns node data, as with matrix_populate_node()
+    if (NULL == label)
+    {
+        graph->nodes[*index].data = (void *)data;
+    }
+    else if (E_SUCCESS !=
+             matrix_populate_node(graph, *index, (void *)data, label))
+    {
+        if (is_reused)
+        {
+            graph->nodes[*index].is_free           = true;
+            graph->free_slots[graph->free_count++] = *index;
+        }
+        else
+        {
+            graph->num_nodes--;
+        }
+        goto END;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void clear_node_edges(matrix_t * graph, size_t index)
+{
+    uint64_t bit = (uint64_t)1 << (index % BITS_PER_WORD);
+
+    memset(&graph->present[index * graph->row_words],
+           0,
+           graph->row_words * sizeof(uint64_t));
+
+    for (size_t row = 0; row < graph->num_nodes; row++)
+    {
+        graph->present[(row * graph->row_words) + (index / BITS_PER_WORD)] &=
+            ~bit;
+    }
+}
+
+static bool valid_indices(const matrix_t * graph,
+                          size_t           src_index,
+                          size_t           dst_index)
+{
+    return (src_index < graph->num_nodes) && (dst_index < graph->num_nodes);
+}
+
+static size_t max_weight(const matrix_t * graph)
+{
+    // Unweighted graphs accept any weight and store none
+    size_t limit = SIZE_MAX;
+
+    if (MATRIX_WEIGHT_U32 == graph->weight_type)
+    {
+        limit = UINT32_MAX;
+    }
+    else if (MATRIX_WEIGHT_U16 == graph->weight_type)
+    {
+        limit = UINT16_MAX;
+    }
+
+    return limit;
+}
+
+static size_t load_weight(const matrix_t * graph, size_t row, size_t column)
+{
+    size_t cell   = (row * graph->stride) + column;
+    size_t weight = 0;
+
+    switch (graph->weight_type)
+    {
+        case MATRIX_WEIGHT_U32:
+            weight = ((const uint32_t *)graph->weights)[cell];
+            break;
+        case MATRIX_WEIGHT_U16:
+            weight = ((const uint16_t *)graph->weights)[cell];
+            break;
+        case MATRIX_WEIGHT_NONE:
+            weight = 1;
+            break;
+        default:
+            weight = ((const size_t *)graph->weights)[cell];
+            break;
+    }
+
+    return weight;
+}
+
+static void store_weight(matrix_t * graph,
+                         size_t     row,
+                         size_t     column,
+                         size_t     weight)
+{
+    size_t cells[2] = { (row * graph->stride) + column,
+                        (column * graph->stride) + row };
+    size_t count    = graph->is_directed ? 1 : 2;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        switch (graph->weight_type)
+        {
+            case MATRIX_WEIGHT_U32:
+                ((uint32_t *)graph->weights)[cells[idx]] = (uint32_t)weight;
+                break;
+            case MATRIX_WEIGHT_U16:
+                ((uint16_t *)graph->weights)[cells[idx]] = (uint16_t)weight;
+                break;
+            case MATRIX_WEIGHT_NONE:
+                break;
+            default:
+                ((size_t *)graph->weights)[cells[idx]] = weight;
+                break;
+        }
+    }
+}
+
+static void mark_edge(matrix_t * graph, size_t row, size_t column, bool is_set)
+{
+    size_t   words[2] = { (row * graph->row_words) + (column / BITS_PER_WORD),
+                          (column * graph->row_words) + (row / BITS_PER_WORD) };
+    uint64_t bits[2]  = { (uint64_t)1 << (column % BITS_PER_WORD),
+                          (uint64_t)1 << (row % BITS_PER_WORD) };
+    size_t   count    = graph->is_directed ? 1 : 2;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (is_set)
+        {
+            graph->present[words[idx]] |= bits[idx];
+        }
+        else
+        {
+            graph->present[words[idx]] &= ~bits[idx];
+        }
+    }
+}
+
+static bool edge_present(const matrix_t * graph, size_t row, size_t column)
+{
+    uint64_t word =
+        graph->present[(row * graph->row_words) + (column / BITS_PER_WORD)];
+
+    return 0 != ((word >> (column % BITS_PER_WORD)) & 1);
+}
+
+static int find_label(const matrix_t * graph,
+                      const char *     label,
+                      size_t *         index)
+{
+    int    exit_code = E_FAILURE;
+    size_t found     = string_table_get(graph->labels, label);
+
+    if (STRING_TABLE_NO_VALUE != found)
+    {
+        *index    = found;
+        exit_code = E_SUCCESS;
+    }
+
+    return exit_code;
+}
+
+static int find_labels(const matrix_t * graph,
+                       const char *     src_label,
+                       const char *     dst_label,
+                       size_t *         src_index,
+                       size_t *         dst_index)
+{
+    int exit_code = find_label(graph, src_label, src_index);
+
+    if (E_SUCCESS == exit_code)
+    {
+        exit_code = find_label(graph, dst_label, dst_index);
+    }
+
+    return exit_code;
+}
+
+static void visit_set(const matrix_t * graph,
+                      const uint64_t * set,
+                      ACTION_F         action)
+{
+    uint64_t word = 0;
+    size_t   node = 0;
+
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        for (word = set[idx]; 0 != word; word &= word - 1)
+        {
+            node = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+            action(graph->nodes[node].data);
+        }
+    }
+}
+
+static int dijkstra_init(const matrix_t *   graph,
+                         size_t             start_index,
+                         dijkstra_state_t * state)
+{
+    int      exit_code = E_FAILURE;
+    size_t * block     = NULL;
+
+    // Presence rows already cover whole vectors of columns
+    state->count = graph->row_words * BITS_PER_WORD;
+
+    block = aligned_calloc(3 * state->count * sizeof(size_t));
+    if (NULL == block)
+    {
+        goto END;
+    }
+
+    state->distances = block;
+    state->keys      = &block[state->count];
+    state->parents   = &block[2 * state->count];
+
+    for (size_t idx = 0; idx < state->count; idx++)
+    {
+        state->distances[idx] = MATRIX_DISTANCE_INFINITY;
+        state->keys[idx]      = MATRIX_DISTANCE_INFINITY;
+        state->parents[idx]   = MATRIX_NO_NODE;
+    }
+
+    state->distances[start_index] = 0;
+    state->keys[start_index]      = 0;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void dijkstra_run(const matrix_t *   graph,
+                         size_t             target_index,
+                         dijkstra_state_t * state)
+{
+    ARGMIN_F argmin = select_argmin_kernel();
+    RELAX_F  relax  = select_relax_kernel();
+    size_t   node   = 0;
+
+    for (;;)
+    {
+        node = argmin(state->keys, state->count);
+        if ((MATRIX_NO_NODE == node) || (target_index == node))
+        {
+            break;
+        }
+
+        state->keys[node] = MATRIX_DISTANCE_INFINITY;
+        relax(graph, node, state);
+    }
+}
+
+static int trace_path(const size_t * parents,
+                      size_t         target_index,
+                      size_t **      path,
+                      size_t *       path_length)
+{
+    int    exit_code = E_FAILURE;
+    size_t length    = 0;
+    size_t node      = 0;
+
+    for (node = target_index; MATRIX_NO_NODE != node; node = parents[node])
+    {
+        length++;
+    }
+
+    *path = calloc(length, sizeof(size_t));
+    if (NULL == *path)
+    {
+        goto END;
+    }
+
+    *path_length = length;
+    for (node = target_index; MATRIX_NO_NODE != node; node = parents[node])
+    {
+        (*path)[--length] = node;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static int copy_path_labels(const matrix_t * graph,
+                            const size_t *   indices,
+                            size_t           length,
+                            char ***         path,
+                            int *            path_length)
+{
+    int     exit_code = E_FAILURE;
+    char ** labels    = NULL;
+
+    if (INT_MAX < length)
+    {
+        goto END;
+    }
+
+    // Only the nodes on the path get their labels copied
+    labels = calloc(length, sizeof(char *));
+    if (NULL == labels)
+    {
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < length; idx++)
+    {
+        if ((NULL != graph->nodes[indices[idx]].label) &&
+            (E_SUCCESS != copy_string(graph->nodes[indices[idx]].label,
+                                      &labels[idx],
+                                      MAX_LABEL_SIZE,
+                                      false)))
+        {
+            for (size_t copied = 0; copied < idx; copied++)
+            {
+                free(labels[copied]);
+            }
+            free(labels);
+            goto END;
+        }
+    }
+
+    *path        = labels;
+    *path_length = (int)length;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static size_t label_heuristic(size_t node_index,
+                              size_t target_index,
+                              void * context)
+{
+    const label_heuristic_t * adapter      = context;
+    const char *              node_label   = NULL;
+    const char *              target_label = NULL;
+    size_t                    bound        = 0;
+
+    node_label   = adapter->graph->nodes[node_index].label;
+    target_label = adapter->graph->nodes[target_index].label;
+    if ((NULL != node_label) && (NULL != target_label))
+    {
+        bound = adapter->heuristic(node_label, target_label);
+    }
+
+    return bound;
+}
+
+static matrix_t * transpose(const matrix_t * graph)
+{
+    matrix_t *       reverse = NULL;
+    const uint64_t * row     = NULL;
+    uint64_t         word    = 0;
+    size_t           column  = 0;
+
+    reverse = matrix_init_weighted(graph->num_nodes,
+                                   true,
+                                   graph->weight_type,
+                                   graph->custom_compare,
+                                   graph->custom_free);
+    if (NULL == reverse)
+    {
+        goto END;
+    }
+
+    for (size_t node = 0; node < graph->num_nodes; node++)
+    {
+        row = &graph->present[node * graph->row_words];
+        for (size_t idx = 0; idx < graph->row_words; idx++)
+        {
+            for (word = row[idx]; 0 != word; word &= word - 1)
+            {
+                column =
+                    (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+                store_weight(
+                    reverse, column, node, load_weight(graph, node, column));
+                mark_edge(reverse, column, node, true);
+            }
+        }
+    }
+
+END:
+    return reverse;
+}
+
+static size_t farthest_node(const matrix_t * graph, const size_t * closest)
+{
+    size_t best          = MATRIX_NO_NODE;
+    size_t best_distance = 0;
+
+    // Nodes no landmark reaches are the farthest of all
+    for (size_t idx = 0; idx < graph->num_nodes; idx++)
+    {
+        if ((!graph->nodes[idx].is_free) && (closest[idx] > best_distance))
+        {
+            best_distance = closest[idx];
+            best          = idx;
+        }
+    }
+
+    return best;
+}
+
+static matrix_source_t * find_source(const matrix_paths_t * paths,
+                                     size_t                 source_index)
+{
+    matrix_source_t * source = NULL;
+
+    for (size_t idx = 0; idx < paths->count; idx++)
+    {
+        if (source_index == paths->sources[idx].index)
+        {
+            source = &paths->sources[idx];
+            break;
+        }
+    }
+
+    return source;
+}
+
+static int resize_paths(matrix_paths_t * paths)
+{
+    int                exit_code  = E_FAILURE;
+    size_t             node_count = paths->graph->num_nodes;
+    priority_queue_t * queue      = NULL;
+    size_t *           scratch    = NULL;
+    uint8_t *          marks      = NULL;
+
+    // One entry more than needed keeps an empty graph's arrays valid
+    queue   = priority_queue_new((uint32_t)node_count);
+    scratch = calloc((3 * node_count) + 1, sizeof(size_t));
+    marks   = calloc(node_count + 1, sizeof(uint8_t));
+    if ((NULL == queue) || (NULL == scratch) || (NULL == marks))
+    {
+        priority_queue_delete(&queue);
+        free(scratch);
+        free(marks);
+        goto END;
+    }
+
+    priority_queue_delete(&paths->queue);
+    free(paths->scratch);
+    free(paths->marks);
+    paths->queue   = queue;
+    paths->scratch = scratch;
+    paths->marks   = marks;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void repair_edge(matrix_paths_t * paths,
+                        size_t           src_index,
+                        size_t           dst_index,
+                        size_t           old_weight,
+                        size_t           new_weight)
+{
+    matrix_source_t * source = NULL;
+
+    for (size_t idx = 0; idx < paths->count; idx++)
+    {
+        source = &paths->sources[idx];
+        if (new_weight < old_weight)
+        {
+            lower_edge(paths, source, src_index, dst_index);
+            if (!paths->graph->is_directed)
+            {
+                lower_edge(paths, source, dst_index, src_index);
+            }
+            settle_paths(paths, source, false);
+        }
+        else if (new_weight > old_weight)
+        {
+            // Only an edge of the shortest path tree can lengthen a path
+            if (src_index == source->parents[dst_index])
+            {
+                raise_edge(paths, source, dst_index);
+            }
+            else if ((!paths->graph->is_directed) &&
+                     (dst_index == source->parents[src_index]))
+            {
+                raise_edge(paths, source, src_index);
+            }
+        }
+    }
+}
+
+static void lower_edge(matrix_paths_t *  paths,
+                       matrix_source_t * source,
+                       size_t            src_index,
+                       size_t            dst_index)
+{
+    size_t * distances = source->distances;
+    size_t   weight    = load_weight(paths->graph, src_index, dst_index);
+    size_t   sum       = distances[src_index] + weight;
+
+    // An unreachable source node overflows the sum and is skipped
+    if ((sum >= distances[src_index]) && (sum < distances[dst_index]))
+    {
+        distances[dst_index]       = sum;
+        source->parents[dst_index] = src_index;
+        priority_queue_update(paths->queue, (uint32_t)dst_index, sum);
+    }
+}
+
+static void raise_edge(matrix_paths_t *  paths,
+                       matrix_source_t * source,
+                       size_t            root)
+{
+    size_t    node_count   = paths->node_count;
+    size_t *  first_child  = paths->scratch;
+    size_t *  next_sibling = &paths->scratch[node_count];
+    size_t *  subtree      = &paths->scratch[2 * node_count];
+    size_t *  distances    = source->distances;
+    size_t *  parents      = source->parents;
+    uint8_t * marks        = paths->marks;
+    size_t    size         = 0;
+    size_t    node         = 0;
+    size_t    parent       = 0;
+    size_t    distance     = 0;
+    uint32_t  item         = 0;
+
+    for (size_t idx = 0; idx < node_count; idx++)
+    {
+        first_child[idx] = MATRIX_NO_NODE;
+    }
+    for (size_t idx = 0; idx < node_count; idx++)
+    {
+        parent = parents[idx];
+        if (MATRIX_NO_NODE != parent)
+        {
+            next_sibling[idx]   = first_child[parent];
+            first_child[parent] = idx;
+        }
+    }
+
+    // Every node whose path can lengthen is in the subtree below the edge
+    subtree[size++] = root;
+    marks[root]     = REPAIR_PENDING;
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        for (node = first_child[subtree[idx]]; MATRIX_NO_NODE != node;
+             node = next_sibling[node])
+        {
+            subtree[size++] = node;
+            marks[node]     = REPAIR_PENDING;
+        }
+    }
+
+    // Nearest first, a node keeps its distance when a node outside the
+    // subtree, or one that kept its own, still reaches it as cheaply
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        priority_queue_push(
+            paths->queue, (uint32_t)subtree[idx], distances[subtree[idx]]);
+    }
+    while (E_SUCCESS == priority_queue_pop(paths->queue, &item, NULL))
+    {
+        parent = best_parent(paths, source, item, &distance);
+        if ((MATRIX_NO_NODE != parent) && (distance == distances[item]))
+        {
+            parents[item] = parent;
+            marks[item]   = REPAIR_KEPT;
+        }
+        else
+        {
+            marks[item] = REPAIR_AFFECTED;
+        }
+    }
+
+    // The rest start from their best neighbor outside the affected region,
+    // then settle among themselves
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        node = subtree[idx];
+        if (REPAIR_AFFECTED == marks[node])
+        {
+            distances[node] = MATRIX_DISTANCE_INFINITY;
+            parents[node]   = MATRIX_NO_NODE;
+        }
+    }
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        node = subtree[idx];
+        if (REPAIR_AFFECTED != marks[node])
+        {
+            continue;
+        }
+        parent = best_parent(paths, source, node, &distance);
+        if (MATRIX_NO_NODE != parent)
+        {
+            distances[node] = distance;
+            parents[node]   = parent;
+            priority_queue_push(paths->queue, (uint32_t)node, distance);
+        }
+    }
+    settle_paths(paths, source, true);
+
+    for (size_t idx = 0; idx < size; idx++)
+    {
+        marks[subtree[idx]] = REPAIR_UNTOUCHED;
+    }
+}
+
+static size_t best_parent(const matrix_paths_t *  paths,
+                          const matrix_source_t * source,
+                          size_t                  node,
+                          size_t *                distance)
+{
+    const matrix_t * graph = paths->graph;
+    size_t           best  = MATRIX_NO_NODE;
+    size_t           sum   = 0;
+
+    *distance = MATRIX_DISTANCE_INFINITY;
+    for (size_t idx = 0; idx < paths->node_count; idx++)
+    {
+        if ((idx == node) || (REPAIR_PENDING == paths->marks[idx]) ||
+            (REPAIR_AFFECTED == paths->marks[idx]) ||
+            (!edge_present(graph, idx, node)))
+        {
+            continue;
+        }
+
+        sum = source->distances[idx] + load_weight(graph, idx, node);
+        if ((sum >= source->distances[idx]) && (sum < *distance))
+        {
+            *distance = sum;
+            best      = idx;
+        }
+    }
+
+    return best;
+}
+
+static void settle_paths(matrix_paths_t *  paths,
+                         matrix_source_t * source,
+                         bool              only_affected)
+{
+    const matrix_t * graph     = paths->graph;
+    size_t *         distances = source->distances;
+    const uint64_t * row       = NULL;
+    uint64_t         word      = 0;
+    uint32_t         item      = 0;
+    size_t           next      = 0;
+    size_t           sum       = 0;
+
+    while (E_SUCCESS == priority_queue_pop(paths->queue, &item, NULL))
+    {
+        row = &graph->present[(size_t)item * graph->row_words];
+        for (size_t idx = 0; idx < graph->row_words; idx++)
+        {
+            for (word = row[idx]; 0 != word; word &= word - 1)
+            {
+                next = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+                if (only_affected && (REPAIR_AFFECTED != paths->marks[next]))
+                {
+                    continue;
+                }
+
+                sum = distances[item] + load_weight(graph, item, next);
+                if ((sum < distances[item]) || (sum >= distances[next]))
+                {
+                    continue;
+                }
+                distances[next]       = sum;
+                source->parents[next] = item;
+                priority_queue_update(paths->queue, (uint32_t)next, sum);
+            }
+        }
+    }
+}
+
+static void notify_paths(matrix_t * graph,
+                         size_t     src_index,
+                         size_t     dst_index,
+                         size_t     old_weight)
+{
+    matrix_paths_t * paths      = graph->paths;
+    size_t           new_weight = MATRIX_DISTANCE_INFINITY;
+
+    if (edge_present(graph, src_index, dst_index))
+    {
+        new_weight = load_weight(graph, src_index, dst_index);
+    }
+
+    while (NULL != paths)
+    {
+        if (paths->node_count == graph->num_nodes)
+        {
+            repair_edge(paths, src_index, dst_index, old_weight, new_weight);
+        }
+        paths = paths->next;
+    }
+}
+
+static void drop_edge(matrix_t * graph, size_t src_index, size_t dst_index)
+{
+    size_t old_weight = load_weight(graph, src_index, dst_index);
+
+    store_weight(graph, src_index, dst_index, 0);
+    mark_edge(graph, src_index, dst_index, false);
+    notify_paths(graph, src_index, dst_index, old_weight);
+}
+
+static int multiply_serial(const uint64_t * left,
+                           const uint64_t * right,
+                           uint64_t *       product,
+                           size_t           row_count,
+                           size_t           row_words,
+                           void *           context)
+{
+    (void)context;
+    return matrix_bitset_multiply(
+        left, right, product, row_count, row_words, 0, row_count, 0, row_words);
+}
+
+static void keep_data(void * data)
+{
+    (void)data;
+}
+
+static ARGMIN_F select_argmin_kernel(void)
+{
+#ifdef MATRIX_X86
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return argmin_avx2;
+    }
+#endif
+    return argmin_scalar;
+}
+
+static RELAX_F select_relax_kernel(void)
+{
+#ifdef MATRIX_X86
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return relax_avx2;
+    }
+#endif
+    return relax_scalar;
+}
+
+static size_t argmin_scalar(const size_t * keys, size_t count)
+{
+    size_t best     = MATRIX_NO_NODE;
+    size_t best_key = MATRIX_DISTANCE_INFINITY;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if (keys[idx] < best_key)
+        {
+            best_key = keys[idx];
+            best     = idx;
+        }
+    }
+
+    return best;
+}
+
+static void relax_scalar(const matrix_t *   graph,
+                         size_t             node,
+                         dijkstra_state_t * state)
+{
+    const uint64_t * row      = &graph->present[node * graph->row_words];
+    size_t           distance = state->distances[node];
+    size_t           target   = 0;
+    size_t           sum      = 0;
+    uint64_t         word     = 0;
+
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        for (word = row[idx]; 0 != word; word &= word - 1)
+        {
+            target = (idx * BITS_PER_WORD) + (size_t)__builtin_ctzll(word);
+            sum    = distance + load_weight(graph, node, target);
+            if ((sum >= distance) && (sum < state->distances[target]))
+            {
+                state->distances[target] = sum;
+                state->keys[target]      = sum;
+                state->parents[target]   = node;
+            }
+        }
+    }
+}
+
+static ROW_OR_F select_or_kernel(void)
+{
+#ifdef MATRIX_X86
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return row_or_avx2;
+    }
+#endif
+    return row_or_scalar;
+}
+
+static ROW_AND_COUNT_F select_count_kernel(void)
+{
+#ifdef MATRIX_X86
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return row_and_count_avx2;
+    }
+#endif
+    return row_and_count_scalar;
+}
+
+static void row_or_scalar(uint64_t *       destination,
+                          const uint64_t * source,
+                          size_t           words)
+{
+    for (size_t idx = 0; idx < words; idx++)
+    {
+        destination[idx] |= source[idx];
+    }
+}
+
+static size_t row_and_count_scalar(const uint64_t * first,
+                                   const uint64_t * second,
+                                   size_t           words)
+{
+    size_t count = 0;
+
+    for (size_t idx = 0; idx < words; idx++)
+    {
+        count += (size_t)__builtin_popcountll(first[idx] & second[idx]);
+    }
+
+    return count;
+}
+
+#ifdef MATRIX_X86
+#define AVX2_WORDS 4
+
+__attribute__((target("avx2"))) static void row_or_avx2(
+    uint64_t * destination, const uint64_t * source, size_t words)
+{
+    size_t idx = 0;
+
+    for (; (idx + AVX2_WORDS) <= words; idx += AVX2_WORDS)
+    {
+        _mm256_storeu_si256(
+            (__m256i *)&destination[idx],
+            _mm256_or_si256(
+                _mm256_loadu_si256((const __m256i *)&destination[idx]),
+                _mm256_loadu_si256((const __m256i *)&source[idx])));
+    }
+
+    row_or_scalar(&destination[idx], &source[idx], words - idx);
+}
+
+/*
+ * AVX2 has no vector popcount. Each byte is split into nibbles that index a
+ * 16-entry bit-count table with a shuffle, and the byte counts are summed
+ * into 64-bit lanes with SAD against zero.
+ */
+__attribute__((target("avx2"))) static size_t row_and_count_avx2(
+    const uint64_t * first, const uint64_t * second, size_t words)
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2,
+                                            3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2,
+                                            2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i       totals   = _mm256_setzero_si256();
+    __m256i       bits;
+    __m256i       counts;
+    uint64_t      lanes[AVX2_WORDS];
+    size_t        idx = 0;
+
+    for (; (idx + AVX2_WORDS) <= words; idx += AVX2_WORDS)
+    {
+        bits   = _mm256_and_si256(
+            _mm256_loadu_si256((const __m256i *)&first[idx]),
+            _mm256_loadu_si256((const __m256i *)&second[idx]));
+        counts = _mm256_add_epi8(
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256(bits, low_mask)),
+            _mm256_shuffle_epi8(
+                lookup,
+                _mm256_and_si256(_mm256_srli_epi16(bits, 4), low_mask)));
+        totals = _mm256_add_epi64(
+            totals, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes, totals);
+
+    return (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]) +
+           row_and_count_scalar(&first[idx], &second[idx], words - idx);
+}
+
+/*
+ * AVX2 only compares signed 64-bit lanes. Distances are compared with the
+ * sign bit flipped so that signed comparisons order them as unsigned values.
+ * Each lane keeps its own first minimum, and ties between lanes go to the
+ * lowest index, matching the scalar kernel.
+ */
+__attribute__((target("avx2"))) static size_t argmin_avx2(const size_t * keys,
+                                                          size_t count)
+{
+    const __m256i bias      = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i step      = _mm256_set1_epi64x(DIJKSTRA_LANES);
+    __m256i       best_keys = _mm256_set1_epi64x(INT64_MAX);
+    __m256i       best_idx  = _mm256_setzero_si256();
+    __m256i       indices   = _mm256_setr_epi64x(0, 1, 2, 3);
+    __m256i       current;
+    __m256i       smaller;
+    uint64_t      lane_keys[DIJKSTRA_LANES];
+    uint64_t      lane_idx[DIJKSTRA_LANES];
+    size_t        best     = MATRIX_NO_NODE;
+    size_t        best_key = MATRIX_DISTANCE_INFINITY;
+
+    for (size_t idx = 0; idx < count; idx += DIJKSTRA_LANES)
+    {
+        current = _mm256_xor_si256(
+            _mm256_load_si256((const __m256i *)&keys[idx]), bias);
+        smaller   = _mm256_cmpgt_epi64(best_keys, current);
+        best_keys = _mm256_blendv_epi8(best_keys, current, smaller);
+        best_idx  = _mm256_blendv_epi8(best_idx, indices, smaller);
+        indices   = _mm256_add_epi64(indices, step);
+    }
+
+    _mm256_storeu_si256((__m256i *)lane_keys,
+                        _mm256_xor_si256(best_keys, bias));
+    _mm256_storeu_si256((__m256i *)lane_idx, best_idx);
+
+    for (size_t lane = 0; lane < DIJKSTRA_LANES; lane++)
+    {
+        if ((lane_keys[lane] < best_key) ||
+            ((lane_keys[lane] == best_key) &&
+             (MATRIX_DISTANCE_INFINITY != best_key) &&
+             (lane_idx[lane] < best)))
+        {
+            best_key = lane_keys[lane];
+            best     = lane_idx[lane];
+        }
+    }
+
+    return best;
+}
+
+/*
+ * Loads the weights of four adjacent cells of a row as 64-bit lanes. Rows are
+ * padded to a whole cache line, so the load never leaves the row.
+ */
+__attribute__((target("avx2"))) static inline __m256i load_weights_avx2(
+    const matrix_t * graph, size_t row, size_t column)
+{
+    size_t  cell    = (row * graph->stride) + column;
+    __m256i weights = _mm256_set1_epi64x(1);
+
+    switch (graph->weight_type)
+    {
+        case MATRIX_WEIGHT_U32:
+            weights = _mm256_cvtepu32_epi64(_mm_loadu_si128(
+                (const __m128i *)&((const uint32_t *)graph->weights)[cell]));
+            break;
+        case MATRIX_WEIGHT_U16:
+            weights = _mm256_cvtepu16_epi64(_mm_loadl_epi64(
+                (const __m128i *)&((const uint16_t *)graph->weights)[cell]));
+            break;
+        case MATRIX_WEIGHT_NONE:
+            break;
+        default:
+            weights = _mm256_loadu_si256(
+                (const __m256i *)&((const size_t *)graph->weights)[cell]);
+            break;
+    }
+
+    return weights;
+}
+
+__attribute__((target("avx2"))) static void relax_avx2(
+    const matrix_t * graph, size_t node, dijkstra_state_t * state)
+{
+    const uint64_t * row       = &graph->present[node * graph->row_words];
+    const __m256i    bias      = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i    lane_bits = _mm256_setr_epi64x(1, 2, 4, 8);
+    const __m256i    via =
+        _mm256_set1_epi64x((long long)state->distances[node]);
+    const __m256i biased_via = _mm256_xor_si256(via, bias);
+    const __m256i from       = _mm256_set1_epi64x((long long)node);
+    __m256i       present;
+    __m256i       sum;
+    __m256i       biased_sum;
+    __m256i       current;
+    __m256i       shorter;
+    uint64_t      word   = 0;
+    size_t        shift  = 0;
+    size_t        column = 0;
+
+    for (size_t idx = 0; idx < graph->row_words; idx++)
+    {
+        // Only groups of four columns holding at least one edge are loaded
+        for (word = row[idx]; 0 != word;
+             word &= ~((uint64_t)0xF << shift))
+        {
+            shift  = (size_t)__builtin_ctzll(word) & ~(size_t)3;
+            column = (idx * BITS_PER_WORD) + shift;
+
+            present = _mm256_cmpeq_epi64(
+                _mm256_and_si256(
+                    _mm256_set1_epi64x((long long)((word >> shift) & 0xF)),
+                    lane_bits),
+                lane_bits);
+            sum = _mm256_add_epi64(via,
+                                   load_weights_avx2(graph, node, column));
+            biased_sum = _mm256_xor_si256(sum, bias);
+            current =
+                _mm256_load_si256((const __m256i *)&state->distances[column]);
+
+            // A sum below 'via' wrapped around and must not be taken
+            shorter = _mm256_cmpgt_epi64(_mm256_xor_si256(current, bias),
+                                         biased_sum);
+            shorter = _mm256_andnot_si256(
+                _mm256_cmpgt_epi64(biased_via, biased_sum), shorter);
+            shorter = _mm256_and_si256(shorter, present);
+            if (_mm256_testz_si256(shorter, shorter))
+            {
+                continue;
+            }
+
+            _mm256_store_si256((__m256i *)&state->distances[column],
+                               _mm256_blendv_epi8(current, sum, shorter));
+            _mm256_store_si256(
+                (__m256i *)&state->keys[column],
+                _mm256_blendv_epi8(
+                    _mm256_load_si256((const __m256i *)&state->keys[column]),
+                    sum,
+                    shorter));
+            _mm256_store_si256(
+                (__m256i *)&state->parents[column],
+                _mm256_blendv_epi8(
+                    _mm256_load_si256(
+                        (const __m256i *)&state->parents[column]),
+                    from,
+                    shorter));
+        }
+    }
+}
+#endif
+
 /*** end of file ***/
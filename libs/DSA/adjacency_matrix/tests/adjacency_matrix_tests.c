@@ -0,0 +1,1586 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adjacency_matrix.h"
+#include "comparisons.h"
+#include "utilities.h"
+
+#define NODE_COUNT     70 // Rows span two presence words
+#define LARGE_COUNT    1000
+#define RANDOM_COUNT   150
+#define RANDOM_DENSITY 4 // One in this many pairs gets an edge
+#define MAX_TEST_LABEL 16
+#define GROW_COUNT     300 // Several doublings, rows spanning five words
+#define PATH_COUNT     130
+#define PATH_WEIGHTS   100
+#define SPARSE_DENSITY 40 // Sparse enough to leave some pairs unreachable
+#define LANDMARK_COUNT 4
+#define REACH_SOURCES  37 // Stride between the sources checked by BFS
+#define PATH_SOURCES   43 // Stride between the sources kept up to date
+#define PATH_CHANGES   400
+
+matrix_t * test_matrix = NULL;
+
+int    node_data[NODE_COUNT];
+int    free_count = 0;
+int    visit_order[NODE_COUNT];
+size_t visit_count = 0;
+int    grow_data[GROW_COUNT];
+size_t heuristic_calls = 0;
+size_t multiply_calls  = 0;
+
+void count_free(void * data)
+{
+    (void)data;
+    free_count++;
+}
+
+void record_visit(const void * data)
+{
+    visit_order[visit_count++] = *(const int *)data;
+}
+
+bool is_even(const void * data, const char * label)
+{
+    (void)label;
+    return 0 == (*(const int *)data % 2);
+}
+
+// Labels every node "n<index>" and adds the edges of a small tree-like graph
+static void build_traversal_graph(void)
+{
+    char   label[MAX_TEST_LABEL] = { 0 };
+    size_t edges[][2] = { { 0, 64 }, { 0, 2 }, { 64, 66 }, { 64, 3 },
+                          { 2, 4 },  { 4, 0 }, { 66, 68 }, { 5, 6 } };
+
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        node_data[idx] = idx;
+        snprintf(label, sizeof(label), "n%d", idx);
+        matrix_populate_node(test_matrix, (size_t)idx, &node_data[idx], label);
+    }
+
+    for (size_t idx = 0; idx < (sizeof(edges) / sizeof(edges[0])); idx++)
+    {
+        matrix_add_edge_by_index(test_matrix, edges[idx][0], edges[idx][1], 1);
+    }
+
+    visit_count = 0;
+}
+
+void setup(void)
+{
+    free_count  = 0;
+    test_matrix = matrix_init(NODE_COUNT, true, int_comp, count_free);
+}
+
+void teardown(void)
+{
+    if (NULL != test_matrix)
+    {
+        matrix_destroy(&test_matrix);
+    }
+}
+
+void test_matrix_init(void)
+{
+    matrix_t * empty = NULL;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_matrix);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(test_matrix, 0, 1));
+
+    CU_ASSERT_PTR_NULL(matrix_init(NODE_COUNT, true, NULL, count_free));
+    CU_ASSERT_PTR_NULL(matrix_init(NODE_COUNT, true, int_comp, NULL));
+    CU_ASSERT_PTR_NULL(matrix_init(SIZE_MAX / 2, true, int_comp, count_free));
+
+    empty = matrix_init(0, false, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(empty);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(empty, 0, 0));
+    matrix_destroy(&empty);
+    CU_ASSERT_PTR_NULL(empty);
+}
+
+void test_matrix_edges_by_index(void)
+{
+    size_t weight = 0;
+
+    // Zero is a valid weight; presence is tracked separately
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(test_matrix, 3, 65, 0), E_SUCCESS);
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(test_matrix, 3, 65));
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(test_matrix, 65, 3));
+    CU_ASSERT_EQUAL(
+        matrix_get_edge_weight_by_index(test_matrix, 3, 65, &weight),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 0);
+
+    CU_ASSERT_EQUAL(
+        matrix_set_edge_weight_by_index(test_matrix, 3, 65, SIZE_MAX),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        matrix_get_edge_weight_by_index(test_matrix, 3, 65, &weight),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, SIZE_MAX);
+
+    CU_ASSERT_EQUAL(matrix_remove_edge_by_index(test_matrix, 3, 65),
+                    E_SUCCESS);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(test_matrix, 3, 65));
+    CU_ASSERT_EQUAL(matrix_remove_edge_by_index(test_matrix, 3, 65),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(
+        matrix_get_edge_weight_by_index(test_matrix, 3, 65, &weight),
+        E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_set_edge_weight_by_index(test_matrix, 3, 65, 1),
+                    E_FAILURE);
+
+    // Out of range
+    CU_ASSERT_EQUAL(
+        matrix_add_edge_by_index(test_matrix, 0, NODE_COUNT, 1), E_FAILURE);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(test_matrix, NODE_COUNT, 0));
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(NULL, 0, 1, 1), E_FAILURE);
+}
+
+void test_matrix_undirected_narrow_weights(void)
+{
+    matrix_t * graph  = NULL;
+    size_t     weight = 0;
+
+    graph = matrix_init_weighted(
+        NODE_COUNT, false, MATRIX_WEIGHT_U16, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(graph, 1, 69, UINT16_MAX),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(graph, 1, 2, UINT16_MAX + 1),
+                    E_FAILURE);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 1, 2));
+
+    // Both directions share the weight
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(graph, 69, 1));
+    CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(graph, 69, 1, &weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, UINT16_MAX);
+    CU_ASSERT_EQUAL(matrix_set_edge_weight_by_index(graph, 69, 1, 7),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(graph, 1, 69, &weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 7);
+
+    CU_ASSERT_EQUAL(matrix_remove_edge_by_index(graph, 69, 1), E_SUCCESS);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 1, 69));
+    matrix_destroy(&graph);
+
+    graph = matrix_init_weighted(
+        LARGE_COUNT, true, MATRIX_WEIGHT_U32, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    CU_ASSERT_EQUAL(
+        matrix_add_edge_by_index(graph, LARGE_COUNT - 1, 0, UINT32_MAX),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(graph, 0, 1, SIZE_MAX),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(
+        matrix_get_edge_weight_by_index(graph, LARGE_COUNT - 1, 0, &weight),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, UINT32_MAX);
+    matrix_destroy(&graph);
+}
+
+void test_matrix_neighbors_by_index(void)
+{
+    size_t   count      = 0;
+    size_t * neighbors  = NULL;
+    size_t   expected[] = { 0, 5, 63, 64, 69 };
+
+    for (size_t idx = 0; idx < (sizeof(expected) / sizeof(expected[0])); idx++)
+    {
+        matrix_add_edge_by_index(test_matrix, 10, expected[idx], idx);
+    }
+    matrix_add_edge_by_index(test_matrix, 11, 10, 1);
+
+    CU_ASSERT_EQUAL(
+        matrix_get_neighbors_by_index(test_matrix, 10, &count, &neighbors),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(count, sizeof(expected) / sizeof(expected[0]));
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        CU_ASSERT_EQUAL(neighbors[idx], expected[idx]);
+    }
+    free(neighbors);
+
+    CU_ASSERT_EQUAL(
+        matrix_get_neighbors_by_index(test_matrix, 12, &count, &neighbors),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(count, 0);
+    CU_ASSERT_PTR_NULL(neighbors);
+
+    CU_ASSERT_EQUAL(matrix_get_neighbors_by_index(
+                        test_matrix, NODE_COUNT, &count, &neighbors),
+                    E_FAILURE);
+}
+
+void test_matrix_populate_node(void)
+{
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        node_data[idx] = idx;
+    }
+
+    CU_ASSERT_EQUAL(matrix_populate_node(test_matrix, 0, &node_data[0], "A"),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_populate_node(test_matrix, 1, &node_data[1], "B"),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        matrix_populate_node(test_matrix, NODE_COUNT, &node_data[0], "C"),
+        E_FAILURE);
+
+    CU_ASSERT_EQUAL(matrix_depopulate_node(test_matrix, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(free_count, 1);
+
+    // Destroying frees the data of every populated node
+    matrix_destroy(&test_matrix);
+    CU_ASSERT_PTR_NULL(test_matrix);
+    CU_ASSERT_EQUAL(free_count, 2);
+}
+
+void test_matrix_degree_by_index(void)
+{
+    size_t degree = 0;
+
+    CU_ASSERT_EQUAL(matrix_get_degree_by_index(test_matrix, 3, &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 0);
+
+    for (size_t idx = 0; idx < NODE_COUNT; idx += 3)
+    {
+        matrix_add_edge_by_index(test_matrix, 3, idx, 1);
+    }
+    CU_ASSERT_EQUAL(matrix_get_degree_by_index(test_matrix, 3, &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, (NODE_COUNT + 2) / 3);
+
+    // Directed edges only count at their source
+    CU_ASSERT_EQUAL(matrix_get_degree_by_index(test_matrix, 6, &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 0);
+
+    CU_ASSERT_EQUAL(
+        matrix_get_degree_by_index(test_matrix, NODE_COUNT, &degree),
+        E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_get_degree_by_index(test_matrix, 0, NULL),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_get_degree_by_index(NULL, 0, &degree), E_FAILURE);
+}
+
+void test_matrix_unweighted(void)
+{
+    matrix_t * graph  = NULL;
+    size_t     weight = 0;
+
+    graph = matrix_init_weighted(
+        LARGE_COUNT, false, MATRIX_WEIGHT_NONE, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    // Any weight is accepted, and every edge reads back as 1
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(graph, 5, 900, SIZE_MAX),
+                    E_SUCCESS);
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(graph, 900, 5));
+    CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(graph, 900, 5, &weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 1);
+    CU_ASSERT_EQUAL(matrix_set_edge_weight_by_index(graph, 5, 900, 7),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(graph, 5, 900, &weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 1);
+
+    CU_ASSERT_EQUAL(matrix_remove_edge_by_index(graph, 900, 5), E_SUCCESS);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 5, 900));
+
+    matrix_destroy(&graph);
+}
+
+void test_matrix_expand_frontier(void)
+{
+    size_t     words    = matrix_bitset_words(test_matrix);
+    uint64_t * frontier = NULL;
+    uint64_t * visited  = NULL;
+    uint64_t * next     = NULL;
+
+    CU_ASSERT_EQUAL_FATAL(words % 8, 0);
+    CU_ASSERT_TRUE_FATAL(words * 64 >= NODE_COUNT);
+    CU_ASSERT_EQUAL(matrix_bitset_words(NULL), 0);
+
+    frontier = calloc(words, sizeof(uint64_t));
+    visited  = calloc(words, sizeof(uint64_t));
+    next     = calloc(words, sizeof(uint64_t));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(frontier);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(visited);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(next);
+
+    // 0 -> 1, 0 -> 65, 65 -> 2, 65 -> 0, 1 -> 69
+    matrix_add_edge_by_index(test_matrix, 0, 1, 1);
+    matrix_add_edge_by_index(test_matrix, 0, 65, 1);
+    matrix_add_edge_by_index(test_matrix, 65, 2, 1);
+    matrix_add_edge_by_index(test_matrix, 65, 0, 1);
+    matrix_add_edge_by_index(test_matrix, 1, 69, 1);
+
+    frontier[0] = 1;
+    visited[0]  = 1;
+    CU_ASSERT_EQUAL(
+        matrix_expand_frontier(test_matrix, frontier, visited, next),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(next[0], (uint64_t)1 << 1);
+    CU_ASSERT_EQUAL(next[1], (uint64_t)1 << 1);
+
+    // Node 0 has been visited, so 65 only reaches 2 and 1 reaches 69
+    frontier[0] = next[0];
+    frontier[1] = next[1];
+    visited[0] |= next[0];
+    visited[1] |= next[1];
+    CU_ASSERT_EQUAL(
+        matrix_expand_frontier(test_matrix, frontier, visited, next),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(next[0], (uint64_t)1 << 2);
+    CU_ASSERT_EQUAL(next[1], (uint64_t)1 << 5);
+    for (size_t idx = 2; idx < words; idx++)
+    {
+        CU_ASSERT_EQUAL(next[idx], 0);
+    }
+
+    // Bits past the last node are rejected
+    frontier[1] = (uint64_t)1 << 6;
+    CU_ASSERT_EQUAL(
+        matrix_expand_frontier(test_matrix, frontier, visited, next),
+        E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_expand_frontier(test_matrix, NULL, visited, next),
+                    E_FAILURE);
+
+    free(frontier);
+    free(visited);
+    free(next);
+}
+
+void test_matrix_triangles(void)
+{
+    matrix_t * graph    = NULL;
+    size_t     count    = 0;
+    size_t     expected = 0;
+
+    graph = matrix_init_weighted(
+        RANDOM_COUNT, false, MATRIX_WEIGHT_NONE, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    srand(42);
+    for (size_t src = 0; src < RANDOM_COUNT; src++)
+    {
+        for (size_t dst = src; dst < RANDOM_COUNT; dst++)
+        {
+            if (0 == (rand() % RANDOM_DENSITY))
+            {
+                matrix_add_edge_by_index(graph, src, dst, 1);
+            }
+        }
+    }
+
+    // Compare against checking every triple
+    for (size_t first = 0; first < RANDOM_COUNT; first++)
+    {
+        for (size_t second = first + 1; second < RANDOM_COUNT; second++)
+        {
+            if (!matrix_has_edge_by_index(graph, first, second))
+            {
+                continue;
+            }
+
+            for (size_t third = second + 1; third < RANDOM_COUNT; third++)
+            {
+                expected += (matrix_has_edge_by_index(graph, first, third) &&
+                             matrix_has_edge_by_index(graph, second, third));
+            }
+        }
+    }
+
+    CU_ASSERT_EQUAL(matrix_count_triangles(graph, &count), E_SUCCESS);
+    CU_ASSERT_EQUAL(count, expected);
+    CU_ASSERT_NOT_EQUAL(expected, 0);
+
+    expected = 0;
+    for (size_t idx = 0; idx < RANDOM_COUNT; idx++)
+    {
+        expected += (matrix_has_edge_by_index(graph, 3, idx) &&
+                     matrix_has_edge_by_index(graph, 140, idx));
+    }
+    CU_ASSERT_EQUAL(matrix_common_neighbors_by_index(graph, 3, 140, &count),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(count, expected);
+
+    // Triangles are only defined for undirected graphs
+    CU_ASSERT_EQUAL(matrix_count_triangles(test_matrix, &count), E_FAILURE);
+    CU_ASSERT_EQUAL(
+        matrix_common_neighbors_by_index(graph, 0, RANDOM_COUNT, &count),
+        E_FAILURE);
+
+    matrix_destroy(&graph);
+}
+
+void test_matrix_bfs(void)
+{
+    int expected[] = { 0, 2, 64, 3, 4, 66, 68 };
+
+    build_traversal_graph();
+
+    // Levels in ascending index order: {0}, {2, 64}, {3, 4, 66}, {68}
+    CU_ASSERT_EQUAL(matrix_bfs(test_matrix, "n0", record_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(visit_count, sizeof(expected) / sizeof(int));
+    for (size_t idx = 0; idx < visit_count; idx++)
+    {
+        CU_ASSERT_EQUAL(visit_order[idx], expected[idx]);
+    }
+
+    visit_count = 0;
+    CU_ASSERT_EQUAL(matrix_bfs_by_index(test_matrix, 6, record_visit),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 1);
+
+    CU_ASSERT_EQUAL(matrix_bfs(test_matrix, "missing", record_visit),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_bfs(test_matrix, "n0", NULL), E_FAILURE);
+    CU_ASSERT_EQUAL(
+        matrix_bfs_by_index(test_matrix, NODE_COUNT, record_visit),
+        E_FAILURE);
+}
+
+void test_matrix_dfs(void)
+{
+    int expected[] = { 0, 2, 4, 64, 3, 66, 68 };
+
+    build_traversal_graph();
+
+    CU_ASSERT_EQUAL(matrix_dfs(test_matrix, "n0", record_visit), E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(visit_count, sizeof(expected) / sizeof(int));
+    for (size_t idx = 0; idx < visit_count; idx++)
+    {
+        CU_ASSERT_EQUAL(visit_order[idx], expected[idx]);
+    }
+
+    // A long chain across several words, which also reaches 3 through 64
+    visit_count = 0;
+    for (size_t idx = 7; (idx + 1) < NODE_COUNT; idx++)
+    {
+        matrix_add_edge_by_index(test_matrix, idx, idx + 1, 1);
+    }
+    CU_ASSERT_EQUAL(matrix_dfs_by_index(test_matrix, 7, record_visit),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(visit_count, NODE_COUNT - 6);
+    CU_ASSERT_EQUAL(visit_order[64 - 7 + 1], 3);
+    CU_ASSERT_EQUAL(visit_order[visit_count - 1], NODE_COUNT - 1);
+
+    CU_ASSERT_EQUAL(matrix_dfs(test_matrix, "missing", record_visit),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_dfs(NULL, "n0", record_visit), E_FAILURE);
+}
+
+void test_matrix_flood_fill(void)
+{
+    int expected[] = { 0, 2, 64, 4, 66, 68 };
+
+    build_traversal_graph();
+
+    // 3 fails the predicate; 5 and 6 are not connected
+    CU_ASSERT_EQUAL(
+        matrix_flood_fill(test_matrix, "n0", is_even, record_visit),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(visit_count, sizeof(expected) / sizeof(int));
+    for (size_t idx = 0; idx < visit_count; idx++)
+    {
+        CU_ASSERT_EQUAL(visit_order[idx], expected[idx]);
+    }
+
+    // An odd start fills nothing, and odd nodes block the way
+    visit_count = 0;
+    CU_ASSERT_EQUAL(
+        matrix_flood_fill_by_index(test_matrix, 5, is_even, record_visit),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, 0);
+
+    matrix_add_edge_by_index(test_matrix, 3, 8, 1);
+    CU_ASSERT_EQUAL(
+        matrix_flood_fill_by_index(test_matrix, 0, is_even, record_visit),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(visit_count, sizeof(expected) / sizeof(int));
+
+    CU_ASSERT_EQUAL(matrix_flood_fill(test_matrix, "n0", NULL, record_visit),
+                    E_FAILURE);
+}
+
+void test_matrix_labels(void)
+{
+    size_t   weight        = 0;
+    size_t   num_neighbors = 0;
+    size_t * neighbors     = NULL;
+    void *   data          = NULL;
+
+    build_traversal_graph();
+
+    CU_ASSERT_EQUAL(matrix_get_node_data(test_matrix, "n64", &data),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(data, &node_data[64]);
+    CU_ASSERT_EQUAL(matrix_get_node_data(test_matrix, "n70", &data),
+                    E_FAILURE);
+
+    CU_ASSERT_EQUAL(matrix_add_edge_by_label(test_matrix, "n1", "n69", 9),
+                    E_SUCCESS);
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(test_matrix, 1, 69));
+    CU_ASSERT_TRUE(matrix_has_edge_by_label(test_matrix, "n1", "n69"));
+    CU_ASSERT_FALSE(matrix_has_edge_by_label(test_matrix, "n69", "n1"));
+    CU_ASSERT_EQUAL(
+        matrix_set_edge_weight_by_label(test_matrix, "n1", "n69", 4),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        matrix_get_edge_weight_by_label(test_matrix, "n1", "n69", &weight),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 4);
+
+    CU_ASSERT_EQUAL(matrix_get_neighbors_by_label(
+                        test_matrix, "n0", &num_neighbors, &neighbors),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(num_neighbors, 2);
+    CU_ASSERT_EQUAL(neighbors[0], 2);
+    CU_ASSERT_EQUAL(neighbors[1], 64);
+    free(neighbors);
+
+    CU_ASSERT_EQUAL(matrix_remove_edge_by_label(test_matrix, "n1", "n69"),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_remove_edge_by_label(test_matrix, "n1", "n69"),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_add_edge_by_label(test_matrix, "n1", "none", 1),
+                    E_FAILURE);
+
+    // Labels are unique, and free again once their node is depopulated
+    CU_ASSERT_EQUAL(
+        matrix_populate_node(test_matrix, 1, &node_data[1], "n2"), E_FAILURE);
+    CU_ASSERT_EQUAL(
+        matrix_populate_node(test_matrix, 1, &node_data[1], "n1"), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_depopulate_node(test_matrix, 2), E_SUCCESS);
+    CU_ASSERT_FALSE(matrix_has_edge_by_label(test_matrix, "n0", "n2"));
+    CU_ASSERT_EQUAL(
+        matrix_populate_node(test_matrix, 1, &node_data[1], "n2"), E_SUCCESS);
+    CU_ASSERT_TRUE(matrix_has_edge_by_label(test_matrix, "n0", "n64"));
+    CU_ASSERT_EQUAL(matrix_get_node_data(test_matrix, "n1", &data),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_get_node_data(test_matrix, "n2", &data),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(data, &node_data[1]);
+
+    CU_ASSERT_EQUAL(matrix_populate_node(test_matrix,
+                                         3,
+                                         &node_data[3],
+                                         "a label that is far too long"),
+                    E_FAILURE);
+}
+
+void test_matrix_add_remove_node(void)
+{
+    matrix_t * graph                 = NULL;
+    char       label[MAX_TEST_LABEL] = { 0 };
+    size_t     weight                = 0;
+    void *     data                  = NULL;
+
+    graph = matrix_init(0, true, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    // Edges added along the way survive every growth
+    for (int idx = 0; idx < GROW_COUNT; idx++)
+    {
+        grow_data[idx] = idx;
+        snprintf(label, sizeof(label), "n%d", idx);
+        CU_ASSERT_EQUAL_FATAL(matrix_add_node(graph, &grow_data[idx], label),
+                              E_SUCCESS);
+        if (0 != idx)
+        {
+            matrix_add_edge_by_index(graph, idx - 1, idx, idx);
+        }
+    }
+    CU_ASSERT(matrix_bitset_words(graph) * 64 >= GROW_COUNT);
+
+    for (size_t idx = 1; idx < GROW_COUNT; idx++)
+    {
+        CU_ASSERT_EQUAL(
+            matrix_get_edge_weight_by_index(graph, idx - 1, idx, &weight),
+            E_SUCCESS);
+        CU_ASSERT_EQUAL(weight, idx);
+        CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, idx, idx - 1));
+    }
+    CU_ASSERT_EQUAL(matrix_get_node_data(graph, "n299", &data), E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(data, &grow_data[GROW_COUNT - 1]);
+
+    // Removing a node drops its edges in both directions
+    CU_ASSERT_EQUAL(matrix_remove_node(graph, "n100"), E_SUCCESS);
+    CU_ASSERT_EQUAL(free_count, 1);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 99, 100));
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 100, 101));
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(graph, 101, 102));
+    CU_ASSERT_EQUAL(matrix_remove_node(graph, "n100"), E_FAILURE);
+
+    // A failed add keeps the free slot, and the next add takes it
+    CU_ASSERT_EQUAL(matrix_add_node(graph, &grow_data[0], "n7"), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_add_node(graph, &grow_data[100], "back"),
+                    E_SUCCESS);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 99, 100));
+    CU_ASSERT_EQUAL(matrix_add_edge_by_label(graph, "n99", "back", 5),
+                    E_SUCCESS);
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(graph, 99, 100));
+
+    // With no free slots left, the next node is appended
+    CU_ASSERT_EQUAL(matrix_add_node(graph, &grow_data[1], "last"), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(graph, 0, GROW_COUNT, 1),
+                    E_SUCCESS);
+    CU_ASSERT_TRUE(matrix_has_edge_by_label(graph, "n0", "last"));
+
+    CU_ASSERT_EQUAL(matrix_add_node(graph, NULL, "none"), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_remove_node(NULL, "n0"), E_FAILURE);
+
+    matrix_destroy(&graph);
+    CU_ASSERT_EQUAL(free_count, GROW_COUNT + 2);
+}
+
+// Bellman-Ford over every cell, as a reference for the Dijkstra kernels
+static void reference_distances(matrix_t * graph, size_t start, size_t * out)
+{
+    size_t weight  = 0;
+    bool   changed = true;
+
+    for (size_t idx = 0; idx < PATH_COUNT; idx++)
+    {
+        out[idx] = MATRIX_DISTANCE_INFINITY;
+    }
+    out[start] = 0;
+
+    while (changed)
+    {
+        changed = false;
+        for (size_t src = 0; src < PATH_COUNT; src++)
+        {
+            for (size_t dst = 0; dst < PATH_COUNT; dst++)
+            {
+                if ((MATRIX_DISTANCE_INFINITY == out[src]) ||
+                    (E_SUCCESS != matrix_get_edge_weight_by_index(
+                                      graph, src, dst, &weight)) ||
+                    ((out[src] + weight) >= out[dst]))
+                {
+                    continue;
+                }
+                out[dst] = out[src] + weight;
+                changed  = true;
+            }
+        }
+    }
+}
+
+static void check_random_distances(matrix_weight_t weight_type)
+{
+    matrix_t * graph = NULL;
+    size_t     expected[PATH_COUNT];
+    size_t     distances[PATH_COUNT];
+    size_t     parents[PATH_COUNT];
+    size_t     weight = 0;
+
+    graph = matrix_init_weighted(
+        PATH_COUNT, true, weight_type, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    srand(7);
+    for (size_t src = 0; src < PATH_COUNT; src++)
+    {
+        for (size_t dst = 0; dst < PATH_COUNT; dst++)
+        {
+            if (0 == (rand() % RANDOM_DENSITY))
+            {
+                matrix_add_edge_by_index(
+                    graph, src, dst, (size_t)rand() % PATH_WEIGHTS);
+            }
+        }
+    }
+
+    for (size_t start = 0; start < PATH_COUNT; start += 13)
+    {
+        reference_distances(graph, start, expected);
+        CU_ASSERT_EQUAL(matrix_shortest_distances_by_index(
+                            graph, start, distances, parents),
+                        E_SUCCESS);
+        CU_ASSERT_EQUAL(parents[start], MATRIX_NO_NODE);
+        for (size_t idx = 0; idx < PATH_COUNT; idx++)
+        {
+            CU_ASSERT_EQUAL(distances[idx], expected[idx]);
+            if ((idx == start) || (MATRIX_NO_NODE == parents[idx]))
+            {
+                continue;
+            }
+
+            // Every parent link is an edge on a shortest path
+            CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(
+                                graph, parents[idx], idx, &weight),
+                            E_SUCCESS);
+            CU_ASSERT_EQUAL(distances[parents[idx]] + weight, distances[idx]);
+        }
+    }
+
+    matrix_destroy(&graph);
+}
+
+void test_matrix_shortest_distances(void)
+{
+    check_random_distances(MATRIX_WEIGHT_SIZE_T);
+    check_random_distances(MATRIX_WEIGHT_U32);
+    check_random_distances(MATRIX_WEIGHT_U16);
+    check_random_distances(MATRIX_WEIGHT_NONE);
+}
+
+void test_matrix_dijkstra(void)
+{
+    size_t * path         = NULL;
+    size_t   path_length  = 0;
+    size_t   total_weight = 0;
+    char **  labels       = NULL;
+    int      label_count  = 0;
+
+    build_traversal_graph();
+
+    // 0 -> 64 -> 66 -> 68 is shorter than the direct edge 0 -> 68
+    matrix_add_edge_by_index(test_matrix, 0, 68, 10);
+    matrix_set_edge_weight_by_index(test_matrix, 0, 64, 2);
+    matrix_set_edge_weight_by_index(test_matrix, 64, 66, 3);
+    matrix_set_edge_weight_by_index(test_matrix, 66, 68, 4);
+
+    CU_ASSERT_EQUAL(matrix_dijkstra_by_index(
+                        test_matrix, 0, 68, &path, &path_length, &total_weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(path_length, 4);
+    CU_ASSERT_EQUAL(path[0], 0);
+    CU_ASSERT_EQUAL(path[1], 64);
+    CU_ASSERT_EQUAL(path[2], 66);
+    CU_ASSERT_EQUAL(path[3], 68);
+    CU_ASSERT_EQUAL(total_weight, 9);
+    CU_ASSERT_STRING_EQUAL(matrix_get_label_by_index(test_matrix, path[1]),
+                           "n64");
+    free(path);
+
+    CU_ASSERT_EQUAL(matrix_dijkstra_shortest_path(test_matrix,
+                                                  "n0",
+                                                  "n68",
+                                                  &labels,
+                                                  &label_count,
+                                                  &total_weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(label_count, 4);
+    CU_ASSERT_STRING_EQUAL(labels[0], "n0");
+    CU_ASSERT_STRING_EQUAL(labels[3], "n68");
+    for (int idx = 0; idx < label_count; idx++)
+    {
+        free(labels[idx]);
+    }
+    free(labels);
+
+    // A path to itself is one node long
+    CU_ASSERT_EQUAL(matrix_dijkstra_by_index(
+                        test_matrix, 5, 5, &path, &path_length, &total_weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(path_length, 1);
+    CU_ASSERT_EQUAL(total_weight, 0);
+    free(path);
+
+    CU_ASSERT_EQUAL(matrix_dijkstra_by_index(
+                        test_matrix, 68, 0, &path, &path_length, &total_weight),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_dijkstra_shortest_path(test_matrix,
+                                                  "n0",
+                                                  "none",
+                                                  &labels,
+                                                  &label_count,
+                                                  &total_weight),
+                    E_FAILURE);
+    CU_ASSERT_PTR_NULL(matrix_get_label_by_index(test_matrix, NODE_COUNT));
+}
+
+size_t count_heuristic(const char * label, const char * target_label)
+{
+    (void)label;
+    (void)target_label;
+    heuristic_calls++;
+    return 0;
+}
+
+void test_matrix_astar(void)
+{
+    size_t * path         = NULL;
+    size_t   path_length  = 0;
+    size_t   total_weight = 0;
+    char **  labels       = NULL;
+    int      label_count  = 0;
+    size_t   weight       = 0;
+    size_t   bounds[NODE_COUNT];
+
+    build_traversal_graph();
+    matrix_add_edge_by_index(test_matrix, 0, 68, 10);
+    matrix_set_edge_weight_by_index(test_matrix, 0, 64, 2);
+    matrix_set_edge_weight_by_index(test_matrix, 64, 66, 3);
+    matrix_set_edge_weight_by_index(test_matrix, 66, 68, 4);
+
+    // Without a heuristic the search is Dijkstra's
+    CU_ASSERT_EQUAL(matrix_astar_by_index(test_matrix,
+                                          0,
+                                          68,
+                                          NULL,
+                                          NULL,
+                                          &path,
+                                          &path_length,
+                                          &total_weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(path_length, 4);
+    CU_ASSERT_EQUAL(path[1], 64);
+    CU_ASSERT_EQUAL(path[2], 66);
+    CU_ASSERT_EQUAL(total_weight, 9);
+    free(path);
+
+    // Exact bounds, with infinity for the nodes that cannot reach the target
+    for (size_t idx = 0; idx < NODE_COUNT; idx++)
+    {
+        bounds[idx] = MATRIX_DISTANCE_INFINITY;
+        if (E_SUCCESS ==
+            matrix_dijkstra_by_index(
+                test_matrix, idx, 68, &path, &path_length, &weight))
+        {
+            bounds[idx] = weight;
+            free(path);
+        }
+    }
+    CU_ASSERT_EQUAL(bounds[3], MATRIX_DISTANCE_INFINITY);
+    CU_ASSERT_EQUAL(matrix_astar_by_index(test_matrix,
+                                          0,
+                                          68,
+                                          matrix_vector_heuristic,
+                                          bounds,
+                                          &path,
+                                          &path_length,
+                                          &total_weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(path_length, 4);
+    CU_ASSERT_EQUAL(total_weight, 9);
+    free(path);
+
+    heuristic_calls = 0;
+    CU_ASSERT_EQUAL(matrix_astar_shortest_path(test_matrix,
+                                               "n0",
+                                               "n68",
+                                               count_heuristic,
+                                               &labels,
+                                               &label_count,
+                                               &total_weight),
+                    E_SUCCESS);
+    CU_ASSERT(heuristic_calls > 0);
+    CU_ASSERT_EQUAL_FATAL(label_count, 4);
+    CU_ASSERT_STRING_EQUAL(labels[0], "n0");
+    CU_ASSERT_STRING_EQUAL(labels[2], "n66");
+    CU_ASSERT_STRING_EQUAL(labels[3], "n68");
+    CU_ASSERT_EQUAL(total_weight, 9);
+    for (int idx = 0; idx < label_count; idx++)
+    {
+        free(labels[idx]);
+    }
+    free(labels);
+
+    // A bound of infinity at the start means there is no path
+    bounds[0] = MATRIX_DISTANCE_INFINITY;
+    CU_ASSERT_EQUAL(matrix_astar_by_index(test_matrix,
+                                          0,
+                                          68,
+                                          matrix_vector_heuristic,
+                                          bounds,
+                                          &path,
+                                          &path_length,
+                                          &total_weight),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_astar_by_index(test_matrix,
+                                          68,
+                                          0,
+                                          NULL,
+                                          NULL,
+                                          &path,
+                                          &path_length,
+                                          &total_weight),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_astar_shortest_path(test_matrix,
+                                               "n0",
+                                               "none",
+                                               NULL,
+                                               &labels,
+                                               &label_count,
+                                               &total_weight),
+                    E_FAILURE);
+}
+
+static void check_landmarks(bool is_directed)
+{
+    matrix_t *           graph     = NULL;
+    matrix_landmarks_t * landmarks = NULL;
+    const size_t *       nodes     = NULL;
+    size_t               count     = 0;
+    size_t *             path      = NULL;
+    size_t               length    = 0;
+    size_t               weight    = 0;
+    size_t               expected[PATH_COUNT];
+
+    graph = matrix_init(PATH_COUNT, is_directed, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    srand(11);
+    for (size_t src = 0; src < PATH_COUNT; src++)
+    {
+        for (size_t dst = 0; dst < PATH_COUNT; dst++)
+        {
+            if (0 == (rand() % SPARSE_DENSITY))
+            {
+                matrix_add_edge_by_index(
+                    graph, src, dst, (size_t)rand() % PATH_WEIGHTS);
+            }
+        }
+    }
+
+    landmarks = matrix_landmarks_create(graph, LANDMARK_COUNT);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(landmarks);
+    nodes = matrix_landmarks_get_nodes(landmarks, &count);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(nodes);
+    CU_ASSERT_EQUAL(count, LANDMARK_COUNT);
+    for (size_t idx = 1; idx < count; idx++)
+    {
+        CU_ASSERT_NOT_EQUAL(nodes[idx], nodes[idx - 1]);
+    }
+
+    // Every bound is admissible, and every query matches Dijkstra's
+    for (size_t start = 0; start < PATH_COUNT; start += 7)
+    {
+        reference_distances(graph, start, expected);
+        for (size_t target = 0; target < PATH_COUNT; target++)
+        {
+            if (MATRIX_DISTANCE_INFINITY == expected[target])
+            {
+                CU_ASSERT_EQUAL(matrix_astar_by_index(graph,
+                                                      start,
+                                                      target,
+                                                      matrix_landmark_heuristic,
+                                                      landmarks,
+                                                      &path,
+                                                      &length,
+                                                      &weight),
+                                E_FAILURE);
+                continue;
+            }
+
+            CU_ASSERT(matrix_landmark_heuristic(start, target, landmarks) <=
+                      expected[target]);
+            CU_ASSERT_EQUAL(matrix_astar_by_index(graph,
+                                                  start,
+                                                  target,
+                                                  matrix_landmark_heuristic,
+                                                  landmarks,
+                                                  &path,
+                                                  &length,
+                                                  &weight),
+                            E_SUCCESS);
+            CU_ASSERT_EQUAL(weight, expected[target]);
+            CU_ASSERT_EQUAL(path[0], start);
+            CU_ASSERT_EQUAL(path[length - 1], target);
+            free(path);
+        }
+    }
+
+    matrix_landmarks_destroy(&landmarks);
+    CU_ASSERT_PTR_NULL(landmarks);
+    matrix_destroy(&graph);
+}
+
+void test_matrix_landmarks(void)
+{
+    matrix_landmarks_t * landmarks = NULL;
+    size_t               count     = 0;
+
+    check_landmarks(true);
+    check_landmarks(false);
+
+    // No more landmarks than nodes
+    landmarks = matrix_landmarks_create(test_matrix, 2 * NODE_COUNT);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(landmarks);
+    CU_ASSERT_PTR_NOT_NULL(matrix_landmarks_get_nodes(landmarks, &count));
+    CU_ASSERT(count <= NODE_COUNT);
+    CU_ASSERT_EQUAL(matrix_landmark_heuristic(NODE_COUNT, 0, landmarks), 0);
+    matrix_landmarks_destroy(&landmarks);
+
+    CU_ASSERT_PTR_NULL(matrix_landmarks_create(NULL, LANDMARK_COUNT));
+    CU_ASSERT_PTR_NULL(matrix_landmarks_create(test_matrix, 0));
+    CU_ASSERT_PTR_NULL(matrix_landmarks_get_nodes(NULL, &count));
+}
+
+// Computes each quarter of rows and columns separately, as a thread pool
+// would
+int split_multiply(const uint64_t * left,
+                   const uint64_t * right,
+                   uint64_t *       product,
+                   size_t           row_count,
+                   size_t           row_words,
+                   void *           context)
+{
+    size_t half_words  = (row_words / 2) - ((row_words / 2) % 8);
+    size_t half_rows   = row_count / 2;
+    size_t rows[2][2]  = { { 0, half_rows },
+                           { half_rows, row_count - half_rows } };
+    size_t words[2][2] = { { 0, half_words },
+                           { half_words, row_words - half_words } };
+
+    CU_ASSERT_PTR_EQUAL(context, &multiply_calls);
+    multiply_calls++;
+    for (size_t block = 0; block < 4; block++)
+    {
+        if (E_SUCCESS != matrix_bitset_multiply(left,
+                                                right,
+                                                product,
+                                                row_count,
+                                                row_words,
+                                                rows[block / 2][0],
+                                                rows[block / 2][1],
+                                                words[block % 2][0],
+                                                words[block % 2][1]))
+        {
+            return E_FAILURE;
+        }
+    }
+    return E_SUCCESS;
+}
+
+// Checks the reach rows against hop counts from an unweighted Dijkstra
+static void check_reach(matrix_t *       graph,
+                        size_t           count,
+                        size_t           hops,
+                        const uint64_t * reach)
+{
+    size_t   words = matrix_bitset_words(graph);
+    size_t * level = calloc(count, sizeof(size_t));
+    bool     is_set;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(level);
+    for (size_t src = 0; src < count; src += REACH_SOURCES)
+    {
+        matrix_shortest_distances_by_index(graph, src, level, NULL);
+        for (size_t dst = 0; dst < (words * 64); dst++)
+        {
+            is_set = 0 != ((reach[(src * words) + (dst / 64)] >> (dst % 64)) &
+                           1);
+            CU_ASSERT_EQUAL(is_set,
+                            (dst < count) &&
+                                (MATRIX_DISTANCE_INFINITY != level[dst]) &&
+                                (level[dst] <= hops));
+        }
+    }
+
+    free(level);
+}
+
+void test_matrix_reachability(void)
+{
+    matrix_t * graph   = NULL;
+    uint64_t * reach   = NULL;
+    uint64_t * closure = NULL;
+    size_t     words   = 0;
+    size_t     hops[]  = { 0, 1, 2, 3, 5, 12, SIZE_MAX };
+
+    graph = matrix_init_weighted(
+        LARGE_COUNT, true, MATRIX_WEIGHT_NONE, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    words = matrix_bitset_words(graph);
+
+    // About two edges per node leaves long paths and unreachable pairs
+    srand(13);
+    for (size_t src = 0; src < LARGE_COUNT; src++)
+    {
+        for (int edge = 0; edge < 2; edge++)
+        {
+            matrix_add_edge_by_index(
+                graph, src, (size_t)rand() % LARGE_COUNT, 1);
+        }
+    }
+
+    for (size_t idx = 0; idx < (sizeof(hops) / sizeof(hops[0])); idx++)
+    {
+        CU_ASSERT_EQUAL_FATAL(matrix_reachability(graph, hops[idx], &reach),
+                              E_SUCCESS);
+        check_reach(graph, LARGE_COUNT, hops[idx], reach);
+        free(reach);
+    }
+
+    // Strips of columns computed apart give the same bits
+    multiply_calls = 0;
+    CU_ASSERT_EQUAL_FATAL(matrix_transitive_closure(graph, &closure),
+                          E_SUCCESS);
+    CU_ASSERT_EQUAL_FATAL(
+        matrix_reachability_with(
+            graph, SIZE_MAX, split_multiply, &multiply_calls, &reach),
+        E_SUCCESS);
+    CU_ASSERT(multiply_calls > 0);
+    CU_ASSERT(multiply_calls <= 20);
+    CU_ASSERT_EQUAL(
+        memcmp(reach, closure, LARGE_COUNT * words * sizeof(uint64_t)), 0);
+    free(reach);
+
+    CU_ASSERT_EQUAL(matrix_reachability_with(
+                        graph, 7, split_multiply, &multiply_calls, &reach),
+                    E_SUCCESS);
+    check_reach(graph, LARGE_COUNT, 7, reach);
+    free(reach);
+
+    CU_ASSERT_NOT_EQUAL(matrix_bitset_multiply(closure,
+                                               closure,
+                                               NULL,
+                                               LARGE_COUNT,
+                                               words,
+                                               0,
+                                               LARGE_COUNT,
+                                               0,
+                                               8),
+                        E_SUCCESS);
+    CU_ASSERT_NOT_EQUAL(matrix_bitset_multiply(closure,
+                                               closure,
+                                               closure,
+                                               LARGE_COUNT,
+                                               words,
+                                               0,
+                                               LARGE_COUNT,
+                                               words - 7,
+                                               8),
+                        E_SUCCESS);
+    CU_ASSERT_NOT_EQUAL(matrix_bitset_multiply(closure,
+                                               closure,
+                                               closure,
+                                               LARGE_COUNT,
+                                               words,
+                                               1,
+                                               LARGE_COUNT,
+                                               0,
+                                               8),
+                        E_SUCCESS);
+    CU_ASSERT_NOT_EQUAL(matrix_reachability(NULL, 1, &reach), E_SUCCESS);
+    CU_ASSERT_NOT_EQUAL(matrix_transitive_closure(graph, NULL), E_SUCCESS);
+
+    free(closure);
+    matrix_destroy(&graph);
+}
+
+void test_matrix_nodes_by_index(void)
+{
+    matrix_t * graph = NULL;
+    size_t     index = 0;
+    void *     data  = NULL;
+
+    graph = matrix_init(0, false, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    for (size_t idx = 0; idx < 3; idx++)
+    {
+        CU_ASSERT_EQUAL(
+            matrix_add_node_by_index(graph, &node_data[idx], &index),
+            E_SUCCESS);
+        CU_ASSERT_EQUAL(index, idx);
+        CU_ASSERT_PTR_NULL(matrix_get_label_by_index(graph, index));
+    }
+    CU_ASSERT_EQUAL(matrix_get_node_count(graph), 3);
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(graph, 0, 1, 4), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_get_node_data_by_index(graph, 2, &data),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(data, &node_data[2]);
+
+    // Unlabeled nodes free their slot the same way
+    CU_ASSERT_EQUAL(matrix_remove_node_by_index(graph, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(free_count, 1);
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 0, 1));
+    CU_ASSERT_EQUAL(matrix_get_node_data_by_index(graph, 1, &data),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_NULL(data);
+    CU_ASSERT_EQUAL(matrix_remove_node_by_index(graph, 1), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_add_node_by_index(graph, &node_data[5], &index),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(index, 1);
+    CU_ASSERT_EQUAL(matrix_get_node_count(graph), 3);
+
+    CU_ASSERT_EQUAL(matrix_get_node_data_by_index(graph, 3, &data),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_add_node_by_index(graph, NULL, &index), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_remove_node_by_index(graph, 3), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_get_node_count(NULL), 0);
+
+    matrix_destroy(&graph);
+    CU_ASSERT_EQUAL(free_count, 4);
+}
+
+void test_matrix_conversion(void)
+{
+    graph_t *  list    = NULL;
+    graph_t *  copy    = NULL;
+    matrix_t * graph   = NULL;
+    void *     data    = NULL;
+    size_t     weight  = 0;
+    size_t     degree  = 0;
+    size_t     one_way = 0;
+
+    list = graph_create(count_free, int_comp);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(list);
+    for (int idx = 0; idx < NODE_COUNT; idx++)
+    {
+        node_data[idx] = idx;
+        graph_add_node(list, &node_data[idx]);
+    }
+    for (int idx = 1; idx < NODE_COUNT; idx++)
+    {
+        graph_add_edge(list, &node_data[idx - 1], &node_data[idx], idx, true);
+    }
+
+    // Parallel edges keep the lightest weight, in both directions
+    graph_add_edge(list, &node_data[1], &node_data[0], 7, true);
+    graph_add_edge(list, &node_data[68], &node_data[3], 9, true);
+    graph_add_edge(list, &node_data[3], &node_data[68], 2, true);
+    graph_add_edge(list, &node_data[5], &node_data[5], 6, true);
+
+    graph = matrix_from_graph(list, false, MATRIX_WEIGHT_U16);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    CU_ASSERT_EQUAL(matrix_get_node_count(graph), NODE_COUNT);
+    for (size_t idx = 0; idx < NODE_COUNT; idx++)
+    {
+        CU_ASSERT_EQUAL(matrix_get_node_data_by_index(graph, idx, &data),
+                        E_SUCCESS);
+        CU_ASSERT_PTR_EQUAL(data, &node_data[idx]);
+        CU_ASSERT_PTR_NULL(matrix_get_label_by_index(graph, idx));
+    }
+    CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(graph, 1, 0, &weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 1);
+    CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(graph, 68, 3, &weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 2);
+    CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(graph, 5, 5, &weight),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(weight, 6);
+    CU_ASSERT_EQUAL(matrix_get_degree_by_index(graph, 68, &degree), E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 3);
+
+    // Back to a list, each pair gets a single two-way edge
+    copy = matrix_to_graph(graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(copy);
+    CU_ASSERT_EQUAL(copy->node_count, NODE_COUNT);
+    CU_ASSERT_EQUAL(copy->directed_edge_count, 0);
+    CU_ASSERT_EQUAL(graph_get_edge_weight(copy, &node_data[3], &node_data[68]),
+                    2);
+    CU_ASSERT_EQUAL(graph_get_edge_weight(copy, &node_data[69], &node_data[68]),
+                    69);
+    CU_ASSERT_EQUAL(graph_node_degree(copy, &node_data[68], &degree),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(degree, 3);
+    graph_destroy(&copy);
+    matrix_destroy(&graph);
+    CU_ASSERT_EQUAL(free_count, 0);
+
+    // One-way edges need a directed matrix, and weights must fit
+    graph_add_edge(list, &node_data[10], &node_data[40], UINT16_MAX + 1, false);
+    CU_ASSERT_PTR_NULL(matrix_from_graph(list, false, MATRIX_WEIGHT_SIZE_T));
+    CU_ASSERT_PTR_NULL(matrix_from_graph(list, true, MATRIX_WEIGHT_U16));
+    graph = matrix_from_graph(list, true, MATRIX_WEIGHT_U32);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(graph, 10, 40));
+    CU_ASSERT_FALSE(matrix_has_edge_by_index(graph, 40, 10));
+    CU_ASSERT_TRUE(matrix_has_edge_by_index(graph, 11, 10));
+
+    // Edges on an unpopulated slot are dropped with it
+    matrix_remove_node_by_index(graph, 0);
+    for (size_t idx = 0; idx < NODE_COUNT; idx++)
+    {
+        matrix_get_degree_by_index(graph, idx, &degree);
+        one_way += degree;
+    }
+
+    copy = matrix_to_graph(graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(copy);
+    CU_ASSERT_EQUAL(copy->node_count, NODE_COUNT - 1);
+    CU_ASSERT_EQUAL(copy->directed_edge_count, one_way);
+    CU_ASSERT_EQUAL(graph_get_edge_weight(copy, &node_data[10], &node_data[40]),
+                    UINT16_MAX + 1);
+    CU_ASSERT_FALSE(graph_edge_exists(copy, &node_data[40], &node_data[10]));
+    graph_destroy(&copy);
+    matrix_destroy(&graph);
+    CU_ASSERT_EQUAL(free_count, 0);
+
+    CU_ASSERT_PTR_NULL(matrix_from_graph(NULL, true, MATRIX_WEIGHT_SIZE_T));
+    CU_ASSERT_PTR_NULL(matrix_to_graph(NULL));
+
+    graph_destroy(&list);
+    CU_ASSERT_EQUAL(free_count, NODE_COUNT);
+}
+
+// Checks every cached source, and one path of each, against a full Dijkstra
+static void check_cached_paths(matrix_t * graph, matrix_paths_t * paths)
+{
+    const size_t * cached = NULL;
+    size_t *       path   = NULL;
+    size_t         expected[PATH_COUNT];
+    size_t         length = 0;
+    size_t         total  = 0;
+    size_t         weight = 0;
+    size_t         sum    = 0;
+    size_t         target = 0;
+
+    for (size_t start = 0; start < PATH_COUNT; start += PATH_SOURCES)
+    {
+        cached = matrix_paths_get_distances(paths, start);
+        CU_ASSERT_PTR_NOT_NULL_FATAL(cached);
+        CU_ASSERT_EQUAL(
+            matrix_shortest_distances_by_index(graph, start, expected, NULL),
+            E_SUCCESS);
+        CU_ASSERT_EQUAL(memcmp(cached, expected, sizeof(expected)), 0);
+
+        // The cached parents trace a path of the cached length
+        target = (size_t)rand() % PATH_COUNT;
+        if (MATRIX_DISTANCE_INFINITY == cached[target])
+        {
+            CU_ASSERT_EQUAL(matrix_paths_get_path(
+                                paths, start, target, &path, &length, &total),
+                            E_FAILURE);
+            continue;
+        }
+        CU_ASSERT_EQUAL_FATAL(matrix_paths_get_path(
+                                  paths, start, target, &path, &length, &total),
+                              E_SUCCESS);
+        CU_ASSERT_EQUAL(total, cached[target]);
+        CU_ASSERT_EQUAL(path[0], start);
+        CU_ASSERT_EQUAL(path[length - 1], target);
+        sum = 0;
+        for (size_t idx = 1; idx < length; idx++)
+        {
+            CU_ASSERT_EQUAL(matrix_get_edge_weight_by_index(
+                                graph, path[idx - 1], path[idx], &weight),
+                            E_SUCCESS);
+            sum += weight;
+        }
+        CU_ASSERT_EQUAL(sum, total);
+        free(path);
+        path = NULL;
+    }
+}
+
+static void check_dynamic_paths(bool is_directed)
+{
+    matrix_t *       graph  = NULL;
+    matrix_paths_t * paths  = NULL;
+    size_t *         path   = NULL;
+    size_t           length = 0;
+    size_t           src    = 0;
+    size_t           dst    = 0;
+    size_t           weight = 0;
+    bool             found  = false;
+    bool             direct = false;
+    int              status = E_FAILURE;
+
+    graph = matrix_init_weighted(
+        PATH_COUNT, is_directed, MATRIX_WEIGHT_U16, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+
+    srand(11);
+    for (size_t src = 0; src < PATH_COUNT; src++)
+    {
+        for (size_t dst = 0; dst < PATH_COUNT; dst++)
+        {
+            if (0 == (rand() % SPARSE_DENSITY))
+            {
+                matrix_add_edge_by_index(
+                    graph, src, dst, (size_t)rand() % PATH_WEIGHTS);
+            }
+        }
+    }
+
+    paths = matrix_paths_create(graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(paths);
+    for (size_t start = 0; start < PATH_COUNT; start += PATH_SOURCES)
+    {
+        CU_ASSERT_EQUAL(matrix_paths_add_source(paths, start), E_SUCCESS);
+    }
+    check_cached_paths(graph, paths);
+
+    for (size_t change = 0; change < PATH_CHANGES; change++)
+    {
+        // Every other change hits the last edge of a path from node 0, as
+        // only tree edges need repairs when they get heavier or go away
+        src = (size_t)rand() % PATH_COUNT;
+        dst = (size_t)rand() % PATH_COUNT;
+        if ((0 == (change % 2)) &&
+            (E_SUCCESS ==
+             matrix_paths_get_path(paths, 0, dst, &path, &length, &weight)))
+        {
+            src = (1 < length) ? path[length - 2] : src;
+            free(path);
+            path = NULL;
+        }
+
+        // Half the changes go to the matrix directly, which repairs the
+        // paths just the same
+        found = (E_SUCCESS ==
+                 matrix_get_edge_weight_by_index(graph, src, dst, &weight));
+        direct = (2 <= (change % 4));
+        switch (rand() % 3)
+        {
+            case 0:
+                if (found)
+                {
+                    status = direct
+                                 ? matrix_remove_edge_by_index(graph, src, dst)
+                                 : matrix_paths_remove_edge(paths, src, dst);
+                    break;
+                }
+                weight = 0;
+                status = direct
+                             ? matrix_add_edge_by_index(graph, src, dst, weight)
+                             : matrix_paths_set_edge(paths, src, dst, weight);
+                break;
+            case 1:
+                weight += 1 + ((size_t)rand() % PATH_WEIGHTS);
+                status = (direct && found)
+                             ? matrix_set_edge_weight_by_index(
+                                   graph, src, dst, weight)
+                             : matrix_paths_set_edge(paths, src, dst, weight);
+                break;
+            default:
+                weight = (size_t)rand() % PATH_WEIGHTS;
+                status = direct
+                             ? matrix_add_edge_by_index(graph, src, dst, weight)
+                             : matrix_paths_set_edge(paths, src, dst, weight);
+                break;
+        }
+        CU_ASSERT_EQUAL(status, E_SUCCESS);
+        check_cached_paths(graph, paths);
+    }
+
+    matrix_paths_destroy(&paths);
+    CU_ASSERT_PTR_NULL(paths);
+    matrix_destroy(&graph);
+}
+
+void test_matrix_paths(void)
+{
+    matrix_t *       graph  = NULL;
+    matrix_paths_t * paths  = NULL;
+    const size_t *   cached = NULL;
+    size_t *         path   = NULL;
+    size_t           length = 0;
+    size_t           total  = 0;
+    size_t           index  = 0;
+
+    check_dynamic_paths(true);
+    check_dynamic_paths(false);
+
+    graph = matrix_init_weighted(
+        3, true, MATRIX_WEIGHT_SIZE_T, int_comp, count_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    paths = matrix_paths_create(graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(paths);
+
+    CU_ASSERT_EQUAL(matrix_paths_add_source(paths, 0), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_paths_add_source(paths, 0), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_paths_add_source(paths, 3), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_paths_set_edge(paths, 0, 1, 4), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_paths_set_edge(paths, 1, 2, 5), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_paths_set_edge(paths, 0, 3, 1), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_paths_remove_edge(paths, 2, 1), E_FAILURE);
+    CU_ASSERT_EQUAL(
+        matrix_paths_get_path(paths, 0, 2, &path, &length, &total), E_SUCCESS);
+    CU_ASSERT_EQUAL(length, 3);
+    CU_ASSERT_EQUAL(total, 9);
+    free(path);
+    path = NULL;
+
+    // A new node stops repairs until the paths are refreshed
+    CU_ASSERT_EQUAL(matrix_add_node_by_index(graph, &node_data[0], &index),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(index, 3);
+    CU_ASSERT_EQUAL(matrix_paths_set_edge(paths, 2, 3, 1), E_FAILURE);
+    CU_ASSERT_PTR_NULL(matrix_paths_get_distances(paths, 0));
+    CU_ASSERT_EQUAL(matrix_paths_refresh(paths), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_paths_set_edge(paths, 2, 3, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_paths_add_source(paths, 3), E_SUCCESS);
+    cached = matrix_paths_get_distances(paths, 0);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(cached);
+    CU_ASSERT_EQUAL(cached[3], 10);
+    CU_ASSERT_EQUAL(matrix_paths_remove_edge(paths, 0, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(cached[1], MATRIX_DISTANCE_INFINITY);
+    CU_ASSERT_EQUAL(cached[3], MATRIX_DISTANCE_INFINITY);
+    CU_ASSERT_EQUAL(
+        matrix_paths_get_path(paths, 0, 3, &path, &length, &total), E_FAILURE);
+
+    CU_ASSERT_EQUAL(matrix_paths_remove_source(paths, 0), E_SUCCESS);
+    CU_ASSERT_EQUAL(matrix_paths_remove_source(paths, 0), E_FAILURE);
+    CU_ASSERT_PTR_NULL(matrix_paths_get_distances(paths, 0));
+    cached = matrix_paths_get_distances(paths, 3);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(cached);
+
+    // Removing a node repairs the paths through each of its edges
+    CU_ASSERT_EQUAL(matrix_add_edge_by_index(graph, 3, 1, 2), E_SUCCESS);
+    CU_ASSERT_EQUAL(cached[2], 7);
+    CU_ASSERT_EQUAL(matrix_set_edge_weight_by_index(graph, 1, 2, 1),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(cached[2], 3);
+    CU_ASSERT_EQUAL(matrix_remove_node_by_index(graph, 3), E_SUCCESS);
+    CU_ASSERT_EQUAL(cached[1], MATRIX_DISTANCE_INFINITY);
+    CU_ASSERT_EQUAL(cached[2], MATRIX_DISTANCE_INFINITY);
+
+    CU_ASSERT_PTR_NULL(matrix_paths_create(NULL));
+    CU_ASSERT_EQUAL(matrix_paths_add_source(NULL, 0), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_paths_set_edge(NULL, 0, 1, 1), E_FAILURE);
+    CU_ASSERT_EQUAL(matrix_paths_refresh(NULL), E_FAILURE);
+    CU_ASSERT_EQUAL(
+        matrix_paths_get_path(paths, 3, 0, NULL, &length, &total), E_FAILURE);
+
+    matrix_paths_destroy(&paths);
+    matrix_paths_destroy(&paths);
+    matrix_destroy(&graph);
+}
+
+static CU_TestInfo adjacency_matrix_tests[] = {
+    { "init", test_matrix_init },
+    { "edges_by_index", test_matrix_edges_by_index },
+    { "undirected_narrow_weights", test_matrix_undirected_narrow_weights },
+    { "neighbors_by_index", test_matrix_neighbors_by_index },
+    { "populate_node", test_matrix_populate_node },
+    { "degree_by_index", test_matrix_degree_by_index },
+    { "unweighted", test_matrix_unweighted },
+    { "expand_frontier", test_matrix_expand_frontier },
+    { "triangles", test_matrix_triangles },
+    { "bfs", test_matrix_bfs },
+    { "dfs", test_matrix_dfs },
+    { "flood_fill", test_matrix_flood_fill },
+    { "labels", test_matrix_labels },
+    { "add_remove_node", test_matrix_add_remove_node },
+    { "shortest_distances", test_matrix_shortest_distances },
+    { "dijkstra", test_matrix_dijkstra },
+    { "astar", test_matrix_astar },
+    { "landmarks", test_matrix_landmarks },
+    { "reachability", test_matrix_reachability },
+    { "nodes_by_index", test_matrix_nodes_by_index },
+    { "conversion", test_matrix_conversion },
+    { "paths", test_matrix_paths },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo adjacency_matrix_test_suite = {
+    "adjacency_matrix Tests",
+    NULL,                  // Suite initialization function
+    NULL,                  // Suite cleanup function
+    setup,                 // Suite setup function
+    teardown,              // Suite teardown function
+    adjacency_matrix_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -0,0 +1,116 @@
+/**
+ * @file disjoint_set.h
+ *
+ * @brief A disjoint-set (union-find) forest over integer IDs.
+ *
+ * Elements are integer IDs in [0, size), such as dense node IDs. Every
+ * element starts in a set of its own; disjoint_set_union() merges two sets
+ * and disjoint_set_find() names the set an element belongs to. Union by rank
+ * and path compression keep both operations at amortised O(α(n)), which is
+ * constant for any practical n.
+ *
+ * Sets can only be merged, never split. Structures that need to remove links
+ * rebuild the forest with disjoint_set_reset().
+ */
+#ifndef _DISJOINT_SET_H
+#define _DISJOINT_SET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Returned by disjoint_set_find() for IDs outside the forest
+#define DISJOINT_SET_INVALID UINT32_MAX
+
+/**
+ * @brief structure of a disjoint-set forest
+ *
+ * @param capacity number of element IDs allocated
+ * @param size number of elements, IDs [0, size)
+ * @param set_count number of disjoint sets among the elements
+ * @param parent parent of each element; roots are their own parent
+ * @param rank upper bound on the height of each root's tree
+ */
+typedef struct disjoint_set_t
+{
+    uint32_t   capacity;
+    uint32_t   size;
+    uint32_t   set_count;
+    uint32_t * parent;
+    uint8_t *  rank;
+} disjoint_set_t;
+
+/**
+ * @brief creates a forest of 'size' singleton sets
+ *
+ * @param size number of elements, IDs [0, size)
+ * @return pointer to the new forest on success, NULL on failure
+ */
+disjoint_set_t * disjoint_set_new(uint32_t size);
+
+/**
+ * @brief appends a new element in a set of its own, growing the forest if
+ * needed
+ *
+ * @param set the forest
+ * @param element set to the ID of the new element; may be NULL
+ * @return 0 on success, non-zero value on failure
+ */
+int disjoint_set_add(disjoint_set_t * set, uint32_t * element);
+
+/**
+ * @brief finds the representative of the set containing an element
+ *
+ * Compresses the path from the element to its root as a side effect.
+ *
+ * @param set the forest
+ * @param element the element ID
+ * @return representative element ID, or DISJOINT_SET_INVALID on failure
+ */
+uint32_t disjoint_set_find(disjoint_set_t * set, uint32_t element);
+
+/**
+ * @brief merges the sets containing two elements
+ *
+ * @param set the forest
+ * @param element_1 the first element ID
+ * @param element_2 the second element ID
+ * @param merged set to true if the elements were in different sets; may be
+ * NULL
+ * @return 0 on success, non-zero value on failure
+ */
+int disjoint_set_union(disjoint_set_t * set,
+                       uint32_t         element_1,
+                       uint32_t         element_2,
+                       bool *           merged);
+
+/**
+ * @brief checks whether two elements are in the same set
+ *
+ * @param set the forest
+ * @param element_1 the first element ID
+ * @param element_2 the second element ID
+ * @return true if both elements exist and share a set, false otherwise
+ */
+bool disjoint_set_same(disjoint_set_t * set,
+                       uint32_t         element_1,
+                       uint32_t         element_2);
+
+/**
+ * @brief puts every element back in a set of its own, keeping the size
+ *
+ * @param set the forest
+ * @return 0 on success, non-zero value on failure
+ */
+int disjoint_set_reset(disjoint_set_t * set);
+
+/**
+ * @brief deletes a forest and sets the caller's pointer to NULL
+ *
+ * @param set_address pointer to the forest pointer
+ * @return 0 on success, non-zero value on failure
+ */
+int disjoint_set_delete(disjoint_set_t ** set_address);
+
+#endif /* _DISJOINT_SET_H */
+
+/*** end of file ***/
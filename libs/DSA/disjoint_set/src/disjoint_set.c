@@ -0,0 +1,252 @@
+#include <stdlib.h>
+
+#include "disjoint_set.h"
+#include "utilities.h"
+
+// Capacity of a forest created with no elements
+#define DEFAULT_CAPACITY 16
+
+/**
+ * @brief Grows the forest's arrays to at least 'capacity' entries
+ */
+static int reserve(disjoint_set_t * set, uint32_t capacity);
+
+disjoint_set_t * disjoint_set_new(uint32_t size)
+{
+    disjoint_set_t * set = NULL;
+
+    if (DISJOINT_SET_INVALID == size)
+    {
+        PRINT_DEBUG("disjoint_set_new(): Size too large.\n");
+        goto END;
+    }
+
+    set = calloc(1, sizeof(disjoint_set_t));
+    if (NULL == set)
+    {
+        PRINT_DEBUG("disjoint_set_new(): CMR failure.\n");
+        goto END;
+    }
+
+    if (E_SUCCESS != reserve(set, (0 == size) ? DEFAULT_CAPACITY : size))
+    {
+        PRINT_DEBUG("disjoint_set_new(): CMR failure.\n");
+        disjoint_set_delete(&set);
+        goto END;
+    }
+
+    set->size = size;
+    disjoint_set_reset(set);
+
+END:
+    return set;
+}
+
+int disjoint_set_add(disjoint_set_t * set, uint32_t * element)
+{
+    int      exit_code = E_FAILURE;
+    uint32_t capacity  = 0;
+
+    if (NULL == set)
+    {
+        PRINT_DEBUG("disjoint_set_add(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if ((DISJOINT_SET_INVALID - 1) <= set->size)
+    {
+        PRINT_DEBUG("disjoint_set_add(): Forest is full.\n");
+        goto END;
+    }
+
+    if (set->size == set->capacity)
+    {
+        capacity = (set->capacity > (UINT32_MAX / 2)) ? (UINT32_MAX - 1)
+                                                       : (set->capacity * 2);
+        if (E_SUCCESS != reserve(set, capacity))
+        {
+            PRINT_DEBUG("disjoint_set_add(): CMR failure.\n");
+            goto END;
+        }
+    }
+
+    set->parent[set->size] = set->size;
+    set->rank[set->size]   = 0;
+    if (NULL != element)
+    {
+        *element = set->size;
+    }
+    set->size++;
+    set->set_count++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+uint32_t disjoint_set_find(disjoint_set_t * set, uint32_t element)
+{
+    uint32_t root = DISJOINT_SET_INVALID;
+    uint32_t next = 0;
+
+    if ((NULL == set) || (element >= set->size))
+    {
+        goto END;
+    }
+
+    root = element;
+    while (set->parent[root] != root)
+    {
+        root = set->parent[root];
+    }
+
+    // Second pass points every element on the path straight at the root
+    while (set->parent[element] != root)
+    {
+        next                 = set->parent[element];
+        set->parent[element] = root;
+        element              = next;
+    }
+
+END:
+    return root;
+}
+
+int disjoint_set_union(disjoint_set_t * set,
+                       uint32_t         element_1,
+                       uint32_t         element_2,
+                       bool *           merged)
+{
+    int      exit_code = E_FAILURE;
+    uint32_t root_1    = 0;
+    uint32_t root_2    = 0;
+
+    if (NULL == set)
+    {
+        PRINT_DEBUG("disjoint_set_union(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    root_1 = disjoint_set_find(set, element_1);
+    root_2 = disjoint_set_find(set, element_2);
+    if ((DISJOINT_SET_INVALID == root_1) || (DISJOINT_SET_INVALID == root_2))
+    {
+        PRINT_DEBUG("disjoint_set_union(): Element out of range.\n");
+        goto END;
+    }
+
+    if (NULL != merged)
+    {
+        *merged = (root_1 != root_2);
+    }
+
+    if (root_1 != root_2)
+    {
+        // Hang the shallower tree under the deeper one
+        if (set->rank[root_1] < set->rank[root_2])
+        {
+            set->parent[root_1] = root_2;
+        }
+        else
+        {
+            set->parent[root_2] = root_1;
+            if (set->rank[root_1] == set->rank[root_2])
+            {
+                set->rank[root_1]++;
+            }
+        }
+        set->set_count--;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool disjoint_set_same(disjoint_set_t * set,
+                       uint32_t         element_1,
+                       uint32_t         element_2)
+{
+    uint32_t root = disjoint_set_find(set, element_1);
+
+    return ((DISJOINT_SET_INVALID != root) &&
+            (root == disjoint_set_find(set, element_2)));
+}
+
+int disjoint_set_reset(disjoint_set_t * set)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == set)
+    {
+        PRINT_DEBUG("disjoint_set_reset(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    for (uint32_t element = 0; element < set->size; element++)
+    {
+        set->parent[element] = element;
+        set->rank[element]   = 0;
+    }
+    set->set_count = set->size;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int disjoint_set_delete(disjoint_set_t ** set_address)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == set_address) || (NULL == *set_address))
+    {
+        PRINT_DEBUG("disjoint_set_delete(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    free((*set_address)->parent);
+    free((*set_address)->rank);
+    free(*set_address);
+    *set_address = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static int reserve(disjoint_set_t * set, uint32_t capacity)
+{
+    int        exit_code = E_FAILURE;
+    uint32_t * parent    = NULL;
+    uint8_t *  rank      = NULL;
+
+    parent = realloc(set->parent, capacity * sizeof(uint32_t));
+    if (NULL == parent)
+    {
+        goto END;
+    }
+    set->parent = parent;
+
+    rank = realloc(set->rank, capacity * sizeof(uint8_t));
+    if (NULL == rank)
+    {
+        goto END;
+    }
+    set->rank     = rank;
+    set->capacity = capacity;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/*** end of file ***/
@@ -0,0 +1,186 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "disjoint_set.h"
+#include "utilities.h"
+
+#define SET_SIZE     8
+#define MODEL_SIZE   2000
+#define MODEL_UNIONS 1500
+
+disjoint_set_t * test_set = NULL;
+
+uint32_t model[MODEL_SIZE];
+
+void setup(void)
+{
+    test_set = disjoint_set_new(SET_SIZE);
+}
+
+void teardown(void)
+{
+    if (NULL != test_set)
+    {
+        disjoint_set_delete(&test_set);
+    }
+}
+
+void test_disjoint_set_new(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_set);
+    CU_ASSERT_EQUAL(test_set->size, SET_SIZE);
+    CU_ASSERT_EQUAL(test_set->set_count, SET_SIZE);
+    for (uint32_t idx = 0; idx < SET_SIZE; idx++)
+    {
+        CU_ASSERT_EQUAL(disjoint_set_find(test_set, idx), idx);
+    }
+    CU_ASSERT_FALSE(disjoint_set_same(test_set, 0, 1));
+}
+
+void test_disjoint_set_union(void)
+{
+    bool merged = false;
+
+    CU_ASSERT_EQUAL(disjoint_set_union(test_set, 0, 1, &merged), E_SUCCESS);
+    CU_ASSERT_TRUE(merged);
+    CU_ASSERT_EQUAL(disjoint_set_union(test_set, 2, 3, NULL), E_SUCCESS);
+    CU_ASSERT_EQUAL(disjoint_set_union(test_set, 1, 3, &merged), E_SUCCESS);
+    CU_ASSERT_TRUE(merged);
+    CU_ASSERT_EQUAL(test_set->set_count, SET_SIZE - 3);
+
+    CU_ASSERT_TRUE(disjoint_set_same(test_set, 0, 2));
+    CU_ASSERT_FALSE(disjoint_set_same(test_set, 0, 4));
+
+    // Already joined, so nothing changes
+    CU_ASSERT_EQUAL(disjoint_set_union(test_set, 3, 0, &merged), E_SUCCESS);
+    CU_ASSERT_FALSE(merged);
+    CU_ASSERT_EQUAL(test_set->set_count, SET_SIZE - 3);
+}
+
+void test_disjoint_set_invalid(void)
+{
+    CU_ASSERT_PTR_NULL(disjoint_set_new(DISJOINT_SET_INVALID));
+    CU_ASSERT_EQUAL(disjoint_set_find(test_set, SET_SIZE),
+                    DISJOINT_SET_INVALID);
+    CU_ASSERT_EQUAL(disjoint_set_find(NULL, 0), DISJOINT_SET_INVALID);
+    CU_ASSERT_EQUAL(disjoint_set_union(test_set, 0, SET_SIZE, NULL),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(disjoint_set_union(NULL, 0, 1, NULL), E_NULL_POINTER);
+    CU_ASSERT_FALSE(disjoint_set_same(test_set, SET_SIZE, SET_SIZE));
+    CU_ASSERT_EQUAL(disjoint_set_add(NULL, NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(disjoint_set_reset(NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(disjoint_set_delete(NULL), E_NULL_POINTER);
+}
+
+void test_disjoint_set_add(void)
+{
+    disjoint_set_t * set     = disjoint_set_new(0);
+    uint32_t         element = 0;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(set);
+    CU_ASSERT_EQUAL(set->size, 0);
+
+    // Grows past the initial capacity
+    for (uint32_t idx = 0; idx < 100; idx++)
+    {
+        CU_ASSERT_EQUAL(disjoint_set_add(set, &element), E_SUCCESS);
+        CU_ASSERT_EQUAL(element, idx);
+        if (0 != idx)
+        {
+            disjoint_set_union(set, idx - 1, idx, NULL);
+        }
+    }
+    CU_ASSERT_EQUAL(set->size, 100);
+    CU_ASSERT_EQUAL(set->set_count, 1);
+    CU_ASSERT_TRUE(disjoint_set_same(set, 0, 99));
+
+    CU_ASSERT_EQUAL(disjoint_set_add(set, NULL), E_SUCCESS);
+    CU_ASSERT_EQUAL(set->set_count, 2);
+    CU_ASSERT_FALSE(disjoint_set_same(set, 0, 100));
+
+    disjoint_set_delete(&set);
+    CU_ASSERT_PTR_NULL(set);
+}
+
+void test_disjoint_set_matches_model(void)
+{
+    disjoint_set_t * set       = disjoint_set_new(MODEL_SIZE);
+    uint32_t         first     = 0;
+    uint32_t         second    = 0;
+    uint32_t         old_label = 0;
+    uint32_t         labels    = MODEL_SIZE;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(set);
+
+    // The model relabels a whole set on every union
+    for (uint32_t idx = 0; idx < MODEL_SIZE; idx++)
+    {
+        model[idx] = idx;
+    }
+
+    for (uint32_t idx = 0; idx < MODEL_UNIONS; idx++)
+    {
+        first  = (uint32_t)(rand() % MODEL_SIZE);
+        second = (uint32_t)(rand() % MODEL_SIZE);
+        disjoint_set_union(set, first, second, NULL);
+        if (model[first] != model[second])
+        {
+            old_label = model[second];
+            for (uint32_t elem = 0; elem < MODEL_SIZE; elem++)
+            {
+                if (old_label == model[elem])
+                {
+                    model[elem] = model[first];
+                }
+            }
+            labels--;
+        }
+    }
+
+    CU_ASSERT_EQUAL(set->set_count, labels);
+    for (uint32_t idx = 0; idx < MODEL_UNIONS; idx++)
+    {
+        first  = (uint32_t)(rand() % MODEL_SIZE);
+        second = (uint32_t)(rand() % MODEL_SIZE);
+        CU_ASSERT_EQUAL(disjoint_set_same(set, first, second),
+                        model[first] == model[second]);
+    }
+
+    disjoint_set_delete(&set);
+}
+
+void test_disjoint_set_reset(void)
+{
+    for (uint32_t idx = 1; idx < SET_SIZE; idx++)
+    {
+        disjoint_set_union(test_set, 0, idx, NULL);
+    }
+    CU_ASSERT_EQUAL(test_set->set_count, 1);
+
+    CU_ASSERT_EQUAL(disjoint_set_reset(test_set), E_SUCCESS);
+    CU_ASSERT_EQUAL(test_set->set_count, SET_SIZE);
+    CU_ASSERT_FALSE(disjoint_set_same(test_set, 0, 1));
+}
+
+static CU_TestInfo disjoint_set_tests[] = {
+    { "new", test_disjoint_set_new },
+    { "union", test_disjoint_set_union },
+    { "invalid", test_disjoint_set_invalid },
+    { "add", test_disjoint_set_add },
+    { "matches_model", test_disjoint_set_matches_model },
+    { "reset", test_disjoint_set_reset },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo disjoint_set_test_suite = {
+    "disjoint_set Tests",
+    NULL,              // Suite initialization function
+    NULL,              // Suite cleanup function
+    setup,             // Suite setup function
+    teardown,          // Suite teardown function
+    disjoint_set_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -0,0 +1,286 @@
+/**
+ * @file indexed_list.h
+ *
+ * @brief A sequence with O(log n) positional access, insertion and removal.
+ *
+ * `indexed_list_t` stores its elements in a height-balanced (AVL) tree where
+ * every node records the size of its subtree, so the element at any position
+ * is found by descending the tree instead of walking from the head. The API
+ * mirrors linked_list.h function for function (`list_X` becomes
+ * `indexed_list_X`), so code that indexes into a `list_t` with
+ * `list_peek_position`, `list_push_position`, `list_pop_position` or
+ * `list_pick_random_item` can switch over by renaming calls.
+ *
+ * Differences from `list_t`:
+ *  - `indexed_list_find_first_occurrence` returns the matching data rather
+ *    than an internal node.
+ *  - `indexed_list_find_all_occurrences` keeps matches in list order.
+ *  - `indexed_list_pop_position` returns the data without freeing it.
+ */
+#ifndef _INDEXED_LIST_H
+#define _INDEXED_LIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "callback_types.h"
+
+/**
+ * @brief structure of an indexed list node
+ *
+ * @param data void pointer to whatever data the node holds
+ * @param left subtree holding the elements before this one
+ * @param right subtree holding the elements after this one
+ * @param size number of nodes in the subtree rooted here
+ * @param height height of the subtree rooted here
+ */
+typedef struct indexed_node_t
+{
+    void *                  data;
+    struct indexed_node_t * left;
+    struct indexed_node_t * right;
+    uint32_t                size;
+    int32_t                 height;
+} indexed_node_t;
+
+/**
+ * @brief structure of an indexed list object
+ *
+ * @param size is the number of elements the list is currently storing
+ * @param root pointer to the root of the tree
+ * @param custom_free pointer to the user defined free function
+ * @param compare_func pointer to the user defined compare function
+ */
+typedef struct indexed_list_t
+{
+    uint32_t         size;
+    indexed_node_t * root;
+    FREE_F           custom_free;
+    CMP_F            compare_func;
+} indexed_list_t;
+
+/**
+ * @brief A pointer to a user-defined function that gets called in the
+ *        foreach_call on each item in the list.
+ */
+typedef void (*ACT_F)(void *);
+
+/**
+ * @brief creates a new indexed list
+ *
+ * @param free_func pointer to the free function to be used with that list
+ * @param comp_func pointer to the compare function to be used with that list
+ * @returns pointer to allocated list on success or NULL on failure
+ */
+indexed_list_t * indexed_list_new(FREE_F free_func, CMP_F comp_func);
+
+/**
+ * @brief pushes data onto the head of the list in O(log n)
+ *
+ * @param list list to push the data into
+ * @param data data to be pushed
+ * @returns 0 on success, non-zero value on failure
+ */
+int indexed_list_push_head(indexed_list_t * list, void * data);
+
+/**
+ * @brief pushes data onto the tail of the list in O(log n)
+ *
+ * @param list list to push the data into
+ * @param data data to be pushed
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_push_tail(indexed_list_t * list, void * data);
+
+/**
+ * @brief inserts data so that it ends up at 'position', in O(log n)
+ *
+ * @param list list to push the data into
+ * @param data data to be pushed
+ * @param position the position in which to insert the data (0 to size)
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_push_position(indexed_list_t * list,
+                               void *           data,
+                               uint32_t         position);
+
+/**
+ * @brief checks if the list object is empty
+ *
+ * @param list pointer to list object to be checked
+ * @returns 0 if list is empty, non-zero value if not empty or on failure
+ */
+int indexed_list_is_empty(indexed_list_t * list);
+
+/**
+ * @brief pops the data at the head of the list
+ *
+ * @param list list to pop the data out of
+ * @return pointer to popped data on success, NULL on failure
+ */
+void * indexed_list_pop_head(indexed_list_t * list);
+
+/**
+ * @brief pops the data at the tail of the list
+ *
+ * @param list list to pop the data out of
+ * @return pointer to popped data on success, NULL on failure
+ */
+void * indexed_list_pop_tail(indexed_list_t * list);
+
+/**
+ * @brief pops the data at a specific position, in O(log n)
+ *
+ * @param list list to pop the data out of
+ * @param position position of the data
+ * @return pointer to popped data on success, NULL on failure
+ */
+void * indexed_list_pop_position(indexed_list_t * list, uint32_t position);
+
+/**
+ * @brief removes and frees the data at the head of the list
+ *
+ * @param list list to remove the data from
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_remove_head(indexed_list_t * list);
+
+/**
+ * @brief removes and frees the data at the tail of the list
+ *
+ * @param list list to remove the data from
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_remove_tail(indexed_list_t * list);
+
+/**
+ * @brief removes and frees the data at a specific position, in O(log n)
+ *
+ * @param list list to remove the data from
+ * @param position position of the data
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_remove_position(indexed_list_t * list, uint32_t position);
+
+/**
+ * @brief get the data at the head of the list without popping
+ *
+ * @param list list to peek into
+ * @return pointer to head data on success, NULL on failure
+ */
+void * indexed_list_peek_head(indexed_list_t * list);
+
+/**
+ * @brief get the data at the tail of the list without popping
+ *
+ * @param list list to peek into
+ * @return pointer to tail data on success, NULL on failure
+ */
+void * indexed_list_peek_tail(indexed_list_t * list);
+
+/**
+ * @brief get the data at a specific position without popping, in O(log n)
+ *
+ * @param list list to peek into
+ * @param position position of the data
+ * @return pointer to the data on success, NULL on failure
+ */
+void * indexed_list_peek_position(indexed_list_t * list, uint32_t position);
+
+/**
+ * @brief remove and free the first element that compares equal to data_p
+ *
+ * @param list list to remove the data from
+ * @param data_p the data object to be searched for
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_remove_data(indexed_list_t * list, void * data_p);
+
+/**
+ * @brief perform a user defined action on every element, in list order
+ *
+ * @param list list to perform actions on
+ * @param action_function pointer to user defined action function
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_foreach_call(indexed_list_t * list, ACT_F action_function);
+
+/**
+ * @brief checks whether any element compares equal to data_p
+ *
+ * @param list list to search through
+ * @param data_p the data object to be searched for
+ * @return true if found, false otherwise
+ */
+bool indexed_list_contains(indexed_list_t * list, void * data_p);
+
+/**
+ * @brief picks an element uniformly at random, in O(log n)
+ *
+ * @param list list to pick from
+ * @return pointer to the data on success, NULL on failure
+ */
+void * indexed_list_pick_random_item(indexed_list_t * list);
+
+/**
+ * @brief find the first element matching search_data as found by the user
+ *        defined compare function
+ *
+ * @param list list to search through
+ * @param search_data the data to be searched for
+ * @return pointer to the matching data on success, NULL on failure
+ */
+void * indexed_list_find_first_occurrence(indexed_list_t * list,
+                                          void *           search_data);
+
+/**
+ * @brief find the position of the first element matching search_data
+ *
+ * @param list list to search through
+ * @param search_data the data to be searched for
+ * @param position set to the position of the match
+ * @return 0 on success, non-zero value if not found or on failure
+ */
+int indexed_list_index_of(indexed_list_t * list,
+                          void *           search_data,
+                          uint32_t *       position);
+
+/**
+ * @brief find every element matching search_data, in list order
+ *
+ * @param list list to search through
+ * @param search_data the data to be searched for
+ * @return pointer to a new list of all matches on success, NULL on failure
+ */
+indexed_list_t * indexed_list_find_all_occurrences(indexed_list_t * list,
+                                                   void * search_data);
+
+/**
+ * @brief stable sort of the list as per user defined compare function
+ *
+ * @param list pointer to list to be sorted
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_sort(indexed_list_t * list);
+
+/**
+ * @brief clear all elements out of a list
+ *
+ * @param list list to clear out
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_clear(indexed_list_t * list);
+
+/**
+ * @brief delete a list
+ *
+ * @param list_address pointer to list pointer
+ * @return 0 on success, non-zero value on failure
+ */
+int indexed_list_delete(indexed_list_t ** list_address);
+
+#endif /* _INDEXED_LIST_H */
+
+/*** end of file ***/
@@ -0,0 +1,1020 @@
+#include <limits.h> // INT_MAX
+
+#include "comparisons.h"
+#include "indexed_list.h"
+#include "number_generator.h"
+#include "utilities.h"
+
+// An AVL tree of 2^32 nodes is at most ~46 levels deep
+#define MAX_TREE_HEIGHT 64
+
+/**
+ * @brief Create a new `indexed_node_t`
+ *
+ * @param data The data to store in the node
+ * @return indexed_node_t* on success, NULL on failure
+ */
+static indexed_node_t * indexed_node_new(void * data);
+
+/**
+ * @brief Number of nodes in a subtree, 0 for NULL
+ */
+static uint32_t node_size(indexed_node_t * node);
+
+/**
+ * @brief Height of a subtree, 0 for NULL
+ */
+static int32_t node_height(indexed_node_t * node);
+
+/**
+ * @brief Recomputes the size and height of a node from its children
+ */
+static void node_update(indexed_node_t * node);
+
+/**
+ * @brief Rotations used to restore the AVL balance
+ *
+ * @return The new root of the rotated subtree
+ */
+static indexed_node_t * rotate_left(indexed_node_t * node);
+static indexed_node_t * rotate_right(indexed_node_t * node);
+
+/**
+ * @brief Restores the AVL balance of a node whose children are balanced
+ *
+ * @return The new root of the subtree
+ */
+static indexed_node_t * node_rebalance(indexed_node_t * node);
+
+/**
+ * @brief Inserts a node so that it ends up at 'position' within the subtree
+ *
+ * @return The new root of the subtree
+ */
+static indexed_node_t * node_insert(indexed_node_t * node,
+                                    uint32_t         position,
+                                    indexed_node_t * new_node);
+
+/**
+ * @brief Removes the node at 'position' within the subtree and frees it
+ *
+ * @param data Set to the data of the removed node
+ * @return The new root of the subtree
+ */
+static indexed_node_t * node_remove(indexed_node_t * node,
+                                    uint32_t         position,
+                                    void **          data);
+
+/**
+ * @brief Finds the node at 'position' within the subtree
+ *
+ * @return The node, or NULL if position is out of bounds
+ */
+static indexed_node_t * node_at(indexed_node_t * node, uint32_t position);
+
+/**
+ * @brief Finds the position of the first element equal to 'search_data'
+ *
+ * @return The position, or the list size if there is no match
+ */
+static uint32_t find_position(indexed_list_t * list, void * search_data);
+
+/**
+ * @brief Stable bottom-up merge sort of an array of data pointers
+ */
+static void merge_sort(void ** items,
+                       void ** scratch,
+                       size_t  count,
+                       CMP_F   compare_func);
+
+indexed_list_t * indexed_list_new(FREE_F free_func, CMP_F comp_func)
+{
+    indexed_list_t * new_list = NULL;
+
+    new_list = calloc(1, sizeof(indexed_list_t));
+    if (NULL == new_list)
+    {
+        PRINT_DEBUG("indexed_list_new(): CMR failure.\n");
+        goto END;
+    }
+
+    new_list->size         = 0;
+    new_list->root         = NULL;
+    new_list->custom_free  = free_func;
+    new_list->compare_func = comp_func;
+
+END:
+    return new_list;
+}
+
+int indexed_list_push_head(indexed_list_t * list, void * data)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == data))
+    {
+        PRINT_DEBUG("indexed_list_push_head(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = indexed_list_push_position(list, data, 0);
+
+END:
+    return exit_code;
+}
+
+int indexed_list_push_tail(indexed_list_t * list, void * data)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == data))
+    {
+        PRINT_DEBUG("indexed_list_push_tail(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = indexed_list_push_position(list, data, list->size);
+
+END:
+    return exit_code;
+}
+
+int indexed_list_push_position(indexed_list_t * list,
+                               void *           data,
+                               uint32_t         position)
+{
+    int              exit_code = E_FAILURE;
+    indexed_node_t * new_node  = NULL;
+
+    if ((NULL == list) || (NULL == data))
+    {
+        PRINT_DEBUG("indexed_list_push_position(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if ((position > list->size) || (UINT32_MAX == list->size))
+    {
+        PRINT_DEBUG("indexed_list_push_position(): Position out of bounds.\n");
+        goto END;
+    }
+
+    new_node = indexed_node_new(data);
+    if (NULL == new_node)
+    {
+        PRINT_DEBUG("indexed_list_push_position(): Unable to create node.\n");
+        goto END;
+    }
+
+    list->root = node_insert(list->root, position, new_node);
+    list->size += 1;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int indexed_list_is_empty(indexed_list_t * list)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_is_empty(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        exit_code = E_SUCCESS;
+    }
+
+END:
+    return exit_code;
+}
+
+void * indexed_list_pop_head(indexed_list_t * list)
+{
+    void * data = NULL;
+
+    if ((NULL == list) || (0 == list->size))
+    {
+        PRINT_DEBUG("indexed_list_pop_head(): List is empty.\n");
+        goto END;
+    }
+
+    data = indexed_list_pop_position(list, 0);
+
+END:
+    return data;
+}
+
+void * indexed_list_pop_tail(indexed_list_t * list)
+{
+    void * data = NULL;
+
+    if ((NULL == list) || (0 == list->size))
+    {
+        PRINT_DEBUG("indexed_list_pop_tail(): List is empty.\n");
+        goto END;
+    }
+
+    data = indexed_list_pop_position(list, list->size - 1);
+
+END:
+    return data;
+}
+
+void * indexed_list_pop_position(indexed_list_t * list, uint32_t position)
+{
+    void * data = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_pop_position(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (position >= list->size)
+    {
+        PRINT_DEBUG("indexed_list_pop_position(): Position out of bounds.\n");
+        goto END;
+    }
+
+    list->root = node_remove(list->root, position, &data);
+    list->size--;
+
+END:
+    return data;
+}
+
+int indexed_list_remove_head(indexed_list_t * list)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_remove_head(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = indexed_list_remove_position(list, 0);
+
+END:
+    return exit_code;
+}
+
+int indexed_list_remove_tail(indexed_list_t * list)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_remove_tail(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        PRINT_DEBUG("indexed_list_remove_tail(): List is empty.\n");
+        goto END;
+    }
+
+    exit_code = indexed_list_remove_position(list, list->size - 1);
+
+END:
+    return exit_code;
+}
+
+int indexed_list_remove_position(indexed_list_t * list, uint32_t position)
+{
+    int    exit_code = E_FAILURE;
+    void * data      = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_remove_position(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (position >= list->size)
+    {
+        PRINT_DEBUG(
+            "indexed_list_remove_position(): Position out of bounds.\n");
+        goto END;
+    }
+
+    data = indexed_list_pop_position(list, position);
+    if (NULL != list->custom_free)
+    {
+        list->custom_free(data);
+    }
+    data = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void * indexed_list_peek_head(indexed_list_t * list)
+{
+    void * data = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_peek_head(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        PRINT_DEBUG("indexed_list_peek_head(): Empty list.\n");
+        goto END;
+    }
+
+    data = node_at(list->root, 0)->data;
+
+END:
+    return data;
+}
+
+void * indexed_list_peek_tail(indexed_list_t * list)
+{
+    void * data = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_peek_tail(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        PRINT_DEBUG("indexed_list_peek_tail(): Empty list.\n");
+        goto END;
+    }
+
+    data = node_at(list->root, list->size - 1)->data;
+
+END:
+    return data;
+}
+
+void * indexed_list_peek_position(indexed_list_t * list, uint32_t position)
+{
+    void * data = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_peek_position(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (position >= list->size)
+    {
+        PRINT_DEBUG("indexed_list_peek_position(): Position out of bounds.\n");
+        goto END;
+    }
+
+    data = node_at(list->root, position)->data;
+
+END:
+    return data;
+}
+
+int indexed_list_remove_data(indexed_list_t * list, void * data_p)
+{
+    int      exit_code = E_FAILURE;
+    uint32_t position  = 0;
+
+    if ((NULL == list) || (NULL == data_p))
+    {
+        PRINT_DEBUG("indexed_list_remove_data(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    position = find_position(list, data_p);
+    if (position == list->size)
+    {
+        PRINT_DEBUG("indexed_list_remove_data(): Data not found.\n");
+        goto END;
+    }
+
+    exit_code = indexed_list_remove_position(list, position);
+
+END:
+    return exit_code;
+}
+
+int indexed_list_foreach_call(indexed_list_t * list, ACT_F action_function)
+{
+    int              exit_code              = E_FAILURE;
+    indexed_node_t * stack[MAX_TREE_HEIGHT] = { 0 };
+    indexed_node_t * current                = NULL;
+    size_t           depth                  = 0;
+
+    if ((NULL == list) || (NULL == action_function))
+    {
+        PRINT_DEBUG("indexed_list_foreach_call(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // Iterative in-order walk
+    current = list->root;
+    while ((NULL != current) || (0 < depth))
+    {
+        while (NULL != current)
+        {
+            stack[depth++] = current;
+            current        = current->left;
+        }
+
+        current = stack[--depth];
+        action_function(current->data);
+        current = current->right;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool indexed_list_contains(indexed_list_t * list, void * data_p)
+{
+    bool result = false;
+
+    if ((NULL == list) || (NULL == data_p))
+    {
+        PRINT_DEBUG("indexed_list_contains(): NULL argument passed.\n");
+        goto END;
+    }
+
+    result = (find_position(list, data_p) < list->size);
+
+END:
+    return result;
+}
+
+void * indexed_list_pick_random_item(indexed_list_t * list)
+{
+    int    exit_code    = E_FAILURE;
+    int    random_index = 0;
+    void * data         = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_pick_random_item(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        PRINT_DEBUG("indexed_list_pick_random_item(): List is empty.\n");
+        goto END;
+    }
+
+    // Ensure list->size - 1 fits within the range of an int
+    if (list->size > INT_MAX)
+    {
+        PRINT_DEBUG("indexed_list_pick_random_item(): List size too large.\n");
+        goto END;
+    }
+
+    exit_code = random_number(0, (int)(list->size - 1), &random_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG(
+            "indexed_list_pick_random_item(): Unable to generate a random "
+            "index.\n");
+        goto END;
+    }
+
+    data = node_at(list->root, (uint32_t)random_index)->data;
+
+END:
+    return data;
+}
+
+void * indexed_list_find_first_occurrence(indexed_list_t * list,
+                                          void *           search_data)
+{
+    void *   data     = NULL;
+    uint32_t position = 0;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG(
+            "indexed_list_find_first_occurrence(): NULL argument passed.\n");
+        goto END;
+    }
+
+    position = find_position(list, search_data);
+    if (position < list->size)
+    {
+        data = node_at(list->root, position)->data;
+    }
+
+END:
+    return data;
+}
+
+int indexed_list_index_of(indexed_list_t * list,
+                          void *           search_data,
+                          uint32_t *       position)
+{
+    int      exit_code = E_FAILURE;
+    uint32_t found     = 0;
+
+    if ((NULL == list) || (NULL == position))
+    {
+        PRINT_DEBUG("indexed_list_index_of(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    found = find_position(list, search_data);
+    if (found == list->size)
+    {
+        goto END;
+    }
+
+    *position = found;
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+indexed_list_t * indexed_list_find_all_occurrences(indexed_list_t * list,
+                                                   void * search_data)
+{
+    indexed_list_t * new_list               = NULL;
+    indexed_node_t * stack[MAX_TREE_HEIGHT] = { 0 };
+    indexed_node_t * current                = NULL;
+    size_t           depth                  = 0;
+    int              check                  = E_FAILURE;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG(
+            "indexed_list_find_all_occurrences(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        PRINT_DEBUG("indexed_list_find_all_occurrences(): Empty list.\n");
+        goto END;
+    }
+
+    new_list = indexed_list_new(list->custom_free, list->compare_func);
+    if (NULL == new_list)
+    {
+        PRINT_DEBUG(
+            "indexed_list_find_all_occurrences(): Unable to create new "
+            "list.\n");
+        goto END;
+    }
+
+    current = list->root;
+    while ((NULL != current) || (0 < depth))
+    {
+        while (NULL != current)
+        {
+            stack[depth++] = current;
+            current        = current->left;
+        }
+
+        current = stack[--depth];
+        if (EQUAL == list->compare_func(search_data, current->data))
+        {
+            check = indexed_list_push_tail(new_list, current->data);
+            if (E_SUCCESS != check)
+            {
+                PRINT_DEBUG(
+                    "indexed_list_find_all_occurrences(): Unable to push data "
+                    "into list.\n");
+                // The matches are still owned by 'list'
+                new_list->custom_free = NULL;
+                indexed_list_delete(&new_list);
+                goto END;
+            }
+        }
+        current = current->right;
+    }
+
+END:
+    return new_list;
+}
+
+int indexed_list_sort(indexed_list_t * list)
+{
+    int              exit_code              = E_FAILURE;
+    void **          items                  = NULL;
+    void **          scratch                = NULL;
+    indexed_node_t * stack[MAX_TREE_HEIGHT] = { 0 };
+    indexed_node_t * current                = NULL;
+    size_t           depth                  = 0;
+    size_t           idx                    = 0;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_sort(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (2 > list->size)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    items   = calloc(list->size, sizeof(void *));
+    scratch = calloc(list->size, sizeof(void *));
+    if ((NULL == items) || (NULL == scratch))
+    {
+        PRINT_DEBUG("indexed_list_sort(): CMR failure.\n");
+        goto END;
+    }
+
+    // Gather, sort, then write the data back in order; the tree shape is
+    // unaffected
+    for (int pass = 0; pass < 2; pass++)
+    {
+        idx     = 0;
+        current = list->root;
+        while ((NULL != current) || (0 < depth))
+        {
+            while (NULL != current)
+            {
+                stack[depth++] = current;
+                current        = current->left;
+            }
+
+            current = stack[--depth];
+            if (0 == pass)
+            {
+                items[idx++] = current->data;
+            }
+            else
+            {
+                current->data = items[idx++];
+            }
+            current = current->right;
+        }
+
+        if (0 == pass)
+        {
+            merge_sort(items, scratch, list->size, list->compare_func);
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(scratch);
+    free(items);
+    return exit_code;
+}
+
+int indexed_list_clear(indexed_list_t * list)
+{
+    int              exit_code = E_FAILURE;
+    indexed_node_t * current   = NULL;
+    indexed_node_t * child     = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("indexed_list_clear(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    // Rotate left children up so the tree is freed without a stack
+    current = list->root;
+    while (NULL != current)
+    {
+        if (NULL != current->left)
+        {
+            child          = current->left;
+            current->left  = child->right;
+            child->right   = current;
+            current        = child;
+            continue;
+        }
+
+        child = current->right;
+        if (NULL != list->custom_free)
+        {
+            list->custom_free(current->data);
+            current->data = NULL;
+        }
+        free(current);
+        current = child;
+    }
+
+    list->root = NULL;
+    list->size = 0;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int indexed_list_delete(indexed_list_t ** list_address)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list_address) || (NULL == *list_address))
+    {
+        PRINT_DEBUG("indexed_list_delete(): NULL argument passed.\n");
+        return E_NULL_POINTER;
+    }
+
+    exit_code = indexed_list_clear(*list_address);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("indexed_list_delete(): Unable to clear list.\n");
+        goto END;
+    }
+
+    free(*list_address);
+    *list_address = NULL;
+
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static indexed_node_t * indexed_node_new(void * data)
+{
+    indexed_node_t * new_node = NULL;
+
+    new_node = calloc(1, sizeof(indexed_node_t));
+    if (NULL == new_node)
+    {
+        PRINT_DEBUG("indexed_node_new(): CMR failure.\n");
+        goto END;
+    }
+
+    new_node->data   = data;
+    new_node->left   = NULL;
+    new_node->right  = NULL;
+    new_node->size   = 1;
+    new_node->height = 1;
+
+END:
+    return new_node;
+}
+
+static uint32_t node_size(indexed_node_t * node)
+{
+    return (NULL == node) ? 0 : node->size;
+}
+
+static int32_t node_height(indexed_node_t * node)
+{
+    return (NULL == node) ? 0 : node->height;
+}
+
+static void node_update(indexed_node_t * node)
+{
+    int32_t left_height  = node_height(node->left);
+    int32_t right_height = node_height(node->right);
+
+    node->size   = node_size(node->left) + node_size(node->right) + 1;
+    node->height = ((left_height > right_height) ? left_height : right_height) +
+                   1;
+}
+
+static indexed_node_t * rotate_left(indexed_node_t * node)
+{
+    indexed_node_t * pivot = node->right;
+
+    node->right = pivot->left;
+    pivot->left = node;
+    node_update(node);
+    node_update(pivot);
+
+    return pivot;
+}
+
+static indexed_node_t * rotate_right(indexed_node_t * node)
+{
+    indexed_node_t * pivot = node->left;
+
+    node->left   = pivot->right;
+    pivot->right = node;
+    node_update(node);
+    node_update(pivot);
+
+    return pivot;
+}
+
+static indexed_node_t * node_rebalance(indexed_node_t * node)
+{
+    int32_t balance = 0;
+
+    node_update(node);
+    balance = node_height(node->left) - node_height(node->right);
+
+    if (1 < balance)
+    {
+        if (node_height(node->left->left) < node_height(node->left->right))
+        {
+            node->left = rotate_left(node->left);
+        }
+        node = rotate_right(node);
+    }
+    else if (-1 > balance)
+    {
+        if (node_height(node->right->right) < node_height(node->right->left))
+        {
+            node->right = rotate_right(node->right);
+        }
+        node = rotate_left(node);
+    }
+
+    return node;
+}
+
+static indexed_node_t * node_insert(indexed_node_t * node,
+                                    uint32_t         position,
+                                    indexed_node_t * new_node)
+{
+    uint32_t left_size = 0;
+
+    if (NULL == node)
+    {
+        return new_node;
+    }
+
+    left_size = node_size(node->left);
+    if (position <= left_size)
+    {
+        node->left = node_insert(node->left, position, new_node);
+    }
+    else
+    {
+        node->right =
+            node_insert(node->right, position - left_size - 1, new_node);
+    }
+
+    return node_rebalance(node);
+}
+
+static indexed_node_t * node_remove(indexed_node_t * node,
+                                    uint32_t         position,
+                                    void **          data)
+{
+    indexed_node_t * result    = NULL;
+    uint32_t         left_size = node_size(node->left);
+    void *           successor = NULL;
+
+    if (position < left_size)
+    {
+        node->left = node_remove(node->left, position, data);
+    }
+    else if (position > left_size)
+    {
+        node->right = node_remove(node->right, position - left_size - 1, data);
+    }
+    else
+    {
+        *data = node->data;
+
+        if ((NULL == node->left) || (NULL == node->right))
+        {
+            // The remaining child (if any) is already balanced
+            result = (NULL != node->left) ? node->left : node->right;
+            free(node);
+            goto END;
+        }
+
+        // Replace with the in-order successor
+        node->right = node_remove(node->right, 0, &successor);
+        node->data  = successor;
+    }
+
+    result = node_rebalance(node);
+END:
+    return result;
+}
+
+static indexed_node_t * node_at(indexed_node_t * node, uint32_t position)
+{
+    uint32_t left_size = 0;
+
+    while (NULL != node)
+    {
+        left_size = node_size(node->left);
+        if (position == left_size)
+        {
+            break;
+        }
+
+        if (position < left_size)
+        {
+            node = node->left;
+        }
+        else
+        {
+            position -= left_size + 1;
+            node = node->right;
+        }
+    }
+
+    return node;
+}
+
+static uint32_t find_position(indexed_list_t * list, void * search_data)
+{
+    indexed_node_t * stack[MAX_TREE_HEIGHT] = { 0 };
+    indexed_node_t * current                = list->root;
+    size_t           depth                  = 0;
+    uint32_t         position               = 0;
+
+    while ((NULL != current) || (0 < depth))
+    {
+        while (NULL != current)
+        {
+            stack[depth++] = current;
+            current        = current->left;
+        }
+
+        current = stack[--depth];
+        if (EQUAL == list->compare_func(search_data, current->data))
+        {
+            goto END;
+        }
+        position++;
+        current = current->right;
+    }
+
+END:
+    return position;
+}
+
+static void merge_sort(void ** items,
+                       void ** scratch,
+                       size_t  count,
+                       CMP_F   compare_func)
+{
+    void ** source      = items;
+    void ** destination = scratch;
+    void ** swap        = NULL;
+    size_t  middle      = 0;
+    size_t  high        = 0;
+    size_t  first_idx   = 0;
+    size_t  second_idx  = 0;
+
+    for (size_t width = 1; width < count; width *= 2)
+    {
+        for (size_t low = 0; low < count; low += 2 * width)
+        {
+            middle     = (low + width < count) ? low + width : count;
+            high       = (middle + width < count) ? middle + width : count;
+            first_idx  = low;
+            second_idx = middle;
+
+            for (size_t out = low; out < high; out++)
+            {
+                // Take from the second run only when strictly smaller
+                if ((second_idx < high) &&
+                    ((first_idx >= middle) ||
+                     (LESS_THAN ==
+                      compare_func(source[second_idx], source[first_idx]))))
+                {
+                    destination[out] = source[second_idx++];
+                }
+                else
+                {
+                    destination[out] = source[first_idx++];
+                }
+            }
+        }
+
+        swap        = source;
+        source      = destination;
+        destination = swap;
+    }
+
+    if (source != items)
+    {
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            items[idx] = source[idx];
+        }
+    }
+}
+
+/*** end of file ***/
@@ -0,0 +1,263 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "comparisons.h"
+#include "indexed_list.h"
+#include "utilities.h"
+
+#define DATA_ARR_LENGTH 10
+#define MODEL_LENGTH    2000
+#define MAX_HEIGHT      16 // 1.44 * log2(MODEL_LENGTH) rounded up
+
+indexed_list_t * test_list = NULL;
+
+int data[DATA_ARR_LENGTH]   = { 44, 51, 77, 14, 68, 41, 46, 18, 72, 53 };
+int sorted[DATA_ARR_LENGTH] = { 14, 18, 41, 44, 46, 51, 53, 68, 72, 77 };
+
+int values[MODEL_LENGTH];
+int action_total = 0;
+
+void custom_action(void * data)
+{
+    action_total += *(int *)data;
+}
+
+void custom_free(void * data)
+{
+    (void)data;
+}
+
+void setup(void)
+{
+    test_list = indexed_list_new(custom_free, int_comp);
+}
+
+void teardown(void)
+{
+    if (NULL != test_list)
+    {
+        indexed_list_delete(&test_list);
+    }
+}
+
+void push_data(void)
+{
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        indexed_list_push_tail(test_list, &data[idx]);
+    }
+}
+
+void test_indexed_list_new(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_list);
+    CU_ASSERT_EQUAL(test_list->size, 0);
+    CU_ASSERT_PTR_NULL(test_list->root);
+    CU_ASSERT_EQUAL(indexed_list_is_empty(test_list), E_SUCCESS);
+}
+
+void test_indexed_list_push_null(void)
+{
+    CU_ASSERT_EQUAL(indexed_list_push_head(NULL, &data[0]), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(indexed_list_push_tail(test_list, NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(indexed_list_push_position(test_list, &data[0], 1),
+                    E_FAILURE);
+}
+
+void test_indexed_list_push_and_peek(void)
+{
+    push_data();
+    CU_ASSERT_EQUAL(test_list->size, DATA_ARR_LENGTH);
+    CU_ASSERT_PTR_EQUAL(indexed_list_peek_head(test_list), &data[0]);
+    CU_ASSERT_PTR_EQUAL(indexed_list_peek_tail(test_list),
+                        &data[DATA_ARR_LENGTH - 1]);
+
+    for (uint32_t idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        CU_ASSERT_PTR_EQUAL(indexed_list_peek_position(test_list, idx),
+                            &data[idx]);
+    }
+
+    CU_ASSERT_PTR_NULL(indexed_list_peek_position(test_list, DATA_ARR_LENGTH));
+}
+
+void test_indexed_list_pop(void)
+{
+    push_data();
+
+    CU_ASSERT_PTR_EQUAL(indexed_list_pop_head(test_list), &data[0]);
+    CU_ASSERT_PTR_EQUAL(indexed_list_pop_tail(test_list), &data[9]);
+    CU_ASSERT_PTR_EQUAL(indexed_list_pop_position(test_list, 3), &data[4]);
+    CU_ASSERT_EQUAL(test_list->size, DATA_ARR_LENGTH - 3);
+    CU_ASSERT_PTR_EQUAL(indexed_list_peek_position(test_list, 3), &data[5]);
+
+    CU_ASSERT_EQUAL(indexed_list_remove_head(test_list), E_SUCCESS);
+    CU_ASSERT_EQUAL(indexed_list_remove_tail(test_list), E_SUCCESS);
+    CU_ASSERT_EQUAL(indexed_list_remove_position(test_list, 0), E_SUCCESS);
+    CU_ASSERT_EQUAL(test_list->size, DATA_ARR_LENGTH - 6);
+    CU_ASSERT_PTR_EQUAL(indexed_list_peek_head(test_list), &data[3]);
+}
+
+void test_indexed_list_matches_model(void)
+{
+    int *    model[MODEL_LENGTH];
+    uint32_t model_size = 0;
+    uint32_t position   = 0;
+    void *   popped     = NULL;
+
+    // Random inserts and removals checked against a plain array
+    for (int step = 0; step < (MODEL_LENGTH * 2); step++)
+    {
+        if ((model_size < MODEL_LENGTH) &&
+            ((0 == model_size) || (0 != (rand() % 3))))
+        {
+            position           = (uint32_t)rand() % (model_size + 1);
+            values[model_size] = step;
+            CU_ASSERT_EQUAL(indexed_list_push_position(
+                                test_list, &values[model_size], position),
+                            E_SUCCESS);
+            for (uint32_t idx = model_size; idx > position; idx--)
+            {
+                model[idx] = model[idx - 1];
+            }
+            model[position] = &values[model_size];
+            model_size++;
+        }
+        else
+        {
+            position = (uint32_t)rand() % model_size;
+            popped   = indexed_list_pop_position(test_list, position);
+            CU_ASSERT_PTR_EQUAL(popped, model[position]);
+            for (uint32_t idx = position; (idx + 1) < model_size; idx++)
+            {
+                model[idx] = model[idx + 1];
+            }
+            model_size--;
+        }
+    }
+
+    CU_ASSERT_EQUAL(test_list->size, model_size);
+    for (uint32_t idx = 0; idx < model_size; idx++)
+    {
+        CU_ASSERT_PTR_EQUAL(indexed_list_peek_position(test_list, idx),
+                            model[idx]);
+    }
+
+    CU_ASSERT_TRUE(test_list->root->height <= MAX_HEIGHT);
+}
+
+void test_indexed_list_search(void)
+{
+    int      search   = 46;
+    int      missing  = 99;
+    uint32_t position = 0;
+
+    push_data();
+
+    CU_ASSERT_PTR_EQUAL(indexed_list_find_first_occurrence(test_list, &search),
+                        &data[6]);
+    CU_ASSERT_PTR_NULL(indexed_list_find_first_occurrence(test_list, &missing));
+    CU_ASSERT_EQUAL(indexed_list_index_of(test_list, &search, &position),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(position, 6);
+    CU_ASSERT_TRUE(indexed_list_contains(test_list, &search));
+    CU_ASSERT_FALSE(indexed_list_contains(test_list, &missing));
+
+    CU_ASSERT_EQUAL(indexed_list_remove_data(test_list, &search), E_SUCCESS);
+    CU_ASSERT_FALSE(indexed_list_contains(test_list, &search));
+    CU_ASSERT_EQUAL(indexed_list_remove_data(test_list, &missing), E_FAILURE);
+}
+
+void test_indexed_list_find_all_occurrences(void)
+{
+    indexed_list_t * matches = NULL;
+    int              search  = 51;
+
+    push_data();
+    indexed_list_push_head(test_list, &data[1]);
+
+    matches = indexed_list_find_all_occurrences(test_list, &search);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(matches);
+    CU_ASSERT_EQUAL(matches->size, 2);
+    indexed_list_delete(&matches);
+}
+
+void test_indexed_list_foreach_call(void)
+{
+    int expected = 0;
+
+    push_data();
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        expected += data[idx];
+    }
+
+    action_total = 0;
+    CU_ASSERT_EQUAL(indexed_list_foreach_call(test_list, custom_action),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(action_total, expected);
+    CU_ASSERT_EQUAL(indexed_list_foreach_call(test_list, NULL),
+                    E_NULL_POINTER);
+}
+
+void test_indexed_list_sort(void)
+{
+    push_data();
+
+    CU_ASSERT_EQUAL(indexed_list_sort(test_list), E_SUCCESS);
+    for (uint32_t idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        CU_ASSERT_EQUAL(*(int *)indexed_list_peek_position(test_list, idx),
+                        sorted[idx]);
+    }
+}
+
+void test_indexed_list_pick_random_item(void)
+{
+    void * item = NULL;
+
+    CU_ASSERT_PTR_NULL(indexed_list_pick_random_item(test_list));
+
+    push_data();
+    item = indexed_list_pick_random_item(test_list);
+    CU_ASSERT_PTR_NOT_NULL(item);
+    CU_ASSERT_TRUE(indexed_list_contains(test_list, item));
+}
+
+void test_indexed_list_clear(void)
+{
+    push_data();
+
+    CU_ASSERT_EQUAL(indexed_list_clear(test_list), E_SUCCESS);
+    CU_ASSERT_EQUAL(test_list->size, 0);
+    CU_ASSERT_PTR_NULL(test_list->root);
+    CU_ASSERT_EQUAL(indexed_list_clear(NULL), E_NULL_POINTER);
+}
+
+static CU_TestInfo indexed_list_tests[] = {
+    { "new", test_indexed_list_new },
+    { "push_null", test_indexed_list_push_null },
+    { "push_and_peek", test_indexed_list_push_and_peek },
+    { "pop", test_indexed_list_pop },
+    { "matches_model", test_indexed_list_matches_model },
+    { "search", test_indexed_list_search },
+    { "find_all_occurrences", test_indexed_list_find_all_occurrences },
+    { "foreach_call", test_indexed_list_foreach_call },
+    { "sort", test_indexed_list_sort },
+    { "pick_random_item", test_indexed_list_pick_random_item },
+    { "clear", test_indexed_list_clear },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo indexed_list_test_suite = {
+    "indexed_list Tests",
+    NULL,              // Suite initialization function
+    NULL,              // Suite cleanup function
+    setup,             // Suite setup function
+    teardown,          // Suite teardown function
+    indexed_list_tests // The combined array of all tests
+};
+
+/*** end of file ***/
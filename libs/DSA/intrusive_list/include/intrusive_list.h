@@ -0,0 +1,229 @@
+/**
+ * @file intrusive_list.h
+ *
+ * @brief A doubly-linked list whose link fields live inside the caller's own
+ * structs.
+ *
+ * `list_t` allocates a node per element and has to scan to find the node that
+ * owns a given pointer. An intrusive list instead links an `intrusive_link_t`
+ * embedded in each element, so inserting never allocates and an element can
+ * unlink itself in O(1). The list never owns or frees its elements.
+ *
+ * Usage:
+ * @code
+ * typedef struct session
+ * {
+ *     int              client_fd;
+ *     intrusive_link_t active_link; // Membership in the active session list
+ * } session_t;
+ *
+ * intrusive_list_t active_sessions;
+ * intrusive_list_init(&active_sessions);
+ *
+ * intrusive_link_init(&session->active_link);
+ * intrusive_list_push_tail(&active_sessions, &session->active_link);
+ * ...
+ * intrusive_list_unlink(&active_sessions, &session->active_link);
+ *
+ * intrusive_link_t * link = NULL;
+ * INTRUSIVE_LIST_FOR_EACH(link, &active_sessions)
+ * {
+ *     session_t * entry = INTRUSIVE_LIST_ENTRY(link, session_t, active_link);
+ * }
+ * @endcode
+ *
+ * An element may sit in several lists at once by embedding one link per list.
+ * None of these functions are thread safe.
+ */
+#ifndef _INTRUSIVE_LIST_H
+#define _INTRUSIVE_LIST_H
+
+#include <stdbool.h>
+#include <stddef.h> // offsetof()
+#include <stdint.h>
+
+/**
+ * @brief Recovers a pointer to the struct that embeds 'link' as 'member'.
+ */
+#define INTRUSIVE_LIST_ENTRY(link, type, member) \
+    ((type *)((char *)(link) - offsetof(type, member)))
+
+/**
+ * @brief Iterates over every link in a list, head to tail. The current link
+ * must not be unlinked inside the loop; use INTRUSIVE_LIST_FOR_EACH_SAFE.
+ */
+#define INTRUSIVE_LIST_FOR_EACH(link, list)                          \
+    for ((link) = (list)->sentinel.next; (link) != &(list)->sentinel; \
+         (link) = (link)->next)
+
+/**
+ * @brief Iterates over every link in a list, head to tail, allowing the
+ * current link to be unlinked inside the loop.
+ */
+#define INTRUSIVE_LIST_FOR_EACH_SAFE(link, next_link, list)          \
+    for ((link) = (list)->sentinel.next, (next_link) = (link)->next; \
+         (link) != &(list)->sentinel;                                \
+         (link) = (next_link), (next_link) = (link)->next)
+
+/**
+ * @brief Link fields to embed in an element
+ *
+ * @param prev the previous link, or NULL when not in a list
+ * @param next the next link, or NULL when not in a list
+ */
+typedef struct intrusive_link_t
+{
+    struct intrusive_link_t * prev;
+    struct intrusive_link_t * next;
+} intrusive_link_t;
+
+/**
+ * @brief structure of an intrusive list object
+ *
+ * @param sentinel circular anchor; its next is the head and its prev the tail
+ * @param size number of linked elements
+ */
+typedef struct intrusive_list_t
+{
+    intrusive_link_t sentinel;
+    uint32_t         size;
+} intrusive_list_t;
+
+/**
+ * @brief Initializes an empty list.
+ *
+ * @param list The list to initialize.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_init(intrusive_list_t * list);
+
+/**
+ * @brief Marks a link as not belonging to any list. Call once before the
+ * link is first used.
+ *
+ * @param link The link to initialize.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_link_init(intrusive_link_t * link);
+
+/**
+ * @brief Checks whether a link is currently in a list.
+ *
+ * @param link The link to check.
+ * @return true if linked, false otherwise
+ */
+bool intrusive_link_is_linked(const intrusive_link_t * link);
+
+/**
+ * @brief Links an element at the head of the list in O(1).
+ *
+ * @param list The list.
+ * @param link An unlinked link embedded in the element.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_push_head(intrusive_list_t * list, intrusive_link_t * link);
+
+/**
+ * @brief Links an element at the tail of the list in O(1).
+ *
+ * @param list The list.
+ * @param link An unlinked link embedded in the element.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_push_tail(intrusive_list_t * list, intrusive_link_t * link);
+
+/**
+ * @brief Links an element directly before another one in O(1).
+ *
+ * @param list The list holding 'position'.
+ * @param position A link already in 'list'.
+ * @param link An unlinked link embedded in the element.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_insert_before(intrusive_list_t * list,
+                                 intrusive_link_t * position,
+                                 intrusive_link_t * link);
+
+/**
+ * @brief Links an element directly after another one in O(1).
+ *
+ * @param list The list holding 'position'.
+ * @param position A link already in 'list'.
+ * @param link An unlinked link embedded in the element.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_insert_after(intrusive_list_t * list,
+                                intrusive_link_t * position,
+                                intrusive_link_t * link);
+
+/**
+ * @brief Unlinks an element from the list in O(1).
+ *
+ * @param list The list holding 'link'.
+ * @param link The link to remove. It is reset to the unlinked state.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_unlink(intrusive_list_t * list, intrusive_link_t * link);
+
+/**
+ * @brief Moves a linked element to the tail of the list in O(1), e.g. to
+ * keep the list in least-recently-used order.
+ *
+ * @param list The list holding 'link'.
+ * @param link The link to move.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_move_to_tail(intrusive_list_t * list,
+                                intrusive_link_t * link);
+
+/**
+ * @brief Unlinks and returns the head of the list.
+ *
+ * @param list The list.
+ * @return The unlinked head, or NULL if the list is empty or on failure
+ */
+intrusive_link_t * intrusive_list_pop_head(intrusive_list_t * list);
+
+/**
+ * @brief Unlinks and returns the tail of the list.
+ *
+ * @param list The list.
+ * @return The unlinked tail, or NULL if the list is empty or on failure
+ */
+intrusive_link_t * intrusive_list_pop_tail(intrusive_list_t * list);
+
+/**
+ * @brief Returns the head of the list without unlinking it.
+ *
+ * @param list The list.
+ * @return The head, or NULL if the list is empty or on failure
+ */
+intrusive_link_t * intrusive_list_peek_head(intrusive_list_t * list);
+
+/**
+ * @brief Returns the tail of the list without unlinking it.
+ *
+ * @param list The list.
+ * @return The tail, or NULL if the list is empty or on failure
+ */
+intrusive_link_t * intrusive_list_peek_tail(intrusive_list_t * list);
+
+/**
+ * @brief checks if the list object is empty
+ *
+ * @param list pointer to list object to be checked
+ * @return true if the list is empty or NULL, false otherwise
+ */
+bool intrusive_list_is_empty(const intrusive_list_t * list);
+
+/**
+ * @brief Unlinks every element. The elements themselves are not freed.
+ *
+ * @param list The list to clear.
+ * @return 0 on success, non-zero value on failure
+ */
+int intrusive_list_clear(intrusive_list_t * list);
+
+#endif /* _INTRUSIVE_LIST_H */
+
+/*** end of file ***/
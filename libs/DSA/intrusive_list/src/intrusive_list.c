@@ -0,0 +1,334 @@
+#include "intrusive_list.h"
+#include "utilities.h"
+
+/**
+ * @brief Splices 'link' in between two adjacent links
+ */
+static void link_between(intrusive_list_t * list,
+                         intrusive_link_t * prev,
+                         intrusive_link_t * next,
+                         intrusive_link_t * link);
+
+/**
+ * @brief Splices 'link' out of its neighbours and resets it
+ */
+static void link_remove(intrusive_list_t * list, intrusive_link_t * link);
+
+int intrusive_list_init(intrusive_list_t * list)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("intrusive_list_init(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    list->sentinel.prev = &list->sentinel;
+    list->sentinel.next = &list->sentinel;
+    list->size          = 0;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int intrusive_link_init(intrusive_link_t * link)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == link)
+    {
+        PRINT_DEBUG("intrusive_link_init(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    link->prev = NULL;
+    link->next = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool intrusive_link_is_linked(const intrusive_link_t * link)
+{
+    return (NULL != link) && (NULL != link->next);
+}
+
+int intrusive_list_push_head(intrusive_list_t * list, intrusive_link_t * link)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == link))
+    {
+        PRINT_DEBUG("intrusive_list_push_head(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (intrusive_link_is_linked(link))
+    {
+        PRINT_DEBUG("intrusive_list_push_head(): Link is already in a list.\n");
+        goto END;
+    }
+
+    link_between(list, &list->sentinel, list->sentinel.next, link);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int intrusive_list_push_tail(intrusive_list_t * list, intrusive_link_t * link)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == link))
+    {
+        PRINT_DEBUG("intrusive_list_push_tail(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (intrusive_link_is_linked(link))
+    {
+        PRINT_DEBUG("intrusive_list_push_tail(): Link is already in a list.\n");
+        goto END;
+    }
+
+    link_between(list, list->sentinel.prev, &list->sentinel, link);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int intrusive_list_insert_before(intrusive_list_t * list,
+                                 intrusive_link_t * position,
+                                 intrusive_link_t * link)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == position) || (NULL == link))
+    {
+        PRINT_DEBUG("intrusive_list_insert_before(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (!intrusive_link_is_linked(position) || intrusive_link_is_linked(link))
+    {
+        PRINT_DEBUG("intrusive_list_insert_before(): Invalid link state.\n");
+        goto END;
+    }
+
+    link_between(list, position->prev, position, link);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int intrusive_list_insert_after(intrusive_list_t * list,
+                                intrusive_link_t * position,
+                                intrusive_link_t * link)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == position) || (NULL == link))
+    {
+        PRINT_DEBUG("intrusive_list_insert_after(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (!intrusive_link_is_linked(position) || intrusive_link_is_linked(link))
+    {
+        PRINT_DEBUG("intrusive_list_insert_after(): Invalid link state.\n");
+        goto END;
+    }
+
+    link_between(list, position, position->next, link);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int intrusive_list_unlink(intrusive_list_t * list, intrusive_link_t * link)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == link))
+    {
+        PRINT_DEBUG("intrusive_list_unlink(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (!intrusive_link_is_linked(link) || (&list->sentinel == link))
+    {
+        PRINT_DEBUG("intrusive_list_unlink(): Link is not in a list.\n");
+        goto END;
+    }
+
+    link_remove(list, link);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int intrusive_list_move_to_tail(intrusive_list_t * list,
+                                intrusive_link_t * link)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == link))
+    {
+        PRINT_DEBUG("intrusive_list_move_to_tail(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (!intrusive_link_is_linked(link) || (&list->sentinel == link))
+    {
+        PRINT_DEBUG("intrusive_list_move_to_tail(): Link is not in a list.\n");
+        goto END;
+    }
+
+    if (list->sentinel.prev != link)
+    {
+        link_remove(list, link);
+        link_between(list, list->sentinel.prev, &list->sentinel, link);
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+intrusive_link_t * intrusive_list_pop_head(intrusive_list_t * list)
+{
+    intrusive_link_t * link = intrusive_list_peek_head(list);
+
+    if (NULL != link)
+    {
+        link_remove(list, link);
+    }
+
+    return link;
+}
+
+intrusive_link_t * intrusive_list_pop_tail(intrusive_list_t * list)
+{
+    intrusive_link_t * link = intrusive_list_peek_tail(list);
+
+    if (NULL != link)
+    {
+        link_remove(list, link);
+    }
+
+    return link;
+}
+
+intrusive_link_t * intrusive_list_peek_head(intrusive_list_t * list)
+{
+    intrusive_link_t * link = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("intrusive_list_peek_head(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 != list->size)
+    {
+        link = list->sentinel.next;
+    }
+
+END:
+    return link;
+}
+
+intrusive_link_t * intrusive_list_peek_tail(intrusive_list_t * list)
+{
+    intrusive_link_t * link = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("intrusive_list_peek_tail(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 != list->size)
+    {
+        link = list->sentinel.prev;
+    }
+
+END:
+    return link;
+}
+
+bool intrusive_list_is_empty(const intrusive_list_t * list)
+{
+    return (NULL == list) || (0 == list->size);
+}
+
+int intrusive_list_clear(intrusive_list_t * list)
+{
+    int                exit_code = E_FAILURE;
+    intrusive_link_t * link      = NULL;
+    intrusive_link_t * next_link = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("intrusive_list_clear(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    INTRUSIVE_LIST_FOR_EACH_SAFE(link, next_link, list)
+    {
+        link->prev = NULL;
+        link->next = NULL;
+    }
+
+    list->sentinel.prev = &list->sentinel;
+    list->sentinel.next = &list->sentinel;
+    list->size          = 0;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static void link_between(intrusive_list_t * list,
+                         intrusive_link_t * prev,
+                         intrusive_link_t * next,
+                         intrusive_link_t * link)
+{
+    link->prev = prev;
+    link->next = next;
+    prev->next = link;
+    next->prev = link;
+    list->size++;
+}
+
+static void link_remove(intrusive_list_t * list, intrusive_link_t * link)
+{
+    link->prev->next = link->next;
+    link->next->prev = link->prev;
+    link->prev       = NULL;
+    link->next       = NULL;
+    list->size--;
+}
+
+/*** end of file ***/
@@ -0,0 +1,263 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "intrusive_list.h"
+#include "utilities.h"
+
+#define ENTRY_COUNT 10
+
+typedef struct entry_t
+{
+    int              value;
+    intrusive_link_t link;
+    intrusive_link_t second_link;
+} entry_t;
+
+intrusive_list_t test_list;
+entry_t          entries[ENTRY_COUNT];
+
+void setup(void)
+{
+    intrusive_list_init(&test_list);
+    for (int idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        entries[idx].value = idx;
+        intrusive_link_init(&entries[idx].link);
+        intrusive_link_init(&entries[idx].second_link);
+    }
+}
+
+void teardown(void)
+{
+    intrusive_list_clear(&test_list);
+}
+
+void push_entries(void)
+{
+    for (int idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        intrusive_list_push_tail(&test_list, &entries[idx].link);
+    }
+}
+
+int value_of(intrusive_link_t * link)
+{
+    return INTRUSIVE_LIST_ENTRY(link, entry_t, link)->value;
+}
+
+bool list_is_consistent(intrusive_list_t * list)
+{
+    intrusive_link_t * link  = NULL;
+    uint32_t           count = 0;
+
+    INTRUSIVE_LIST_FOR_EACH(link, list)
+    {
+        if (link->next->prev != link)
+        {
+            return false;
+        }
+        count++;
+    }
+
+    return (count == list->size) &&
+           (list->sentinel.prev->next == &list->sentinel);
+}
+
+void test_intrusive_list_init(void)
+{
+    CU_ASSERT_EQUAL(test_list.size, 0);
+    CU_ASSERT_TRUE(intrusive_list_is_empty(&test_list));
+    CU_ASSERT_PTR_NULL(intrusive_list_peek_head(&test_list));
+    CU_ASSERT_PTR_NULL(intrusive_list_pop_tail(&test_list));
+    CU_ASSERT_FALSE(intrusive_link_is_linked(&entries[0].link));
+    CU_ASSERT_EQUAL(intrusive_list_init(NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(intrusive_link_init(NULL), E_NULL_POINTER);
+}
+
+void test_intrusive_list_push_null(void)
+{
+    CU_ASSERT_EQUAL(intrusive_list_push_head(NULL, &entries[0].link),
+                    E_NULL_POINTER);
+    CU_ASSERT_EQUAL(intrusive_list_push_tail(&test_list, NULL),
+                    E_NULL_POINTER);
+    CU_ASSERT_EQUAL(intrusive_list_unlink(&test_list, NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(test_list.size, 0);
+}
+
+void test_intrusive_list_push_and_pop(void)
+{
+    intrusive_list_push_tail(&test_list, &entries[1].link);
+    intrusive_list_push_head(&test_list, &entries[0].link);
+    intrusive_list_push_tail(&test_list, &entries[2].link);
+
+    CU_ASSERT_EQUAL(test_list.size, 3);
+    CU_ASSERT_TRUE(list_is_consistent(&test_list));
+    CU_ASSERT_EQUAL(value_of(intrusive_list_peek_head(&test_list)), 0);
+    CU_ASSERT_EQUAL(value_of(intrusive_list_peek_tail(&test_list)), 2);
+
+    CU_ASSERT_EQUAL(value_of(intrusive_list_pop_head(&test_list)), 0);
+    CU_ASSERT_EQUAL(value_of(intrusive_list_pop_tail(&test_list)), 2);
+    CU_ASSERT_FALSE(intrusive_link_is_linked(&entries[0].link));
+    CU_ASSERT_EQUAL(value_of(intrusive_list_pop_head(&test_list)), 1);
+    CU_ASSERT_TRUE(intrusive_list_is_empty(&test_list));
+}
+
+void test_intrusive_list_double_insert(void)
+{
+    intrusive_list_push_tail(&test_list, &entries[0].link);
+
+    CU_ASSERT_EQUAL(intrusive_list_push_tail(&test_list, &entries[0].link),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(intrusive_list_push_head(&test_list, &entries[0].link),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(test_list.size, 1);
+    CU_ASSERT_TRUE(list_is_consistent(&test_list));
+}
+
+void test_intrusive_list_unlink(void)
+{
+    int                expected[] = { 1, 2, 3, 5, 6, 7, 8 };
+    intrusive_link_t * link       = NULL;
+    int                idx        = 0;
+
+    push_entries();
+
+    CU_ASSERT_EQUAL(intrusive_list_unlink(&test_list, &entries[4].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(intrusive_list_unlink(&test_list, &entries[0].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(intrusive_list_unlink(&test_list, &entries[9].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(intrusive_list_unlink(&test_list, &entries[9].link),
+                    E_FAILURE);
+    CU_ASSERT_FALSE(intrusive_link_is_linked(&entries[4].link));
+    CU_ASSERT_EQUAL(test_list.size, ENTRY_COUNT - 3);
+    CU_ASSERT_TRUE(list_is_consistent(&test_list));
+
+    INTRUSIVE_LIST_FOR_EACH(link, &test_list)
+    {
+        CU_ASSERT_EQUAL(value_of(link), expected[idx]);
+        idx++;
+    }
+    CU_ASSERT_EQUAL(idx, ENTRY_COUNT - 3);
+}
+
+void test_intrusive_list_insert_relative(void)
+{
+    intrusive_list_push_tail(&test_list, &entries[2].link);
+
+    CU_ASSERT_EQUAL(intrusive_list_insert_before(
+                        &test_list, &entries[2].link, &entries[1].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(intrusive_list_insert_after(
+                        &test_list, &entries[2].link, &entries[3].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(intrusive_list_insert_after(
+                        &test_list, &entries[5].link, &entries[4].link),
+                    E_FAILURE);
+
+    CU_ASSERT_EQUAL(test_list.size, 3);
+    CU_ASSERT_TRUE(list_is_consistent(&test_list));
+    CU_ASSERT_EQUAL(value_of(intrusive_list_pop_head(&test_list)), 1);
+    CU_ASSERT_EQUAL(value_of(intrusive_list_pop_head(&test_list)), 2);
+    CU_ASSERT_EQUAL(value_of(intrusive_list_pop_head(&test_list)), 3);
+}
+
+void test_intrusive_list_move_to_tail(void)
+{
+    push_entries();
+
+    CU_ASSERT_EQUAL(intrusive_list_move_to_tail(&test_list, &entries[0].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(intrusive_list_move_to_tail(&test_list, &entries[0].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(test_list.size, ENTRY_COUNT);
+    CU_ASSERT_TRUE(list_is_consistent(&test_list));
+    CU_ASSERT_EQUAL(value_of(intrusive_list_peek_head(&test_list)), 1);
+    CU_ASSERT_EQUAL(value_of(intrusive_list_peek_tail(&test_list)), 0);
+}
+
+void test_intrusive_list_unlink_while_iterating(void)
+{
+    intrusive_link_t * link      = NULL;
+    intrusive_link_t * next_link = NULL;
+
+    push_entries();
+
+    INTRUSIVE_LIST_FOR_EACH_SAFE(link, next_link, &test_list)
+    {
+        if (0 == (value_of(link) % 2))
+        {
+            intrusive_list_unlink(&test_list, link);
+        }
+    }
+
+    CU_ASSERT_EQUAL(test_list.size, ENTRY_COUNT / 2);
+    CU_ASSERT_TRUE(list_is_consistent(&test_list));
+    INTRUSIVE_LIST_FOR_EACH(link, &test_list)
+    {
+        CU_ASSERT_EQUAL(value_of(link) % 2, 1);
+    }
+}
+
+void test_intrusive_list_multiple_lists(void)
+{
+    intrusive_list_t   second_list;
+    intrusive_link_t * link = NULL;
+
+    intrusive_list_init(&second_list);
+    push_entries();
+    intrusive_list_push_head(&second_list, &entries[3].second_link);
+    intrusive_list_push_head(&second_list, &entries[7].second_link);
+
+    intrusive_list_unlink(&test_list, &entries[3].link);
+
+    CU_ASSERT_EQUAL(test_list.size, ENTRY_COUNT - 1);
+    CU_ASSERT_EQUAL(second_list.size, 2);
+    link = intrusive_list_peek_tail(&second_list);
+    CU_ASSERT_EQUAL(INTRUSIVE_LIST_ENTRY(link, entry_t, second_link)->value, 3);
+
+    intrusive_list_clear(&second_list);
+}
+
+void test_intrusive_list_clear(void)
+{
+    push_entries();
+
+    CU_ASSERT_EQUAL(intrusive_list_clear(&test_list), E_SUCCESS);
+    CU_ASSERT_TRUE(intrusive_list_is_empty(&test_list));
+    for (int idx = 0; idx < ENTRY_COUNT; idx++)
+    {
+        CU_ASSERT_FALSE(intrusive_link_is_linked(&entries[idx].link));
+    }
+    CU_ASSERT_EQUAL(intrusive_list_push_tail(&test_list, &entries[0].link),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(intrusive_list_clear(NULL), E_NULL_POINTER);
+}
+
+static CU_TestInfo intrusive_list_tests[] = {
+    { "init", test_intrusive_list_init },
+    { "push_null", test_intrusive_list_push_null },
+    { "push_and_pop", test_intrusive_list_push_and_pop },
+    { "double_insert", test_intrusive_list_double_insert },
+    { "unlink", test_intrusive_list_unlink },
+    { "insert_relative", test_intrusive_list_insert_relative },
+    { "move_to_tail", test_intrusive_list_move_to_tail },
+    { "unlink_while_iterating", test_intrusive_list_unlink_while_iterating },
+    { "multiple_lists", test_intrusive_list_multiple_lists },
+    { "clear", test_intrusive_list_clear },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo intrusive_list_test_suite = {
+    "intrusive_list Tests",
+    NULL,                // Suite initialization function
+    NULL,                // Suite cleanup function
+    setup,               // Suite setup function
+    teardown,            // Suite teardown function
+    intrusive_list_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -203,6 +203,16 @@ void * list_peek_position(list_t * list, uint32_t position);
  */
 int list_remove_data(list_t * list, void * data_p);
 
+/**
+ * @brief remove a node the caller already holds, such as one saved from
+ *        list->head after a push, in O(1)
+ *
+ * @param list list the node belongs to
+ * @param node the node to remove; its data is passed to the free function
+ * @return 0 on success, non-zero value on failure
+ */
+int list_remove_node(list_t * list, list_node_t * node);
+
 /**
  * @brief perform a user defined action on the data contained in all of the
  *        nodes in list
@@ -554,6 +554,22 @@ END:
     return exit_code;
 }
 
+int list_remove_node(list_t * list, list_node_t * node)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list) || (NULL == node))
+    {
+        PRINT_DEBUG("list_remove_node(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    exit_code = remove_node(list, node);
+END:
+    return exit_code;
+}
+
 int list_foreach_call(list_t * list, ACT_F action_function)
 {
     int           exit_code    = E_FAILURE;
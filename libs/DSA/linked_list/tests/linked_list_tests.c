@@ -632,6 +632,25 @@ void test_list_remove_data(void)
     CU_ASSERT_PTR_NULL(list_peek_head(test_list));
 }
 
+void test_list_remove_node(void)
+{
+    list_node_t * middle = NULL;
+
+    list_push_head(test_list, &data[0]);
+    list_push_head(test_list, &data[1]);
+    middle = test_list->head;
+    list_push_head(test_list, &data[2]); // [77, 51, 44]
+
+    CU_ASSERT_EQUAL(list_remove_node(test_list, middle), E_SUCCESS); // [77, 44]
+    CU_ASSERT_EQUAL(test_list->size, 2);
+    CU_ASSERT_EQUAL(*(int *)list_peek_head(test_list), data[2]);
+    CU_ASSERT_EQUAL(*(int *)list_peek_tail(test_list), data[0]);
+
+    CU_ASSERT_EQUAL(list_remove_node(test_list, test_list->tail), E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(test_list->head, test_list->tail);
+    CU_ASSERT_EQUAL(list_remove_node(test_list, NULL), E_NULL_POINTER);
+}
+
 void test_list_foreach_call_null_list(void)
 {
     int exit_code = E_FAILURE;
@@ -883,6 +902,7 @@ static CU_TestInfo linked_list_tests[] = {
     { "remove_data_null_list", test_list_remove_data_null_list },
     { "remove_data_null_data_p", test_list_remove_data_null_data_p },
     { "remove_data", test_list_remove_data },
+    { "remove_node", test_list_remove_node },
     { "foreach_call_null_list", test_list_foreach_call_null_list },
     { "foreach_call", test_list_foreach_call },
     { "contains_null_list", test_list_contains_null_list },
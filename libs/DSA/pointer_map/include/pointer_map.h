@@ -0,0 +1,112 @@
+/**
+ * @file pointer_map.h
+ *
+ * @brief An open-addressing hash map keyed by pointer identity.
+ *
+ * Keys are compared by address, never dereferenced, which makes the map a
+ * cheap index from objects the caller already owns (node data, nodes) to
+ * related objects. Lookups, inserts and removals are O(1) expected.
+ *
+ * Slots are probed linearly and removals shift later entries back instead of
+ * leaving tombstones, so heavy churn does not slow lookups down. The table
+ * doubles whenever it becomes half full.
+ *
+ * A key may be inserted more than once with different values, as when two
+ * parallel edges lead to the same neighbour; pointer_map_remove() then takes
+ * out one exact key/value pair.
+ */
+#ifndef _POINTER_MAP_H
+#define _POINTER_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief one slot of a pointer map; empty slots have a NULL key
+ *
+ * @param key the key address
+ * @param value the value stored under the key
+ */
+typedef struct pointer_map_entry_t
+{
+    const void * key;
+    void *       value;
+} pointer_map_entry_t;
+
+/**
+ * @brief structure of a pointer map object
+ *
+ * @param capacity number of slots, always a power of two
+ * @param size number of key/value pairs stored
+ * @param shift right shift that turns a 64-bit hash into a slot index
+ * @param entries the slots
+ */
+typedef struct pointer_map_t
+{
+    size_t                capacity;
+    size_t                size;
+    uint32_t              shift;
+    pointer_map_entry_t * entries;
+} pointer_map_t;
+
+/**
+ * @brief creates a new, empty pointer map
+ *
+ * @param capacity number of pairs the map holds before it first grows
+ * @return pointer to the new map on success, NULL on failure
+ */
+pointer_map_t * pointer_map_new(size_t capacity);
+
+/**
+ * @brief adds a key/value pair, growing the map if needed
+ *
+ * Existing pairs with the same key are kept.
+ *
+ * @param map the map
+ * @param key the key address; must not be NULL
+ * @param value the value; must not be NULL
+ * @return 0 on success, non-zero value on failure
+ */
+int pointer_map_insert(pointer_map_t * map, const void * key, void * value);
+
+/**
+ * @brief looks up a key
+ *
+ * @param map the map
+ * @param key the key address
+ * @return one of the values stored under the key, or NULL if there are none
+ */
+void * pointer_map_get(const pointer_map_t * map, const void * key);
+
+/**
+ * @brief removes a key/value pair
+ *
+ * @param map the map
+ * @param key the key address
+ * @param value the value to remove, or NULL to remove any one pair with the
+ * key
+ * @return 0 on success, non-zero value on failure or if no pair matched
+ */
+int pointer_map_remove(pointer_map_t * map,
+                       const void *    key,
+                       const void *    value);
+
+/**
+ * @brief removes every pair, keeping the allocated slots
+ *
+ * @param map the map
+ * @return 0 on success, non-zero value on failure
+ */
+int pointer_map_clear(pointer_map_t * map);
+
+/**
+ * @brief deletes a map and sets the caller's pointer to NULL
+ *
+ * @param map_address pointer to the map pointer
+ * @return 0 on success, non-zero value on failure
+ */
+int pointer_map_delete(pointer_map_t ** map_address);
+
+#endif /* _POINTER_MAP_H */
+
+/*** end of file ***/
@@ -0,0 +1,289 @@
+#include <stdlib.h>
+#include <string.h> // memset()
+
+#include "pointer_map.h"
+#include "utilities.h"
+
+// Smallest number of slots a map is created with
+#define MIN_CAPACITY 8
+
+// 2^64 divided by the golden ratio; spreads aligned addresses across slots
+#define FIBONACCI_MULTIPLIER UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @brief Returns the slot a key hashes to
+ */
+static size_t home_slot(const pointer_map_t * map, const void * key);
+
+/**
+ * @brief Allocates 'capacity' empty slots and rehashes every pair into them
+ */
+static int resize(pointer_map_t * map, size_t capacity);
+
+/**
+ * @brief Empties 'slot' and shifts later entries of its probe run back
+ */
+static void remove_slot(pointer_map_t * map, size_t slot);
+
+pointer_map_t * pointer_map_new(size_t capacity)
+{
+    pointer_map_t * map   = NULL;
+    size_t          slots = MIN_CAPACITY;
+
+    if (capacity > (SIZE_MAX / 4))
+    {
+        PRINT_DEBUG("pointer_map_new(): Capacity too large.\n");
+        goto END;
+    }
+
+    map = calloc(1, sizeof(pointer_map_t));
+    if (NULL == map)
+    {
+        PRINT_DEBUG("pointer_map_new(): CMR failure.\n");
+        goto END;
+    }
+
+    // Keep the table at most half full
+    while (slots < (capacity * 2))
+    {
+        slots *= 2;
+    }
+
+    if (E_SUCCESS != resize(map, slots))
+    {
+        PRINT_DEBUG("pointer_map_new(): CMR failure.\n");
+        free(map);
+        map = NULL;
+        goto END;
+    }
+
+END:
+    return map;
+}
+
+int pointer_map_insert(pointer_map_t * map, const void * key, void * value)
+{
+    int    exit_code = E_FAILURE;
+    size_t slot      = 0;
+    size_t mask      = 0;
+
+    if ((NULL == map) || (NULL == key) || (NULL == value))
+    {
+        PRINT_DEBUG("pointer_map_insert(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (((map->size + 1) * 2) > map->capacity)
+    {
+        if ((map->capacity > (SIZE_MAX / sizeof(pointer_map_entry_t) / 2)) ||
+            (E_SUCCESS != resize(map, map->capacity * 2)))
+        {
+            PRINT_DEBUG("pointer_map_insert(): CMR failure.\n");
+            goto END;
+        }
+    }
+
+    mask = map->capacity - 1;
+    slot = home_slot(map, key);
+    while (NULL != map->entries[slot].key)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    map->entries[slot].key   = key;
+    map->entries[slot].value = value;
+    map->size++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void * pointer_map_get(const pointer_map_t * map, const void * key)
+{
+    void * value = NULL;
+    size_t slot  = 0;
+    size_t mask  = 0;
+
+    if ((NULL == map) || (NULL == key))
+    {
+        goto END;
+    }
+
+    mask = map->capacity - 1;
+    slot = home_slot(map, key);
+    while (NULL != map->entries[slot].key)
+    {
+        if (key == map->entries[slot].key)
+        {
+            value = map->entries[slot].value;
+            goto END;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+END:
+    return value;
+}
+
+int pointer_map_remove(pointer_map_t * map,
+                       const void *    key,
+                       const void *    value)
+{
+    int    exit_code = E_FAILURE;
+    size_t slot      = 0;
+    size_t mask      = 0;
+
+    if ((NULL == map) || (NULL == key))
+    {
+        PRINT_DEBUG("pointer_map_remove(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    mask = map->capacity - 1;
+    slot = home_slot(map, key);
+    while (NULL != map->entries[slot].key)
+    {
+        if ((key == map->entries[slot].key) &&
+            ((NULL == value) || (value == map->entries[slot].value)))
+        {
+            remove_slot(map, slot);
+            map->size--;
+            exit_code = E_SUCCESS;
+            goto END;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+END:
+    return exit_code;
+}
+
+int pointer_map_clear(pointer_map_t * map)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == map)
+    {
+        PRINT_DEBUG("pointer_map_clear(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    memset(map->entries, 0, map->capacity * sizeof(pointer_map_entry_t));
+    map->size = 0;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int pointer_map_delete(pointer_map_t ** map_address)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == map_address) || (NULL == *map_address))
+    {
+        PRINT_DEBUG("pointer_map_delete(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    free((*map_address)->entries);
+    free(*map_address);
+    *map_address = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static size_t home_slot(const pointer_map_t * map, const void * key)
+{
+    // The high bits of the product are the best mixed
+    return (size_t)(((uint64_t)(uintptr_t)key * FIBONACCI_MULTIPLIER) >>
+                    map->shift);
+}
+
+static int resize(pointer_map_t * map, size_t capacity)
+{
+    int                   exit_code   = E_FAILURE;
+    pointer_map_entry_t * old_entries = map->entries;
+    size_t                old_count   = map->capacity;
+    size_t                slot        = 0;
+    uint32_t              shift       = 64;
+
+    map->entries = calloc(capacity, sizeof(pointer_map_entry_t));
+    if (NULL == map->entries)
+    {
+        map->entries = old_entries;
+        goto END;
+    }
+
+    for (size_t slots = capacity; slots > 1; slots /= 2)
+    {
+        shift--;
+    }
+
+    map->capacity = capacity;
+    map->shift    = shift;
+
+    for (size_t idx = 0; idx < old_count; idx++)
+    {
+        if (NULL == old_entries[idx].key)
+        {
+            continue;
+        }
+
+        slot = home_slot(map, old_entries[idx].key);
+        while (NULL != map->entries[slot].key)
+        {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        map->entries[slot] = old_entries[idx];
+    }
+    free(old_entries);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void remove_slot(pointer_map_t * map, size_t slot)
+{
+    size_t mask = map->capacity - 1;
+    size_t next = slot;
+    size_t home = 0;
+
+    for (;;)
+    {
+        next = (next + 1) & mask;
+        if (NULL == map->entries[next].key)
+        {
+            break;
+        }
+
+        /*
+         * An entry may move back into the hole only if its home slot is not
+         * cyclically within (slot, next]; otherwise a lookup starting at its
+         * home would stop at the hole before reaching it.
+         */
+        home = home_slot(map, map->entries[next].key);
+        if (((next - home) & mask) >= ((next - slot) & mask))
+        {
+            map->entries[slot] = map->entries[next];
+            slot               = next;
+        }
+    }
+
+    map->entries[slot].key   = NULL;
+    map->entries[slot].value = NULL;
+}
+
+/*** end of file ***/
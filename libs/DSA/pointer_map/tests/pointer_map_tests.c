@@ -0,0 +1,165 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pointer_map.h"
+#include "utilities.h"
+
+#define MAP_CAPACITY 4
+#define KEY_COUNT    64
+#define MODEL_SIZE   5000
+#define MODEL_ROUNDS 20000
+
+pointer_map_t * test_map = NULL;
+
+int  keys[KEY_COUNT];
+int  values[KEY_COUNT];
+char model_keys[MODEL_SIZE];
+int  model[MODEL_SIZE];
+
+void setup(void)
+{
+    test_map = pointer_map_new(MAP_CAPACITY);
+}
+
+void teardown(void)
+{
+    if (NULL != test_map)
+    {
+        pointer_map_delete(&test_map);
+    }
+}
+
+void test_pointer_map_new(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_map);
+    CU_ASSERT_EQUAL(test_map->size, 0);
+    CU_ASSERT(test_map->capacity >= (2 * MAP_CAPACITY));
+    CU_ASSERT_EQUAL(test_map->capacity & (test_map->capacity - 1), 0);
+    CU_ASSERT_PTR_NULL(pointer_map_get(test_map, &keys[0]));
+}
+
+void test_pointer_map_insert_get(void)
+{
+    // Enough keys to force several resizes
+    for (int idx = 0; idx < KEY_COUNT; idx++)
+    {
+        CU_ASSERT_EQUAL(pointer_map_insert(test_map, &keys[idx], &values[idx]),
+                        E_SUCCESS);
+    }
+    CU_ASSERT_EQUAL(test_map->size, KEY_COUNT);
+    CU_ASSERT(test_map->capacity >= (2 * KEY_COUNT));
+
+    for (int idx = 0; idx < KEY_COUNT; idx++)
+    {
+        CU_ASSERT_PTR_EQUAL(pointer_map_get(test_map, &keys[idx]),
+                            &values[idx]);
+    }
+    CU_ASSERT_PTR_NULL(pointer_map_get(test_map, &values[0]));
+}
+
+void test_pointer_map_duplicates(void)
+{
+    pointer_map_insert(test_map, &keys[0], &values[0]);
+    pointer_map_insert(test_map, &keys[0], &values[1]);
+    CU_ASSERT_EQUAL(test_map->size, 2);
+
+    // Removing one exact pair leaves the other reachable
+    CU_ASSERT_EQUAL(pointer_map_remove(test_map, &keys[0], &values[0]),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(pointer_map_get(test_map, &keys[0]), &values[1]);
+    CU_ASSERT_EQUAL(pointer_map_remove(test_map, &keys[0], &values[0]),
+                    E_FAILURE);
+
+    CU_ASSERT_EQUAL(pointer_map_remove(test_map, &keys[0], NULL), E_SUCCESS);
+    CU_ASSERT_PTR_NULL(pointer_map_get(test_map, &keys[0]));
+    CU_ASSERT_EQUAL(test_map->size, 0);
+}
+
+void test_pointer_map_invalid(void)
+{
+    CU_ASSERT_PTR_NULL(pointer_map_new(SIZE_MAX));
+    CU_ASSERT_EQUAL(pointer_map_insert(NULL, &keys[0], &values[0]),
+                    E_NULL_POINTER);
+    CU_ASSERT_EQUAL(pointer_map_insert(test_map, NULL, &values[0]),
+                    E_NULL_POINTER);
+    CU_ASSERT_EQUAL(pointer_map_insert(test_map, &keys[0], NULL),
+                    E_NULL_POINTER);
+    CU_ASSERT_PTR_NULL(pointer_map_get(NULL, &keys[0]));
+    CU_ASSERT_EQUAL(pointer_map_remove(test_map, NULL, NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(pointer_map_remove(test_map, &keys[0], NULL), E_FAILURE);
+    CU_ASSERT_EQUAL(pointer_map_clear(NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(pointer_map_delete(NULL), E_NULL_POINTER);
+}
+
+void test_pointer_map_matches_model(void)
+{
+    int    key     = 0;
+    size_t present = 0;
+
+    // Adjacent bytes collide in the low bits, stressing the probe runs
+    for (int round = 0; round < MODEL_ROUNDS; round++)
+    {
+        key = rand() % MODEL_SIZE;
+        if (0 == model[key])
+        {
+            model[key] = 1;
+            present++;
+            CU_ASSERT_EQUAL(
+                pointer_map_insert(test_map, &model_keys[key], &model[key]),
+                E_SUCCESS);
+        }
+        else
+        {
+            model[key] = 0;
+            present--;
+            CU_ASSERT_EQUAL(
+                pointer_map_remove(test_map, &model_keys[key], &model[key]),
+                E_SUCCESS);
+        }
+    }
+
+    CU_ASSERT_EQUAL(test_map->size, present);
+    for (key = 0; key < MODEL_SIZE; key++)
+    {
+        CU_ASSERT_PTR_EQUAL(pointer_map_get(test_map, &model_keys[key]),
+                            (0 == model[key]) ? NULL : &model[key]);
+    }
+}
+
+void test_pointer_map_clear(void)
+{
+    for (int idx = 0; idx < KEY_COUNT; idx++)
+    {
+        pointer_map_insert(test_map, &keys[idx], &values[idx]);
+    }
+
+    CU_ASSERT_EQUAL(pointer_map_clear(test_map), E_SUCCESS);
+    CU_ASSERT_EQUAL(test_map->size, 0);
+    CU_ASSERT_PTR_NULL(pointer_map_get(test_map, &keys[3]));
+    CU_ASSERT_EQUAL(pointer_map_insert(test_map, &keys[3], &values[3]),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(pointer_map_get(test_map, &keys[3]), &values[3]);
+}
+
+static CU_TestInfo pointer_map_tests[] = {
+    { "new", test_pointer_map_new },
+    { "insert_get", test_pointer_map_insert_get },
+    { "duplicates", test_pointer_map_duplicates },
+    { "invalid", test_pointer_map_invalid },
+    { "matches_model", test_pointer_map_matches_model },
+    { "clear", test_pointer_map_clear },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo pointer_map_test_suite = {
+    "pointer_map Tests",
+    NULL,             // Suite initialization function
+    NULL,             // Suite cleanup function
+    setup,            // Suite setup function
+    teardown,         // Suite teardown function
+    pointer_map_tests // The combined array of all tests
+};
+
+/*** end of file ***/
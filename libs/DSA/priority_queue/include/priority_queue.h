@@ -0,0 +1,156 @@
+/**
+ * @file priority_queue.h
+ *
+ * @brief An indexed d-ary min-heap with decrease-key.
+ *
+ * Items are integer IDs in [0, capacity), such as dense node IDs, and each
+ * item is in the queue at most once. Because the heap records where every
+ * item sits, an item's priority can be lowered in O(log n) without pushing a
+ * duplicate entry, which keeps shortest-path searches at one heap entry per
+ * node.
+ *
+ * A wider heap is shallower, so decrease-key moves fewer levels at the cost
+ * of more comparisons per pop. PRIORITY_QUEUE_ARITY defaults to 4.
+ */
+#ifndef _PRIORITY_QUEUE_H
+#define _PRIORITY_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Children per heap node; may be overridden between 2 and 16
+#ifndef PRIORITY_QUEUE_ARITY
+#define PRIORITY_QUEUE_ARITY 4
+#endif
+
+_Static_assert((2 <= PRIORITY_QUEUE_ARITY) && (16 >= PRIORITY_QUEUE_ARITY),
+               "PRIORITY_QUEUE_ARITY must be between 2 and 16");
+
+// Position recorded for items that are not in the queue
+#define PRIORITY_QUEUE_ABSENT UINT32_MAX
+
+/**
+ * @brief structure of a priority queue object
+ *
+ * @param capacity number of item IDs the queue accepts
+ * @param size number of items currently queued
+ * @param heap queued item IDs in heap order
+ * @param position heap slot of each item ID, or PRIORITY_QUEUE_ABSENT
+ * @param priority current priority of each queued item ID
+ */
+typedef struct priority_queue_t
+{
+    uint32_t   capacity;
+    uint32_t   size;
+    uint32_t * heap;
+    uint32_t * position;
+    size_t *   priority;
+} priority_queue_t;
+
+/**
+ * @brief creates a new, empty priority queue
+ *
+ * @param capacity number of item IDs the queue accepts, [0, capacity)
+ * @return pointer to the new queue on success, NULL on failure
+ */
+priority_queue_t * priority_queue_new(uint32_t capacity);
+
+/**
+ * @brief adds an item that is not already queued
+ *
+ * @param queue the queue
+ * @param item the item ID
+ * @param priority the item's priority; smaller pops first
+ * @return 0 on success, non-zero value on failure
+ */
+int priority_queue_push(priority_queue_t * queue,
+                        uint32_t           item,
+                        size_t             priority);
+
+/**
+ * @brief lowers the priority of a queued item
+ *
+ * @param queue the queue
+ * @param item the item ID
+ * @param priority the new priority, no greater than the current one
+ * @return 0 on success, non-zero value on failure
+ */
+int priority_queue_decrease(priority_queue_t * queue,
+                            uint32_t           item,
+                            size_t             priority);
+
+/**
+ * @brief adds an item, or lowers its priority if it is already queued with a
+ * greater one. Does nothing if it is queued with a priority no greater than
+ * 'priority'.
+ *
+ * @param queue the queue
+ * @param item the item ID
+ * @param priority the item's priority
+ * @return 0 on success, non-zero value on failure
+ */
+int priority_queue_update(priority_queue_t * queue,
+                          uint32_t           item,
+                          size_t             priority);
+
+/**
+ * @brief removes the item with the smallest priority
+ *
+ * @param queue the queue
+ * @param item set to the removed item ID
+ * @param priority set to its priority; may be NULL
+ * @return 0 on success, non-zero value if empty or on failure
+ */
+int priority_queue_pop(priority_queue_t * queue,
+                       uint32_t *         item,
+                       size_t *           priority);
+
+/**
+ * @brief reads the item with the smallest priority without removing it
+ *
+ * @param queue the queue
+ * @param item set to the item ID
+ * @param priority set to its priority; may be NULL
+ * @return 0 on success, non-zero value if empty or on failure
+ */
+int priority_queue_peek(const priority_queue_t * queue,
+                        uint32_t *               item,
+                        size_t *                 priority);
+
+/**
+ * @brief checks whether an item is queued
+ *
+ * @param queue the queue
+ * @param item the item ID
+ * @return true if queued, false otherwise
+ */
+bool priority_queue_contains(const priority_queue_t * queue, uint32_t item);
+
+/**
+ * @brief checks if the queue is empty
+ *
+ * @param queue the queue
+ * @return true if empty or NULL, false otherwise
+ */
+bool priority_queue_is_empty(const priority_queue_t * queue);
+
+/**
+ * @brief removes every item in O(size), keeping the capacity
+ *
+ * @param queue the queue
+ * @return 0 on success, non-zero value on failure
+ */
+int priority_queue_clear(priority_queue_t * queue);
+
+/**
+ * @brief deletes a queue
+ *
+ * @param queue_address pointer to the queue pointer
+ * @return 0 on success, non-zero value on failure
+ */
+int priority_queue_delete(priority_queue_t ** queue_address);
+
+#endif /* _PRIORITY_QUEUE_H */
+
+/*** end of file ***/
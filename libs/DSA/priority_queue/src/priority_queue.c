@@ -0,0 +1,340 @@
+#include <stdlib.h>
+
+#include "priority_queue.h"
+#include "utilities.h"
+
+#define ARITY PRIORITY_QUEUE_ARITY
+
+/**
+ * @brief Moves the item in 'slot' towards the root until its parent is no
+ * greater than it
+ */
+static void sift_up(priority_queue_t * queue, uint32_t slot);
+
+/**
+ * @brief Moves the item in 'slot' towards the leaves until no child is
+ * smaller than it
+ */
+static void sift_down(priority_queue_t * queue, uint32_t slot);
+
+/**
+ * @brief Writes 'item' into heap slot 'slot' and records its position
+ */
+static void place(priority_queue_t * queue, uint32_t slot, uint32_t item);
+
+priority_queue_t * priority_queue_new(uint32_t capacity)
+{
+    priority_queue_t * queue = NULL;
+
+    if (PRIORITY_QUEUE_ABSENT == capacity)
+    {
+        PRINT_DEBUG("priority_queue_new(): Capacity too large.\n");
+        goto END;
+    }
+
+    queue = calloc(1, sizeof(priority_queue_t));
+    if (NULL == queue)
+    {
+        PRINT_DEBUG("priority_queue_new(): CMR failure.\n");
+        goto END;
+    }
+
+    // Allocate at least one entry so an empty queue still has valid arrays
+    queue->capacity = capacity;
+    queue->size     = 0;
+    queue->heap     = calloc(capacity + 1, sizeof(uint32_t));
+    queue->position = calloc(capacity + 1, sizeof(uint32_t));
+    queue->priority = calloc(capacity + 1, sizeof(size_t));
+    if ((NULL == queue->heap) || (NULL == queue->position) ||
+        (NULL == queue->priority))
+    {
+        PRINT_DEBUG("priority_queue_new(): CMR failure.\n");
+        priority_queue_delete(&queue);
+        goto END;
+    }
+
+    for (uint32_t item = 0; item < capacity; item++)
+    {
+        queue->position[item] = PRIORITY_QUEUE_ABSENT;
+    }
+
+END:
+    return queue;
+}
+
+int priority_queue_push(priority_queue_t * queue,
+                        uint32_t           item,
+                        size_t             priority)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == queue)
+    {
+        PRINT_DEBUG("priority_queue_push(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if ((item >= queue->capacity) ||
+        (PRIORITY_QUEUE_ABSENT != queue->position[item]))
+    {
+        PRINT_DEBUG("priority_queue_push(): Invalid or duplicate item.\n");
+        goto END;
+    }
+
+    queue->priority[item] = priority;
+    place(queue, queue->size, item);
+    queue->size++;
+    sift_up(queue, queue->size - 1);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int priority_queue_decrease(priority_queue_t * queue,
+                            uint32_t           item,
+                            size_t             priority)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == queue)
+    {
+        PRINT_DEBUG("priority_queue_decrease(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (!priority_queue_contains(queue, item) ||
+        (priority > queue->priority[item]))
+    {
+        PRINT_DEBUG("priority_queue_decrease(): Item absent or priority "
+                    "would increase.\n");
+        goto END;
+    }
+
+    queue->priority[item] = priority;
+    sift_up(queue, queue->position[item]);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int priority_queue_update(priority_queue_t * queue,
+                          uint32_t           item,
+                          size_t             priority)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == queue)
+    {
+        PRINT_DEBUG("priority_queue_update(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (item >= queue->capacity)
+    {
+        PRINT_DEBUG("priority_queue_update(): Item out of range.\n");
+        goto END;
+    }
+
+    if (PRIORITY_QUEUE_ABSENT == queue->position[item])
+    {
+        exit_code = priority_queue_push(queue, item, priority);
+        goto END;
+    }
+
+    if (priority < queue->priority[item])
+    {
+        queue->priority[item] = priority;
+        sift_up(queue, queue->position[item]);
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int priority_queue_pop(priority_queue_t * queue,
+                       uint32_t *         item,
+                       size_t *           priority)
+{
+    int exit_code = E_FAILURE;
+
+    exit_code = priority_queue_peek(queue, item, priority);
+    if (E_SUCCESS != exit_code)
+    {
+        goto END;
+    }
+
+    queue->position[*item] = PRIORITY_QUEUE_ABSENT;
+    queue->size--;
+    if (0 != queue->size)
+    {
+        place(queue, 0, queue->heap[queue->size]);
+        sift_down(queue, 0);
+    }
+
+END:
+    return exit_code;
+}
+
+int priority_queue_peek(const priority_queue_t * queue,
+                        uint32_t *               item,
+                        size_t *                 priority)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == queue) || (NULL == item))
+    {
+        PRINT_DEBUG("priority_queue_peek(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (0 == queue->size)
+    {
+        goto END;
+    }
+
+    *item = queue->heap[0];
+    if (NULL != priority)
+    {
+        *priority = queue->priority[*item];
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool priority_queue_contains(const priority_queue_t * queue, uint32_t item)
+{
+    return (NULL != queue) && (item < queue->capacity) &&
+           (PRIORITY_QUEUE_ABSENT != queue->position[item]);
+}
+
+bool priority_queue_is_empty(const priority_queue_t * queue)
+{
+    return (NULL == queue) || (0 == queue->size);
+}
+
+int priority_queue_clear(priority_queue_t * queue)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == queue)
+    {
+        PRINT_DEBUG("priority_queue_clear(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    for (uint32_t slot = 0; slot < queue->size; slot++)
+    {
+        queue->position[queue->heap[slot]] = PRIORITY_QUEUE_ABSENT;
+    }
+    queue->size = 0;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int priority_queue_delete(priority_queue_t ** queue_address)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == queue_address) || (NULL == *queue_address))
+    {
+        PRINT_DEBUG("priority_queue_delete(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    free((*queue_address)->heap);
+    free((*queue_address)->position);
+    free((*queue_address)->priority);
+    free(*queue_address);
+    *queue_address = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static void sift_up(priority_queue_t * queue, uint32_t slot)
+{
+    uint32_t item     = queue->heap[slot];
+    size_t   priority = queue->priority[item];
+    uint32_t parent   = 0;
+
+    while (0 != slot)
+    {
+        parent = (slot - 1) / ARITY;
+        if (queue->priority[queue->heap[parent]] <= priority)
+        {
+            break;
+        }
+        place(queue, slot, queue->heap[parent]);
+        slot = parent;
+    }
+    place(queue, slot, item);
+}
+
+static void sift_down(priority_queue_t * queue, uint32_t slot)
+{
+    uint32_t item     = queue->heap[slot];
+    size_t   priority = queue->priority[item];
+    size_t   first    = 0;
+    size_t   last     = 0;
+    size_t   smallest = 0;
+
+    for (;;)
+    {
+        // Widened so the child index of a slot near UINT32_MAX cannot wrap
+        first = ((size_t)slot * ARITY) + 1;
+        if (first >= queue->size)
+        {
+            break;
+        }
+
+        last = first + ARITY;
+        if (last > queue->size)
+        {
+            last = queue->size;
+        }
+
+        smallest = first;
+        for (size_t child = first + 1; child < last; child++)
+        {
+            if (queue->priority[queue->heap[child]] <
+                queue->priority[queue->heap[smallest]])
+            {
+                smallest = child;
+            }
+        }
+
+        if (priority <= queue->priority[queue->heap[smallest]])
+        {
+            break;
+        }
+        place(queue, slot, queue->heap[smallest]);
+        slot = (uint32_t)smallest;
+    }
+    place(queue, slot, item);
+}
+
+static void place(priority_queue_t * queue, uint32_t slot, uint32_t item)
+{
+    queue->heap[slot]     = item;
+    queue->position[item] = slot;
+}
+
+/*** end of file ***/
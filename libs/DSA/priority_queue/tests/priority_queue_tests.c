@@ -0,0 +1,203 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "priority_queue.h"
+#include "utilities.h"
+
+#define QUEUE_CAPACITY 16
+#define MODEL_CAPACITY 3000
+
+priority_queue_t * test_queue = NULL;
+
+size_t model[MODEL_CAPACITY];
+
+void setup(void)
+{
+    test_queue = priority_queue_new(QUEUE_CAPACITY);
+}
+
+void teardown(void)
+{
+    if (NULL != test_queue)
+    {
+        priority_queue_delete(&test_queue);
+    }
+}
+
+void test_priority_queue_new(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_queue);
+    CU_ASSERT_EQUAL(test_queue->size, 0);
+    CU_ASSERT_EQUAL(test_queue->capacity, QUEUE_CAPACITY);
+    CU_ASSERT_TRUE(priority_queue_is_empty(test_queue));
+    CU_ASSERT_FALSE(priority_queue_contains(test_queue, 0));
+}
+
+void test_priority_queue_push_pop(void)
+{
+    size_t   priorities[] = { 7, 3, 9, 1, 5, 3 };
+    uint32_t expected[]   = { 3, 1, 5, 4, 0, 2 };
+    uint32_t item         = 0;
+    size_t   priority     = 0;
+
+    for (uint32_t idx = 0; idx < 6; idx++)
+    {
+        CU_ASSERT_EQUAL(priority_queue_push(test_queue, idx, priorities[idx]),
+                        E_SUCCESS);
+    }
+    CU_ASSERT_EQUAL(test_queue->size, 6);
+    CU_ASSERT_TRUE(priority_queue_contains(test_queue, 4));
+
+    CU_ASSERT_EQUAL(priority_queue_peek(test_queue, &item, &priority),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(item, 3);
+    CU_ASSERT_EQUAL(priority, 1);
+
+    for (uint32_t idx = 0; idx < 6; idx++)
+    {
+        CU_ASSERT_EQUAL(priority_queue_pop(test_queue, &item, &priority),
+                        E_SUCCESS);
+        CU_ASSERT_EQUAL(priority, priorities[expected[idx]]);
+        CU_ASSERT_FALSE(priority_queue_contains(test_queue, item));
+    }
+    CU_ASSERT_EQUAL(priority_queue_pop(test_queue, &item, NULL), E_FAILURE);
+}
+
+void test_priority_queue_invalid(void)
+{
+    uint32_t item = 0;
+
+    CU_ASSERT_EQUAL(priority_queue_push(test_queue, QUEUE_CAPACITY, 1),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(priority_queue_push(test_queue, 2, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(priority_queue_push(test_queue, 2, 0), E_FAILURE);
+    CU_ASSERT_EQUAL(priority_queue_decrease(test_queue, 2, 5), E_FAILURE);
+    CU_ASSERT_EQUAL(priority_queue_decrease(test_queue, 3, 0), E_FAILURE);
+    CU_ASSERT_EQUAL(priority_queue_push(NULL, 0, 0), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(priority_queue_pop(test_queue, NULL, NULL),
+                    E_NULL_POINTER);
+    CU_ASSERT_EQUAL(priority_queue_peek(NULL, &item, NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(test_queue->size, 1);
+}
+
+void test_priority_queue_decrease(void)
+{
+    uint32_t item = 0;
+
+    for (uint32_t idx = 0; idx < QUEUE_CAPACITY; idx++)
+    {
+        priority_queue_push(test_queue, idx, 100 + idx);
+    }
+
+    CU_ASSERT_EQUAL(priority_queue_decrease(test_queue, 12, 4), E_SUCCESS);
+    CU_ASSERT_EQUAL(priority_queue_decrease(test_queue, 9, 2), E_SUCCESS);
+    CU_ASSERT_EQUAL(test_queue->size, QUEUE_CAPACITY);
+
+    priority_queue_pop(test_queue, &item, NULL);
+    CU_ASSERT_EQUAL(item, 9);
+    priority_queue_pop(test_queue, &item, NULL);
+    CU_ASSERT_EQUAL(item, 12);
+    priority_queue_pop(test_queue, &item, NULL);
+    CU_ASSERT_EQUAL(item, 0);
+}
+
+void test_priority_queue_update(void)
+{
+    size_t   priority = 0;
+    uint32_t item     = 0;
+
+    CU_ASSERT_EQUAL(priority_queue_update(test_queue, 5, 50), E_SUCCESS);
+    CU_ASSERT_EQUAL(priority_queue_update(test_queue, 5, 80), E_SUCCESS);
+    CU_ASSERT_EQUAL(priority_queue_update(test_queue, 6, 60), E_SUCCESS);
+    CU_ASSERT_EQUAL(priority_queue_update(test_queue, 6, 40), E_SUCCESS);
+    CU_ASSERT_EQUAL(test_queue->size, 2);
+
+    priority_queue_pop(test_queue, &item, &priority);
+    CU_ASSERT_EQUAL(item, 6);
+    CU_ASSERT_EQUAL(priority, 40);
+    priority_queue_pop(test_queue, &item, &priority);
+    CU_ASSERT_EQUAL(item, 5);
+    CU_ASSERT_EQUAL(priority, 50);
+}
+
+void test_priority_queue_matches_model(void)
+{
+    priority_queue_t * queue    = priority_queue_new(MODEL_CAPACITY);
+    uint32_t           item     = 0;
+    size_t             priority = 0;
+    size_t             previous = 0;
+    uint32_t           popped   = 0;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(queue);
+    srand(7);
+
+    for (uint32_t idx = 0; idx < MODEL_CAPACITY; idx++)
+    {
+        model[idx] = (size_t)(rand() % 100000);
+        priority_queue_push(queue, idx, model[idx]);
+    }
+
+    // Lower a random half, some of them more than once
+    for (uint32_t round = 0; round < MODEL_CAPACITY; round++)
+    {
+        item = (uint32_t)(rand() % MODEL_CAPACITY);
+        if (0 != model[item])
+        {
+            model[item] = (size_t)(rand() % model[item]);
+            CU_ASSERT_EQUAL(priority_queue_decrease(queue, item, model[item]),
+                            E_SUCCESS);
+        }
+    }
+
+    while (E_SUCCESS == priority_queue_pop(queue, &item, &priority))
+    {
+        CU_ASSERT_EQUAL(priority, model[item]);
+        CU_ASSERT(previous <= priority);
+        previous = priority;
+        popped++;
+    }
+    CU_ASSERT_EQUAL(popped, MODEL_CAPACITY);
+
+    priority_queue_delete(&queue);
+}
+
+void test_priority_queue_clear(void)
+{
+    for (uint32_t idx = 0; idx < QUEUE_CAPACITY; idx++)
+    {
+        priority_queue_push(test_queue, idx, idx);
+    }
+
+    CU_ASSERT_EQUAL(priority_queue_clear(test_queue), E_SUCCESS);
+    CU_ASSERT_TRUE(priority_queue_is_empty(test_queue));
+    for (uint32_t idx = 0; idx < QUEUE_CAPACITY; idx++)
+    {
+        CU_ASSERT_FALSE(priority_queue_contains(test_queue, idx));
+    }
+    CU_ASSERT_EQUAL(priority_queue_push(test_queue, 3, 3), E_SUCCESS);
+    CU_ASSERT_EQUAL(priority_queue_clear(NULL), E_NULL_POINTER);
+}
+
+static CU_TestInfo priority_queue_tests[] = {
+    { "new", test_priority_queue_new },
+    { "push_pop", test_priority_queue_push_pop },
+    { "invalid", test_priority_queue_invalid },
+    { "decrease", test_priority_queue_decrease },
+    { "update", test_priority_queue_update },
+    { "matches_model", test_priority_queue_matches_model },
+    { "clear", test_priority_queue_clear },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo priority_queue_test_suite = {
+    "priority_queue Tests",
+    NULL,                // Suite initialization function
+    NULL,                // Suite cleanup function
+    setup,               // Suite setup function
+    teardown,            // Suite teardown function
+    priority_queue_tests // The combined array of all tests
+};
+
+/*** end of file ***/
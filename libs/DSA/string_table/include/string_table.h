@@ -0,0 +1,124 @@
+/**
+ * @file string_table.h
+ *
+ * @brief An interned string table with an open-addressing hash index.
+ *
+ * Each distinct string is copied once into an arena of large blocks and is
+ * never moved or freed until the table is deleted, so the returned pointers
+ * stay valid and two equal strings always intern to the same address. Every
+ * string carries a size_t value, which makes the table a cheap map from
+ * names to indices. Lookups and inserts are O(1) expected.
+ *
+ * Strings are never removed; a string is unbound by setting its value back to
+ * STRING_TABLE_NO_VALUE, and binding it again reuses the same copy. Slots are
+ * probed linearly and the index doubles whenever it becomes half full.
+ */
+#ifndef _STRING_TABLE_H
+#define _STRING_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Value of a string that is interned but not bound to anything
+#define STRING_TABLE_NO_VALUE SIZE_MAX
+
+/**
+ * @brief one slot of the index; empty slots have a NULL string
+ *
+ * @param string the interned copy
+ * @param hash hash of the string, kept so probes and resizes skip rehashing
+ * @param value the value bound to the string
+ */
+typedef struct string_table_entry_t
+{
+    const char * string;
+    uint64_t     hash;
+    size_t       value;
+} string_table_entry_t;
+
+/**
+ * @brief one block of the string arena
+ *
+ * @param next the previously filled block
+ * @param used number of bytes handed out
+ * @param size number of bytes in the block
+ * @param bytes the strings
+ */
+typedef struct string_table_block_t
+{
+    struct string_table_block_t * next;
+    size_t                        used;
+    size_t                        size;
+    char                          bytes[];
+} string_table_block_t;
+
+/**
+ * @brief structure of a string table object
+ *
+ * @param capacity number of slots, always a power of two
+ * @param size number of strings interned
+ * @param shift right shift that turns a 64-bit hash into a slot index
+ * @param entries the slots
+ * @param arena the block strings are currently copied into
+ */
+typedef struct string_table_t
+{
+    size_t                 capacity;
+    size_t                 size;
+    uint32_t               shift;
+    string_table_entry_t * entries;
+    string_table_block_t * arena;
+} string_table_t;
+
+/**
+ * @brief creates a new, empty string table
+ *
+ * @param capacity number of strings the table holds before the index first
+ * grows
+ * @return pointer to the new table on success, NULL on failure
+ */
+string_table_t * string_table_new(size_t capacity);
+
+/**
+ * @brief returns the interned copy of a string, adding it if needed
+ *
+ * A newly added string is bound to STRING_TABLE_NO_VALUE.
+ *
+ * @param table the table
+ * @param string the string to intern
+ * @return the interned copy, valid until the table is deleted, or NULL on
+ * failure
+ */
+const char * string_table_intern(string_table_t * table, const char * string);
+
+/**
+ * @brief binds a value to a string, interning the string if needed
+ *
+ * @param table the table
+ * @param string the string
+ * @param value the value, or STRING_TABLE_NO_VALUE to unbind the string
+ * @return 0 on success, non-zero value on failure
+ */
+int string_table_set(string_table_t * table, const char * string, size_t value);
+
+/**
+ * @brief looks up the value bound to a string
+ *
+ * @param table the table
+ * @param string the string
+ * @return the value, or STRING_TABLE_NO_VALUE if the string is not bound
+ */
+size_t string_table_get(const string_table_t * table, const char * string);
+
+/**
+ * @brief deletes a table and every interned string, and sets the caller's
+ * pointer to NULL
+ *
+ * @param table_address pointer to the table pointer
+ * @return 0 on success, non-zero value on failure
+ */
+int string_table_delete(string_table_t ** table_address);
+
+#endif /* _STRING_TABLE_H */
+
+/*** end of file ***/
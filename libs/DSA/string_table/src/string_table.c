@@ -0,0 +1,361 @@
+#include <stdlib.h>
+#include <string.h> // memcpy(), strcmp(), strlen()
+
+#include "string_table.h"
+#include "utilities.h"
+
+// Smallest number of slots a table is created with
+#define MIN_CAPACITY 8
+
+// Bytes in an arena block; longer strings get a block of their own
+#define ARENA_BLOCK_SIZE 4096
+
+// 64-bit FNV-1a parameters
+#define FNV_OFFSET_BASIS UINT64_C(0xCBF29CE484222325)
+#define FNV_PRIME        UINT64_C(0x100000001B3)
+
+// 2^64 divided by the golden ratio; spreads nearby hashes across slots
+#define FIBONACCI_MULTIPLIER UINT64_C(0x9E3779B97F4A7C15)
+
+/**
+ * @brief Hashes a NUL-terminated string and reports its length
+ */
+static uint64_t hash_string(const char * string, size_t * length);
+
+/**
+ * @brief Returns the slot a hash maps to
+ */
+static size_t home_slot(const string_table_t * table, uint64_t hash);
+
+/**
+ * @brief Returns the slot holding 'string', or the empty slot where it would
+ * be added
+ */
+static size_t find_slot(const string_table_t * table,
+                        const char *           string,
+                        uint64_t               hash);
+
+/**
+ * @brief Allocates 'capacity' empty slots and moves every entry into them
+ */
+static int resize(string_table_t * table, size_t capacity);
+
+/**
+ * @brief Copies 'length' bytes of 'string' plus a terminator into the arena
+ */
+static char * arena_copy(string_table_t * table,
+                         const char *     string,
+                         size_t           length);
+
+/**
+ * @brief Returns the slot of 'string', adding it if it is not interned yet
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure
+ */
+static int intern_slot(string_table_t * table,
+                       const char *     string,
+                       size_t *         slot);
+
+string_table_t * string_table_new(size_t capacity)
+{
+    string_table_t * table = NULL;
+    size_t           slots = MIN_CAPACITY;
+
+    if (capacity > (SIZE_MAX / sizeof(string_table_entry_t) / 4))
+    {
+        PRINT_DEBUG("string_table_new(): Capacity too large.\n");
+        goto END;
+    }
+
+    table = calloc(1, sizeof(string_table_t));
+    if (NULL == table)
+    {
+        PRINT_DEBUG("string_table_new(): CMR failure.\n");
+        goto END;
+    }
+
+    // Keep the index at most half full
+    while (slots < (capacity * 2))
+    {
+        slots *= 2;
+    }
+
+    if (E_SUCCESS != resize(table, slots))
+    {
+        PRINT_DEBUG("string_table_new(): CMR failure.\n");
+        free(table);
+        table = NULL;
+        goto END;
+    }
+
+END:
+    return table;
+}
+
+const char * string_table_intern(string_table_t * table, const char * string)
+{
+    const char * interned = NULL;
+    size_t       slot     = 0;
+
+    if ((NULL == table) || (NULL == string))
+    {
+        PRINT_DEBUG("string_table_intern(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (E_SUCCESS != intern_slot(table, string, &slot))
+    {
+        PRINT_DEBUG("string_table_intern(): CMR failure.\n");
+        goto END;
+    }
+
+    interned = table->entries[slot].string;
+END:
+    return interned;
+}
+
+int string_table_set(string_table_t * table, const char * string, size_t value)
+{
+    int    exit_code = E_FAILURE;
+    size_t slot      = 0;
+
+    if ((NULL == table) || (NULL == string))
+    {
+        PRINT_DEBUG("string_table_set(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (E_SUCCESS != intern_slot(table, string, &slot))
+    {
+        PRINT_DEBUG("string_table_set(): CMR failure.\n");
+        goto END;
+    }
+
+    table->entries[slot].value = value;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+size_t string_table_get(const string_table_t * table, const char * string)
+{
+    size_t   value  = STRING_TABLE_NO_VALUE;
+    size_t   slot   = 0;
+    size_t   length = 0;
+    uint64_t hash   = 0;
+
+    if ((NULL == table) || (NULL == string))
+    {
+        goto END;
+    }
+
+    hash = hash_string(string, &length);
+    slot = find_slot(table, string, hash);
+    if (NULL != table->entries[slot].string)
+    {
+        value = table->entries[slot].value;
+    }
+
+END:
+    return value;
+}
+
+int string_table_delete(string_table_t ** table_address)
+{
+    int                    exit_code = E_FAILURE;
+    string_table_block_t * block     = NULL;
+
+    if ((NULL == table_address) || (NULL == *table_address))
+    {
+        PRINT_DEBUG("string_table_delete(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    while (NULL != (*table_address)->arena)
+    {
+        block                   = (*table_address)->arena;
+        (*table_address)->arena = block->next;
+        free(block);
+    }
+
+    free((*table_address)->entries);
+    free(*table_address);
+    *table_address = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static uint64_t hash_string(const char * string, size_t * length)
+{
+    uint64_t hash  = FNV_OFFSET_BASIS;
+    size_t   count = 0;
+
+    for (; '\0' != string[count]; count++)
+    {
+        hash ^= (unsigned char)string[count];
+        hash *= FNV_PRIME;
+    }
+
+    *length = count;
+    return hash;
+}
+
+static size_t home_slot(const string_table_t * table, uint64_t hash)
+{
+    // The high bits of the product are the best mixed
+    return (size_t)((hash * FIBONACCI_MULTIPLIER) >> table->shift);
+}
+
+static size_t find_slot(const string_table_t * table,
+                        const char *           string,
+                        uint64_t               hash)
+{
+    size_t mask = table->capacity - 1;
+    size_t slot = home_slot(table, hash);
+
+    while (NULL != table->entries[slot].string)
+    {
+        if ((hash == table->entries[slot].hash) &&
+            (0 == strcmp(string, table->entries[slot].string)))
+        {
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+static int resize(string_table_t * table, size_t capacity)
+{
+    int                    exit_code   = E_FAILURE;
+    string_table_entry_t * old_entries = table->entries;
+    size_t                 old_count   = table->capacity;
+    size_t                 slot        = 0;
+    uint32_t               shift       = 64;
+
+    table->entries = calloc(capacity, sizeof(string_table_entry_t));
+    if (NULL == table->entries)
+    {
+        table->entries = old_entries;
+        goto END;
+    }
+
+    for (size_t slots = capacity; slots > 1; slots /= 2)
+    {
+        shift--;
+    }
+
+    table->capacity = capacity;
+    table->shift    = shift;
+
+    for (size_t idx = 0; idx < old_count; idx++)
+    {
+        if (NULL == old_entries[idx].string)
+        {
+            continue;
+        }
+
+        slot = home_slot(table, old_entries[idx].hash);
+        while (NULL != table->entries[slot].string)
+        {
+            slot = (slot + 1) & (capacity - 1);
+        }
+        table->entries[slot] = old_entries[idx];
+    }
+    free(old_entries);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static char * arena_copy(string_table_t * table,
+                         const char *     string,
+                         size_t           length)
+{
+    string_table_block_t * block = table->arena;
+    char *                 copy  = NULL;
+    size_t                 size  = ARENA_BLOCK_SIZE;
+
+    if ((NULL == block) || ((block->size - block->used) <= length))
+    {
+        if (length >= (SIZE_MAX - sizeof(string_table_block_t)))
+        {
+            goto END;
+        }
+
+        size  = (length >= ARENA_BLOCK_SIZE) ? (length + 1) : ARENA_BLOCK_SIZE;
+        block = calloc(1, sizeof(string_table_block_t) + size);
+        if (NULL == block)
+        {
+            goto END;
+        }
+
+        block->size  = size;
+        block->next  = table->arena;
+        table->arena = block;
+    }
+
+    copy = &block->bytes[block->used];
+    memcpy(copy, string, length);
+    copy[length] = '\0';
+    block->used += length + 1;
+
+END:
+    return copy;
+}
+
+static int intern_slot(string_table_t * table,
+                       const char *     string,
+                       size_t *         slot)
+{
+    int      exit_code = E_FAILURE;
+    size_t   length    = 0;
+    uint64_t hash      = hash_string(string, &length);
+    char *   copy      = NULL;
+
+    *slot = find_slot(table, string, hash);
+    if (NULL != table->entries[*slot].string)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    if (((table->size + 1) * 2) > table->capacity)
+    {
+        if ((table->capacity >
+             (SIZE_MAX / sizeof(string_table_entry_t) / 2)) ||
+            (E_SUCCESS != resize(table, table->capacity * 2)))
+        {
+            goto END;
+        }
+        *slot = find_slot(table, string, hash);
+    }
+
+    copy = arena_copy(table, string, length);
+    if (NULL == copy)
+    {
+        goto END;
+    }
+
+    table->entries[*slot].string = copy;
+    table->entries[*slot].hash   = hash;
+    table->entries[*slot].value  = STRING_TABLE_NO_VALUE;
+    table->size++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+/*** end of file ***/
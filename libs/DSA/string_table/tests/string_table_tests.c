@@ -0,0 +1,155 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "string_table.h"
+#include "utilities.h"
+
+#define TABLE_CAPACITY 4
+#define STRING_COUNT   2000 // Enough strings to fill several arena blocks
+#define MAX_TEST_KEY   16
+#define LONG_LENGTH    10000
+
+string_table_t * test_table = NULL;
+
+void setup(void)
+{
+    test_table = string_table_new(TABLE_CAPACITY);
+}
+
+void teardown(void)
+{
+    if (NULL != test_table)
+    {
+        string_table_delete(&test_table);
+    }
+}
+
+void test_string_table_new(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_table);
+    CU_ASSERT_EQUAL(test_table->size, 0);
+    CU_ASSERT(test_table->capacity >= (2 * TABLE_CAPACITY));
+    CU_ASSERT_EQUAL(test_table->capacity & (test_table->capacity - 1), 0);
+    CU_ASSERT_EQUAL(string_table_get(test_table, "a"), STRING_TABLE_NO_VALUE);
+    CU_ASSERT_PTR_NULL(string_table_new(SIZE_MAX));
+}
+
+void test_string_table_intern(void)
+{
+    char         buffer[] = "label";
+    const char * first    = NULL;
+    const char * second   = NULL;
+
+    first = string_table_intern(test_table, buffer);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(first);
+    CU_ASSERT_PTR_NOT_EQUAL(first, buffer);
+    CU_ASSERT_STRING_EQUAL(first, "label");
+
+    // The copy does not depend on the caller's buffer
+    buffer[0] = 'x';
+    second    = string_table_intern(test_table, "label");
+    CU_ASSERT_PTR_EQUAL(first, second);
+    CU_ASSERT_EQUAL(test_table->size, 1);
+    CU_ASSERT_EQUAL(string_table_get(test_table, "label"),
+                    STRING_TABLE_NO_VALUE);
+
+    // The empty string is a string like any other
+    CU_ASSERT_PTR_NOT_NULL(string_table_intern(test_table, ""));
+    CU_ASSERT_EQUAL(test_table->size, 2);
+}
+
+void test_string_table_set_get(void)
+{
+    char         key[MAX_TEST_KEY] = { 0 };
+    const char * interned[STRING_COUNT];
+
+    for (int idx = 0; idx < STRING_COUNT; idx++)
+    {
+        snprintf(key, sizeof(key), "key-%d", idx);
+        CU_ASSERT_EQUAL(string_table_set(test_table, key, (size_t)idx),
+                        E_SUCCESS);
+        interned[idx] = string_table_intern(test_table, key);
+    }
+    CU_ASSERT_EQUAL(test_table->size, STRING_COUNT);
+    CU_ASSERT(test_table->capacity >= (2 * STRING_COUNT));
+
+    // Growing the index and the arena moves no strings
+    for (int idx = 0; idx < STRING_COUNT; idx++)
+    {
+        snprintf(key, sizeof(key), "key-%d", idx);
+        CU_ASSERT_EQUAL(string_table_get(test_table, key), (size_t)idx);
+        CU_ASSERT_PTR_EQUAL(string_table_intern(test_table, key),
+                            interned[idx]);
+        CU_ASSERT_STRING_EQUAL(interned[idx], key);
+    }
+    CU_ASSERT_EQUAL(string_table_get(test_table, "key-"),
+                    STRING_TABLE_NO_VALUE);
+
+    // Unbinding keeps the interned copy for the next binding
+    CU_ASSERT_EQUAL(
+        string_table_set(test_table, "key-7", STRING_TABLE_NO_VALUE),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(string_table_get(test_table, "key-7"),
+                    STRING_TABLE_NO_VALUE);
+    CU_ASSERT_EQUAL(string_table_set(test_table, "key-7", 70), E_SUCCESS);
+    CU_ASSERT_EQUAL(string_table_get(test_table, "key-7"), 70);
+    CU_ASSERT_PTR_EQUAL(string_table_intern(test_table, "key-7"), interned[7]);
+    CU_ASSERT_EQUAL(test_table->size, STRING_COUNT);
+}
+
+void test_string_table_long_string(void)
+{
+    char *       long_string = calloc(LONG_LENGTH + 1, sizeof(char));
+    const char * interned    = NULL;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(long_string);
+    memset(long_string, 'z', LONG_LENGTH);
+
+    // Longer than an arena block
+    interned = string_table_intern(test_table, long_string);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(interned);
+    CU_ASSERT_STRING_EQUAL(interned, long_string);
+    CU_ASSERT_PTR_NOT_NULL(string_table_intern(test_table, "short"));
+    CU_ASSERT_PTR_EQUAL(string_table_intern(test_table, long_string),
+                        interned);
+
+    free(long_string);
+}
+
+void test_string_table_invalid(void)
+{
+    string_table_t * table = NULL;
+
+    CU_ASSERT_PTR_NULL(string_table_intern(NULL, "a"));
+    CU_ASSERT_PTR_NULL(string_table_intern(test_table, NULL));
+    CU_ASSERT_NOT_EQUAL(string_table_set(NULL, "a", 1), E_SUCCESS);
+    CU_ASSERT_NOT_EQUAL(string_table_set(test_table, NULL, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(string_table_get(NULL, "a"), STRING_TABLE_NO_VALUE);
+    CU_ASSERT_EQUAL(string_table_get(test_table, NULL),
+                    STRING_TABLE_NO_VALUE);
+    CU_ASSERT_NOT_EQUAL(string_table_delete(NULL), E_SUCCESS);
+    CU_ASSERT_NOT_EQUAL(string_table_delete(&table), E_SUCCESS);
+}
+
+static CU_TestInfo string_table_tests[] = {
+    { "new", test_string_table_new },
+    { "intern", test_string_table_intern },
+    { "set_get", test_string_table_set_get },
+    { "long_string", test_string_table_long_string },
+    { "invalid", test_string_table_invalid },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo string_table_test_suite = {
+    "string_table Tests",
+    NULL,              // Suite initialization function
+    NULL,              // Suite cleanup function
+    setup,             // Suite setup function
+    teardown,          // Suite teardown function
+    string_table_tests // The combined array of all tests
+};
+
+/*** end of file ***/
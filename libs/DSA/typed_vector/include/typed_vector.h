@@ -0,0 +1,646 @@
+/**
+ * @file typed_vector.h
+ *
+ * @brief Macro-generated, type-specialized vectors that store their values
+ * contiguously instead of behind `void *` pointers.
+ *
+ * `vector_t` keeps one pointer per element, so a vector of integers or small
+ * structs needs a heap allocation per element and a pointer chase on every
+ * access. The macros in this file stamp out a vector for a concrete element
+ * type, with every operation generated as a `static inline` function so the
+ * comparator is visible to (and inlined by) the compiler in sort and find.
+ *
+ * Usage:
+ * @code
+ * VECTOR_DEFINE(u32_vec, uint32_t)             // scalar, uses < and ==
+ * VECTOR_DEFINE_CMP(cell_vec, cell_t, cell_cmp) // custom comparator
+ *
+ * u32_vec_t * vec = u32_vec_new(16);
+ * u32_vec_append(vec, 42);
+ * u32_vec_sort(vec);
+ * u32_vec_delete(&vec);
+ * @endcode
+ *
+ * A custom comparator must have the signature
+ * `comp_rtns_t cmp(const type * lhs, const type * rhs)` and should be declared
+ * `static inline` in the same translation unit so it can be inlined.
+ *
+ * The generated API mirrors `vector.h`:
+ * - `name_t * name_new(int initial_capacity)`
+ * - `int      name_append(name_t * vector, type value)`
+ * - `int      name_reserve(name_t * vector, int min_capacity)`
+ * - `int      name_insert(name_t * vector, type value, int index)`
+ * - `bool     name_is_empty(name_t * vector)`
+ * - `int      name_pop(name_t * vector, type * value)`
+ * - `int      name_remove(name_t * vector, int index)`
+ * - `type *   name_get_element(name_t * vector, int index)`
+ * - `int      name_set_element(name_t * vector, type value, int index)`
+ * - `int      name_size(name_t * vector)`
+ * - `int      name_capacity(name_t * vector)`
+ * - `int      name_iterate(name_t * vector, name_action_f action_function)`
+ * - `type *   name_find_first_occurrence(name_t * vector, const type * data)`
+ * - `name_t * name_find_all_occurrences(name_t * vector, const type * data)`
+ * - `int      name_sort(name_t * vector)`
+ * - `int      name_clear(name_t * vector)`
+ * - `void     name_delete(name_t ** vector)`
+ */
+#ifndef _TYPED_VECTOR_H
+#define _TYPED_VECTOR_H
+
+#include <limits.h> // INT_MAX
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h> // memmove()
+
+#include "comparisons.h"
+#include "utilities.h"
+
+// Capacity used when a non-positive initial capacity is requested
+#define TYPED_VECTOR_MIN_CAPACITY 8
+
+// Largest capacity reserve accepts, so append's size + 1 is always an int
+#define TYPED_VECTOR_MAX_CAPACITY (INT_MAX - 1)
+
+// Partitions at or below this size are finished with insertion sort
+#define TYPED_VECTOR_INSERTION_THRESHOLD 16
+
+// Number of elements compared per block during a scan. Each block is compared
+// without an early exit so the compiler can vectorize the inner loop.
+#define TYPED_VECTOR_SCAN_BLOCK 16
+
+// Depth of the explicit partition stack used by sort (2 * log2(INT_MAX))
+#define TYPED_VECTOR_SORT_STACK 64
+
+/**
+ * @brief Generates a three-way comparator for a scalar type using the built-in
+ * `<` and `==` operators.
+ *
+ * @param name Prefix of the generated vector; the comparator is emitted as
+ * `name_compare`.
+ * @param type The scalar element type.
+ */
+#define VECTOR_SCALAR_COMPARE(name, type)                                    \
+    static inline comp_rtns_t name##_compare(const type * lhs,               \
+                                             const type * rhs)               \
+    {                                                                        \
+        return (*lhs == *rhs) ? EQUAL                                        \
+                              : ((*lhs < *rhs) ? LESS_THAN : GREATER_THAN);  \
+    }
+
+/**
+ * @brief Generates a vector of a scalar element type.
+ *
+ * @param name Prefix used for the generated type and functions.
+ * @param type The scalar element type (integers, floats, pointers).
+ */
+#define VECTOR_DEFINE(name, type)     \
+    VECTOR_SCALAR_COMPARE(name, type) \
+    VECTOR_DEFINE_CMP(name, type, name##_compare)
+
+/**
+ * @brief Generates a vector of an arbitrary element type.
+ *
+ * @param name Prefix used for the generated type and functions.
+ * @param type The element type, stored by value.
+ * @param cmp Comparator with the signature
+ * `comp_rtns_t cmp(const type *, const type *)`.
+ */
+#define VECTOR_DEFINE_CMP(name, type, cmp)                                     \
+    typedef void (*name##_action_f)(type *);                                   \
+                                                                               \
+    typedef struct name                                                        \
+    {                                                                          \
+        type * elements;                                                       \
+        int    size;                                                           \
+        int    capacity;                                                       \
+    } name##_t;                                                                \
+                                                                               \
+    static inline name##_t * name##_new(int initial_capacity)                  \
+    {                                                                          \
+        name##_t * new_vector = NULL;                                          \
+                                                                               \
+        if (0 >= initial_capacity)                                             \
+        {                                                                      \
+            initial_capacity = TYPED_VECTOR_MIN_CAPACITY;                      \
+        }                                                                      \
+                                                                               \
+        new_vector = calloc(1, sizeof(name##_t));                              \
+        if (NULL == new_vector)                                                \
+        {                                                                      \
+            PRINT_DEBUG(#name "_new(): CMR failure - new_vector.\n");          \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        new_vector->elements = calloc((size_t)initial_capacity, sizeof(type)); \
+        if (NULL == new_vector->elements)                                      \
+        {                                                                      \
+            PRINT_DEBUG(#name "_new(): CMR failure - elements.\n");            \
+            free(new_vector);                                                  \
+            new_vector = NULL;                                                 \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        new_vector->capacity = initial_capacity;                               \
+        new_vector->size     = 0;                                              \
+                                                                               \
+    END:                                                                       \
+        return new_vector;                                                     \
+    }                                                                          \
+                                                                               \
+    static inline int name##_reserve(name##_t * vector, int min_capacity)      \
+    {                                                                          \
+        int    exit_code    = E_FAILURE;                                       \
+        int    new_capacity = 0;                                               \
+        type * resized      = NULL;                                            \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_reserve(): NULL argument passed.\n");          \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if (min_capacity <= vector->capacity)                                  \
+        {                                                                      \
+            exit_code = E_SUCCESS;                                             \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if ((TYPED_VECTOR_MAX_CAPACITY < min_capacity) ||                      \
+            ((SIZE_MAX / sizeof(type)) < (size_t)min_capacity))                \
+        {                                                                      \
+            PRINT_DEBUG(#name "_reserve(): Capacity too large.\n");            \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        /* Doubling past the limit clamps to exactly what was asked for */     \
+        new_capacity = vector->capacity;                                       \
+        while (new_capacity < min_capacity)                                    \
+        {                                                                      \
+            if ((TYPED_VECTOR_MAX_CAPACITY / 2) < new_capacity)                \
+            {                                                                  \
+                new_capacity = min_capacity;                                   \
+                break;                                                         \
+            }                                                                  \
+            new_capacity *= 2;                                                 \
+        }                                                                      \
+                                                                               \
+        resized = realloc(vector->elements,                                    \
+                          (size_t)new_capacity * sizeof(type));                \
+        if (NULL == resized)                                                   \
+        {                                                                      \
+            PRINT_DEBUG(#name "_reserve(): Failed to reallocate.\n");          \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        vector->elements = resized;                                            \
+        vector->capacity = new_capacity;                                       \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline int name##_insert(name##_t * vector, type value, int index)  \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_insert(): NULL argument passed.\n");           \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if ((0 > index) || (index > vector->size))                             \
+        {                                                                      \
+            PRINT_DEBUG(#name "_insert(): Position out of bounds.\n");         \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        exit_code = name##_reserve(vector, vector->size + 1);                  \
+        if (E_SUCCESS != exit_code)                                            \
+        {                                                                      \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        memmove(&vector->elements[index + 1],                                  \
+                &vector->elements[index],                                      \
+                (size_t)(vector->size - index) * sizeof(type));                \
+        vector->elements[index] = value;                                       \
+        vector->size++;                                                        \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline int name##_append(name##_t * vector, type value)             \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_append(): NULL argument passed.\n");           \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        exit_code = name##_reserve(vector, vector->size + 1);                  \
+        if (E_SUCCESS != exit_code)                                            \
+        {                                                                      \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        vector->elements[vector->size++] = value;                              \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline bool name##_is_empty(name##_t * vector)                      \
+    {                                                                          \
+        return (NULL == vector) || (0 == vector->size);                        \
+    }                                                                          \
+                                                                               \
+    static inline int name##_pop(name##_t * vector, type * value)              \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+                                                                               \
+        if ((NULL == vector) || (NULL == value))                               \
+        {                                                                      \
+            PRINT_DEBUG(#name "_pop(): NULL argument passed.\n");              \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if (0 == vector->size)                                                 \
+        {                                                                      \
+            PRINT_DEBUG(#name "_pop(): Empty vector.\n");                      \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        *value = vector->elements[--vector->size];                             \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline int name##_remove(name##_t * vector, int index)              \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_remove(): NULL argument passed.\n");           \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if ((0 > index) || (index >= vector->size))                            \
+        {                                                                      \
+            PRINT_DEBUG(#name "_remove(): Index out of bounds.\n");            \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        memmove(&vector->elements[index],                                      \
+                &vector->elements[index + 1],                                  \
+                (size_t)(vector->size - index - 1) * sizeof(type));            \
+        vector->size--;                                                        \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline type * name##_get_element(name##_t * vector, int index)      \
+    {                                                                          \
+        type * element = NULL;                                                 \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_get_element(): NULL argument passed.\n");      \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if ((0 > index) || (index >= vector->size))                            \
+        {                                                                      \
+            PRINT_DEBUG(#name "_get_element(): Index out of bounds.\n");       \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        element = &vector->elements[index];                                    \
+    END:                                                                       \
+        return element;                                                        \
+    }                                                                          \
+                                                                               \
+    static inline int name##_set_element(                                      \
+        name##_t * vector, type value, int index)                              \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_set_element(): NULL argument passed.\n");      \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if ((0 > index) || (index >= vector->size))                            \
+        {                                                                      \
+            PRINT_DEBUG(#name "_set_element(): Index out of bounds.\n");       \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        vector->elements[index] = value;                                       \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline int name##_size(name##_t * vector)                           \
+    {                                                                          \
+        return (NULL == vector) ? -1 : vector->size;                           \
+    }                                                                          \
+                                                                               \
+    static inline int name##_capacity(name##_t * vector)                       \
+    {                                                                          \
+        return (NULL == vector) ? -1 : vector->capacity;                       \
+    }                                                                          \
+                                                                               \
+    static inline int name##_iterate(name##_t *     vector,                    \
+                                     name##_action_f action_function)          \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+                                                                               \
+        if ((NULL == vector) || (NULL == action_function))                     \
+        {                                                                      \
+            PRINT_DEBUG(#name "_iterate(): NULL argument passed.\n");          \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        for (int idx = 0; idx < vector->size; idx++)                           \
+        {                                                                      \
+            action_function(&vector->elements[idx]);                           \
+        }                                                                      \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    /* Returns the index of the first match at or after 'start', or -1 */     \
+    static inline int name##_scan(                                             \
+        const name##_t * vector, const type * search_data, int start)          \
+    {                                                                          \
+        const type * elements = vector->elements;                              \
+        int          idx      = start;                                         \
+        int          hits     = 0;                                             \
+                                                                               \
+        /* Compare whole blocks branch-free until one contains a match */      \
+        for (; (idx + TYPED_VECTOR_SCAN_BLOCK) <= vector->size;                \
+             idx += TYPED_VECTOR_SCAN_BLOCK)                                   \
+        {                                                                      \
+            hits = 0;                                                          \
+            for (int lane = 0; lane < TYPED_VECTOR_SCAN_BLOCK; lane++)         \
+            {                                                                  \
+                hits |= (EQUAL == cmp(&elements[idx + lane], search_data));    \
+            }                                                                  \
+                                                                               \
+            if (0 != hits)                                                     \
+            {                                                                  \
+                break;                                                         \
+            }                                                                  \
+        }                                                                      \
+                                                                               \
+        for (; idx < vector->size; idx++)                                      \
+        {                                                                      \
+            if (EQUAL == cmp(&elements[idx], search_data))                     \
+            {                                                                  \
+                return idx;                                                    \
+            }                                                                  \
+        }                                                                      \
+                                                                               \
+        return -1;                                                             \
+    }                                                                          \
+                                                                               \
+    static inline type * name##_find_first_occurrence(                         \
+        name##_t * vector, const type * search_data)                           \
+    {                                                                          \
+        type * found_element = NULL;                                           \
+        int    index         = -1;                                             \
+                                                                               \
+        if ((NULL == vector) || (NULL == search_data))                         \
+        {                                                                      \
+            PRINT_DEBUG(#name                                                  \
+                        "_find_first_occurrence(): NULL argument passed.\n");  \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        index = name##_scan(vector, search_data, 0);                           \
+        if (0 <= index)                                                        \
+        {                                                                      \
+            found_element = &vector->elements[index];                          \
+        }                                                                      \
+                                                                               \
+    END:                                                                       \
+        return found_element;                                                  \
+    }                                                                          \
+                                                                               \
+    static inline void name##_delete(name##_t ** vector)                       \
+    {                                                                          \
+        if ((NULL == vector) || (NULL == *vector))                             \
+        {                                                                      \
+            PRINT_DEBUG(#name "_delete(): NULL argument passed.\n");           \
+            return;                                                            \
+        }                                                                      \
+                                                                               \
+        free((*vector)->elements);                                             \
+        (*vector)->elements = NULL;                                            \
+        free(*vector);                                                         \
+        *vector = NULL;                                                        \
+    }                                                                          \
+                                                                               \
+    static inline name##_t * name##_find_all_occurrences(                      \
+        name##_t * vector, const type * search_data)                           \
+    {                                                                          \
+        name##_t * result_vector = NULL;                                       \
+        int        index         = -1;                                         \
+                                                                               \
+        if ((NULL == vector) || (NULL == search_data))                         \
+        {                                                                      \
+            PRINT_DEBUG(#name                                                  \
+                        "_find_all_occurrences(): NULL argument passed.\n");   \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        index = name##_scan(vector, search_data, 0);                           \
+        if (0 > index)                                                         \
+        {                                                                      \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        result_vector = name##_new(TYPED_VECTOR_MIN_CAPACITY);                 \
+        if (NULL == result_vector)                                             \
+        {                                                                      \
+            PRINT_DEBUG(#name "_find_all_occurrences(): Unable to create "     \
+                              "result vector.\n");                             \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        while (0 <= index)                                                     \
+        {                                                                      \
+            if (E_SUCCESS !=                                                   \
+                name##_append(result_vector, vector->elements[index]))         \
+            {                                                                  \
+                PRINT_DEBUG(#name "_find_all_occurrences(): Unable to "        \
+                                  "append element.\n");                        \
+                name##_delete(&result_vector);                                 \
+                goto END;                                                      \
+            }                                                                  \
+                                                                               \
+            index = name##_scan(vector, search_data, index + 1);               \
+        }                                                                      \
+                                                                               \
+    END:                                                                       \
+        return result_vector;                                                  \
+    }                                                                          \
+                                                                               \
+    static inline void name##_swap(type * elements, int first, int second)     \
+    {                                                                          \
+        type temp        = elements[first];                                    \
+        elements[first]  = elements[second];                                   \
+        elements[second] = temp;                                               \
+    }                                                                          \
+                                                                               \
+    static inline void name##_insertion_sort(                                  \
+        type * elements, int low, int high)                                    \
+    {                                                                          \
+        for (int idx = low + 1; idx <= high; idx++)                            \
+        {                                                                      \
+            type key = elements[idx];                                          \
+            int  pos = idx - 1;                                                \
+                                                                               \
+            while ((pos >= low) && (LESS_THAN == cmp(&key, &elements[pos])))   \
+            {                                                                  \
+                elements[pos + 1] = elements[pos];                             \
+                pos--;                                                         \
+            }                                                                  \
+            elements[pos + 1] = key;                                           \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    /* Hoare partition around a median-of-three pivot */                      \
+    static inline int name##_partition(type * elements, int low, int high)     \
+    {                                                                          \
+        int  mid   = low + ((high - low) / 2);                                 \
+        int  left  = low - 1;                                                  \
+        int  right = high + 1;                                                 \
+        type pivot;                                                            \
+                                                                               \
+        if (LESS_THAN == cmp(&elements[mid], &elements[low]))                  \
+        {                                                                      \
+            name##_swap(elements, low, mid);                                   \
+        }                                                                      \
+        if (LESS_THAN == cmp(&elements[high], &elements[low]))                 \
+        {                                                                      \
+            name##_swap(elements, low, high);                                  \
+        }                                                                      \
+        if (LESS_THAN == cmp(&elements[high], &elements[mid]))                 \
+        {                                                                      \
+            name##_swap(elements, mid, high);                                  \
+        }                                                                      \
+        pivot = elements[mid];                                                 \
+                                                                               \
+        for (;;)                                                               \
+        {                                                                      \
+            do                                                                 \
+            {                                                                  \
+                left++;                                                        \
+            } while (LESS_THAN == cmp(&elements[left], &pivot));               \
+                                                                               \
+            do                                                                 \
+            {                                                                  \
+                right--;                                                       \
+            } while (GREATER_THAN == cmp(&elements[right], &pivot));           \
+                                                                               \
+            if (left >= right)                                                 \
+            {                                                                  \
+                return right;                                                  \
+            }                                                                  \
+                                                                               \
+            name##_swap(elements, left, right);                                \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    static inline int name##_sort(name##_t * vector)                           \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+        int stack[TYPED_VECTOR_SORT_STACK * 2];                                \
+        int top   = 0;                                                         \
+        int low   = 0;                                                         \
+        int high  = 0;                                                         \
+        int split = 0;                                                         \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_sort(): NULL argument passed.\n");             \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        if (1 < vector->size)                                                  \
+        {                                                                      \
+            stack[top++] = 0;                                                  \
+            stack[top++] = vector->size - 1;                                   \
+        }                                                                      \
+                                                                               \
+        /* Recurse into the smaller side first to bound the stack depth */     \
+        while (0 < top)                                                        \
+        {                                                                      \
+            high = stack[--top];                                               \
+            low  = stack[--top];                                               \
+                                                                               \
+            while ((high - low) >= TYPED_VECTOR_INSERTION_THRESHOLD)           \
+            {                                                                  \
+                split = name##_partition(vector->elements, low, high);         \
+                if ((split - low) < (high - split))                            \
+                {                                                              \
+                    stack[top++] = split + 1;                                  \
+                    stack[top++] = high;                                       \
+                    high         = split;                                      \
+                }                                                              \
+                else                                                           \
+                {                                                              \
+                    stack[top++] = low;                                        \
+                    stack[top++] = split;                                      \
+                    low          = split + 1;                                  \
+                }                                                              \
+            }                                                                  \
+                                                                               \
+            name##_insertion_sort(vector->elements, low, high);                \
+        }                                                                      \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }                                                                          \
+                                                                               \
+    static inline int name##_clear(name##_t * vector)                          \
+    {                                                                          \
+        int exit_code = E_FAILURE;                                             \
+                                                                               \
+        if (NULL == vector)                                                    \
+        {                                                                      \
+            PRINT_DEBUG(#name "_clear(): NULL argument passed.\n");            \
+            goto END;                                                          \
+        }                                                                      \
+                                                                               \
+        vector->size = 0;                                                      \
+                                                                               \
+        exit_code = E_SUCCESS;                                                 \
+    END:                                                                       \
+        return exit_code;                                                      \
+    }
+
+#endif /* _TYPED_VECTOR_H */
+
+/*** end of file ***/
@@ -0,0 +1,235 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "typed_vector.h"
+#include "utilities.h"
+
+#define DATA_ARR_LENGTH 10
+#define LARGE_LENGTH    5000
+
+typedef struct
+{
+    int row;
+    int col;
+} point_t;
+
+static inline comp_rtns_t point_compare(const point_t * lhs,
+                                        const point_t * rhs)
+{
+    if (lhs->row != rhs->row)
+    {
+        return (lhs->row < rhs->row) ? LESS_THAN : GREATER_THAN;
+    }
+
+    if (lhs->col != rhs->col)
+    {
+        return (lhs->col < rhs->col) ? LESS_THAN : GREATER_THAN;
+    }
+
+    return EQUAL;
+}
+
+VECTOR_DEFINE(u32_vec, uint32_t)
+VECTOR_DEFINE_CMP(point_vec, point_t, point_compare)
+
+u32_vec_t * test_vector = NULL;
+
+uint32_t data[DATA_ARR_LENGTH] = { 44, 51, 77, 14, 68, 41, 46, 18, 72, 53 };
+
+void increment_action(uint32_t * value)
+{
+    (*value)++;
+}
+
+void setup(void)
+{
+    test_vector = u32_vec_new(4);
+}
+
+void teardown(void)
+{
+    if (NULL != test_vector)
+    {
+        u32_vec_delete(&test_vector);
+    }
+}
+
+void test_typed_vector_new(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_vector);
+    CU_ASSERT_EQUAL(u32_vec_size(test_vector), 0);
+    CU_ASSERT_EQUAL(u32_vec_capacity(test_vector), 4);
+    CU_ASSERT_TRUE(u32_vec_is_empty(test_vector));
+}
+
+void test_typed_vector_append_grows(void)
+{
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        CU_ASSERT_EQUAL(u32_vec_append(test_vector, data[idx]), E_SUCCESS);
+    }
+
+    CU_ASSERT_EQUAL(u32_vec_size(test_vector), DATA_ARR_LENGTH);
+    CU_ASSERT_TRUE(u32_vec_capacity(test_vector) >= DATA_ARR_LENGTH);
+
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        CU_ASSERT_EQUAL(*u32_vec_get_element(test_vector, idx), data[idx]);
+    }
+}
+
+void test_typed_vector_reserve(void)
+{
+    CU_ASSERT_EQUAL(u32_vec_reserve(test_vector, 100), E_SUCCESS);
+    CU_ASSERT_TRUE(u32_vec_capacity(test_vector) >= 100);
+    CU_ASSERT_EQUAL(u32_vec_reserve(test_vector, 2), E_SUCCESS);
+    CU_ASSERT_TRUE(u32_vec_capacity(test_vector) >= 100);
+
+    // Too large to double towards or to leave room for one more append
+    CU_ASSERT_EQUAL(u32_vec_reserve(test_vector, INT_MAX), E_FAILURE);
+    CU_ASSERT_TRUE(u32_vec_capacity(test_vector) < INT_MAX);
+    CU_ASSERT_EQUAL(u32_vec_reserve(NULL, 1), E_FAILURE);
+}
+
+void test_typed_vector_insert_remove(void)
+{
+    uint32_t value = 0;
+
+    CU_ASSERT_EQUAL(u32_vec_append(test_vector, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(u32_vec_append(test_vector, 3), E_SUCCESS);
+    CU_ASSERT_EQUAL(u32_vec_insert(test_vector, 2, 1), E_SUCCESS);
+    CU_ASSERT_EQUAL(u32_vec_insert(test_vector, 9, 5), E_FAILURE);
+
+    CU_ASSERT_EQUAL(*u32_vec_get_element(test_vector, 0), 1);
+    CU_ASSERT_EQUAL(*u32_vec_get_element(test_vector, 1), 2);
+    CU_ASSERT_EQUAL(*u32_vec_get_element(test_vector, 2), 3);
+
+    CU_ASSERT_EQUAL(u32_vec_remove(test_vector, 0), E_SUCCESS);
+    CU_ASSERT_EQUAL(u32_vec_remove(test_vector, 2), E_FAILURE);
+    CU_ASSERT_EQUAL(u32_vec_pop(test_vector, &value), E_SUCCESS);
+    CU_ASSERT_EQUAL(value, 3);
+    CU_ASSERT_EQUAL(u32_vec_size(test_vector), 1);
+    CU_ASSERT_PTR_NULL(u32_vec_get_element(test_vector, 1));
+}
+
+void test_typed_vector_set_and_iterate(void)
+{
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        u32_vec_append(test_vector, data[idx]);
+    }
+
+    CU_ASSERT_EQUAL(u32_vec_set_element(test_vector, 100, 0), E_SUCCESS);
+    CU_ASSERT_EQUAL(u32_vec_iterate(test_vector, increment_action), E_SUCCESS);
+    CU_ASSERT_EQUAL(*u32_vec_get_element(test_vector, 0), 101);
+    CU_ASSERT_EQUAL(*u32_vec_get_element(test_vector, 1), data[1] + 1);
+}
+
+void test_typed_vector_find(void)
+{
+    uint32_t     search = 7;
+    uint32_t     absent = 8;
+    u32_vec_t *  found  = NULL;
+    const size_t stride = 37;
+
+    // Place matches both inside full scan blocks and in the tail
+    for (uint32_t idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        u32_vec_append(test_vector, (0 == (idx % stride)) ? search : idx + 10);
+    }
+
+    CU_ASSERT_PTR_EQUAL(u32_vec_find_first_occurrence(test_vector, &search),
+                        u32_vec_get_element(test_vector, 0));
+    CU_ASSERT_PTR_NULL(u32_vec_find_first_occurrence(test_vector, &absent));
+
+    found = u32_vec_find_all_occurrences(test_vector, &search);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(found);
+    CU_ASSERT_EQUAL(u32_vec_size(found), (LARGE_LENGTH + stride - 1) / stride);
+    u32_vec_delete(&found);
+
+    CU_ASSERT_PTR_NULL(u32_vec_find_all_occurrences(test_vector, &absent));
+}
+
+void test_typed_vector_sort(void)
+{
+    srand(1);
+    for (int idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        u32_vec_append(test_vector, (uint32_t)(rand() % 100));
+    }
+
+    CU_ASSERT_EQUAL(u32_vec_sort(test_vector), E_SUCCESS);
+
+    for (int idx = 1; idx < LARGE_LENGTH; idx++)
+    {
+        CU_ASSERT_FATAL(test_vector->elements[idx - 1] <=
+                        test_vector->elements[idx]);
+    }
+}
+
+void test_typed_vector_sort_struct(void)
+{
+    point_vec_t * points = point_vec_new(0);
+    point_t       point  = { 0, 0 };
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(points);
+
+    for (int idx = 0; idx < DATA_ARR_LENGTH * 10; idx++)
+    {
+        point.row = (int)data[idx % DATA_ARR_LENGTH] % 3;
+        point.col = DATA_ARR_LENGTH * 10 - idx;
+        point_vec_append(points, point);
+    }
+
+    CU_ASSERT_EQUAL(point_vec_sort(points), E_SUCCESS);
+
+    for (int idx = 1; idx < point_vec_size(points); idx++)
+    {
+        CU_ASSERT_NOT_EQUAL(
+            point_compare(&points->elements[idx - 1], &points->elements[idx]),
+            GREATER_THAN);
+    }
+
+    point_vec_delete(&points);
+    CU_ASSERT_PTR_NULL(points);
+}
+
+void test_typed_vector_clear(void)
+{
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        u32_vec_append(test_vector, data[idx]);
+    }
+
+    CU_ASSERT_EQUAL(u32_vec_clear(test_vector), E_SUCCESS);
+    CU_ASSERT_TRUE(u32_vec_is_empty(test_vector));
+    CU_ASSERT_EQUAL(u32_vec_clear(NULL), E_FAILURE);
+}
+
+static CU_TestInfo typed_vector_tests[] = {
+    { "typed_vector_new", test_typed_vector_new },
+    { "typed_vector_append_grows", test_typed_vector_append_grows },
+    { "typed_vector_reserve", test_typed_vector_reserve },
+    { "typed_vector_insert_remove", test_typed_vector_insert_remove },
+    { "typed_vector_set_and_iterate", test_typed_vector_set_and_iterate },
+    { "typed_vector_find", test_typed_vector_find },
+    { "typed_vector_sort", test_typed_vector_sort },
+    { "typed_vector_sort_struct", test_typed_vector_sort_struct },
+    { "typed_vector_clear", test_typed_vector_clear },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo typed_vector_test_suite = {
+    "Typed Vector Tests",
+    NULL,              // Suite initialization function
+    NULL,              // Suite cleanup function
+    setup,             // Suite setup function
+    teardown,          // Suite teardown function
+    typed_vector_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -0,0 +1,194 @@
+/**
+ * @file unrolled_list_bench.c
+ *
+ * @brief Compares traversal and search throughput of `unrolled_list_t`
+ * against `list_t`.
+ *
+ * Usage: unrolled_list_bench [element_count] [repetitions]
+ *
+ * Both lists are filled with the same ints. Elements are pushed alternately
+ * to the head and tail so list_t nodes are not laid out in address order,
+ * which is closer to a long-lived list than a freshly appended one.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "comparisons.h"
+#include "linked_list.h"
+#include "unrolled_list.h"
+#include "utilities.h"
+
+#define DEFAULT_COUNT       1000000
+#define DEFAULT_REPETITIONS 10
+#define NANOSECONDS         1000000000.0
+
+// Accumulated by the traversal action so the walk cannot be optimized out
+static volatile long long checksum = 0;
+
+/**
+ * @brief Adds an element to the checksum
+ */
+static void sum_action(void * data);
+
+/**
+ * @brief Free function for data owned by the benchmark
+ */
+static void no_free(void * data);
+
+/**
+ * @brief Monotonic time in seconds
+ */
+static double now(void);
+
+/**
+ * @brief Prints one result line
+ */
+static void report(const char * label,
+                   double       seconds,
+                   size_t       elements,
+                   int          repetitions);
+
+int main(int argc, char ** argv)
+{
+    int               exit_code   = E_FAILURE;
+    size_t            count       = DEFAULT_COUNT;
+    int               repetitions = DEFAULT_REPETITIONS;
+    int *             values      = NULL;
+    list_t *          list        = NULL;
+    unrolled_list_t * unrolled    = NULL;
+    int               missing     = -1;
+    double            start       = 0.0;
+    double            elapsed     = 0.0;
+
+    if (1 < argc)
+    {
+        count = strtoul(argv[1], NULL, 10);
+    }
+    if (2 < argc)
+    {
+        repetitions = atoi(argv[2]);
+    }
+
+    if ((0 == count) || (0 >= repetitions))
+    {
+        fprintf(stderr, "usage: %s [element_count] [repetitions]\n", argv[0]);
+        goto END;
+    }
+
+    values   = calloc(count, sizeof(int));
+    list     = list_new(no_free, int_comp);
+    unrolled = unrolled_list_new(no_free, int_comp);
+    if ((NULL == values) || (NULL == list) || (NULL == unrolled))
+    {
+        PRINT_DEBUG("main(): CMR failure.\n");
+        goto END;
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        values[idx] = (int)idx;
+        if (0 == (idx % 2))
+        {
+            list_push_tail(list, &values[idx]);
+            unrolled_list_push_tail(unrolled, &values[idx]);
+        }
+        else
+        {
+            list_push_head(list, &values[idx]);
+            unrolled_list_push_head(unrolled, &values[idx]);
+        }
+    }
+
+    printf("%zu elements, %d repetitions, %d pointers per chunk\n",
+           count,
+           repetitions,
+           UNROLLED_LIST_CHUNK_CAPACITY);
+
+    start = now();
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        list_foreach_call(list, sum_action);
+    }
+    elapsed = now() - start;
+    report("list_t foreach", elapsed, count, repetitions);
+
+    start = now();
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        unrolled_list_foreach_call(unrolled, sum_action);
+    }
+    elapsed = now() - start;
+    report("unrolled_list_t foreach", elapsed, count, repetitions);
+
+    // A missing key forces a full scan
+    start = now();
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        checksum += (NULL != list_find_first_occurrence(list, &missing));
+    }
+    elapsed = now() - start;
+    report("list_t find (miss)", elapsed, count, repetitions);
+
+    start = now();
+    for (int rep = 0; rep < repetitions; rep++)
+    {
+        checksum +=
+            (NULL != unrolled_list_find_first_occurrence(unrolled, &missing));
+    }
+    elapsed = now() - start;
+    report("unrolled_list_t find (miss)", elapsed, count, repetitions);
+
+    printf("checksum %lld\n", (long long)checksum);
+
+    exit_code = E_SUCCESS;
+END:
+    if (NULL != unrolled)
+    {
+        unrolled_list_delete(&unrolled);
+    }
+    if (NULL != list)
+    {
+        list_delete(&list);
+    }
+    free(values);
+    return (E_SUCCESS == exit_code) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static void sum_action(void * data)
+{
+    checksum += *(int *)data;
+}
+
+static void no_free(void * data)
+{
+    (void)data;
+}
+
+static double now(void)
+{
+    struct timespec time_now = { 0 };
+
+    clock_gettime(CLOCK_MONOTONIC, &time_now);
+    return (double)time_now.tv_sec + ((double)time_now.tv_nsec / NANOSECONDS);
+}
+
+static void report(const char * label,
+                   double       seconds,
+                   size_t       elements,
+                   int          repetitions)
+{
+    double total = (double)elements * (double)repetitions;
+
+    printf("%-30s %10.3f ms %10.2f M elements/s %8.2f ns/element\n",
+           label,
+           seconds * 1000.0,
+           (total / seconds) / 1000000.0,
+           (seconds * NANOSECONDS) / total);
+}
+
+/*** end of file ***/
@@ -0,0 +1,281 @@
+/**
+ * @file unrolled_list.h
+ *
+ * @brief A doubly-linked list that stores a block of element pointers per
+ * node.
+ *
+ * `list_t` allocates one node per element, so walking it touches a new cache
+ * line on nearly every hop. `unrolled_list_t` packs up to
+ * UNROLLED_LIST_CHUNK_CAPACITY element pointers into each chunk, so traversal
+ * and search read mostly contiguous memory and allocate once per chunk.
+ * Pushing and popping at either end is O(1); positional operations walk the
+ * chunks rather than the elements.
+ *
+ * The API mirrors linked_list.h function for function (`list_X` becomes
+ * `unrolled_list_X`), except that `unrolled_list_find_first_occurrence`
+ * returns the matching data rather than a node, and
+ * `unrolled_list_pop_position` does not free the data it returns.
+ */
+#ifndef _UNROLLED_LIST_H
+#define _UNROLLED_LIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "callback_types.h"
+
+// Element pointers stored per chunk. Fixed, since it sets the size of
+// unrolled_chunk_t and every caller must agree on the layout
+#define UNROLLED_LIST_CHUNK_CAPACITY 32
+
+/**
+ * @brief structure of an unrolled list chunk
+ *
+ * @param prev pointer to the chunk before it
+ * @param next pointer to the chunk after it
+ * @param start index of the first occupied slot in 'items'
+ * @param count number of occupied slots, which are contiguous from 'start'
+ * @param items the element pointers
+ */
+typedef struct unrolled_chunk_t
+{
+    struct unrolled_chunk_t * prev;
+    struct unrolled_chunk_t * next;
+    uint32_t                  start;
+    uint32_t                  count;
+    void *                    items[UNROLLED_LIST_CHUNK_CAPACITY];
+} unrolled_chunk_t;
+
+/**
+ * @brief structure of an unrolled list object
+ *
+ * @param size is the number of elements the list is currently storing
+ * @param chunk_count is the number of chunks currently allocated
+ * @param head pointer to the first chunk
+ * @param tail pointer to the last chunk
+ * @param custom_free pointer to the user defined free function
+ * @param compare_func pointer to the user defined compare function
+ */
+typedef struct unrolled_list_t
+{
+    uint32_t           size;
+    uint32_t           chunk_count;
+    unrolled_chunk_t * head;
+    unrolled_chunk_t * tail;
+    FREE_F             custom_free;
+    CMP_F              compare_func;
+} unrolled_list_t;
+
+/**
+ * @brief A pointer to a user-defined function that gets called in the
+ *        foreach_call on each item in the list.
+ */
+typedef void (*ACT_F)(void *);
+
+/**
+ * @brief creates a new unrolled list
+ *
+ * @param free_func pointer to the free function to be used with that list
+ * @param comp_func pointer to the compare function to be used with that list
+ * @returns pointer to allocated list on success or NULL on failure
+ */
+unrolled_list_t * unrolled_list_new(FREE_F free_func, CMP_F comp_func);
+
+/**
+ * @brief pushes data onto the head of the list in O(1)
+ *
+ * @param list list to push the data into
+ * @param data data to be pushed
+ * @returns 0 on success, non-zero value on failure
+ */
+int unrolled_list_push_head(unrolled_list_t * list, void * data);
+
+/**
+ * @brief pushes data onto the tail of the list in O(1)
+ *
+ * @param list list to push the data into
+ * @param data data to be pushed
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_push_tail(unrolled_list_t * list, void * data);
+
+/**
+ * @brief inserts data so that it ends up at 'position'
+ *
+ * @param list list to push the data into
+ * @param data data to be pushed
+ * @param position the position in which to insert the data (0 to size)
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_push_position(unrolled_list_t * list,
+                                void *            data,
+                                uint32_t          position);
+
+/**
+ * @brief checks if the list object is empty
+ *
+ * @param list pointer to list object to be checked
+ * @returns 0 if list is empty, non-zero value if not empty or on failure
+ */
+int unrolled_list_is_empty(unrolled_list_t * list);
+
+/**
+ * @brief pops the data at the head of the list in O(1)
+ *
+ * @param list list to pop the data out of
+ * @return pointer to popped data on success, NULL on failure
+ */
+void * unrolled_list_pop_head(unrolled_list_t * list);
+
+/**
+ * @brief pops the data at the tail of the list in O(1)
+ *
+ * @param list list to pop the data out of
+ * @return pointer to popped data on success, NULL on failure
+ */
+void * unrolled_list_pop_tail(unrolled_list_t * list);
+
+/**
+ * @brief pops the data at a specific position
+ *
+ * @param list list to pop the data out of
+ * @param position position of the data
+ * @return pointer to popped data on success, NULL on failure
+ */
+void * unrolled_list_pop_position(unrolled_list_t * list, uint32_t position);
+
+/**
+ * @brief removes and frees the data at the head of the list
+ *
+ * @param list list to remove the data from
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_remove_head(unrolled_list_t * list);
+
+/**
+ * @brief removes and frees the data at the tail of the list
+ *
+ * @param list list to remove the data from
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_remove_tail(unrolled_list_t * list);
+
+/**
+ * @brief removes and frees the data at a specific position
+ *
+ * @param list list to remove the data from
+ * @param position position of the data
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_remove_position(unrolled_list_t * list, uint32_t position);
+
+/**
+ * @brief get the data at the head of the list without popping
+ *
+ * @param list list to peek into
+ * @return pointer to head data on success, NULL on failure
+ */
+void * unrolled_list_peek_head(unrolled_list_t * list);
+
+/**
+ * @brief get the data at the tail of the list without popping
+ *
+ * @param list list to peek into
+ * @return pointer to tail data on success, NULL on failure
+ */
+void * unrolled_list_peek_tail(unrolled_list_t * list);
+
+/**
+ * @brief get the data at a specific position without popping
+ *
+ * @param list list to peek into
+ * @param position position of the data
+ * @return pointer to the data on success, NULL on failure
+ */
+void * unrolled_list_peek_position(unrolled_list_t * list, uint32_t position);
+
+/**
+ * @brief remove and free the first element that compares equal to data_p
+ *
+ * @param list list to remove the data from
+ * @param data_p the data object to be searched for
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_remove_data(unrolled_list_t * list, void * data_p);
+
+/**
+ * @brief perform a user defined action on every element, in list order
+ *
+ * @param list list to perform actions on
+ * @param action_function pointer to user defined action function
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_foreach_call(unrolled_list_t * list, ACT_F action_function);
+
+/**
+ * @brief checks whether any element compares equal to data_p
+ *
+ * @param list list to search through
+ * @param data_p the data object to be searched for
+ * @return true if found, false otherwise
+ */
+bool unrolled_list_contains(unrolled_list_t * list, void * data_p);
+
+/**
+ * @brief picks an element uniformly at random
+ *
+ * @param list list to pick from
+ * @return pointer to the data on success, NULL on failure
+ */
+void * unrolled_list_pick_random_item(unrolled_list_t * list);
+
+/**
+ * @brief find the first element matching search_data as found by the user
+ *        defined compare function
+ *
+ * @param list list to search through
+ * @param search_data the data to be searched for
+ * @return pointer to the matching data on success, NULL on failure
+ */
+void * unrolled_list_find_first_occurrence(unrolled_list_t * list,
+                                           void *            search_data);
+
+/**
+ * @brief find every element matching search_data, in list order
+ *
+ * @param list list to search through
+ * @param search_data the data to be searched for
+ * @return pointer to a new list of all matches on success, NULL on failure
+ */
+unrolled_list_t * unrolled_list_find_all_occurrences(unrolled_list_t * list,
+                                                     void * search_data);
+
+/**
+ * @brief stable sort of the list as per user defined compare function
+ *
+ * @param list pointer to list to be sorted
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_sort(unrolled_list_t * list);
+
+/**
+ * @brief clear all elements out of a list
+ *
+ * @param list list to clear out
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_clear(unrolled_list_t * list);
+
+/**
+ * @brief delete a list
+ *
+ * @param list_address pointer to list pointer
+ * @return 0 on success, non-zero value on failure
+ */
+int unrolled_list_delete(unrolled_list_t ** list_address);
+
+#endif /* _UNROLLED_LIST_H */
+
+/*** end of file ***/
@@ -0,0 +1,1076 @@
+#include <limits.h> // INT_MAX
+#include <string.h> // memmove(), memcpy()
+
+#include "comparisons.h"
+#include "number_generator.h"
+#include "unrolled_list.h"
+#include "utilities.h"
+
+#define CHUNK_CAPACITY UNROLLED_LIST_CHUNK_CAPACITY
+
+// Adjacent chunks holding no more than this many elements are merged
+#define MERGE_THRESHOLD (CHUNK_CAPACITY / 2)
+
+/**
+ * @brief Create a new, empty `unrolled_chunk_t`
+ *
+ * @param start Slot the first element will be written to
+ * @return unrolled_chunk_t* on success, NULL on failure
+ */
+static unrolled_chunk_t * chunk_new(uint32_t start);
+
+/**
+ * @brief Links 'chunk' into the list after 'prev' (or at the head if NULL)
+ */
+static void chunk_link_after(unrolled_list_t *  list,
+                             unrolled_chunk_t * prev,
+                             unrolled_chunk_t * chunk);
+
+/**
+ * @brief Unlinks 'chunk' from the list and frees it
+ */
+static void chunk_unlink(unrolled_list_t * list, unrolled_chunk_t * chunk);
+
+/**
+ * @brief Finds the chunk holding 'position', walking from the nearer end
+ *
+ * @param offset Set to the position of the element within the chunk
+ * @return The chunk, or NULL if position is out of bounds
+ */
+static unrolled_chunk_t * chunk_locate(unrolled_list_t * list,
+                                       uint32_t          position,
+                                       uint32_t *        offset);
+
+/**
+ * @brief Inserts data at 'offset' within a chunk, splitting it if full
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure
+ */
+static int chunk_insert(unrolled_list_t *  list,
+                        unrolled_chunk_t * chunk,
+                        uint32_t           offset,
+                        void *             data);
+
+/**
+ * @brief Removes the data at 'offset' within a chunk, merging sparse chunks
+ *
+ * @return The removed data
+ */
+static void * chunk_remove(unrolled_list_t *  list,
+                           unrolled_chunk_t * chunk,
+                           uint32_t           offset);
+
+/**
+ * @brief Merges the chunk after 'chunk' into it when both are sparse
+ */
+static void chunk_try_merge(unrolled_list_t * list, unrolled_chunk_t * chunk);
+
+/**
+ * @brief Finds the first element equal to 'search_data'
+ *
+ * @param offset Set to the position of the element within the chunk
+ * @return The chunk holding the match, or NULL if there is none
+ */
+static unrolled_chunk_t * find_element(unrolled_list_t * list,
+                                       void *            search_data,
+                                       uint32_t *        offset);
+
+/**
+ * @brief Stable bottom-up merge sort of an array of data pointers
+ */
+static void merge_sort(void ** items,
+                       void ** scratch,
+                       size_t  count,
+                       CMP_F   compare_func);
+
+unrolled_list_t * unrolled_list_new(FREE_F free_func, CMP_F comp_func)
+{
+    unrolled_list_t * new_list = NULL;
+
+    new_list = calloc(1, sizeof(unrolled_list_t));
+    if (NULL == new_list)
+    {
+        PRINT_DEBUG("unrolled_list_new(): CMR failure.\n");
+        goto END;
+    }
+
+    new_list->size         = 0;
+    new_list->chunk_count  = 0;
+    new_list->head         = NULL;
+    new_list->tail         = NULL;
+    new_list->custom_free  = free_func;
+    new_list->compare_func = comp_func;
+
+END:
+    return new_list;
+}
+
+int unrolled_list_push_head(unrolled_list_t * list, void * data)
+{
+    int                exit_code = E_FAILURE;
+    unrolled_chunk_t * chunk     = NULL;
+
+    if ((NULL == list) || (NULL == data))
+    {
+        PRINT_DEBUG("unrolled_list_push_head(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    chunk = list->head;
+    if ((NULL == chunk) || (0 == chunk->start))
+    {
+        // Fill the new chunk from the back so later head pushes are O(1)
+        chunk = chunk_new(CHUNK_CAPACITY);
+        if (NULL == chunk)
+        {
+            PRINT_DEBUG("unrolled_list_push_head(): Unable to create chunk.\n");
+            goto END;
+        }
+        chunk_link_after(list, NULL, chunk);
+    }
+
+    chunk->start--;
+    chunk->items[chunk->start] = data;
+    chunk->count++;
+    list->size++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int unrolled_list_push_tail(unrolled_list_t * list, void * data)
+{
+    int                exit_code = E_FAILURE;
+    unrolled_chunk_t * chunk     = NULL;
+
+    if ((NULL == list) || (NULL == data))
+    {
+        PRINT_DEBUG("unrolled_list_push_tail(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    chunk = list->tail;
+    if ((NULL == chunk) || (CHUNK_CAPACITY == (chunk->start + chunk->count)))
+    {
+        chunk = chunk_new(0);
+        if (NULL == chunk)
+        {
+            PRINT_DEBUG("unrolled_list_push_tail(): Unable to create chunk.\n");
+            goto END;
+        }
+        chunk_link_after(list, list->tail, chunk);
+    }
+
+    chunk->items[chunk->start + chunk->count] = data;
+    chunk->count++;
+    list->size++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int unrolled_list_push_position(unrolled_list_t * list,
+                                void *            data,
+                                uint32_t          position)
+{
+    int                exit_code = E_FAILURE;
+    unrolled_chunk_t * chunk     = NULL;
+    uint32_t           offset    = 0;
+
+    if ((NULL == list) || (NULL == data))
+    {
+        PRINT_DEBUG("unrolled_list_push_position(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if ((position > list->size) || (UINT32_MAX == list->size))
+    {
+        PRINT_DEBUG("unrolled_list_push_position(): Position out of bounds.\n");
+        goto END;
+    }
+
+    // Handle special cases for head and tail
+    if (0 == position)
+    {
+        exit_code = unrolled_list_push_head(list, data);
+        goto END;
+    }
+    if (position == list->size)
+    {
+        exit_code = unrolled_list_push_tail(list, data);
+        goto END;
+    }
+
+    chunk     = chunk_locate(list, position, &offset);
+    exit_code = chunk_insert(list, chunk, offset, data);
+
+END:
+    return exit_code;
+}
+
+int unrolled_list_is_empty(unrolled_list_t * list)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_is_empty(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        exit_code = E_SUCCESS;
+    }
+
+END:
+    return exit_code;
+}
+
+void * unrolled_list_pop_head(unrolled_list_t * list)
+{
+    void * data = NULL;
+
+    if ((NULL == list) || (NULL == list->head))
+    {
+        PRINT_DEBUG("unrolled_list_pop_head(): List is empty.\n");
+        goto END;
+    }
+
+    data = chunk_remove(list, list->head, 0);
+
+END:
+    return data;
+}
+
+void * unrolled_list_pop_tail(unrolled_list_t * list)
+{
+    void * data = NULL;
+
+    if ((NULL == list) || (NULL == list->tail))
+    {
+        PRINT_DEBUG("unrolled_list_pop_tail(): List is empty.\n");
+        goto END;
+    }
+
+    data = chunk_remove(list, list->tail, list->tail->count - 1);
+
+END:
+    return data;
+}
+
+void * unrolled_list_pop_position(unrolled_list_t * list, uint32_t position)
+{
+    unrolled_chunk_t * chunk  = NULL;
+    uint32_t           offset = 0;
+    void *             data   = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_pop_position(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (position >= list->size)
+    {
+        PRINT_DEBUG("unrolled_list_pop_position(): Position out of bounds.\n");
+        goto END;
+    }
+
+    chunk = chunk_locate(list, position, &offset);
+    data  = chunk_remove(list, chunk, offset);
+
+END:
+    return data;
+}
+
+int unrolled_list_remove_head(unrolled_list_t * list)
+{
+    int    exit_code = E_FAILURE;
+    void * data      = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_remove_head(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    data = unrolled_list_pop_head(list);
+    if (NULL == data)
+    {
+        goto END;
+    }
+
+    if (NULL != list->custom_free)
+    {
+        list->custom_free(data);
+    }
+    data = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int unrolled_list_remove_tail(unrolled_list_t * list)
+{
+    int    exit_code = E_FAILURE;
+    void * data      = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_remove_tail(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    data = unrolled_list_pop_tail(list);
+    if (NULL == data)
+    {
+        goto END;
+    }
+
+    if (NULL != list->custom_free)
+    {
+        list->custom_free(data);
+    }
+    data = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int unrolled_list_remove_position(unrolled_list_t * list, uint32_t position)
+{
+    int    exit_code = E_FAILURE;
+    void * data      = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_remove_position(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    data = unrolled_list_pop_position(list, position);
+    if (NULL == data)
+    {
+        goto END;
+    }
+
+    if (NULL != list->custom_free)
+    {
+        list->custom_free(data);
+    }
+    data = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void * unrolled_list_peek_head(unrolled_list_t * list)
+{
+    void * data = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_peek_head(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (NULL == list->head)
+    {
+        PRINT_DEBUG("unrolled_list_peek_head(): Empty list.\n");
+        goto END;
+    }
+
+    data = list->head->items[list->head->start];
+
+END:
+    return data;
+}
+
+void * unrolled_list_peek_tail(unrolled_list_t * list)
+{
+    void * data = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_peek_tail(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (NULL == list->tail)
+    {
+        PRINT_DEBUG("unrolled_list_peek_tail(): Empty list.\n");
+        goto END;
+    }
+
+    data = list->tail->items[list->tail->start + list->tail->count - 1];
+
+END:
+    return data;
+}
+
+void * unrolled_list_peek_position(unrolled_list_t * list, uint32_t position)
+{
+    unrolled_chunk_t * chunk  = NULL;
+    uint32_t           offset = 0;
+    void *             data   = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_peek_position(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (position >= list->size)
+    {
+        PRINT_DEBUG("unrolled_list_peek_position(): Position out of bounds.\n");
+        goto END;
+    }
+
+    chunk = chunk_locate(list, position, &offset);
+    data  = chunk->items[chunk->start + offset];
+
+END:
+    return data;
+}
+
+int unrolled_list_remove_data(unrolled_list_t * list, void * data_p)
+{
+    int                exit_code = E_FAILURE;
+    unrolled_chunk_t * chunk     = NULL;
+    uint32_t           offset    = 0;
+    void *             data      = NULL;
+
+    if ((NULL == list) || (NULL == data_p))
+    {
+        PRINT_DEBUG("unrolled_list_remove_data(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    chunk = find_element(list, data_p, &offset);
+    if (NULL == chunk)
+    {
+        PRINT_DEBUG("unrolled_list_remove_data(): Data not found.\n");
+        goto END;
+    }
+
+    data = chunk_remove(list, chunk, offset);
+    if (NULL != list->custom_free)
+    {
+        list->custom_free(data);
+    }
+    data = NULL;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int unrolled_list_foreach_call(unrolled_list_t * list, ACT_F action_function)
+{
+    int                exit_code = E_FAILURE;
+    unrolled_chunk_t * chunk     = NULL;
+    void **            items     = NULL;
+
+    if ((NULL == list) || (NULL == action_function))
+    {
+        PRINT_DEBUG("unrolled_list_foreach_call(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    for (chunk = list->head; NULL != chunk; chunk = chunk->next)
+    {
+        items = &chunk->items[chunk->start];
+        for (uint32_t idx = 0; idx < chunk->count; idx++)
+        {
+            action_function(items[idx]);
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+bool unrolled_list_contains(unrolled_list_t * list, void * data_p)
+{
+    bool     result = false;
+    uint32_t offset = 0;
+
+    if ((NULL == list) || (NULL == data_p))
+    {
+        PRINT_DEBUG("unrolled_list_contains(): NULL argument passed.\n");
+        goto END;
+    }
+
+    result = (NULL != find_element(list, data_p, &offset));
+
+END:
+    return result;
+}
+
+void * unrolled_list_pick_random_item(unrolled_list_t * list)
+{
+    int    exit_code    = E_FAILURE;
+    int    random_index = 0;
+    void * data         = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_pick_random_item(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        PRINT_DEBUG("unrolled_list_pick_random_item(): List is empty.\n");
+        goto END;
+    }
+
+    // Ensure list->size - 1 fits within the range of an int
+    if (list->size > INT_MAX)
+    {
+        PRINT_DEBUG("unrolled_list_pick_random_item(): List size too large.\n");
+        goto END;
+    }
+
+    exit_code = random_number(0, (int)(list->size - 1), &random_index);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG(
+            "unrolled_list_pick_random_item(): Unable to generate a random "
+            "index.\n");
+        goto END;
+    }
+
+    data = unrolled_list_peek_position(list, (uint32_t)random_index);
+
+END:
+    return data;
+}
+
+void * unrolled_list_find_first_occurrence(unrolled_list_t * list,
+                                           void *            search_data)
+{
+    unrolled_chunk_t * chunk  = NULL;
+    uint32_t           offset = 0;
+    void *             data   = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG(
+            "unrolled_list_find_first_occurrence(): NULL argument passed.\n");
+        goto END;
+    }
+
+    chunk = find_element(list, search_data, &offset);
+    if (NULL != chunk)
+    {
+        data = chunk->items[chunk->start + offset];
+    }
+
+END:
+    return data;
+}
+
+unrolled_list_t * unrolled_list_find_all_occurrences(unrolled_list_t * list,
+                                                     void * search_data)
+{
+    unrolled_list_t *  new_list = NULL;
+    unrolled_chunk_t * chunk    = NULL;
+    void **            items    = NULL;
+    int                check    = E_FAILURE;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG(
+            "unrolled_list_find_all_occurrences(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (0 == list->size)
+    {
+        PRINT_DEBUG("unrolled_list_find_all_occurrences(): Empty list.\n");
+        goto END;
+    }
+
+    new_list = unrolled_list_new(list->custom_free, list->compare_func);
+    if (NULL == new_list)
+    {
+        PRINT_DEBUG(
+            "unrolled_list_find_all_occurrences(): Unable to create new "
+            "list.\n");
+        goto END;
+    }
+
+    for (chunk = list->head; NULL != chunk; chunk = chunk->next)
+    {
+        items = &chunk->items[chunk->start];
+        for (uint32_t idx = 0; idx < chunk->count; idx++)
+        {
+            if (EQUAL != list->compare_func(search_data, items[idx]))
+            {
+                continue;
+            }
+
+            check = unrolled_list_push_tail(new_list, items[idx]);
+            if (E_SUCCESS != check)
+            {
+                PRINT_DEBUG(
+                    "unrolled_list_find_all_occurrences(): Unable to push "
+                    "data into list.\n");
+                // The matches are still owned by 'list'
+                new_list->custom_free = NULL;
+                unrolled_list_delete(&new_list);
+                goto END;
+            }
+        }
+    }
+
+END:
+    return new_list;
+}
+
+int unrolled_list_sort(unrolled_list_t * list)
+{
+    int                exit_code = E_FAILURE;
+    void **            items     = NULL;
+    void **            scratch   = NULL;
+    unrolled_chunk_t * chunk     = NULL;
+    size_t             idx       = 0;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_sort(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    if (2 > list->size)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    items   = calloc(list->size, sizeof(void *));
+    scratch = calloc(list->size, sizeof(void *));
+    if ((NULL == items) || (NULL == scratch))
+    {
+        PRINT_DEBUG("unrolled_list_sort(): CMR failure.\n");
+        goto END;
+    }
+
+    // Gather, sort, then write the data back into the same slots
+    for (chunk = list->head; NULL != chunk; chunk = chunk->next)
+    {
+        memcpy(&items[idx],
+               &chunk->items[chunk->start],
+               chunk->count * sizeof(void *));
+        idx += chunk->count;
+    }
+
+    merge_sort(items, scratch, list->size, list->compare_func);
+
+    idx = 0;
+    for (chunk = list->head; NULL != chunk; chunk = chunk->next)
+    {
+        memcpy(&chunk->items[chunk->start],
+               &items[idx],
+               chunk->count * sizeof(void *));
+        idx += chunk->count;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(scratch);
+    free(items);
+    return exit_code;
+}
+
+int unrolled_list_clear(unrolled_list_t * list)
+{
+    int                exit_code = E_FAILURE;
+    unrolled_chunk_t * chunk     = NULL;
+    unrolled_chunk_t * next      = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("unrolled_list_clear(): NULL argument passed.\n");
+        exit_code = E_NULL_POINTER;
+        goto END;
+    }
+
+    chunk = list->head;
+    while (NULL != chunk)
+    {
+        next = chunk->next;
+        if (NULL != list->custom_free)
+        {
+            for (uint32_t idx = 0; idx < chunk->count; idx++)
+            {
+                list->custom_free(chunk->items[chunk->start + idx]);
+            }
+        }
+        free(chunk);
+        chunk = next;
+    }
+
+    list->head        = NULL;
+    list->tail        = NULL;
+    list->size        = 0;
+    list->chunk_count = 0;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int unrolled_list_delete(unrolled_list_t ** list_address)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == list_address) || (NULL == *list_address))
+    {
+        PRINT_DEBUG("unrolled_list_delete(): NULL argument passed.\n");
+        return E_NULL_POINTER;
+    }
+
+    exit_code = unrolled_list_clear(*list_address);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("unrolled_list_delete(): Unable to clear list.\n");
+        goto END;
+    }
+
+    free(*list_address);
+    *list_address = NULL;
+
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static unrolled_chunk_t * chunk_new(uint32_t start)
+{
+    unrolled_chunk_t * new_chunk = NULL;
+
+    new_chunk = calloc(1, sizeof(unrolled_chunk_t));
+    if (NULL == new_chunk)
+    {
+        PRINT_DEBUG("chunk_new(): CMR failure.\n");
+        goto END;
+    }
+
+    new_chunk->start = start;
+    new_chunk->count = 0;
+
+END:
+    return new_chunk;
+}
+
+static void chunk_link_after(unrolled_list_t *  list,
+                             unrolled_chunk_t * prev,
+                             unrolled_chunk_t * chunk)
+{
+    chunk->prev = prev;
+    chunk->next = (NULL == prev) ? list->head : prev->next;
+
+    if (NULL != chunk->next)
+    {
+        chunk->next->prev = chunk;
+    }
+    else
+    {
+        list->tail = chunk;
+    }
+
+    if (NULL != prev)
+    {
+        prev->next = chunk;
+    }
+    else
+    {
+        list->head = chunk;
+    }
+
+    list->chunk_count++;
+}
+
+static void chunk_unlink(unrolled_list_t * list, unrolled_chunk_t * chunk)
+{
+    if (NULL != chunk->prev)
+    {
+        chunk->prev->next = chunk->next;
+    }
+    else
+    {
+        list->head = chunk->next;
+    }
+
+    if (NULL != chunk->next)
+    {
+        chunk->next->prev = chunk->prev;
+    }
+    else
+    {
+        list->tail = chunk->prev;
+    }
+
+    list->chunk_count--;
+    free(chunk);
+}
+
+static unrolled_chunk_t * chunk_locate(unrolled_list_t * list,
+                                       uint32_t          position,
+                                       uint32_t *        offset)
+{
+    unrolled_chunk_t * chunk     = NULL;
+    uint32_t           remaining = 0;
+
+    if (position >= list->size)
+    {
+        goto END;
+    }
+
+    if (position < (list->size / 2))
+    {
+        remaining = position;
+        chunk     = list->head;
+        while (remaining >= chunk->count)
+        {
+            remaining -= chunk->count;
+            chunk = chunk->next;
+        }
+    }
+    else
+    {
+        // Count back from the tail: 'remaining' elements follow 'position'
+        remaining = list->size - position - 1;
+        chunk     = list->tail;
+        while (remaining >= chunk->count)
+        {
+            remaining -= chunk->count;
+            chunk = chunk->prev;
+        }
+        remaining = chunk->count - remaining - 1;
+    }
+
+    *offset = remaining;
+END:
+    return chunk;
+}
+
+static int chunk_insert(unrolled_list_t *  list,
+                        unrolled_chunk_t * chunk,
+                        uint32_t           offset,
+                        void *             data)
+{
+    int                exit_code = E_FAILURE;
+    unrolled_chunk_t * sibling   = NULL;
+    uint32_t           half      = 0;
+
+    if (CHUNK_CAPACITY > (chunk->start + chunk->count))
+    {
+        // Room at the back: shift the elements after 'offset' right
+        memmove(&chunk->items[chunk->start + offset + 1],
+                &chunk->items[chunk->start + offset],
+                (chunk->count - offset) * sizeof(void *));
+    }
+    else if (0 < chunk->start)
+    {
+        // Room at the front: shift the elements before 'offset' left
+        memmove(&chunk->items[chunk->start - 1],
+                &chunk->items[chunk->start],
+                offset * sizeof(void *));
+        chunk->start--;
+    }
+    else
+    {
+        // Full: move the upper half into a new chunk and retry
+        sibling = chunk_new(0);
+        if (NULL == sibling)
+        {
+            PRINT_DEBUG("chunk_insert(): Unable to create chunk.\n");
+            goto END;
+        }
+
+        half = chunk->count / 2;
+        memcpy(sibling->items,
+               &chunk->items[chunk->start + half],
+               (chunk->count - half) * sizeof(void *));
+        sibling->count = chunk->count - half;
+        chunk->count   = half;
+        chunk_link_after(list, chunk, sibling);
+
+        if (offset > half)
+        {
+            exit_code = chunk_insert(list, sibling, offset - half, data);
+        }
+        else
+        {
+            exit_code = chunk_insert(list, chunk, offset, data);
+        }
+        goto END;
+    }
+
+    chunk->items[chunk->start + offset] = data;
+    chunk->count++;
+    list->size++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void * chunk_remove(unrolled_list_t *  list,
+                           unrolled_chunk_t * chunk,
+                           uint32_t           offset)
+{
+    void * data = chunk->items[chunk->start + offset];
+
+    // Close the gap from whichever side moves fewer pointers
+    if (offset < (chunk->count / 2))
+    {
+        memmove(&chunk->items[chunk->start + 1],
+                &chunk->items[chunk->start],
+                offset * sizeof(void *));
+        chunk->start++;
+    }
+    else
+    {
+        memmove(&chunk->items[chunk->start + offset],
+                &chunk->items[chunk->start + offset + 1],
+                (chunk->count - offset - 1) * sizeof(void *));
+    }
+
+    chunk->count--;
+    list->size--;
+
+    if (0 == chunk->count)
+    {
+        chunk_unlink(list, chunk);
+        goto END;
+    }
+
+    chunk_try_merge(list, chunk);
+    if (NULL != chunk->prev)
+    {
+        chunk_try_merge(list, chunk->prev);
+    }
+
+END:
+    return data;
+}
+
+static void chunk_try_merge(unrolled_list_t * list, unrolled_chunk_t * chunk)
+{
+    unrolled_chunk_t * next = chunk->next;
+
+    if ((NULL == next) || (MERGE_THRESHOLD < (chunk->count + next->count)))
+    {
+        return;
+    }
+
+    memmove(chunk->items,
+            &chunk->items[chunk->start],
+            chunk->count * sizeof(void *));
+    memcpy(&chunk->items[chunk->count],
+           &next->items[next->start],
+           next->count * sizeof(void *));
+    chunk->start = 0;
+    chunk->count += next->count;
+
+    chunk_unlink(list, next);
+}
+
+static unrolled_chunk_t * find_element(unrolled_list_t * list,
+                                       void *            search_data,
+                                       uint32_t *        offset)
+{
+    unrolled_chunk_t * chunk = NULL;
+    void **            items = NULL;
+
+    for (chunk = list->head; NULL != chunk; chunk = chunk->next)
+    {
+        items = &chunk->items[chunk->start];
+        for (uint32_t idx = 0; idx < chunk->count; idx++)
+        {
+            if (EQUAL == list->compare_func(search_data, items[idx]))
+            {
+                *offset = idx;
+                goto END;
+            }
+        }
+    }
+
+END:
+    return chunk;
+}
+
+static void merge_sort(void ** items,
+                       void ** scratch,
+                       size_t  count,
+                       CMP_F   compare_func)
+{
+    void ** source      = items;
+    void ** destination = scratch;
+    void ** swap        = NULL;
+    size_t  middle      = 0;
+    size_t  high        = 0;
+    size_t  first_idx   = 0;
+    size_t  second_idx  = 0;
+
+    for (size_t width = 1; width < count; width *= 2)
+    {
+        for (size_t low = 0; low < count; low += 2 * width)
+        {
+            middle     = (low + width < count) ? low + width : count;
+            high       = (middle + width < count) ? middle + width : count;
+            first_idx  = low;
+            second_idx = middle;
+
+            for (size_t out = low; out < high; out++)
+            {
+                // Take from the second run only when strictly smaller
+                if ((second_idx < high) &&
+                    ((first_idx >= middle) ||
+                     (LESS_THAN ==
+                      compare_func(source[second_idx], source[first_idx]))))
+                {
+                    destination[out] = source[second_idx++];
+                }
+                else
+                {
+                    destination[out] = source[first_idx++];
+                }
+            }
+        }
+
+        swap        = source;
+        source      = destination;
+        destination = swap;
+    }
+
+    if (source != items)
+    {
+        memcpy(items, source, count * sizeof(void *));
+    }
+}
+
+/*** end of file ***/
@@ -0,0 +1,295 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "comparisons.h"
+#include "unrolled_list.h"
+#include "utilities.h"
+
+#define DATA_ARR_LENGTH 10
+#define MODEL_LENGTH    2000
+
+unrolled_list_t * test_list = NULL;
+
+int data[DATA_ARR_LENGTH]   = { 44, 51, 77, 14, 68, 41, 46, 18, 72, 53 };
+int sorted[DATA_ARR_LENGTH] = { 14, 18, 41, 44, 46, 51, 53, 68, 72, 77 };
+
+int values[MODEL_LENGTH * 2];
+int action_total = 0;
+
+void custom_action(void * data)
+{
+    action_total += *(int *)data;
+}
+
+void custom_free(void * data)
+{
+    (void)data;
+}
+
+void setup(void)
+{
+    test_list = unrolled_list_new(custom_free, int_comp);
+}
+
+void teardown(void)
+{
+    if (NULL != test_list)
+    {
+        unrolled_list_delete(&test_list);
+    }
+}
+
+void push_data(void)
+{
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        unrolled_list_push_tail(test_list, &data[idx]);
+    }
+}
+
+bool chunks_are_consistent(unrolled_list_t * list)
+{
+    unrolled_chunk_t * chunk  = NULL;
+    uint32_t           total  = 0;
+    uint32_t           chunks = 0;
+
+    for (chunk = list->head; NULL != chunk; chunk = chunk->next)
+    {
+        if ((0 == chunk->count) ||
+            (UNROLLED_LIST_CHUNK_CAPACITY < (chunk->start + chunk->count)) ||
+            ((NULL != chunk->next) && (chunk->next->prev != chunk)))
+        {
+            return false;
+        }
+        total += chunk->count;
+        chunks++;
+    }
+
+    return (total == list->size) && (chunks == list->chunk_count);
+}
+
+void test_unrolled_list_new(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_list);
+    CU_ASSERT_EQUAL(test_list->size, 0);
+    CU_ASSERT_PTR_NULL(test_list->head);
+    CU_ASSERT_PTR_NULL(test_list->tail);
+    CU_ASSERT_EQUAL(unrolled_list_is_empty(test_list), E_SUCCESS);
+}
+
+void test_unrolled_list_push_null(void)
+{
+    CU_ASSERT_EQUAL(unrolled_list_push_head(NULL, &data[0]), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(unrolled_list_push_tail(test_list, NULL), E_NULL_POINTER);
+    CU_ASSERT_EQUAL(unrolled_list_push_position(test_list, &data[0], 1),
+                    E_FAILURE);
+}
+
+void test_unrolled_list_push_and_peek(void)
+{
+    push_data();
+    CU_ASSERT_EQUAL(test_list->size, DATA_ARR_LENGTH);
+    CU_ASSERT_PTR_EQUAL(unrolled_list_peek_head(test_list), &data[0]);
+    CU_ASSERT_PTR_EQUAL(unrolled_list_peek_tail(test_list),
+                        &data[DATA_ARR_LENGTH - 1]);
+
+    for (uint32_t idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        CU_ASSERT_PTR_EQUAL(unrolled_list_peek_position(test_list, idx),
+                            &data[idx]);
+    }
+
+    CU_ASSERT_PTR_NULL(
+        unrolled_list_peek_position(test_list, DATA_ARR_LENGTH));
+}
+
+void test_unrolled_list_deque(void)
+{
+    // Alternate ends across several chunks
+    for (int idx = 0; idx < MODEL_LENGTH; idx++)
+    {
+        values[idx] = idx;
+        if (0 == (idx % 2))
+        {
+            CU_ASSERT_EQUAL(unrolled_list_push_head(test_list, &values[idx]),
+                            E_SUCCESS);
+        }
+        else
+        {
+            CU_ASSERT_EQUAL(unrolled_list_push_tail(test_list, &values[idx]),
+                            E_SUCCESS);
+        }
+    }
+
+    CU_ASSERT_TRUE(chunks_are_consistent(test_list));
+    CU_ASSERT_PTR_EQUAL(unrolled_list_peek_head(test_list),
+                        &values[MODEL_LENGTH - 2]);
+    CU_ASSERT_PTR_EQUAL(unrolled_list_peek_tail(test_list),
+                        &values[MODEL_LENGTH - 1]);
+
+    for (int idx = MODEL_LENGTH - 1; idx >= 0; idx--)
+    {
+        if (0 == (idx % 2))
+        {
+            CU_ASSERT_PTR_EQUAL(unrolled_list_pop_head(test_list),
+                                &values[idx]);
+        }
+        else
+        {
+            CU_ASSERT_PTR_EQUAL(unrolled_list_pop_tail(test_list),
+                                &values[idx]);
+        }
+    }
+
+    CU_ASSERT_EQUAL(test_list->size, 0);
+    CU_ASSERT_EQUAL(test_list->chunk_count, 0);
+    CU_ASSERT_PTR_NULL(unrolled_list_pop_head(test_list));
+}
+
+void test_unrolled_list_matches_model(void)
+{
+    int *    model[MODEL_LENGTH];
+    uint32_t model_size = 0;
+    uint32_t position   = 0;
+    void *   popped     = NULL;
+
+    // Random inserts and removals checked against a plain array
+    for (int step = 0; step < (MODEL_LENGTH * 2); step++)
+    {
+        if ((model_size < MODEL_LENGTH) &&
+            ((0 == model_size) || (0 != (rand() % 3))))
+        {
+            position     = (uint32_t)rand() % (model_size + 1);
+            values[step] = step;
+            CU_ASSERT_EQUAL(unrolled_list_push_position(
+                                test_list, &values[step], position),
+                            E_SUCCESS);
+            for (uint32_t idx = model_size; idx > position; idx--)
+            {
+                model[idx] = model[idx - 1];
+            }
+            model[position] = &values[step];
+            model_size++;
+        }
+        else
+        {
+            position = (uint32_t)rand() % model_size;
+            popped   = unrolled_list_pop_position(test_list, position);
+            CU_ASSERT_PTR_EQUAL(popped, model[position]);
+            for (uint32_t idx = position; (idx + 1) < model_size; idx++)
+            {
+                model[idx] = model[idx + 1];
+            }
+            model_size--;
+        }
+    }
+
+    CU_ASSERT_EQUAL(test_list->size, model_size);
+    CU_ASSERT_TRUE(chunks_are_consistent(test_list));
+    for (uint32_t idx = 0; idx < model_size; idx++)
+    {
+        CU_ASSERT_PTR_EQUAL(unrolled_list_peek_position(test_list, idx),
+                            model[idx]);
+    }
+}
+
+void test_unrolled_list_search(void)
+{
+    int search  = 46;
+    int missing = 99;
+
+    push_data();
+
+    CU_ASSERT_PTR_EQUAL(
+        unrolled_list_find_first_occurrence(test_list, &search), &data[6]);
+    CU_ASSERT_PTR_NULL(
+        unrolled_list_find_first_occurrence(test_list, &missing));
+    CU_ASSERT_TRUE(unrolled_list_contains(test_list, &search));
+    CU_ASSERT_FALSE(unrolled_list_contains(test_list, &missing));
+
+    CU_ASSERT_EQUAL(unrolled_list_remove_data(test_list, &search), E_SUCCESS);
+    CU_ASSERT_FALSE(unrolled_list_contains(test_list, &search));
+    CU_ASSERT_EQUAL(unrolled_list_remove_data(test_list, &missing),
+                    E_FAILURE);
+}
+
+void test_unrolled_list_find_all_occurrences(void)
+{
+    unrolled_list_t * matches = NULL;
+    int               search  = 51;
+
+    push_data();
+    unrolled_list_push_head(test_list, &data[1]);
+
+    matches = unrolled_list_find_all_occurrences(test_list, &search);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(matches);
+    CU_ASSERT_EQUAL(matches->size, 2);
+    unrolled_list_delete(&matches);
+}
+
+void test_unrolled_list_foreach_call(void)
+{
+    int expected = 0;
+
+    push_data();
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        expected += data[idx];
+    }
+
+    action_total = 0;
+    CU_ASSERT_EQUAL(unrolled_list_foreach_call(test_list, custom_action),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(action_total, expected);
+    CU_ASSERT_EQUAL(unrolled_list_foreach_call(test_list, NULL),
+                    E_NULL_POINTER);
+}
+
+void test_unrolled_list_sort(void)
+{
+    push_data();
+
+    CU_ASSERT_EQUAL(unrolled_list_sort(test_list), E_SUCCESS);
+    for (uint32_t idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        CU_ASSERT_EQUAL(*(int *)unrolled_list_peek_position(test_list, idx),
+                        sorted[idx]);
+    }
+}
+
+void test_unrolled_list_clear(void)
+{
+    push_data();
+
+    CU_ASSERT_EQUAL(unrolled_list_clear(test_list), E_SUCCESS);
+    CU_ASSERT_EQUAL(test_list->size, 0);
+    CU_ASSERT_PTR_NULL(test_list->head);
+    CU_ASSERT_EQUAL(unrolled_list_clear(NULL), E_NULL_POINTER);
+}
+
+static CU_TestInfo unrolled_list_tests[] = {
+    { "new", test_unrolled_list_new },
+    { "push_null", test_unrolled_list_push_null },
+    { "push_and_peek", test_unrolled_list_push_and_peek },
+    { "deque", test_unrolled_list_deque },
+    { "matches_model", test_unrolled_list_matches_model },
+    { "search", test_unrolled_list_search },
+    { "find_all_occurrences", test_unrolled_list_find_all_occurrences },
+    { "foreach_call", test_unrolled_list_foreach_call },
+    { "sort", test_unrolled_list_sort },
+    { "clear", test_unrolled_list_clear },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo unrolled_list_test_suite = {
+    "unrolled_list Tests",
+    NULL,               // Suite initialization function
+    NULL,               // Suite cleanup function
+    setup,              // Suite setup function
+    teardown,           // Suite teardown function
+    unrolled_list_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -7,6 +7,7 @@
 #include <stdlib.h>
 
 #include "callback_types.h"
+#include "vector_search.h"
 
 /**
  * @brief A pointer to a user-defined function that gets called in the
@@ -123,6 +124,10 @@ int vector_iterate(vector_t * vector, ACT_F action_function);
 
 /**
  * @brief Finds the first occurrence of a specific element in the vector.
+ *
+ * Vectors created with int_comp or node_ptr_comp are scanned with the
+ * vectorized kernels in vector_search.h instead of calling compare_func.
+ *
  * @param vector Pointer to the vector.
  * @param search_data Pointer to the data to search for.
  * @return Pointer to the first occurrence, or NULL if not found.
@@ -131,12 +136,35 @@ void * vector_find_first_occurrence(vector_t * vector, void ** search_data);
 
 /**
  * @brief Finds all occurrences of a specific element in the vector.
+ *
+ * The result holds the same element pointers as 'vector', which still owns
+ * them. vector_delete() on the result frees only the result; the caller must
+ * not free the elements it returns.
+ *
  * @param vector Pointer to the vector.
  * @param search_data Pointer to the data to search for.
  * @return A new vector containing all occurrences, or NULL if not found.
  */
 vector_t * vector_find_all_occurrences(vector_t * vector, void ** search_data);
 
+/**
+ * @brief Marks the index of every occurrence of an element in a bitmap,
+ * without allocating.
+ *
+ * Bit (idx % 64) of bitmap[idx / 64] is set when the element at idx matches.
+ *
+ * @param vector Pointer to the vector.
+ * @param search_data Pointer to the data to search for.
+ * @param bitmap Output of at least VECTOR_BITMAP_WORDS(vector_size(vector))
+ * words.
+ * @param match_count Set to the number of occurrences found.
+ * @return Status code indicating success or failure.
+ */
+int vector_find_all_indices(vector_t * vector,
+                            void **    search_data,
+                            uint64_t * bitmap,
+                            size_t *   match_count);
+
 /**
  * @brief Sorts the elements in the vector.
  * @param vector Pointer to the vector.
@@ -0,0 +1,110 @@
+/**
+ * @file vector_search.h
+ *
+ * @brief Vectorized equality search over arrays of element pointers.
+ *
+ * These kernels back `vector_find_first_occurrence()` and friends when the
+ * vector uses one of the built-in comparators from comparisons.h:
+ *
+ *  - `node_ptr_comp`: elements match when the pointers are equal, so the
+ *    pointer array itself is scanned.
+ *  - `int_comp`: elements match when the pointed-to ints are equal, so the
+ *    ints are gathered and compared a block at a time.
+ *
+ * On x86_64 the widest instruction set available at runtime (AVX2, then SSE2)
+ * is selected automatically; other targets use a portable scalar loop. NULL
+ * elements never match, mirroring the comparators, which return ERROR for
+ * them.
+ */
+#ifndef _VECTOR_SEARCH_H
+#define _VECTOR_SEARCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "callback_types.h"
+
+// Number of 64-bit words needed for a bitmap covering 'count' elements
+#define VECTOR_BITMAP_WORDS(count) (((size_t)(count) + 63) / 64)
+
+/**
+ * @brief The kinds of keys the search kernels understand
+ */
+typedef enum
+{
+    SEARCH_KEY_NONE, // Comparator not recognized; use compare_func
+    SEARCH_KEY_INT,  // Key is an `int *`; compare the pointed-to values
+    SEARCH_KEY_PTR   // Key is any pointer; compare the pointers themselves
+} search_key_t;
+
+/**
+ * @brief The instruction sets a search kernel can run on
+ */
+typedef enum
+{
+    SEARCH_ISA_SCALAR,
+    SEARCH_ISA_SSE2,
+    SEARCH_ISA_AVX2
+} search_isa_t;
+
+/**
+ * @brief Maps a comparison function to the key type it compares by.
+ *
+ * @param compare_func The comparator a container was created with.
+ * @return SEARCH_KEY_INT for int_comp, SEARCH_KEY_PTR for node_ptr_comp, or
+ * SEARCH_KEY_NONE for anything else.
+ */
+search_key_t vector_search_key_type(CMP_F compare_func);
+
+/**
+ * @brief Finds the first element matching 'key'.
+ *
+ * @param elements Array of element pointers.
+ * @param count Number of elements in 'elements'.
+ * @param key_type SEARCH_KEY_INT or SEARCH_KEY_PTR.
+ * @param key The key to search for. Must not be NULL.
+ * @return The index of the first match, or 'count' if there is none.
+ */
+size_t vector_search_first(void * const * elements,
+                           size_t         count,
+                           search_key_t   key_type,
+                           const void *   key);
+
+/**
+ * @brief Marks every element matching 'key' in a bitmap.
+ *
+ * Bit (idx % 64) of bitmap[idx / 64] is set when elements[idx] matches; every
+ * other bit of the first VECTOR_BITMAP_WORDS(count) words is cleared.
+ *
+ * @param elements Array of element pointers.
+ * @param count Number of elements in 'elements'.
+ * @param key_type SEARCH_KEY_INT or SEARCH_KEY_PTR.
+ * @param key The key to search for. Must not be NULL.
+ * @param bitmap Output of at least VECTOR_BITMAP_WORDS(count) words.
+ * @return The number of matching elements.
+ */
+size_t vector_search_mark(void * const * elements,
+                          size_t         count,
+                          search_key_t   key_type,
+                          const void *   key,
+                          uint64_t *     bitmap);
+
+/**
+ * @brief Reports the instruction set the kernels currently run on.
+ *
+ * @return The active search_isa_t.
+ */
+search_isa_t vector_search_get_isa(void);
+
+/**
+ * @brief Caps the instruction set used by the kernels. Requests above what
+ * the CPU supports are clamped. Intended for testing and benchmarking.
+ *
+ * @param isa The widest instruction set to allow.
+ * @return The instruction set that will actually be used.
+ */
+search_isa_t vector_search_set_isa(search_isa_t isa);
+
+#endif /* _VECTOR_SEARCH_H */
+
+/*** end of file ***/
@@ -1,5 +1,5 @@
 #include <stdlib.h> // qsort()
-#include <string.h> // memmove()
+#include <string.h> // memmove(), memset()
 
 #include "utilities.h"
 #include "vector.h"
@@ -46,6 +46,13 @@ static int vector_shift_elements_right(vector_t * vector, int index);
  */
 static int vector_shift_elements_left(vector_t * vector, int index);
 
+/**
+ * @brief Free function for result vectors, which do not own their elements.
+ *
+ * @param data Pointer to the element.
+ */
+static void keep_element(void * data);
+
 vector_t * vector_new(FREE_F free_func, CMP_F comp_func, int initial_capacity)
 {
     vector_t * new_vector = NULL;
@@ -322,7 +329,9 @@ END:
 
 void * vector_find_first_occurrence(vector_t * vector, void ** search_data)
 {
-    void * found_element = NULL;
+    void *       found_element = NULL;
+    search_key_t key_type      = SEARCH_KEY_NONE;
+    size_t       index         = 0;
 
     if ((NULL == vector) || (NULL == search_data))
     {
@@ -330,6 +339,18 @@ void * vector_find_first_occurrence(vector_t * vector, void ** search_data)
         goto END;
     }
 
+    key_type = vector_search_key_type(vector->compare_func);
+    if (SEARCH_KEY_NONE != key_type)
+    {
+        index = vector_search_first(
+            vector->elements, (size_t)vector->size, key_type, search_data);
+        if (index < (size_t)vector->size)
+        {
+            found_element = vector->elements[index];
+        }
+        goto END;
+    }
+
     for (int idx = 0; idx < vector->size; idx++)
     {
         if (EQUAL == vector->compare_func(search_data, vector->elements[idx]))
@@ -346,6 +367,8 @@ END:
 vector_t * vector_find_all_occurrences(vector_t * vector, void ** search_data)
 {
     vector_t * result_vector = NULL;
+    uint64_t * bitmap        = NULL;
+    size_t     match_count   = 0;
     int        exit_code     = E_FAILURE;
 
     if ((NULL == vector) || (NULL == search_data))
@@ -360,8 +383,24 @@ vector_t * vector_find_all_occurrences(vector_t * vector, void ** search_data)
         goto END;
     }
 
+    bitmap = calloc(VECTOR_BITMAP_WORDS(vector->size), sizeof(uint64_t));
+    if (NULL == bitmap)
+    {
+        PRINT_DEBUG("vector_find_all_occurrences(): CMR failure - bitmap.\n");
+        goto END;
+    }
+
+    exit_code =
+        vector_find_all_indices(vector, search_data, bitmap, &match_count);
+    if ((E_SUCCESS != exit_code) || (0 == match_count))
+    {
+        // If no occurrences were found, return NULL
+        goto END;
+    }
+
+    // The matches still belong to 'vector', so the result never frees them
     result_vector =
-        vector_new(vector->custom_free, vector->compare_func, vector->size);
+        vector_new(keep_element, vector->compare_func, (int)match_count);
     if (NULL == result_vector)
     {
         PRINT_DEBUG(
@@ -371,28 +410,72 @@ vector_t * vector_find_all_occurrences(vector_t * vector, void ** search_data)
 
     for (int idx = 0; idx < vector->size; idx++)
     {
-        if (EQUAL == vector->compare_func(search_data, vector->elements[idx]))
+        if (0 == (bitmap[idx / 64] & ((uint64_t)1 << (idx % 64))))
         {
-            exit_code = vector_append(result_vector, vector->elements[idx]);
-            if (E_SUCCESS != exit_code)
-            {
-                PRINT_DEBUG(
-                    "vector_find_all_occurrences(): Unable to append "
-                    "element.\n");
-                vector_delete(&vector);
-                goto END;
-            }
+            continue;
         }
+
+        exit_code = vector_append(result_vector, vector->elements[idx]);
+        if (E_SUCCESS != exit_code)
+        {
+            PRINT_DEBUG(
+                "vector_find_all_occurrences(): Unable to append "
+                "element.\n");
+            vector_delete(&result_vector);
+            goto END;
+        }
+    }
+
+END:
+    free(bitmap);
+    return result_vector;
+}
+
+int vector_find_all_indices(vector_t * vector,
+                            void **    search_data,
+                            uint64_t * bitmap,
+                            size_t *   match_count)
+{
+    int          exit_code = E_FAILURE;
+    search_key_t key_type  = SEARCH_KEY_NONE;
+    size_t       count     = 0;
+
+    if ((NULL == vector) || (NULL == search_data) || (NULL == bitmap) ||
+        (NULL == match_count))
+    {
+        PRINT_DEBUG("vector_find_all_indices(): NULL argument passed.\n");
+        goto END;
     }
 
-    // If no occurrences were found, free the result vector and return NULL
-    if (0 == result_vector->size)
+    key_type = vector_search_key_type(vector->compare_func);
+    if (SEARCH_KEY_NONE != key_type)
     {
-        vector_delete(&result_vector);
+        count = vector_search_mark(vector->elements,
+                                   (size_t)vector->size,
+                                   key_type,
+                                   search_data,
+                                   bitmap);
+        exit_code = E_SUCCESS;
+        goto END;
     }
 
+    memset(bitmap, 0, VECTOR_BITMAP_WORDS(vector->size) * sizeof(uint64_t));
+    for (int idx = 0; idx < vector->size; idx++)
+    {
+        if (EQUAL == vector->compare_func(search_data, vector->elements[idx]))
+        {
+            bitmap[idx / 64] |= (uint64_t)1 << (idx % 64);
+            count++;
+        }
+    }
+
+    exit_code = E_SUCCESS;
 END:
-    return result_vector;
+    if (NULL != match_count)
+    {
+        *match_count = count;
+    }
+    return exit_code;
 }
 
 int vector_sort(vector_t * vector)
@@ -586,3 +669,8 @@ static int vector_shift_elements_left(vector_t * vector, int index)
 END:
     return exit_code;
 }
+
+static void keep_element(void * data)
+{
+    (void)data;
+}
@@ -0,0 +1,433 @@
+#include <stdatomic.h>
+
+#include "utilities.h"
+#include "vector_search.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define VECTOR_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+#define BLOCK_SIZE 64 // Elements per match mask (one bitmap word)
+
+/**
+ * @brief A pointer to a kernel that matches up to BLOCK_SIZE elements against
+ * a key, returning one bit per element.
+ */
+typedef uint64_t (*MATCH_F)(void * const * elements,
+                            size_t         count,
+                            const void *   key);
+
+// Widest instruction set the caller allows; clamped to the CPU at use
+static _Atomic int isa_limit = SEARCH_ISA_AVX2;
+
+/**
+ * @brief Finds the widest instruction set supported by the running CPU.
+ *
+ * @return The detected search_isa_t.
+ */
+static search_isa_t detect_isa(void);
+
+/**
+ * @brief Picks the match kernel for a key type and the active instruction
+ * set.
+ *
+ * @param key_type SEARCH_KEY_INT or SEARCH_KEY_PTR.
+ * @return The kernel, or NULL if the key type is not supported.
+ */
+static MATCH_F select_kernel(search_key_t key_type);
+
+/**
+ * @brief Index of the lowest set bit of a non-zero mask.
+ */
+static size_t lowest_set_bit(uint64_t mask);
+
+/**
+ * @brief Number of set bits in a mask.
+ */
+static size_t count_set_bits(uint64_t mask);
+
+static uint64_t match_ptr_scalar(void * const * elements,
+                                 size_t         count,
+                                 const void *   key);
+static uint64_t match_int_scalar(void * const * elements,
+                                 size_t         count,
+                                 const void *   key);
+
+#ifdef VECTOR_SEARCH_X86
+static uint64_t match_ptr_sse2(void * const * elements,
+                               size_t         count,
+                               const void *   key);
+static uint64_t match_int_sse2(void * const * elements,
+                               size_t         count,
+                               const void *   key);
+static uint64_t match_ptr_avx2(void * const * elements,
+                               size_t         count,
+                               const void *   key);
+static uint64_t match_int_avx2(void * const * elements,
+                               size_t         count,
+                               const void *   key);
+#endif
+
+search_key_t vector_search_key_type(CMP_F compare_func)
+{
+    search_key_t key_type = SEARCH_KEY_NONE;
+
+    if (int_comp == compare_func)
+    {
+        key_type = SEARCH_KEY_INT;
+    }
+    else if (node_ptr_comp == compare_func)
+    {
+        key_type = SEARCH_KEY_PTR;
+    }
+
+    return key_type;
+}
+
+size_t vector_search_first(void * const * elements,
+                           size_t         count,
+                           search_key_t   key_type,
+                           const void *   key)
+{
+    size_t   result = count;
+    MATCH_F  match  = NULL;
+    uint64_t mask   = 0;
+    size_t   length = 0;
+
+    if ((NULL == elements) || (NULL == key))
+    {
+        PRINT_DEBUG("vector_search_first(): NULL argument passed.\n");
+        goto END;
+    }
+
+    match = select_kernel(key_type);
+    if (NULL == match)
+    {
+        PRINT_DEBUG("vector_search_first(): Unsupported key type.\n");
+        goto END;
+    }
+
+    for (size_t base = 0; base < count; base += BLOCK_SIZE)
+    {
+        length = ((count - base) < BLOCK_SIZE) ? (count - base) : BLOCK_SIZE;
+        mask   = match(&elements[base], length, key);
+        if (0 != mask)
+        {
+            result = base + lowest_set_bit(mask);
+            goto END;
+        }
+    }
+
+END:
+    return result;
+}
+
+size_t vector_search_mark(void * const * elements,
+                          size_t         count,
+                          search_key_t   key_type,
+                          const void *   key,
+                          uint64_t *     bitmap)
+{
+    size_t   matches = 0;
+    MATCH_F  match   = NULL;
+    uint64_t mask    = 0;
+    size_t   length  = 0;
+
+    if ((NULL == elements) || (NULL == key) || (NULL == bitmap))
+    {
+        PRINT_DEBUG("vector_search_mark(): NULL argument passed.\n");
+        goto END;
+    }
+
+    match = select_kernel(key_type);
+    if (NULL == match)
+    {
+        PRINT_DEBUG("vector_search_mark(): Unsupported key type.\n");
+        goto END;
+    }
+
+    for (size_t base = 0; base < count; base += BLOCK_SIZE)
+    {
+        length = ((count - base) < BLOCK_SIZE) ? (count - base) : BLOCK_SIZE;
+        mask   = match(&elements[base], length, key);
+        bitmap[base / BLOCK_SIZE] = mask;
+        matches += count_set_bits(mask);
+    }
+
+END:
+    return matches;
+}
+
+search_isa_t vector_search_get_isa(void)
+{
+    search_isa_t detected = detect_isa();
+    search_isa_t limit    = (search_isa_t)atomic_load(&isa_limit);
+
+    return (limit < detected) ? limit : detected;
+}
+
+search_isa_t vector_search_set_isa(search_isa_t isa)
+{
+    atomic_store(&isa_limit, (int)isa);
+    return vector_search_get_isa();
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static search_isa_t detect_isa(void)
+{
+#ifdef VECTOR_SEARCH_X86
+    // SSE2 is part of the x86_64 baseline
+    return __builtin_cpu_supports("avx2") ? SEARCH_ISA_AVX2 : SEARCH_ISA_SSE2;
+#else
+    return SEARCH_ISA_SCALAR;
+#endif
+}
+
+static MATCH_F select_kernel(search_key_t key_type)
+{
+    MATCH_F      match = NULL;
+    search_isa_t isa   = vector_search_get_isa();
+
+    switch (key_type)
+    {
+        case SEARCH_KEY_INT:
+            match = match_int_scalar;
+#ifdef VECTOR_SEARCH_X86
+            if (SEARCH_ISA_AVX2 == isa)
+            {
+                match = match_int_avx2;
+            }
+            else if (SEARCH_ISA_SSE2 == isa)
+            {
+                match = match_int_sse2;
+            }
+#endif
+            break;
+
+        case SEARCH_KEY_PTR:
+            match = match_ptr_scalar;
+#ifdef VECTOR_SEARCH_X86
+            if (SEARCH_ISA_AVX2 == isa)
+            {
+                match = match_ptr_avx2;
+            }
+            else if (SEARCH_ISA_SSE2 == isa)
+            {
+                match = match_ptr_sse2;
+            }
+#endif
+            break;
+
+        default:
+            break;
+    }
+
+    (void)isa;
+    return match;
+}
+
+static size_t lowest_set_bit(uint64_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_ctzll(mask);
+#else
+    size_t position = 0;
+
+    while (0 == (mask & 1))
+    {
+        mask >>= 1;
+        position++;
+    }
+
+    return position;
+#endif
+}
+
+static size_t count_set_bits(uint64_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_popcountll(mask);
+#else
+    size_t total = 0;
+
+    while (0 != mask)
+    {
+        mask &= mask - 1;
+        total++;
+    }
+
+    return total;
+#endif
+}
+
+static uint64_t match_ptr_scalar(void * const * elements,
+                                 size_t         count,
+                                 const void *   key)
+{
+    uint64_t mask = 0;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        mask |= (uint64_t)(elements[idx] == key) << idx;
+    }
+
+    return mask;
+}
+
+static uint64_t match_int_scalar(void * const * elements,
+                                 size_t         count,
+                                 const void *   key)
+{
+    uint64_t    mask    = 0;
+    int         value   = *(const int *)key;
+    const int * element = NULL;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        element = (const int *)elements[idx];
+        mask |= (uint64_t)((NULL != element) && (value == *element)) << idx;
+    }
+
+    return mask;
+}
+
+#ifdef VECTOR_SEARCH_X86
+
+static uint64_t match_ptr_sse2(void * const * elements,
+                               size_t         count,
+                               const void *   key)
+{
+    uint64_t mask   = 0;
+    size_t   idx    = 0;
+    __m128i  needle = _mm_set1_epi64x((long long)(intptr_t)key);
+    __m128i  lanes;
+    __m128i  equal;
+
+    // SSE2 has no 64-bit compare: both 32-bit halves must match
+    for (; (idx + 2) <= count; idx += 2)
+    {
+        lanes = _mm_loadu_si128((const __m128i *)&elements[idx]);
+        equal = _mm_cmpeq_epi32(lanes, needle);
+        equal = _mm_and_si128(
+            equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+        mask |= (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(equal)) << idx;
+    }
+
+    if (idx < count)
+    {
+        mask |= match_ptr_scalar(&elements[idx], count - idx, key) << idx;
+    }
+
+    return mask;
+}
+
+static uint64_t match_int_sse2(void * const * elements,
+                               size_t         count,
+                               const void *   key)
+{
+    uint64_t    mask   = 0;
+    size_t      idx    = 0;
+    int         value  = *(const int *)key;
+    int         miss   = ~value; // Stand-in for NULL elements
+    int         v[4]   = { 0 };
+    __m128i     needle = _mm_set1_epi32(value);
+    __m128i     lanes;
+    const int * element = NULL;
+
+    // No gather before AVX2: load the ints, then compare four at a time
+    for (; (idx + 4) <= count; idx += 4)
+    {
+        for (size_t lane = 0; lane < 4; lane++)
+        {
+            element = (const int *)elements[idx + lane];
+            v[lane] = (NULL != element) ? *element : miss;
+        }
+
+        lanes = _mm_set_epi32(v[3], v[2], v[1], v[0]);
+        mask |= (uint64_t)_mm_movemask_ps(
+                    _mm_castsi128_ps(_mm_cmpeq_epi32(lanes, needle)))
+                << idx;
+    }
+
+    if (idx < count)
+    {
+        mask |= match_int_scalar(&elements[idx], count - idx, key) << idx;
+    }
+
+    return mask;
+}
+
+__attribute__((target("avx2"))) static uint64_t match_ptr_avx2(
+    void * const * elements, size_t count, const void * key)
+{
+    uint64_t mask   = 0;
+    size_t   idx    = 0;
+    __m256i  needle = _mm256_set1_epi64x((long long)(intptr_t)key);
+    __m256i  low;
+    __m256i  high;
+    uint64_t bits = 0;
+
+    for (; (idx + 8) <= count; idx += 8)
+    {
+        low  = _mm256_loadu_si256((const __m256i *)&elements[idx]);
+        high = _mm256_loadu_si256((const __m256i *)&elements[idx + 4]);
+        bits = (uint64_t)_mm256_movemask_pd(
+                   _mm256_castsi256_pd(_mm256_cmpeq_epi64(low, needle))) |
+               ((uint64_t)_mm256_movemask_pd(
+                    _mm256_castsi256_pd(_mm256_cmpeq_epi64(high, needle)))
+                << 4);
+        mask |= bits << idx;
+    }
+
+    if (idx < count)
+    {
+        mask |= match_ptr_scalar(&elements[idx], count - idx, key) << idx;
+    }
+
+    return mask;
+}
+
+__attribute__((target("avx2"))) static uint64_t match_int_avx2(
+    void * const * elements, size_t count, const void * key)
+{
+    uint64_t mask   = 0;
+    size_t   idx    = 0;
+    __m128i  needle = _mm_set1_epi32(*(const int *)key);
+    __m256i  zero   = _mm256_setzero_si256();
+    __m256i  pointers;
+    __m128i  values;
+
+    for (; (idx + 4) <= count; idx += 4)
+    {
+        pointers = _mm256_loadu_si256((const __m256i *)&elements[idx]);
+
+        // Gathering through a NULL pointer would fault
+        if (0 != _mm256_movemask_pd(
+                     _mm256_castsi256_pd(_mm256_cmpeq_epi64(pointers, zero))))
+        {
+            mask |= match_int_scalar(&elements[idx], 4, key) << idx;
+            continue;
+        }
+
+        // Each lane holds an absolute address, so the gather base is zero
+        values = _mm256_i64gather_epi32((const int *)0, pointers, 1);
+        mask |= (uint64_t)_mm_movemask_ps(
+                    _mm_castsi128_ps(_mm_cmpeq_epi32(values, needle)))
+                << idx;
+    }
+
+    if (idx < count)
+    {
+        mask |= match_int_scalar(&elements[idx], count - idx, key) << idx;
+    }
+
+    return mask;
+}
+
+#endif /* VECTOR_SEARCH_X86 */
+
+/*** end of file ***/
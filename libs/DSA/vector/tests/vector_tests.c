@@ -0,0 +1,240 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "comparisons.h"
+#include "utilities.h"
+#include "vector.h"
+
+#define DATA_ARR_LENGTH 10
+#define LARGE_LENGTH    1000
+#define VALUE_RANGE     7
+
+vector_t * test_vector = NULL;
+
+int data[DATA_ARR_LENGTH] = { 44, 51, 77, 14, 68, 41, 46, 18, 72, 53 };
+int large_data[LARGE_LENGTH];
+
+// Every instruction set the search kernels can be capped to
+search_isa_t isa_levels[] = { SEARCH_ISA_SCALAR,
+                              SEARCH_ISA_SSE2,
+                              SEARCH_ISA_AVX2 };
+
+int free_count = 0;
+
+void custom_free(void * data)
+{
+    (void)data;
+    free_count++;
+}
+
+// Same ordering as int_comp, but not recognized by the search kernels
+comp_rtns_t custom_int_comp(void * first, void * second)
+{
+    return int_comp(first, second);
+}
+
+void setup(void)
+{
+    test_vector = vector_new(custom_free, int_comp, DATA_ARR_LENGTH);
+}
+
+void teardown(void)
+{
+    if (NULL != test_vector)
+    {
+        vector_delete(&test_vector);
+    }
+    vector_search_set_isa(SEARCH_ISA_AVX2);
+}
+
+void fill_large(vector_t * vector)
+{
+    for (int idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        large_data[idx] = rand() % VALUE_RANGE;
+        vector_append(vector, &large_data[idx]);
+    }
+}
+
+void test_vector_search_key_type(void)
+{
+    CU_ASSERT_EQUAL(vector_search_key_type(int_comp), SEARCH_KEY_INT);
+    CU_ASSERT_EQUAL(vector_search_key_type(node_ptr_comp), SEARCH_KEY_PTR);
+    CU_ASSERT_EQUAL(vector_search_key_type(custom_int_comp), SEARCH_KEY_NONE);
+    CU_ASSERT_EQUAL(vector_search_key_type(NULL), SEARCH_KEY_NONE);
+}
+
+void test_vector_find_first_occurrence(void)
+{
+    int    value = 18;
+    int    other = 99;
+    int *  found = NULL;
+    size_t isa   = 0;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_vector);
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        vector_append(test_vector, &data[idx]);
+    }
+
+    for (isa = 0; isa < (sizeof(isa_levels) / sizeof(isa_levels[0])); isa++)
+    {
+        vector_search_set_isa(isa_levels[isa]);
+
+        found = vector_find_first_occurrence(test_vector, (void **)&value);
+        CU_ASSERT_PTR_EQUAL(found, &data[7]);
+
+        found = vector_find_first_occurrence(test_vector, (void **)&other);
+        CU_ASSERT_PTR_NULL(found);
+    }
+
+    CU_ASSERT_PTR_NULL(vector_find_first_occurrence(NULL, (void **)&value));
+    CU_ASSERT_PTR_NULL(vector_find_first_occurrence(test_vector, NULL));
+}
+
+void test_vector_find_first_occurrence_pointer(void)
+{
+    vector_t * vector = NULL;
+    int *      found  = NULL;
+
+    vector = vector_new(custom_free, node_ptr_comp, DATA_ARR_LENGTH);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(vector);
+    for (int idx = 0; idx < DATA_ARR_LENGTH; idx++)
+    {
+        vector_append(vector, &data[idx]);
+    }
+
+    // Pointer equality: a different int with the same value does not match
+    found = vector_find_first_occurrence(vector, (void **)&data[9]);
+    CU_ASSERT_PTR_EQUAL(found, &data[9]);
+    found = vector_find_first_occurrence(vector, (void **)&large_data[0]);
+    CU_ASSERT_PTR_NULL(found);
+
+    vector_delete(&vector);
+}
+
+void test_vector_find_all_indices(void)
+{
+    vector_t * reference = NULL;
+    uint64_t   expected[VECTOR_BITMAP_WORDS(LARGE_LENGTH)];
+    uint64_t   bitmap[VECTOR_BITMAP_WORDS(LARGE_LENGTH)];
+    size_t     expected_count = 0;
+    size_t     match_count    = 0;
+    int        value          = 3;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_vector);
+    fill_large(test_vector);
+
+    // The generic compare_func path is the reference result
+    reference = vector_new(custom_free, custom_int_comp, LARGE_LENGTH);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(reference);
+    for (int idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        vector_append(reference, &large_data[idx]);
+    }
+
+    CU_ASSERT_EQUAL(vector_find_all_indices(
+                        reference, (void **)&value, expected, &expected_count),
+                    E_SUCCESS);
+    CU_ASSERT_TRUE(0 < expected_count);
+
+    for (size_t isa = 0; isa < (sizeof(isa_levels) / sizeof(isa_levels[0]));
+         isa++)
+    {
+        vector_search_set_isa(isa_levels[isa]);
+
+        CU_ASSERT_EQUAL(vector_find_all_indices(
+                            test_vector, (void **)&value, bitmap, &match_count),
+                        E_SUCCESS);
+        CU_ASSERT_EQUAL(match_count, expected_count);
+        CU_ASSERT_EQUAL(memcmp(bitmap, expected, sizeof(bitmap)), 0);
+    }
+
+    CU_ASSERT_EQUAL(vector_find_all_indices(
+                        test_vector, (void **)&value, NULL, &match_count),
+                    E_FAILURE);
+
+    vector_delete(&reference);
+}
+
+void test_vector_find_all_occurrences(void)
+{
+    vector_t * result = NULL;
+    int        value  = 5;
+    int        other  = VALUE_RANGE;
+    int        count  = 0;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(test_vector);
+    fill_large(test_vector);
+
+    for (int idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        count += (value == large_data[idx]);
+    }
+
+    result = vector_find_all_occurrences(test_vector, (void **)&value);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(result);
+    CU_ASSERT_EQUAL(vector_size(result), count);
+    for (int idx = 0; idx < vector_size(result); idx++)
+    {
+        CU_ASSERT_EQUAL(*(int *)vector_get_element(result, idx), value);
+    }
+
+    // The matches still belong to test_vector
+    free_count = 0;
+    vector_delete(&result);
+    CU_ASSERT_EQUAL(free_count, 0);
+
+    result = vector_find_all_occurrences(test_vector, (void **)&other);
+    CU_ASSERT_PTR_NULL(result);
+}
+
+void test_vector_search_null_elements(void)
+{
+    int      values[5]   = { 1, 2, 3, 2, 1 };
+    void *   elements[9] = { &values[0], NULL,       &values[1],
+                             NULL,       &values[2], &values[3],
+                             NULL,       &values[4], &values[1] };
+    uint64_t bitmap[1]   = { 0 };
+    int      value       = 2;
+
+    // NULL elements never match, on every instruction set
+    for (size_t isa = 0; isa < (sizeof(isa_levels) / sizeof(isa_levels[0]));
+         isa++)
+    {
+        vector_search_set_isa(isa_levels[isa]);
+
+        CU_ASSERT_EQUAL(
+            vector_search_first(elements, 9, SEARCH_KEY_INT, &value), 2);
+        CU_ASSERT_EQUAL(
+            vector_search_mark(elements, 9, SEARCH_KEY_INT, &value, bitmap), 3);
+        CU_ASSERT_EQUAL(bitmap[0], 0x124);
+        CU_ASSERT_EQUAL(
+            vector_search_first(elements, 9, SEARCH_KEY_PTR, &values[4]), 7);
+    }
+}
+
+static CU_TestInfo vector_tests[] = {
+    { "search_key_type", test_vector_search_key_type },
+    { "find_first_occurrence", test_vector_find_first_occurrence },
+    { "find_first_occurrence_pointer",
+      test_vector_find_first_occurrence_pointer },
+    { "find_all_indices", test_vector_find_all_indices },
+    { "find_all_occurrences", test_vector_find_all_occurrences },
+    { "search_null_elements", test_vector_search_null_elements },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo vector_test_suite = {
+    "vector Tests",
+    NULL,        // Suite initialization function
+    NULL,        // Suite cleanup function
+    setup,       // Suite setup function
+    teardown,    // Suite teardown function
+    vector_tests // The combined array of all tests
+};
+
+/*** end of file ***/
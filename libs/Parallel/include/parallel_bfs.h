@@ -0,0 +1,89 @@
+/**
+ * @file parallel_bfs.h
+ *
+ * @brief Level-synchronous, direction-optimizing breadth-first search over a
+ * `graph_csr_t` snapshot on a `thread_pool_t`.
+ *
+ * Each level is expanded either top-down (every frontier node claims its
+ * unvisited neighbours) or bottom-up (every unvisited node looks for a parent
+ * in the frontier bitmap), following Beamer et al. Top-down is cheaper while
+ * the frontier is small; bottom-up wins once the frontier holds a large share
+ * of the remaining edges, because each unvisited node stops at the first
+ * parent it finds. The search switches per level based on the edge counts of
+ * the frontier and of the unvisited nodes.
+ *
+ * Bottom-up steps walk incoming edges, so parallel_bfs_create() builds the
+ * reverse of the snapshot once. Keep one parallel_bfs_t per snapshot and reuse
+ * it for repeated reachability or connectivity queries.
+ *
+ * A NULL pool runs every step in the calling thread. No function may be
+ * called from a worker of the pool passed in, and one parallel_bfs_t must not
+ * run two searches at once.
+ */
+#ifndef _PARALLEL_BFS_H
+#define _PARALLEL_BFS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "graph_csr.h"
+#include "thread_pool.h"
+
+// Level reported for nodes that cannot be reached from the start node
+#define PARALLEL_BFS_UNREACHED UINT32_MAX
+
+/**
+ * @brief Opaque search state bound to one snapshot and one pool.
+ */
+typedef struct parallel_bfs parallel_bfs_t;
+
+/**
+ * @brief Creates search state for a snapshot in O(V + E).
+ *
+ * @param thread_pool Pool to run on, or NULL to run in the calling thread.
+ * @param csr Snapshot to search. Must outlive the returned state.
+ * @return Pointer to the new state, or NULL on failure.
+ */
+parallel_bfs_t * parallel_bfs_create(thread_pool_t *     thread_pool,
+                                     const graph_csr_t * csr);
+
+/**
+ * @brief Computes the number of edges from one node to every other node.
+ *
+ * @param bfs Search state.
+ * @param start Index of the starting node in the snapshot.
+ * @param levels Array of node_count entries; unreachable nodes get
+ * PARALLEL_BFS_UNREACHED.
+ * @param reached Set to the number of nodes reached, including the start
+ * node. May be NULL.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_bfs_run(parallel_bfs_t * bfs,
+                     uint32_t         start,
+                     uint32_t *       levels,
+                     size_t *         reached);
+
+/**
+ * @brief Destroys search state. The snapshot and pool are left untouched.
+ *
+ * @param bfs Pointer to the pointer to the state. Set to NULL.
+ */
+void parallel_bfs_destroy(parallel_bfs_t ** bfs);
+
+/**
+ * @brief One-shot search: creates state, runs it once and destroys it.
+ *
+ * @param thread_pool Pool to run on, or NULL to run in the calling thread.
+ * @param csr Snapshot to search.
+ * @param start Index of the starting node in the snapshot.
+ * @param levels Array of node_count entries; see parallel_bfs_run().
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_csr_bfs(thread_pool_t *     thread_pool,
+                     const graph_csr_t * csr,
+                     uint32_t            start,
+                     uint32_t *          levels);
+
+#endif /* _PARALLEL_BFS_H */
+
+/*** end of file ***/
@@ -0,0 +1,62 @@
+/**
+ * @file parallel_floyd_warshall.h
+ *
+ * @brief All-pairs shortest paths with a blocked Floyd-Warshall on a
+ * `thread_pool_t`.
+ *
+ * Distances live in one contiguous row-major matrix, as produced by
+ * graph_distance_matrix(). The matrix is cut into square tiles of
+ * PARALLEL_FW_BLOCK_SIZE rows; every round of the algorithm updates the
+ * diagonal tile first, then the tiles sharing its block row and column, then
+ * all remaining tiles. Tiles within the last two phases are independent and
+ * are run as pool tasks. The min-plus inner loop uses AVX-512 or AVX2 when
+ * the CPU supports it.
+ *
+ * Every function accepts a NULL pool, in which case the work runs in the
+ * calling thread. None of them may be called from a worker of the pool passed
+ * in.
+ */
+#ifndef _PARALLEL_FLOYD_WARSHALL_H
+#define _PARALLEL_FLOYD_WARSHALL_H
+
+#include <stddef.h>
+
+#include "adjacency_list.h"
+#include "thread_pool.h"
+
+// Rows and columns per tile; three tiles of size_t fit in a typical L2 cache
+#define PARALLEL_FW_BLOCK_SIZE 64
+
+/**
+ * @brief Runs Floyd-Warshall in place on a distance matrix.
+ *
+ * Entries equal to GRAPH_DISTANCE_INFINITY mean "no path"; sums saturate at
+ * that value instead of wrapping.
+ *
+ * @param thread_pool Pool to run on, or NULL to run in the calling thread.
+ * @param distances Row-major node_count x node_count matrix, updated in place.
+ * @param node_count Number of rows (and columns) in the matrix.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_floyd_warshall(thread_pool_t * thread_pool,
+                            size_t *        distances,
+                            size_t          node_count);
+
+/**
+ * @brief Computes the all-pairs distance matrix of a graph.
+ *
+ * Produces the same matrix as graph_floyd_warshall(). The caller frees it with
+ * free().
+ *
+ * @param thread_pool Pool to run on, or NULL to run in the calling thread.
+ * @param graph Pointer to the graph.
+ * @param distances Set to the new distance matrix, indexed by node ID.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_graph_floyd_warshall(thread_pool_t * thread_pool,
+                                  graph_t *       graph,
+                                  size_t **       distances);
+
+#endif /* _PARALLEL_FLOYD_WARSHALL_H */
+
+/*** end of file ***/
@@ -0,0 +1,89 @@
+/**
+ * @file parallel_graph_load.h
+ *
+ * @brief Bulk loading of an edge-list file straight into a `graph_csr_t`
+ * snapshot on a `thread_pool_t`.
+ *
+ * Building a large graph through graph_add_node() and graph_add_edge() costs
+ * an allocation and an index lookup per call. parallel_graph_load() skips the
+ * graph_t entirely: it maps the file into memory, parses it in chunks on the
+ * pool, renumbers the node IDs to dense indices, radix sorts the edges by
+ * (source, target) and writes the CSR rows in a single pass. Parallel edges
+ * collapse into one edge carrying the smallest weight.
+ *
+ * Two formats are supported:
+ *  - Text: one edge per line as "source target [weight]", separated by spaces
+ *    or tabs. The weight defaults to 1. Blank lines and lines starting with
+ *    '#' or '%' are ignored.
+ *  - Binary: a packed array of parallel_edge_record_t in host byte order.
+ *
+ * Node IDs are unsigned 32-bit integers and need not be contiguous. Index `i`
+ * of the snapshot holds the `i`-th smallest ID, and `node_data[i]` points at
+ * that ID as a `uint32_t`. The snapshot owns those IDs, so graph_csr_destroy()
+ * releases everything. Nodes only exist if some edge mentions them.
+ *
+ * A NULL pool runs every step in the calling thread. The loader may not be
+ * called from a worker of the pool passed in.
+ */
+#ifndef _PARALLEL_GRAPH_LOAD_H
+#define _PARALLEL_GRAPH_LOAD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "graph_csr.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Layout of the input file.
+ */
+typedef enum
+{
+    PARALLEL_LOAD_TEXT,  // Whitespace-separated "source target [weight]" lines
+    PARALLEL_LOAD_BINARY // Packed parallel_edge_record_t entries
+} parallel_load_format_t;
+
+/**
+ * @brief One edge of a binary edge-list file.
+ */
+typedef struct
+{
+    uint32_t source; // ID of the source node
+    uint32_t target; // ID of the target node
+    uint32_t weight; // Weight of the edge
+} parallel_edge_record_t;
+
+/**
+ * @brief How to interpret the input file.
+ */
+typedef struct
+{
+    parallel_load_format_t format;     // Layout of the file
+    bool                   undirected; // Add every edge in both directions
+} parallel_load_options_t;
+
+/**
+ * @brief Loads an edge-list file into a new snapshot in O(V + E).
+ *
+ * @param thread_pool Pool to run on, or NULL to run in the calling thread.
+ * @param path Path of the file to load.
+ * @param options How to interpret the file.
+ * @return Pointer to the new snapshot, or NULL if the file cannot be read, is
+ * malformed, or on failure. Destroy it with graph_csr_destroy().
+ */
+graph_csr_t * parallel_graph_load(thread_pool_t *                 thread_pool,
+                                  const char *                    path,
+                                  const parallel_load_options_t * options);
+
+/**
+ * @brief Looks up the index of a node by its ID in O(log V).
+ *
+ * @param csr Snapshot returned by parallel_graph_load().
+ * @param id ID of the node in the file.
+ * @return The node's index, or GRAPH_CSR_NO_NODE if it is not present.
+ */
+uint32_t parallel_graph_load_index(const graph_csr_t * csr, uint32_t id);
+
+#endif /* _PARALLEL_GRAPH_LOAD_H */
+
+/*** end of file ***/
@@ -0,0 +1,100 @@
+/**
+ * @file parallel_reachability.h
+ *
+ * @brief Reachability within k hops, and the transitive closure, of a
+ * `matrix_t` on a `thread_pool_t`.
+ *
+ * The powers of the adjacency bitset are taken with matrix_reachability_with()
+ * and every boolean product is split into strips of
+ * PARALLEL_REACH_STRIP_WORDS words of columns. When there are fewer strips
+ * than pool workers, as for any graph of up to 512 nodes, each strip is also
+ * cut into blocks of rows, down to PARALLEL_REACH_MIN_ROWS rows. Each task
+ * runs the Four Russians kernel of matrix_bitset_multiply() on its block, so
+ * blocks share no output and need no locking.
+ *
+ * Every function accepts a NULL pool, in which case the work runs in the
+ * calling thread. None of them may be called from a worker of the pool passed
+ * in.
+ */
+#ifndef _PARALLEL_REACHABILITY_H
+#define _PARALLEL_REACHABILITY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "adjacency_matrix.h"
+#include "thread_pool.h"
+
+// Product words per task; 512 columns, and one cache line of each row
+#define PARALLEL_REACH_STRIP_WORDS 8
+
+// Fewest product rows per task. Every task builds its lookup tables from all
+// rows, which costs about as much as applying them to 256 rows.
+#define PARALLEL_REACH_MIN_ROWS 128
+
+/**
+ * @brief Counts the tasks parallel_bitset_multiply() splits a product into.
+ *
+ * @param row_count The number of rows.
+ * @param row_words Words per row, as returned by matrix_bitset_words().
+ * @param thread_pool The thread_pool_t the product would run on, or NULL.
+ * @return The number of tasks, 0 for an empty product.
+ */
+size_t parallel_bitset_task_count(size_t          row_count,
+                                  size_t          row_words,
+                                  thread_pool_t * thread_pool);
+
+/**
+ * @brief Multiplies two square bit matrices over the boolean semiring on a
+ * pool, as a MATRIX_MULTIPLY_F.
+ *
+ * @param left Row-major, row_count rows of row_words words.
+ * @param right Row-major, row_count rows of row_words words.
+ * @param product Out parameter, row_count rows of row_words words.
+ * @param row_count The number of rows.
+ * @param row_words Words per row, as returned by matrix_bitset_words().
+ * @param thread_pool The thread_pool_t to run on, or NULL to run in the
+ * calling thread.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_bitset_multiply(const uint64_t * left,
+                             const uint64_t * right,
+                             uint64_t *       product,
+                             size_t           row_count,
+                             size_t           row_words,
+                             void *           thread_pool);
+
+/**
+ * @brief Finds which nodes each node reaches within a number of hops.
+ *
+ * Produces the same rows as matrix_reachability().
+ *
+ * @param thread_pool Pool to run on, or NULL to run in the calling thread.
+ * @param graph Pointer to the graph.
+ * @param hops The most edges on a path. Every node reaches itself in 0 hops.
+ * @param reach Set to the new reach rows. The caller frees them with free().
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_matrix_reachability(thread_pool_t *  thread_pool,
+                                 const matrix_t * graph,
+                                 size_t           hops,
+                                 uint64_t **      reach);
+
+/**
+ * @brief Finds every node each node reaches, itself included.
+ *
+ * Produces the same rows as matrix_transitive_closure().
+ *
+ * @param thread_pool Pool to run on, or NULL to run in the calling thread.
+ * @param graph Pointer to the graph.
+ * @param closure Set to the new closure rows. The caller frees them with
+ * free().
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_matrix_transitive_closure(thread_pool_t *  thread_pool,
+                                       const matrix_t * graph,
+                                       uint64_t **      closure);
+
+#endif /* _PARALLEL_REACHABILITY_H */
+
+/*** end of file ***/
@@ -0,0 +1,160 @@
+/**
+ * @file parallel_sort.h
+ *
+ * @brief Parallel sorting for `vector_t` and `list_t` on a `thread_pool_t`.
+ *
+ * Comparison sorts use a stable parallel merge sort: the input is cut into one
+ * run per worker, runs are sorted concurrently, and runs are merged pairwise
+ * with every merge split across workers by co-ranking. Lists are sorted by
+ * gathering their data pointers into an array, sorting it, and writing the
+ * data back into the existing nodes, so no node is reallocated or relinked.
+ *
+ * Radix fast paths are provided for integer keys (LSD over 64-bit keys) and
+ * NUL-terminated string keys (MSD by byte).
+ *
+ * Every function accepts a NULL pool, in which case the work runs in the
+ * calling thread. None of them may be called from a worker of the pool passed
+ * in.
+ */
+#ifndef _PARALLEL_SORT_H
+#define _PARALLEL_SORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "callback_types.h"
+#include "linked_list.h"
+#include "thread_pool.h"
+#include "vector.h"
+
+// Inputs smaller than this are sorted in the calling thread
+#define PARALLEL_SORT_THRESHOLD 16384
+
+/**
+ * @brief A pointer to a user-defined function that maps an element to an
+ * unsigned 64-bit sort key. Keys are sorted in ascending unsigned order.
+ */
+typedef uint64_t (*SORT_KEY_F)(const void *);
+
+/**
+ * @brief Sorts an array of element pointers with a stable parallel merge sort.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param items Array of element pointers to sort in place.
+ * @param count Number of elements in 'items'.
+ * @param compare_func Comparison function applied to pairs of elements.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_sort_array(thread_pool_t * thread_pool,
+                        void **         items,
+                        size_t          count,
+                        CMP_F           compare_func);
+
+/**
+ * @brief Sorts an array of element pointers by integer key with a parallel LSD
+ * radix sort. The sort is stable.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param items Array of element pointers to sort in place.
+ * @param count Number of elements in 'items'.
+ * @param key_func Function extracting the 64-bit key of an element.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_radix_sort_array(thread_pool_t * thread_pool,
+                              void **         items,
+                              size_t          count,
+                              SORT_KEY_F      key_func);
+
+/**
+ * @brief Sorts an array of NUL-terminated strings in byte order with a
+ * parallel MSD radix sort.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param items Array of `char *` to sort in place.
+ * @param count Number of elements in 'items'.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_string_sort_array(thread_pool_t * thread_pool,
+                               void **         items,
+                               size_t          count);
+
+/**
+ * @brief Sorts a vector using its compare function.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param vector Pointer to the vector.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_vector_sort(thread_pool_t * thread_pool, vector_t * vector);
+
+/**
+ * @brief Sorts a vector by integer key using radix sort.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param vector Pointer to the vector.
+ * @param key_func Function extracting the 64-bit key of an element.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_vector_radix_sort(thread_pool_t * thread_pool,
+                               vector_t *      vector,
+                               SORT_KEY_F      key_func);
+
+/**
+ * @brief Sorts a vector of NUL-terminated strings using radix sort.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param vector Pointer to the vector.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_vector_string_sort(thread_pool_t * thread_pool,
+                                vector_t *      vector);
+
+/**
+ * @brief Sorts a list using its compare function.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param list Pointer to the list.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_list_sort(thread_pool_t * thread_pool, list_t * list);
+
+/**
+ * @brief Sorts a list by integer key using radix sort.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param list Pointer to the list.
+ * @param key_func Function extracting the 64-bit key of an element.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_list_radix_sort(thread_pool_t * thread_pool,
+                             list_t *        list,
+                             SORT_KEY_F      key_func);
+
+/**
+ * @brief Sorts a list of NUL-terminated strings using radix sort.
+ *
+ * @param thread_pool Pool to run on, or NULL to sort in the calling thread.
+ * @param list Pointer to the list.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int parallel_list_string_sort(thread_pool_t * thread_pool, list_t * list);
+
+/**
+ * @brief Sort key for elements pointing to an `int`. Preserves signed order.
+ *
+ * @param data Pointer to an int.
+ * @return The order-preserving unsigned key.
+ */
+uint64_t sort_key_int(const void * data);
+
+/**
+ * @brief Sort key for elements pointing to a `size_t`.
+ *
+ * @param data Pointer to a size_t.
+ * @return The key.
+ */
+uint64_t sort_key_size(const void * data);
+
+#endif /* _PARALLEL_SORT_H */
+
+/*** end of file ***/
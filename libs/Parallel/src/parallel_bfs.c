@@ -0,0 +1,623 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h> // memcpy(), memset()
+
+#include "parallel_bfs.h"
+#include "task_group.h"
+#include "utilities.h"
+
+#define BITS_PER_WORD    64
+#define TOP_DOWN_ALPHA   14   // Go bottom-up once frontier edges > rest/ALPHA
+#define BOTTOM_UP_BETA   24   // Go top-down once frontier < node_count/BETA
+#define MIN_TASK_NODES   4096 // Smallest slice of a level given to a task
+#define LOCAL_QUEUE_SIZE 256  // Nodes a top-down task buffers before publishing
+
+/**
+ * @brief How the current level is being expanded
+ */
+typedef enum
+{
+    BFS_TOP_DOWN, // Frontier is a queue; scan its outgoing edges
+    BFS_BOTTOM_UP // Frontier is a bitmap; scan incoming edges of the rest
+} bfs_direction_t;
+
+/**
+ * @brief One slice of a level
+ */
+typedef struct bfs_task
+{
+    parallel_bfs_t * bfs;      // Shared state
+    size_t           begin;    // First queue entry or bitmap word
+    size_t           end;      // One past the last queue entry or bitmap word
+    size_t           awakened; // Nodes this task added to the next frontier
+    size_t           edges;    // Outgoing edges of those nodes
+} bfs_task_t;
+
+struct parallel_bfs
+{
+    const graph_csr_t * csr;         // Snapshot being searched
+    task_group_t *      group;       // Group bound to the caller's pool
+    bfs_task_t *        tasks;       // One slot per worker
+    size_t              max_tasks;   // Number of slots in 'tasks'
+    size_t *            in_offsets;  // Reverse CSR rows; node_count + 1
+    uint32_t *          in_sources;  // Source node of each incoming edge
+    _Atomic uint64_t *  visited;     // One bit per node, set when claimed
+    uint64_t *          frontier;    // Bitmap of the current level
+    uint64_t *          next;        // Bitmap of the next level
+    uint32_t *          queue;       // Current level as a node list
+    uint32_t *          next_queue;  // Next level as a node list
+    atomic_size_t       next_tail;   // Entries used in 'next_queue'
+    size_t              word_count;  // Words in each bitmap
+    uint32_t *          levels;      // Caller's output array
+    uint32_t            depth;       // Level being expanded
+};
+
+/**
+ * @brief Builds the incoming-edge rows of the snapshot.
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int build_reverse(parallel_bfs_t * bfs);
+
+/**
+ * @brief Splits one level into tasks, runs them and totals their results.
+ *
+ * @param bfs Search state.
+ * @param direction Direction of this level.
+ * @param count Frontier size (top-down) or bitmap words (bottom-up).
+ * @param awakened Set to the size of the next frontier.
+ * @param edges Set to the outgoing edge count of the next frontier.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int run_level(parallel_bfs_t * bfs,
+                     bfs_direction_t  direction,
+                     size_t           count,
+                     size_t *         awakened,
+                     size_t *         edges);
+
+/**
+ * @brief Claims the unvisited neighbours of a slice of the frontier queue.
+ */
+static void * top_down_routine(void * data);
+
+/**
+ * @brief Finds a frontier parent for each unvisited node in a slice of words.
+ */
+static void * bottom_up_routine(void * data);
+
+/**
+ * @brief Appends buffered nodes to the shared next-level queue.
+ */
+static void publish(parallel_bfs_t * bfs, uint32_t * local, size_t * count);
+
+/**
+ * @brief Rebuilds the frontier bitmap from the frontier queue.
+ */
+static void queue_to_bitmap(parallel_bfs_t * bfs, size_t count);
+
+/**
+ * @brief Rebuilds the frontier queue from the frontier bitmap.
+ *
+ * @return Number of nodes in the queue.
+ */
+static size_t bitmap_to_queue(parallel_bfs_t * bfs);
+
+/**
+ * @brief Mask of the bits of 'word' that correspond to real nodes.
+ */
+static uint64_t word_mask(const parallel_bfs_t * bfs, size_t word);
+
+/**
+ * @brief Number of outgoing edges of a node.
+ */
+static size_t out_degree(const graph_csr_t * csr, uint32_t node);
+
+parallel_bfs_t * parallel_bfs_create(thread_pool_t *     thread_pool,
+                                     const graph_csr_t * csr)
+{
+    int              exit_code = E_FAILURE;
+    parallel_bfs_t * bfs       = NULL;
+    size_t           count     = 0;
+
+    if (NULL == csr)
+    {
+        PRINT_DEBUG("parallel_bfs_create(): NULL argument passed.\n");
+        goto END;
+    }
+
+    bfs = calloc(1, sizeof(parallel_bfs_t));
+    if (NULL == bfs)
+    {
+        PRINT_DEBUG("parallel_bfs_create(): CMR failure.\n");
+        goto END;
+    }
+
+    bfs->csr        = csr;
+    bfs->word_count = (csr->node_count / BITS_PER_WORD) + 1;
+    bfs->max_tasks  = 1;
+    if (NULL != thread_pool)
+    {
+        bfs->max_tasks = thread_pool_get_thread_count(thread_pool);
+        bfs->max_tasks = (0 == bfs->max_tasks) ? 1 : bfs->max_tasks;
+    }
+    atomic_init(&bfs->next_tail, 0);
+
+    // One spare entry so empty snapshots need no special cases
+    count           = (size_t)csr->node_count + 1;
+    bfs->tasks      = calloc(bfs->max_tasks, sizeof(bfs_task_t));
+    bfs->visited    = calloc(bfs->word_count, sizeof(uint64_t));
+    bfs->frontier   = calloc(bfs->word_count, sizeof(uint64_t));
+    bfs->next       = calloc(bfs->word_count, sizeof(uint64_t));
+    bfs->queue      = calloc(count, sizeof(uint32_t));
+    bfs->next_queue = calloc(count, sizeof(uint32_t));
+    if ((NULL == bfs->tasks) || (NULL == bfs->visited) ||
+        (NULL == bfs->frontier) || (NULL == bfs->next) ||
+        (NULL == bfs->queue) || (NULL == bfs->next_queue))
+    {
+        PRINT_DEBUG("parallel_bfs_create(): CMR failure.\n");
+        goto END;
+    }
+
+    bfs->group = task_group_create(thread_pool);
+    if (NULL == bfs->group)
+    {
+        PRINT_DEBUG("parallel_bfs_create(): Unable to create group.\n");
+        goto END;
+    }
+
+    exit_code = build_reverse(bfs);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("parallel_bfs_create(): Unable to reverse snapshot.\n");
+        goto END;
+    }
+
+END:
+    if ((E_SUCCESS != exit_code) && (NULL != bfs))
+    {
+        parallel_bfs_destroy(&bfs);
+    }
+    return bfs;
+}
+
+int parallel_bfs_run(parallel_bfs_t * bfs,
+                     uint32_t         start,
+                     uint32_t *       levels,
+                     size_t *         reached)
+{
+    int             exit_code      = E_FAILURE;
+    bfs_direction_t direction      = BFS_TOP_DOWN;
+    size_t          node_count     = 0;
+    size_t          frontier_count = 1;
+    size_t          previous_count = 0;
+    size_t          frontier_edges = 0;
+    size_t          unexplored     = 0;
+    size_t          awakened       = 0;
+    size_t          edges          = 0;
+    size_t          total          = 1;
+    uint64_t *      swap_bits      = NULL;
+    uint32_t *      swap_queue     = NULL;
+
+    if ((NULL == bfs) || (NULL == levels))
+    {
+        PRINT_DEBUG("parallel_bfs_run(): NULL argument passed.\n");
+        goto END;
+    }
+
+    node_count = bfs->csr->node_count;
+    if (start >= node_count)
+    {
+        PRINT_DEBUG("parallel_bfs_run(): Start node out of range.\n");
+        goto END;
+    }
+
+    for (size_t node = 0; node < node_count; node++)
+    {
+        levels[node] = PARALLEL_BFS_UNREACHED;
+    }
+    for (size_t word = 0; word < bfs->word_count; word++)
+    {
+        atomic_store_explicit(&bfs->visited[word], 0, memory_order_relaxed);
+    }
+
+    levels[start] = 0;
+    atomic_fetch_or_explicit(&bfs->visited[start / BITS_PER_WORD],
+                             (uint64_t)1 << (start % BITS_PER_WORD),
+                             memory_order_relaxed);
+    bfs->queue[0]  = start;
+    bfs->levels    = levels;
+    frontier_edges = out_degree(bfs->csr, start);
+    unexplored     = bfs->csr->edge_count - frontier_edges;
+
+    for (bfs->depth = 0; 0 != frontier_count; bfs->depth++)
+    {
+        // Switch only while the frontier is growing or shrinking respectively
+        if ((BFS_TOP_DOWN == direction) && (frontier_count > previous_count) &&
+            (frontier_edges > (unexplored / TOP_DOWN_ALPHA)))
+        {
+            queue_to_bitmap(bfs, frontier_count);
+            direction = BFS_BOTTOM_UP;
+        }
+        else if ((BFS_BOTTOM_UP == direction) &&
+                 (frontier_count < previous_count) &&
+                 (frontier_count < (node_count / BOTTOM_UP_BETA)))
+        {
+            frontier_count = bitmap_to_queue(bfs);
+            direction      = BFS_TOP_DOWN;
+        }
+
+        exit_code = run_level(bfs,
+                              direction,
+                              (BFS_TOP_DOWN == direction) ? frontier_count
+                                                          : bfs->word_count,
+                              &awakened,
+                              &edges);
+        if (E_SUCCESS != exit_code)
+        {
+            goto END;
+        }
+
+        if (BFS_TOP_DOWN == direction)
+        {
+            swap_queue      = bfs->queue;
+            bfs->queue      = bfs->next_queue;
+            bfs->next_queue = swap_queue;
+        }
+        else
+        {
+            swap_bits     = bfs->frontier;
+            bfs->frontier = bfs->next;
+            bfs->next     = swap_bits;
+        }
+
+        total += awakened;
+        unexplored -= edges;
+        previous_count = frontier_count;
+        frontier_count = awakened;
+        frontier_edges = edges;
+    }
+
+    if (NULL != reached)
+    {
+        *reached = total;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void parallel_bfs_destroy(parallel_bfs_t ** bfs)
+{
+    if ((NULL == bfs) || (NULL == *bfs))
+    {
+        goto END;
+    }
+
+    task_group_destroy(&(*bfs)->group);
+    free((*bfs)->tasks);
+    free((*bfs)->in_offsets);
+    free((*bfs)->in_sources);
+    free((*bfs)->visited);
+    free((*bfs)->frontier);
+    free((*bfs)->next);
+    free((*bfs)->queue);
+    free((*bfs)->next_queue);
+    free(*bfs);
+    *bfs = NULL;
+
+END:
+    return;
+}
+
+int parallel_csr_bfs(thread_pool_t *     thread_pool,
+                     const graph_csr_t * csr,
+                     uint32_t            start,
+                     uint32_t *          levels)
+{
+    int              exit_code = E_FAILURE;
+    parallel_bfs_t * bfs       = NULL;
+
+    bfs = parallel_bfs_create(thread_pool, csr);
+    if (NULL == bfs)
+    {
+        PRINT_DEBUG("parallel_csr_bfs(): Unable to create search state.\n");
+        goto END;
+    }
+
+    exit_code = parallel_bfs_run(bfs, start, levels, NULL);
+
+END:
+    parallel_bfs_destroy(&bfs);
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static int build_reverse(parallel_bfs_t * bfs)
+{
+    int                 exit_code = E_FAILURE;
+    const graph_csr_t * csr       = bfs->csr;
+    size_t *            cursor    = NULL;
+
+    bfs->in_offsets = calloc((size_t)csr->node_count + 1, sizeof(size_t));
+    bfs->in_sources = calloc(csr->edge_count + 1, sizeof(uint32_t));
+    cursor          = calloc((size_t)csr->node_count + 1, sizeof(size_t));
+    if ((NULL == bfs->in_offsets) || (NULL == bfs->in_sources) ||
+        (NULL == cursor))
+    {
+        PRINT_DEBUG("build_reverse(): CMR failure.\n");
+        goto END;
+    }
+
+    for (size_t edge = 0; edge < csr->edge_count; edge++)
+    {
+        bfs->in_offsets[csr->neighbors[edge] + 1]++;
+    }
+    for (uint32_t node = 0; node < csr->node_count; node++)
+    {
+        bfs->in_offsets[node + 1] += bfs->in_offsets[node];
+        cursor[node] = bfs->in_offsets[node];
+    }
+
+    for (uint32_t node = 0; node < csr->node_count; node++)
+    {
+        for (size_t edge = csr->offsets[node]; edge < csr->offsets[node + 1];
+             edge++)
+        {
+            bfs->in_sources[cursor[csr->neighbors[edge]]++] = node;
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    free(cursor);
+    return exit_code;
+}
+
+static int run_level(parallel_bfs_t * bfs,
+                     bfs_direction_t  direction,
+                     size_t           count,
+                     size_t *         awakened,
+                     size_t *         edges)
+{
+    int             exit_code  = E_FAILURE;
+    task_function_t routine    = top_down_routine;
+    size_t          grain      = MIN_TASK_NODES;
+    size_t          task_count = 0;
+    size_t          slice      = 0;
+    size_t          begin      = 0;
+    size_t          end        = 0;
+
+    if (BFS_BOTTOM_UP == direction)
+    {
+        routine = bottom_up_routine;
+        grain   = MIN_TASK_NODES / BITS_PER_WORD;
+    }
+
+    task_count = count / grain;
+    task_count = (task_count > bfs->max_tasks) ? bfs->max_tasks : task_count;
+    task_count = (0 == task_count) ? 1 : task_count;
+    slice      = (count + task_count - 1) / task_count;
+
+    atomic_store_explicit(&bfs->next_tail, 0, memory_order_relaxed);
+    for (size_t task = 0; task < task_count; task++)
+    {
+        begin = task * slice;
+        begin = (begin > count) ? count : begin;
+        end   = ((count - begin) > slice) ? (begin + slice) : count;
+
+        bfs->tasks[task].bfs      = bfs;
+        bfs->tasks[task].begin    = begin;
+        bfs->tasks[task].end      = end;
+        bfs->tasks[task].awakened = 0;
+        bfs->tasks[task].edges    = 0;
+    }
+
+    // Small levels are not worth a round trip through the pool
+    if (1 == task_count)
+    {
+        routine(&bfs->tasks[0]);
+    }
+    else
+    {
+        for (size_t task = 0; task < task_count; task++)
+        {
+            if (E_SUCCESS !=
+                task_group_submit(bfs->group, routine, &bfs->tasks[task]))
+            {
+                PRINT_DEBUG("run_level(): Unable to submit task.\n");
+                task_group_wait(bfs->group);
+                goto END;
+            }
+        }
+
+        if (E_SUCCESS != task_group_wait(bfs->group))
+        {
+            goto END;
+        }
+    }
+
+    *awakened = 0;
+    *edges    = 0;
+    for (size_t task = 0; task < task_count; task++)
+    {
+        *awakened += bfs->tasks[task].awakened;
+        *edges += bfs->tasks[task].edges;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static void * top_down_routine(void * data)
+{
+    bfs_task_t *        task    = (bfs_task_t *)data;
+    parallel_bfs_t *    bfs     = task->bfs;
+    const graph_csr_t * csr     = bfs->csr;
+    uint32_t            local[LOCAL_QUEUE_SIZE];
+    size_t              pending = 0;
+    uint32_t            node    = 0;
+    uint32_t            target  = 0;
+    uint64_t            bit     = 0;
+
+    for (size_t idx = task->begin; idx < task->end; idx++)
+    {
+        node = bfs->queue[idx];
+        for (size_t edge = csr->offsets[node]; edge < csr->offsets[node + 1];
+             edge++)
+        {
+            target = csr->neighbors[edge];
+            bit    = (uint64_t)1 << (target % BITS_PER_WORD);
+
+            // Test first so claimed nodes cost a load, not a locked RMW
+            if ((0 != (atomic_load_explicit(
+                           &bfs->visited[target / BITS_PER_WORD],
+                           memory_order_relaxed) &
+                       bit)) ||
+                (0 != (atomic_fetch_or_explicit(
+                           &bfs->visited[target / BITS_PER_WORD],
+                           bit,
+                           memory_order_relaxed) &
+                       bit)))
+            {
+                continue;
+            }
+
+            bfs->levels[target] = bfs->depth + 1;
+            task->awakened++;
+            task->edges += out_degree(csr, target);
+
+            local[pending++] = target;
+            if (LOCAL_QUEUE_SIZE == pending)
+            {
+                publish(bfs, local, &pending);
+            }
+        }
+    }
+
+    publish(bfs, local, &pending);
+    return NULL;
+}
+
+static void * bottom_up_routine(void * data)
+{
+    bfs_task_t *        task       = (bfs_task_t *)data;
+    parallel_bfs_t *    bfs        = task->bfs;
+    const graph_csr_t * csr        = bfs->csr;
+    uint64_t            candidates = 0;
+    uint64_t            found      = 0;
+    uint32_t            node       = 0;
+    uint32_t            parent     = 0;
+    int                 bit        = 0;
+
+    // Each task owns whole words, so 'next' and 'visited' need no locking
+    for (size_t word = task->begin; word < task->end; word++)
+    {
+        candidates = ~atomic_load_explicit(&bfs->visited[word],
+                                           memory_order_relaxed) &
+                     word_mask(bfs, word);
+        found      = 0;
+
+        while (0 != candidates)
+        {
+            bit  = __builtin_ctzll(candidates);
+            node = (uint32_t)((word * BITS_PER_WORD) + (size_t)bit);
+            candidates &= candidates - 1;
+
+            for (size_t edge = bfs->in_offsets[node];
+                 edge < bfs->in_offsets[node + 1];
+                 edge++)
+            {
+                parent = bfs->in_sources[edge];
+                if (0 != ((bfs->frontier[parent / BITS_PER_WORD] >>
+                           (parent % BITS_PER_WORD)) &
+                          1))
+                {
+                    found |= (uint64_t)1 << bit;
+                    bfs->levels[node] = bfs->depth + 1;
+                    task->edges += out_degree(csr, node);
+                    break;
+                }
+            }
+        }
+
+        bfs->next[word] = found;
+        if (0 != found)
+        {
+            atomic_fetch_or_explicit(
+                &bfs->visited[word], found, memory_order_relaxed);
+            task->awakened += (size_t)__builtin_popcountll(found);
+        }
+    }
+
+    return NULL;
+}
+
+static void publish(parallel_bfs_t * bfs, uint32_t * local, size_t * count)
+{
+    size_t position = 0;
+
+    if (0 != *count)
+    {
+        position = atomic_fetch_add_explicit(
+            &bfs->next_tail, *count, memory_order_relaxed);
+        memcpy(&bfs->next_queue[position], local, *count * sizeof(uint32_t));
+        *count = 0;
+    }
+}
+
+static void queue_to_bitmap(parallel_bfs_t * bfs, size_t count)
+{
+    uint32_t node = 0;
+
+    memset(bfs->frontier, 0, bfs->word_count * sizeof(uint64_t));
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        node = bfs->queue[idx];
+        bfs->frontier[node / BITS_PER_WORD] |= (uint64_t)1
+                                               << (node % BITS_PER_WORD);
+    }
+}
+
+static size_t bitmap_to_queue(parallel_bfs_t * bfs)
+{
+    size_t   count = 0;
+    uint64_t bits  = 0;
+
+    for (size_t word = 0; word < bfs->word_count; word++)
+    {
+        bits = bfs->frontier[word];
+        while (0 != bits)
+        {
+            bfs->queue[count++] = (uint32_t)((word * BITS_PER_WORD) +
+                                             (size_t)__builtin_ctzll(bits));
+            bits &= bits - 1;
+        }
+    }
+
+    return count;
+}
+
+static uint64_t word_mask(const parallel_bfs_t * bfs, size_t word)
+{
+    size_t first = word * BITS_PER_WORD;
+    size_t count = bfs->csr->node_count;
+
+    if (count >= (first + BITS_PER_WORD))
+    {
+        return UINT64_MAX;
+    }
+
+    return (count > first) ? (((uint64_t)1 << (count - first)) - 1) : 0;
+}
+
+static size_t out_degree(const graph_csr_t * csr, uint32_t node)
+{
+    return csr->offsets[node + 1] - csr->offsets[node];
+}
+
+/*** end of file ***/
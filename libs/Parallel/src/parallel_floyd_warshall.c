@@ -0,0 +1,583 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parallel_floyd_warshall.h"
+#include "task_group.h"
+#include "utilities.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PARALLEL_FW_X86 1
+#include <immintrin.h>
+#endif
+
+#define INFINITY_DISTANCE GRAPH_DISTANCE_INFINITY
+
+/**
+ * @brief A pointer to a kernel that relaxes one row segment through a run of
+ * intermediate nodes:
+ *
+ *     destination[j] = min(destination[j],
+ *                          via_distances[v] + via_rows[(v * stride) + j])
+ *
+ * for every v in [0, via_count) and j in [0, count). Sums that overflow are
+ * ignored, which is the same as saturating them to infinity.
+ */
+typedef void (*MIN_PLUS_F)(size_t *       destination,
+                           const size_t * via_distances,
+                           const size_t * via_rows,
+                           size_t         stride,
+                           size_t         via_count,
+                           size_t         count);
+
+/**
+ * @brief State shared by all tasks of one Floyd-Warshall run
+ */
+typedef struct fw_context
+{
+    size_t *   distances;   // Matrix being updated
+    size_t     node_count;  // Rows (and columns) in the matrix
+    size_t     block_count; // Tiles per row of the matrix
+    size_t     round;       // Block row/column of the current diagonal tile
+    MIN_PLUS_F min_plus;    // Inner-loop kernel
+} fw_context_t;
+
+/**
+ * @brief One block row (or row and column) of a phase
+ */
+typedef struct fw_task
+{
+    fw_context_t * context; // Shared state
+    size_t         block;   // Index of the block handled by this task
+} fw_task_t;
+
+/**
+ * @brief Picks the fastest min-plus kernel the CPU supports.
+ */
+static MIN_PLUS_F select_kernel(void);
+
+/**
+ * @brief Relaxes one tile through every intermediate node of a block.
+ *
+ * @param context Shared state.
+ * @param row_block Block row of the tile being updated.
+ * @param column_block Block column of the tile being updated.
+ * @param via_block Block holding the intermediate nodes.
+ */
+static void update_tile(const fw_context_t * context,
+                        size_t               row_block,
+                        size_t               column_block,
+                        size_t               via_block);
+
+/**
+ * @brief Relaxes a tile whose row and column blocks both differ from the
+ * intermediate block. Neither input tile changes, so each destination row can
+ * be kept in registers across all intermediates.
+ */
+static void update_remainder_tile(const fw_context_t * context,
+                                  size_t               row_block,
+                                  size_t               column_block,
+                                  size_t               via_block);
+
+/**
+ * @brief Submits one task per block other than the current round and waits.
+ */
+static int run_phase(task_group_t *  group,
+                     fw_task_t *     tasks,
+                     fw_context_t *  context,
+                     task_function_t routine);
+
+/**
+ * @brief Updates the tiles in the round's block row and block column.
+ */
+static void * cross_task_routine(void * data);
+
+/**
+ * @brief Updates the tiles of one block row outside the round's cross.
+ */
+static void * remainder_task_routine(void * data);
+
+static void min_plus_scalar(size_t *       destination,
+                            const size_t * via_distances,
+                            const size_t * via_rows,
+                            size_t         stride,
+                            size_t         via_count,
+                            size_t         count);
+
+#ifdef PARALLEL_FW_X86
+_Static_assert(sizeof(size_t) == sizeof(uint64_t),
+               "SIMD kernels assume 64-bit size_t");
+
+static void min_plus_avx2(size_t *       destination,
+                          const size_t * via_distances,
+                          const size_t * via_rows,
+                          size_t         stride,
+                          size_t         via_count,
+                          size_t         count);
+static void min_plus_avx512(size_t *       destination,
+                            const size_t * via_distances,
+                            const size_t * via_rows,
+                            size_t         stride,
+                            size_t         via_count,
+                            size_t         count);
+#endif
+
+int parallel_floyd_warshall(thread_pool_t * thread_pool,
+                            size_t *        distances,
+                            size_t          node_count)
+{
+    int            exit_code = E_FAILURE;
+    task_group_t * group     = NULL;
+    fw_task_t *    tasks     = NULL;
+    fw_context_t   context   = { 0 };
+
+    if (NULL == distances)
+    {
+        PRINT_DEBUG("parallel_floyd_warshall(): NULL argument passed.\n");
+        goto END;
+    }
+
+    context.distances   = distances;
+    context.node_count  = node_count;
+    context.block_count =
+        (node_count + PARALLEL_FW_BLOCK_SIZE - 1) / PARALLEL_FW_BLOCK_SIZE;
+    context.min_plus = select_kernel();
+
+    if (0 == context.block_count)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    tasks = calloc(context.block_count, sizeof(fw_task_t));
+    if (NULL == tasks)
+    {
+        PRINT_DEBUG("parallel_floyd_warshall(): CMR failure.\n");
+        goto END;
+    }
+
+    // A single tile has nothing to run alongside it
+    group = task_group_create((1 < context.block_count) ? thread_pool : NULL);
+    if (NULL == group)
+    {
+        PRINT_DEBUG("parallel_floyd_warshall(): Unable to create group.\n");
+        goto END;
+    }
+
+    for (size_t block = 0; block < context.block_count; block++)
+    {
+        tasks[block].context = &context;
+        tasks[block].block   = block;
+    }
+
+    for (context.round = 0; context.round < context.block_count;
+         context.round++)
+    {
+        // Phase 1: the diagonal tile depends only on itself
+        update_tile(&context, context.round, context.round, context.round);
+
+        // Phase 2: the cross depends on the diagonal tile
+        exit_code = run_phase(group, tasks, &context, cross_task_routine);
+        if (E_SUCCESS != exit_code)
+        {
+            goto END;
+        }
+
+        // Phase 3: everything else depends on the cross
+        exit_code = run_phase(group, tasks, &context, remainder_task_routine);
+        if (E_SUCCESS != exit_code)
+        {
+            goto END;
+        }
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    task_group_destroy(&group);
+    free(tasks);
+    return exit_code;
+}
+
+int parallel_graph_floyd_warshall(thread_pool_t * thread_pool,
+                                  graph_t *       graph,
+                                  size_t **       distances)
+{
+    int      exit_code = E_FAILURE;
+    size_t * matrix    = NULL;
+
+    if ((NULL == graph) || (NULL == distances))
+    {
+        PRINT_DEBUG("parallel_graph_floyd_warshall(): NULL argument passed.\n");
+        goto END;
+    }
+
+    exit_code = graph_distance_matrix(graph, &matrix);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG(
+            "parallel_graph_floyd_warshall(): Unable to build matrix.\n");
+        goto END;
+    }
+
+    exit_code = parallel_floyd_warshall(thread_pool, matrix, graph->node_count);
+    if (E_SUCCESS != exit_code)
+    {
+        free(matrix);
+        goto END;
+    }
+
+    *distances = matrix;
+END:
+    return exit_code;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static MIN_PLUS_F select_kernel(void)
+{
+#ifdef PARALLEL_FW_X86
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return min_plus_avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return min_plus_avx2;
+    }
+#endif
+    return min_plus_scalar;
+}
+
+static void update_tile(const fw_context_t * context,
+                        size_t               row_block,
+                        size_t               column_block,
+                        size_t               via_block)
+{
+    size_t   count        = context->node_count;
+    size_t   row_start    = row_block * PARALLEL_FW_BLOCK_SIZE;
+    size_t   column_start = column_block * PARALLEL_FW_BLOCK_SIZE;
+    size_t   via_start    = via_block * PARALLEL_FW_BLOCK_SIZE;
+    size_t   row_end      = row_start + PARALLEL_FW_BLOCK_SIZE;
+    size_t   column_end   = column_start + PARALLEL_FW_BLOCK_SIZE;
+    size_t   via_end      = via_start + PARALLEL_FW_BLOCK_SIZE;
+    size_t * row          = NULL;
+
+    // The last block may be partial
+    row_end    = (row_end > count) ? count : row_end;
+    column_end = (column_end > count) ? count : column_end;
+    via_end    = (via_end > count) ? count : via_end;
+
+    // Intermediates must be outermost for the diagonal and cross tiles
+    for (size_t via = via_start; via < via_end; via++)
+    {
+        for (size_t from = row_start; from < row_end; from++)
+        {
+            row = &context->distances[from * count];
+            if (INFINITY_DISTANCE == row[via])
+            {
+                continue;
+            }
+
+            context->min_plus(&row[column_start],
+                              &row[via],
+                              &context->distances[(via * count) + column_start],
+                              count,
+                              1,
+                              column_end - column_start);
+        }
+    }
+}
+
+static void update_remainder_tile(const fw_context_t * context,
+                                  size_t               row_block,
+                                  size_t               column_block,
+                                  size_t               via_block)
+{
+    size_t   count        = context->node_count;
+    size_t   row_start    = row_block * PARALLEL_FW_BLOCK_SIZE;
+    size_t   column_start = column_block * PARALLEL_FW_BLOCK_SIZE;
+    size_t   via_start    = via_block * PARALLEL_FW_BLOCK_SIZE;
+    size_t   row_end      = row_start + PARALLEL_FW_BLOCK_SIZE;
+    size_t   column_end   = column_start + PARALLEL_FW_BLOCK_SIZE;
+    size_t   via_end      = via_start + PARALLEL_FW_BLOCK_SIZE;
+    size_t * row          = NULL;
+    size_t * via_rows     = NULL;
+
+    row_end    = (row_end > count) ? count : row_end;
+    column_end = (column_end > count) ? count : column_end;
+    via_end    = (via_end > count) ? count : via_end;
+    via_rows   = &context->distances[(via_start * count) + column_start];
+
+    for (size_t from = row_start; from < row_end; from++)
+    {
+        row = &context->distances[from * count];
+        context->min_plus(&row[column_start],
+                          &row[via_start],
+                          via_rows,
+                          count,
+                          via_end - via_start,
+                          column_end - column_start);
+    }
+}
+
+static int run_phase(task_group_t *  group,
+                     fw_task_t *     tasks,
+                     fw_context_t *  context,
+                     task_function_t routine)
+{
+    int exit_code = E_FAILURE;
+
+    for (size_t block = 0; block < context->block_count; block++)
+    {
+        if (block == context->round)
+        {
+            continue;
+        }
+
+        if (E_SUCCESS != task_group_submit(group, routine, &tasks[block]))
+        {
+            PRINT_DEBUG("run_phase(): Unable to submit task.\n");
+            task_group_wait(group);
+            goto END;
+        }
+    }
+
+    exit_code = task_group_wait(group);
+END:
+    return exit_code;
+}
+
+static void * cross_task_routine(void * data)
+{
+    fw_task_t *    task    = (fw_task_t *)data;
+    fw_context_t * context = task->context;
+
+    update_tile(context, context->round, task->block, context->round);
+    update_tile(context, task->block, context->round, context->round);
+
+    return NULL;
+}
+
+static void * remainder_task_routine(void * data)
+{
+    fw_task_t *    task    = (fw_task_t *)data;
+    fw_context_t * context = task->context;
+
+    for (size_t column = 0; column < context->block_count; column++)
+    {
+        if (column != context->round)
+        {
+            update_remainder_tile(
+                context, task->block, column, context->round);
+        }
+    }
+
+    return NULL;
+}
+
+static void min_plus_scalar(size_t *       destination,
+                            const size_t * via_distances,
+                            const size_t * via_rows,
+                            size_t         stride,
+                            size_t         via_count,
+                            size_t         count)
+{
+    const size_t * source       = NULL;
+    size_t         via_distance = 0;
+    size_t         candidate    = 0;
+
+    for (size_t via = 0; via < via_count; via++)
+    {
+        via_distance = via_distances[via];
+        if (INFINITY_DISTANCE == via_distance)
+        {
+            continue;
+        }
+
+        source = &via_rows[via * stride];
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            // Branch-free so the compiler can vectorize the loop
+            candidate = via_distance + source[idx];
+            candidate = (candidate < via_distance) ? INFINITY_DISTANCE
+                                                   : candidate;
+            destination[idx] =
+                (candidate < destination[idx]) ? candidate : destination[idx];
+        }
+    }
+}
+
+#ifdef PARALLEL_FW_X86
+#define AVX2_LANES    4
+#define AVX2_UNROLL   4
+#define AVX512_LANES  8
+#define AVX512_UNROLL 8
+
+/*
+ * AVX2 only compares signed 64-bit lanes. Accumulators are kept with the sign
+ * bit flipped so that signed comparisons order them as unsigned values.
+ */
+__attribute__((target("avx2"))) static inline __m256i min_plus_step_avx2(
+    __m256i biased_acc, __m256i via, __m256i biased_via, __m256i through)
+{
+    const __m256i bias       = _mm256_set1_epi64x(INT64_MIN);
+    __m256i       biased_sum = _mm256_xor_si256(_mm256_add_epi64(via, through),
+                                          bias);
+
+    // A sum below 'via' wrapped around and must not be taken
+    __m256i wrapped = _mm256_cmpgt_epi64(biased_via, biased_sum);
+    __m256i shorter = _mm256_cmpgt_epi64(biased_acc, biased_sum);
+
+    shorter = _mm256_andnot_si256(wrapped, shorter);
+    return _mm256_blendv_epi8(biased_acc, biased_sum, shorter);
+}
+
+__attribute__((target("avx2"))) static void min_plus_avx2(
+    size_t *       destination,
+    const size_t * via_distances,
+    const size_t * via_rows,
+    size_t         stride,
+    size_t         via_count,
+    size_t         count)
+{
+    const __m256i  bias   = _mm256_set1_epi64x(INT64_MIN);
+    const size_t * source = NULL;
+    __m256i        acc[AVX2_UNROLL];
+    __m256i        via;
+    __m256i        biased_via;
+    size_t         idx = 0;
+
+    // Fixed-width strips let the accumulators live in registers
+    for (; (idx + (AVX2_LANES * AVX2_UNROLL)) <= count;
+         idx += (AVX2_LANES * AVX2_UNROLL))
+    {
+        for (size_t lane = 0; lane < AVX2_UNROLL; lane++)
+        {
+            acc[lane] = _mm256_xor_si256(
+                _mm256_loadu_si256(
+                    (const __m256i *)&destination[idx + (lane * AVX2_LANES)]),
+                bias);
+        }
+
+        for (size_t step = 0; step < via_count; step++)
+        {
+            if (INFINITY_DISTANCE == via_distances[step])
+            {
+                continue;
+            }
+
+            via        = _mm256_set1_epi64x((long long)via_distances[step]);
+            biased_via = _mm256_xor_si256(via, bias);
+            source     = &via_rows[(step * stride) + idx];
+            for (size_t lane = 0; lane < AVX2_UNROLL; lane++)
+            {
+                acc[lane] = min_plus_step_avx2(
+                    acc[lane],
+                    via,
+                    biased_via,
+                    _mm256_loadu_si256(
+                        (const __m256i *)&source[lane * AVX2_LANES]));
+            }
+        }
+
+        for (size_t lane = 0; lane < AVX2_UNROLL; lane++)
+        {
+            _mm256_storeu_si256(
+                (__m256i *)&destination[idx + (lane * AVX2_LANES)],
+                _mm256_xor_si256(acc[lane], bias));
+        }
+    }
+
+    min_plus_scalar(&destination[idx],
+                    via_distances,
+                    &via_rows[idx],
+                    stride,
+                    via_count,
+                    count - idx);
+}
+
+__attribute__((target("avx512f"))) static void min_plus_avx512(
+    size_t *       destination,
+    const size_t * via_distances,
+    const size_t * via_rows,
+    size_t         stride,
+    size_t         via_count,
+    size_t         count)
+{
+    const size_t * source = NULL;
+    __m512i        acc[AVX512_UNROLL];
+    __m512i        via;
+    __m512i        sum;
+    __mmask8       valid = 0;
+    __mmask8       mask  = 0;
+    size_t         idx   = 0;
+
+    // Fixed-width strips let the accumulators live in registers
+    for (; (idx + (AVX512_LANES * AVX512_UNROLL)) <= count;
+         idx += (AVX512_LANES * AVX512_UNROLL))
+    {
+        for (size_t lane = 0; lane < AVX512_UNROLL; lane++)
+        {
+            acc[lane] =
+                _mm512_loadu_si512(&destination[idx + (lane * AVX512_LANES)]);
+        }
+
+        for (size_t step = 0; step < via_count; step++)
+        {
+            if (INFINITY_DISTANCE == via_distances[step])
+            {
+                continue;
+            }
+
+            via    = _mm512_set1_epi64((long long)via_distances[step]);
+            source = &via_rows[(step * stride) + idx];
+            for (size_t lane = 0; lane < AVX512_UNROLL; lane++)
+            {
+                sum = _mm512_add_epi64(
+                    via, _mm512_loadu_si512(&source[lane * AVX512_LANES]));
+
+                // A sum below 'via' wrapped around and must not be taken
+                valid     = _mm512_cmpge_epu64_mask(sum, via);
+                acc[lane] = _mm512_mask_min_epu64(acc[lane], valid, acc[lane],
+                                                  sum);
+            }
+        }
+
+        for (size_t lane = 0; lane < AVX512_UNROLL; lane++)
+        {
+            _mm512_storeu_si512(&destination[idx + (lane * AVX512_LANES)],
+                                acc[lane]);
+        }
+    }
+
+    // Masked loads cover the remaining columns without a scalar tail
+    for (; idx < count; idx += AVX512_LANES)
+    {
+        mask   = ((count - idx) >= AVX512_LANES)
+                     ? (__mmask8)0xFF
+                     : (__mmask8)((1U << (count - idx)) - 1);
+        acc[0] = _mm512_maskz_loadu_epi64(mask, &destination[idx]);
+
+        for (size_t step = 0; step < via_count; step++)
+        {
+            if (INFINITY_DISTANCE == via_distances[step])
+            {
+                continue;
+            }
+
+            via    = _mm512_set1_epi64((long long)via_distances[step]);
+            sum    = _mm512_add_epi64(
+                via,
+                _mm512_maskz_loadu_epi64(
+                    mask, &via_rows[(step * stride) + idx]));
+            valid  = _mm512_cmpge_epu64_mask(sum, via);
+            acc[0] = _mm512_mask_min_epu64(acc[0], valid, acc[0], sum);
+        }
+
+        _mm512_mask_storeu_epi64(&destination[idx], mask, acc[0]);
+    }
+}
+#endif /* PARALLEL_FW_X86 */
+
+/*** end of file ***/
@@ -0,0 +1,1151 @@
+// NOLINTNEXTLINE
+#define _GNU_SOURCE // madvise()
+
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h> // memchr(), memcpy()
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "parallel_graph_load.h"
+#include "task_group.h"
+#include "utilities.h"
+
+#define MIN_CHUNK_BYTES   (1 << 20) // Smallest slice of a text file per task
+#define MIN_CHUNK_EDGES   65536     // Smallest slice of an array per task
+#define CHUNKS_PER_THREAD 4    // Text slices per worker, to even out line mix
+#define MIN_DENSE_IDS     65536 // Always renumber through a table below this
+#define RADIX_BITS        8
+#define RADIX_BUCKETS     (1 << RADIX_BITS)
+#define RADIX_MASK        ((uint64_t)RADIX_BUCKETS - 1)
+#define ID_MASK           ((uint64_t)UINT32_MAX)
+
+/**
+ * @brief An edge being loaded.
+ *
+ * Until the nodes are renumbered the key holds the raw IDs as
+ * (source << 32) | target; afterwards it holds the node indices as
+ * (source << shift) | target, so sorting by key sorts by row then column.
+ */
+typedef struct load_edge
+{
+    uint64_t key;
+    size_t   weight;
+} load_edge_t;
+
+/**
+ * @brief The phases of a load
+ */
+typedef enum
+{
+    LOAD_PARSE,   // Parse a byte range of a text file into the task's buffer
+    LOAD_GATHER,  // Move the task's parsed edges into the shared edge array
+    LOAD_DECODE,  // Copy a range of binary records into the edge array
+    LOAD_MARK,    // Flag the IDs used by a range of edges
+    LOAD_COLLECT, // Copy the IDs used by a range of edges into one array
+    LOAD_REMAP,   // Replace the IDs of a range of edges by node indices
+    LOAD_COUNT,   // Count one digit of a range of sort keys
+    LOAD_SCATTER  // Move a range of sort keys into their buckets
+} load_phase_t;
+
+typedef struct load_context load_context_t;
+
+/**
+ * @brief One slice of a phase
+ */
+typedef struct load_task
+{
+    load_context_t * context;  // Shared state
+    size_t           index;    // Position of this task in the task array
+    size_t           begin;    // First byte, record, edge or key of the slice
+    size_t           end;      // One past the last one
+    load_edge_t *    edges;    // Edges parsed from a text slice
+    size_t           count;    // Entries used in 'edges'
+    size_t           capacity; // Entries allocated in 'edges'
+    size_t           offset;   // Where 'edges' goes in the shared edge array
+    uint32_t         max_id;   // Largest ID seen in the slice
+    bool             failed;   // Slice was malformed or out of memory
+} load_task_t;
+
+struct load_context
+{
+    const char *    map;         // Contents of the file
+    size_t          map_size;    // Bytes in 'map'
+    load_edge_t *   edges;       // Edges in file order, then reversed copies
+    size_t          edge_count;  // Edges read from the file
+    bool            undirected;  // Whether reversed copies follow the edges
+    atomic_uchar *  present;     // Flag per ID, for table renumbering
+    uint32_t *      remap;       // Node index per ID, for table renumbering
+    uint32_t *      labels;      // ID of each node index, ascending
+    uint32_t        node_count;  // Entries in 'labels'
+    unsigned        shift;       // Bits of a node index within a sort key
+    load_edge_t *   edge_source; // Edges read by the current sort pass
+    load_edge_t *   edge_target; // Edges written by the current sort pass
+    uint32_t *      id_source;   // IDs read by the current sort pass
+    uint32_t *      id_target;   // IDs written by the current sort pass
+    bool            sort_ids;    // Whether the sort runs on IDs or edges
+    unsigned        digit;       // Shift of the digit being sorted on
+    size_t *        histograms;  // [max_tasks][RADIX_BUCKETS]
+    load_task_t *   tasks;       // Task slots
+    size_t          max_tasks;   // Number of slots in 'tasks'
+    size_t          task_count;  // Slots used by the current phase
+    size_t          workers;     // Threads in the pool, at least 1
+    task_group_t *  group;       // Group bound to the caller's pool
+    load_phase_t    phase;       // Phase currently being executed
+};
+
+/**
+ * @brief Maps a whole file read-only into memory.
+ *
+ * @param path Path of the file.
+ * @param map Set to the contents, or NULL for an empty file.
+ * @param size Set to the size of the file.
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int map_file(const char * path, const char ** map, size_t * size);
+
+/**
+ * @brief Parses a text file into context->edges.
+ *
+ * @return E_SUCCESS on success, E_FAILURE if malformed or on failure.
+ */
+static int read_text(load_context_t * context, uint32_t * max_id);
+
+/**
+ * @brief Decodes a binary file into context->edges.
+ *
+ * @return E_SUCCESS on success, E_FAILURE if malformed or on failure.
+ */
+static int read_binary(load_context_t * context, uint32_t * max_id);
+
+/**
+ * @brief Gives every ID a dense node index and rewrites the edge keys.
+ *
+ * IDs up to a small multiple of the edge count are numbered through a lookup
+ * table; sparser IDs are sorted and looked up by binary search instead.
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int number_nodes(load_context_t * context, uint32_t max_id);
+
+/**
+ * @brief Stable LSD radix sort of the current sort source on its low 'bits'.
+ *
+ * The sorted data ends up in edge_source or id_source.
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int sort_keys(load_context_t * context, size_t count, unsigned bits);
+
+/**
+ * @brief Writes the sorted, deduplicated edges into a new snapshot.
+ *
+ * @return Pointer to the new snapshot, or NULL on failure.
+ */
+static graph_csr_t * build_csr(load_context_t *    context,
+                               const load_edge_t * edges,
+                               size_t              count);
+
+/**
+ * @brief Splits [0, count) into equal slices for the next phase.
+ */
+static void split_range(load_context_t * context, size_t count);
+
+/**
+ * @brief Runs every task of a phase and waits for them.
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int run_phase(load_context_t * context, load_phase_t phase);
+
+/**
+ * @brief Runs one slice of the current phase.
+ */
+static void * load_task_routine(void * data);
+
+/**
+ * @brief Parses the lines of one text slice into the task's buffer.
+ */
+static void parse_range(load_task_t * task);
+
+/**
+ * @brief Appends an edge to the task's buffer, growing it as needed.
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+static int append_edge(load_task_t * task, uint64_t key, size_t weight);
+
+/**
+ * @brief Reads an unsigned decimal number no larger than 'limit'.
+ *
+ * @param cursor Position to read from; advanced past the digits.
+ * @param end End of the input.
+ * @param limit Largest value accepted.
+ * @param value Set to the number read.
+ * @return true if at least one digit was read without overflow.
+ */
+static bool parse_number(const char ** cursor,
+                         const char *  end,
+                         uint64_t      limit,
+                         uint64_t *    value);
+
+/**
+ * @brief Skips spaces, tabs and carriage returns.
+ */
+static const char * skip_blanks(const char * cursor, const char * end);
+
+/**
+ * @brief Binary search for an ID in an ascending array of IDs.
+ *
+ * @return Its position, or GRAPH_CSR_NO_NODE if absent.
+ */
+static uint32_t find_label(const uint32_t * labels,
+                           uint32_t         count,
+                           uint32_t         id);
+
+/**
+ * @brief Number of bits needed to hold 'value'; at least 1.
+ */
+static unsigned bit_width(uint64_t value);
+
+graph_csr_t * parallel_graph_load(thread_pool_t *                 thread_pool,
+                                  const char *                    path,
+                                  const parallel_load_options_t * options)
+{
+    int            exit_code = E_FAILURE;
+    graph_csr_t *  csr       = NULL;
+    load_context_t context   = { 0 };
+    load_edge_t *  scratch   = NULL;
+    uint32_t       max_id    = 0;
+    size_t         total     = 0;
+
+    if ((NULL == path) || (NULL == options))
+    {
+        PRINT_DEBUG("parallel_graph_load(): NULL argument passed.\n");
+        goto END;
+    }
+
+    context.undirected = options->undirected;
+    context.workers    = 1;
+    if (NULL != thread_pool)
+    {
+        context.workers = thread_pool_get_thread_count(thread_pool);
+        context.workers = (0 == context.workers) ? 1 : context.workers;
+    }
+    context.max_tasks = context.workers * CHUNKS_PER_THREAD;
+
+    context.tasks      = calloc(context.max_tasks, sizeof(load_task_t));
+    context.histograms = calloc(context.max_tasks * RADIX_BUCKETS,
+                                sizeof(size_t));
+    context.group      = task_group_create(thread_pool);
+    if ((NULL == context.tasks) || (NULL == context.histograms) ||
+        (NULL == context.group))
+    {
+        PRINT_DEBUG("parallel_graph_load(): CMR failure.\n");
+        goto END;
+    }
+
+    for (size_t task = 0; task < context.max_tasks; task++)
+    {
+        context.tasks[task].context = &context;
+        context.tasks[task].index   = task;
+    }
+
+    if (E_SUCCESS != map_file(path, &context.map, &context.map_size))
+    {
+        goto END;
+    }
+
+    if (PARALLEL_LOAD_TEXT == options->format)
+    {
+        if (E_SUCCESS != read_text(&context, &max_id))
+        {
+            goto END;
+        }
+    }
+    else if (PARALLEL_LOAD_BINARY == options->format)
+    {
+        if (E_SUCCESS != read_binary(&context, &max_id))
+        {
+            goto END;
+        }
+    }
+    else
+    {
+        PRINT_DEBUG("parallel_graph_load(): Invalid format.\n");
+        goto END;
+    }
+
+    // The file is no longer needed once every edge has been read
+    munmap((void *)context.map, context.map_size);
+    context.map = NULL;
+
+    if (E_SUCCESS != number_nodes(&context, max_id))
+    {
+        goto END;
+    }
+
+    total   = context.edge_count * (context.undirected ? 2 : 1);
+    scratch = malloc((total + 1) * sizeof(load_edge_t));
+    if (NULL == scratch)
+    {
+        PRINT_DEBUG("parallel_graph_load(): CMR failure.\n");
+        goto END;
+    }
+
+    context.edge_source = context.edges;
+    context.edge_target = scratch;
+    context.sort_ids    = false;
+    if (E_SUCCESS != sort_keys(&context, total, 2 * context.shift))
+    {
+        goto END;
+    }
+
+    csr = build_csr(&context, context.edge_source, total);
+    if (NULL == csr)
+    {
+        goto END;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    if (NULL != context.map)
+    {
+        munmap((void *)context.map, context.map_size);
+    }
+    if (NULL != context.tasks)
+    {
+        for (size_t task = 0; task < context.max_tasks; task++)
+        {
+            free(context.tasks[task].edges);
+        }
+    }
+    if (E_SUCCESS != exit_code)
+    {
+        free(context.labels);
+    }
+    task_group_destroy(&context.group);
+    free(scratch);
+    free(context.edges);
+    free(context.histograms);
+    free(context.tasks);
+    return csr;
+}
+
+uint32_t parallel_graph_load_index(const graph_csr_t * csr, uint32_t id)
+{
+    uint32_t index = GRAPH_CSR_NO_NODE;
+
+    if ((NULL == csr) || (NULL == csr->owned_data))
+    {
+        PRINT_DEBUG("parallel_graph_load_index(): NULL argument passed.\n");
+        goto END;
+    }
+
+    index = find_label((const uint32_t *)csr->owned_data, csr->node_count, id);
+
+END:
+    return index;
+}
+
+/****************************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ****************************************************************************/
+
+static int map_file(const char * path, const char ** map, size_t * size)
+{
+    int         exit_code = E_FAILURE;
+    int         file_fd   = -1;
+    struct stat info      = { 0 };
+    void *      contents  = NULL;
+
+    *map  = NULL;
+    *size = 0;
+
+    file_fd = open(path, O_RDONLY);
+    if (0 > file_fd)
+    {
+        PRINT_DEBUG("map_file(): Unable to open '%s'.\n", path);
+        goto END;
+    }
+
+    if ((0 != fstat(file_fd, &info)) || (!S_ISREG(info.st_mode)))
+    {
+        PRINT_DEBUG("map_file(): '%s' is not a regular file.\n", path);
+        goto END;
+    }
+
+    // mmap() rejects zero-length mappings; an empty file is an empty graph
+    if (0 == info.st_size)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    contents = mmap(
+        NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file_fd, 0);
+    if (MAP_FAILED == contents)
+    {
+        PRINT_DEBUG("map_file(): Unable to map '%s'.\n", path);
+        goto END;
+    }
+
+    // Each task streams through its slice once
+    (void)madvise(contents, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+    *map      = contents;
+    *size     = (size_t)info.st_size;
+    exit_code = E_SUCCESS;
+END:
+    if (0 <= file_fd)
+    {
+        close(file_fd);
+    }
+    return exit_code;
+}
+
+static int read_text(load_context_t * context, uint32_t * max_id)
+{
+    int          exit_code  = E_FAILURE;
+    size_t       task_count = 1;
+    size_t       position   = 0;
+    size_t       total      = 0;
+    const char * newline    = NULL;
+
+    if (NULL != context->map)
+    {
+        task_count = context->map_size / MIN_CHUNK_BYTES;
+    }
+    task_count = (task_count > context->max_tasks) ? context->max_tasks
+                                                   : task_count;
+    task_count = (0 == task_count) ? 1 : task_count;
+
+    // Move every cut forward to the start of a line
+    for (size_t task = 0; task < task_count; task++)
+    {
+        context->tasks[task].begin = position;
+
+        position = (context->map_size * (task + 1)) / task_count;
+        if ((position < context->map_size) &&
+            (position > context->tasks[task].begin))
+        {
+            newline = memchr(&context->map[position - 1],
+                             '\n',
+                             context->map_size - (position - 1));
+            position = (NULL == newline)
+                           ? context->map_size
+                           : (size_t)(newline - context->map) + 1;
+        }
+        position = (position < context->tasks[task].begin)
+                       ? context->tasks[task].begin
+                       : position;
+        position = (task + 1 == task_count) ? context->map_size : position;
+
+        context->tasks[task].end = position;
+    }
+
+    context->task_count = task_count;
+    if (E_SUCCESS != run_phase(context, LOAD_PARSE))
+    {
+        goto END;
+    }
+
+    for (size_t task = 0; task < task_count; task++)
+    {
+        if (context->tasks[task].failed)
+        {
+            PRINT_DEBUG("read_text(): Malformed edge list near byte %zu.\n",
+                        context->tasks[task].begin);
+            goto END;
+        }
+
+        context->tasks[task].offset = total;
+        total += context->tasks[task].count;
+        *max_id = (context->tasks[task].max_id > *max_id)
+                      ? context->tasks[task].max_id
+                      : *max_id;
+    }
+
+    context->edge_count = total;
+    context->edges      = malloc(
+        ((total * (context->undirected ? 2 : 1)) + 1) * sizeof(load_edge_t));
+    if (NULL == context->edges)
+    {
+        PRINT_DEBUG("read_text(): CMR failure.\n");
+        goto END;
+    }
+
+    exit_code = run_phase(context, LOAD_GATHER);
+END:
+    return exit_code;
+}
+
+static int read_binary(load_context_t * context, uint32_t * max_id)
+{
+    int    exit_code = E_FAILURE;
+    size_t count     = 0;
+
+    if (0 != (context->map_size % sizeof(parallel_edge_record_t)))
+    {
+        PRINT_DEBUG("read_binary(): File size is not a whole number of "
+                    "records.\n");
+        goto END;
+    }
+
+    count               = context->map_size / sizeof(parallel_edge_record_t);
+    context->edge_count = count;
+    context->edges      = malloc(
+        ((count * (context->undirected ? 2 : 1)) + 1) * sizeof(load_edge_t));
+    if (NULL == context->edges)
+    {
+        PRINT_DEBUG("read_binary(): CMR failure.\n");
+        goto END;
+    }
+
+    split_range(context, count);
+    if (E_SUCCESS != run_phase(context, LOAD_DECODE))
+    {
+        goto END;
+    }
+
+    for (size_t task = 0; task < context->task_count; task++)
+    {
+        *max_id = (context->tasks[task].max_id > *max_id)
+                      ? context->tasks[task].max_id
+                      : *max_id;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static int number_nodes(load_context_t * context, uint32_t max_id)
+{
+    int        exit_code = E_FAILURE;
+    size_t     ids       = context->edge_count * 2;
+    size_t     limit     = (size_t)max_id + 1;
+    uint32_t * scratch   = NULL;
+    uint32_t * collected = NULL;
+    uint32_t * sorted    = NULL;
+    uint32_t * resized   = NULL;
+    size_t     count     = 0;
+
+    // No node can be used without an edge, so either bound caps the count
+    limit           = (ids < limit) ? ids : limit;
+    context->labels = malloc((limit + 1) * sizeof(uint32_t));
+    if (NULL == context->labels)
+    {
+        PRINT_DEBUG("number_nodes(): CMR failure.\n");
+        goto END;
+    }
+
+    if (((size_t)max_id < ids) || ((size_t)max_id < MIN_DENSE_IDS))
+    {
+        context->present = calloc((size_t)max_id + 1, sizeof(atomic_uchar));
+        context->remap   = malloc(((size_t)max_id + 1) * sizeof(uint32_t));
+        if ((NULL == context->present) || (NULL == context->remap))
+        {
+            PRINT_DEBUG("number_nodes(): CMR failure.\n");
+            goto END;
+        }
+
+        split_range(context, context->edge_count);
+        if (E_SUCCESS != run_phase(context, LOAD_MARK))
+        {
+            goto END;
+        }
+
+        for (size_t id = 0; (0 != ids) && (id <= max_id); id++)
+        {
+            if (0 != atomic_load_explicit(&context->present[id],
+                                          memory_order_relaxed))
+            {
+                context->remap[id]       = (uint32_t)count;
+                context->labels[count++] = (uint32_t)id;
+            }
+        }
+    }
+    else
+    {
+        collected = malloc(ids * sizeof(uint32_t));
+        scratch   = malloc(ids * sizeof(uint32_t));
+        if ((NULL == collected) || (NULL == scratch))
+        {
+            PRINT_DEBUG("number_nodes(): CMR failure.\n");
+            goto END;
+        }
+
+        context->id_source = collected;
+        context->id_target = scratch;
+        split_range(context, context->edge_count);
+        if (E_SUCCESS != run_phase(context, LOAD_COLLECT))
+        {
+            goto END;
+        }
+
+        context->sort_ids = true;
+        if (E_SUCCESS != sort_keys(context, ids, bit_width(max_id)))
+        {
+            goto END;
+        }
+
+        sorted = context->id_source;
+        for (size_t idx = 0; idx < ids; idx++)
+        {
+            if ((0 == count) || (sorted[idx] != context->labels[count - 1]))
+            {
+                context->labels[count++] = sorted[idx];
+            }
+        }
+
+        // Keep only what the snapshot will hold on to
+        resized = realloc(context->labels, (count + 1) * sizeof(uint32_t));
+        context->labels = (NULL == resized) ? context->labels : resized;
+    }
+
+    if (GRAPH_CSR_NO_NODE <= count)
+    {
+        PRINT_DEBUG("number_nodes(): Too many nodes.\n");
+        goto END;
+    }
+
+    context->node_count = (uint32_t)count;
+    context->shift      = bit_width((0 == count) ? 0 : count - 1);
+
+    split_range(context, context->edge_count);
+    exit_code = run_phase(context, LOAD_REMAP);
+END:
+    free(context->present);
+    free(context->remap);
+    context->present = NULL;
+    context->remap   = NULL;
+    free(collected);
+    free(scratch);
+    return exit_code;
+}
+
+static int sort_keys(load_context_t * context, size_t count, unsigned bits)
+{
+    int           exit_code   = E_FAILURE;
+    size_t        running     = 0;
+    size_t        bucket_size = 0;
+    size_t *      slot        = NULL;
+    bool          is_trivial  = false;
+    load_edge_t * edge_swap   = NULL;
+    uint32_t *    id_swap     = NULL;
+
+    for (unsigned digit = 0; digit < bits; digit += RADIX_BITS)
+    {
+        context->digit = digit;
+        split_range(context, count);
+        if (E_SUCCESS != run_phase(context, LOAD_COUNT))
+        {
+            goto END;
+        }
+
+        // Bucket-major, task-minor offsets keep the sort stable
+        running    = 0;
+        is_trivial = false;
+        for (size_t bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+        {
+            bucket_size = 0;
+            for (size_t task = 0; task < context->task_count; task++)
+            {
+                slot = &context->histograms[(task * RADIX_BUCKETS) + bucket];
+                bucket_size += *slot;
+                running += *slot;
+                *slot = running - *slot;
+            }
+            is_trivial = is_trivial || (count == bucket_size);
+        }
+
+        // Every key agrees on this digit, so the pass would not move anything
+        if (is_trivial)
+        {
+            continue;
+        }
+
+        if (E_SUCCESS != run_phase(context, LOAD_SCATTER))
+        {
+            goto END;
+        }
+
+        edge_swap            = context->edge_source;
+        context->edge_source = context->edge_target;
+        context->edge_target = edge_swap;
+        id_swap              = context->id_source;
+        context->id_source   = context->id_target;
+        context->id_target   = id_swap;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static graph_csr_t * build_csr(load_context_t *    context,
+                               const load_edge_t * edges,
+                               size_t              count)
+{
+    graph_csr_t * csr      = NULL;
+    uint64_t      mask     = ((uint64_t)1 << context->shift) - 1;
+    uint64_t      previous = 0;
+    uint32_t      node     = 0;
+    uint32_t      source   = 0;
+    size_t        written  = 0;
+
+    csr = calloc(1, sizeof(graph_csr_t));
+    if (NULL == csr)
+    {
+        PRINT_DEBUG("build_csr(): CMR failure.\n");
+        goto END;
+    }
+
+    csr->node_count = context->node_count;
+    csr->offsets    = calloc((size_t)csr->node_count + 1, sizeof(size_t));
+    csr->neighbors  = malloc((count + 1) * sizeof(uint32_t));
+    csr->weights    = malloc((count + 1) * sizeof(size_t));
+    csr->node_data  = calloc((size_t)csr->node_count + 1, sizeof(void *));
+    csr->data_keys  = calloc((size_t)csr->node_count + 1, sizeof(void *));
+    csr->data_index = calloc((size_t)csr->node_count + 1, sizeof(uint32_t));
+    if ((NULL == csr->offsets) || (NULL == csr->neighbors) ||
+        (NULL == csr->weights) || (NULL == csr->node_data) ||
+        (NULL == csr->data_keys) || (NULL == csr->data_index))
+    {
+        PRINT_DEBUG("build_csr(): CMR failure.\n");
+        graph_csr_destroy(&csr);
+        goto END;
+    }
+
+    // Labels are contiguous, so index order is also address order
+    csr->owned_data = context->labels;
+    context->labels = NULL;
+    for (uint32_t idx = 0; idx < csr->node_count; idx++)
+    {
+        csr->node_data[idx]  = &((uint32_t *)csr->owned_data)[idx];
+        csr->data_keys[idx]  = csr->node_data[idx];
+        csr->data_index[idx] = idx;
+    }
+
+    // Duplicates are adjacent after the sort; keep the lightest of each run
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if ((0 != written) && (edges[idx].key == previous))
+        {
+            csr->weights[written - 1] =
+                (edges[idx].weight < csr->weights[written - 1])
+                    ? edges[idx].weight
+                    : csr->weights[written - 1];
+            continue;
+        }
+
+        source = (uint32_t)(edges[idx].key >> context->shift);
+        while (node <= source)
+        {
+            csr->offsets[node++] = written;
+        }
+
+        csr->neighbors[written] = (uint32_t)(edges[idx].key & mask);
+        csr->weights[written]   = edges[idx].weight;
+        previous                = edges[idx].key;
+        written++;
+    }
+
+    while (node <= csr->node_count)
+    {
+        csr->offsets[node++] = written;
+    }
+    csr->edge_count = written;
+
+END:
+    return csr;
+}
+
+static void split_range(load_context_t * context, size_t count)
+{
+    size_t task_count = count / MIN_CHUNK_EDGES;
+
+    task_count = (task_count > context->workers) ? context->workers
+                                                 : task_count;
+    task_count = (0 == task_count) ? 1 : task_count;
+
+    for (size_t task = 0; task < task_count; task++)
+    {
+        context->tasks[task].begin = (count * task) / task_count;
+        context->tasks[task].end   = (count * (task + 1)) / task_count;
+    }
+
+    context->task_count = task_count;
+}
+
+static int run_phase(load_context_t * context, load_phase_t phase)
+{
+    int exit_code = E_FAILURE;
+
+    context->phase = phase;
+
+    // Small inputs are not worth a round trip through the pool
+    if (1 == context->task_count)
+    {
+        load_task_routine(&context->tasks[0]);
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    for (size_t task = 0; task < context->task_count; task++)
+    {
+        if (E_SUCCESS != task_group_submit(context->group,
+                                           load_task_routine,
+                                           &context->tasks[task]))
+        {
+            PRINT_DEBUG("run_phase(): Unable to submit task.\n");
+            task_group_wait(context->group);
+            goto END;
+        }
+    }
+
+    exit_code = task_group_wait(context->group);
+END:
+    return exit_code;
+}
+
+static void * load_task_routine(void * data)
+{
+    load_task_t *                  task      = (load_task_t *)data;
+    load_context_t *               context   = task->context;
+    const parallel_edge_record_t * records   = NULL;
+    size_t *                       histogram = NULL;
+    load_edge_t *                  edge      = NULL;
+    uint32_t                       source    = 0;
+    uint32_t                       target    = 0;
+    uint64_t                       key       = 0;
+
+    histogram = &context->histograms[task->index * RADIX_BUCKETS];
+
+    switch (context->phase)
+    {
+        case LOAD_PARSE:
+            parse_range(task);
+            break;
+
+        case LOAD_GATHER:
+            if (0 != task->count)
+            {
+                memcpy(&context->edges[task->offset],
+                       task->edges,
+                       task->count * sizeof(load_edge_t));
+            }
+            free(task->edges);
+            task->edges    = NULL;
+            task->count    = 0;
+            task->capacity = 0;
+            break;
+
+        case LOAD_DECODE:
+            records      = (const parallel_edge_record_t *)context->map;
+            task->max_id = 0;
+            for (size_t idx = task->begin; idx < task->end; idx++)
+            {
+                source = records[idx].source;
+                target = records[idx].target;
+                context->edges[idx].key =
+                    ((uint64_t)source << 32) | (uint64_t)target;
+                context->edges[idx].weight = records[idx].weight;
+                task->max_id = (source > task->max_id) ? source : task->max_id;
+                task->max_id = (target > task->max_id) ? target : task->max_id;
+            }
+            break;
+
+        case LOAD_MARK:
+            for (size_t idx = task->begin; idx < task->end; idx++)
+            {
+                key = context->edges[idx].key;
+                atomic_store_explicit(
+                    &context->present[key >> 32], 1, memory_order_relaxed);
+                atomic_store_explicit(
+                    &context->present[key & ID_MASK], 1, memory_order_relaxed);
+            }
+            break;
+
+        case LOAD_COLLECT:
+            for (size_t idx = task->begin; idx < task->end; idx++)
+            {
+                key = context->edges[idx].key;
+                context->id_source[2 * idx]       = (uint32_t)(key >> 32);
+                context->id_source[(2 * idx) + 1] = (uint32_t)(key & ID_MASK);
+            }
+            break;
+
+        case LOAD_REMAP:
+            for (size_t idx = task->begin; idx < task->end; idx++)
+            {
+                edge   = &context->edges[idx];
+                source = (uint32_t)(edge->key >> 32);
+                target = (uint32_t)(edge->key & ID_MASK);
+                if (NULL != context->remap)
+                {
+                    source = context->remap[source];
+                    target = context->remap[target];
+                }
+                else
+                {
+                    source = find_label(
+                        context->labels, context->node_count, source);
+                    target = find_label(
+                        context->labels, context->node_count, target);
+                }
+
+                edge->key = ((uint64_t)source << context->shift) | target;
+                if (context->undirected)
+                {
+                    context->edges[context->edge_count + idx].key =
+                        ((uint64_t)target << context->shift) | source;
+                    context->edges[context->edge_count + idx].weight =
+                        edge->weight;
+                }
+            }
+            break;
+
+        case LOAD_COUNT:
+            memset(histogram, 0, RADIX_BUCKETS * sizeof(size_t));
+            for (size_t idx = task->begin; idx < task->end; idx++)
+            {
+                key = context->sort_ids ? context->id_source[idx]
+                                        : context->edge_source[idx].key;
+                histogram[(key >> context->digit) & RADIX_MASK]++;
+            }
+            break;
+
+        case LOAD_SCATTER:
+            if (context->sort_ids)
+            {
+                for (size_t idx = task->begin; idx < task->end; idx++)
+                {
+                    key = context->id_source[idx];
+                    context->id_target[histogram[(key >> context->digit) &
+                                                 RADIX_MASK]++] =
+                        (uint32_t)key;
+                }
+            }
+            else
+            {
+                for (size_t idx = task->begin; idx < task->end; idx++)
+                {
+                    edge = &context->edge_source[idx];
+                    context->edge_target[histogram[(edge->key >>
+                                                    context->digit) &
+                                                   RADIX_MASK]++] = *edge;
+                }
+            }
+            break;
+
+        default:
+            PRINT_DEBUG("load_task_routine(): Invalid phase.\n");
+            break;
+    }
+
+    return NULL;
+}
+
+static void parse_range(load_task_t * task)
+{
+    const char * cursor = task->context->map + task->begin;
+    const char * end    = task->context->map + task->end;
+    uint64_t     source = 0;
+    uint64_t     target = 0;
+    uint64_t     weight = 0;
+
+    task->count    = 0;
+    task->max_id   = 0;
+    task->failed   = false;
+    task->capacity = ((task->end - task->begin) / 16) + 16;
+    task->edges    = malloc(task->capacity * sizeof(load_edge_t));
+    if (NULL == task->edges)
+    {
+        PRINT_DEBUG("parse_range(): CMR failure.\n");
+        task->failed = true;
+        goto END;
+    }
+
+    while (cursor < end)
+    {
+        cursor = skip_blanks(cursor, end);
+        if ((cursor == end) || ('\n' == *cursor))
+        {
+            cursor += (cursor != end);
+            continue;
+        }
+
+        if (('#' == *cursor) || ('%' == *cursor))
+        {
+            cursor = memchr(cursor, '\n', (size_t)(end - cursor));
+            cursor = (NULL == cursor) ? end : cursor + 1;
+            continue;
+        }
+
+        // Record where the bad line starts in case of an error
+        task->begin = (size_t)(cursor - task->context->map);
+
+        weight = 1;
+        if ((!parse_number(&cursor, end, UINT32_MAX, &source)) ||
+            (cursor == skip_blanks(cursor, end)))
+        {
+            task->failed = true;
+            goto END;
+        }
+
+        cursor = skip_blanks(cursor, end);
+        if (!parse_number(&cursor, end, UINT32_MAX, &target))
+        {
+            task->failed = true;
+            goto END;
+        }
+
+        cursor = skip_blanks(cursor, end);
+        if ((cursor != end) && ('\n' != *cursor))
+        {
+            if (!parse_number(&cursor, end, SIZE_MAX, &weight))
+            {
+                task->failed = true;
+                goto END;
+            }
+            cursor = skip_blanks(cursor, end);
+        }
+
+        if ((cursor != end) && ('\n' != *cursor))
+        {
+            task->failed = true;
+            goto END;
+        }
+
+        if (E_SUCCESS != append_edge(task,
+                                     (source << 32) | target,
+                                     (size_t)weight))
+        {
+            task->failed = true;
+            goto END;
+        }
+
+        task->max_id = (source > task->max_id) ? (uint32_t)source
+                                               : task->max_id;
+        task->max_id = (target > task->max_id) ? (uint32_t)target
+                                               : task->max_id;
+    }
+
+END:
+    return;
+}
+
+static int append_edge(load_task_t * task, uint64_t key, size_t weight)
+{
+    int           exit_code = E_FAILURE;
+    load_edge_t * resized   = NULL;
+
+    if (task->count == task->capacity)
+    {
+        resized =
+            realloc(task->edges, task->capacity * 2 * sizeof(load_edge_t));
+        if (NULL == resized)
+        {
+            PRINT_DEBUG("append_edge(): CMR failure.\n");
+            goto END;
+        }
+        task->edges = resized;
+        task->capacity *= 2;
+    }
+
+    task->edges[task->count].key    = key;
+    task->edges[task->count].weight = weight;
+    task->count++;
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+static bool parse_number(const char ** cursor,
+                         const char *  end,
+                         uint64_t      limit,
+                         uint64_t *    value)
+{
+    const char * position = *cursor;
+    uint64_t     digit    = 0;
+    bool         is_valid = false;
+
+    *value = 0;
+    while ((position < end) && ('0' <= *position) && ('9' >= *position))
+    {
+        digit = (uint64_t)(*position - '0');
+        if (*value > ((limit - digit) / 10))
+        {
+            is_valid = false;
+            goto END;
+        }
+
+        *value   = (*value * 10) + digit;
+        is_valid = true;
+        position++;
+    }
+
+END:
+    *cursor = position;
+    return is_valid;
+}
+
+static const char * skip_blanks(const char * cursor, const char * end)
+{
+    while ((cursor < end) &&
+           ((' ' == *cursor) || ('\t' == *cursor) || ('\r' == *cursor)))
+    {
+        cursor++;
+    }
+
+    return cursor;
+}
+
+static uint32_t find_label(const uint32_t * labels,
+                           uint32_t         count,
+                           uint32_t         id)
+{
+    uint32_t index = GRAPH_CSR_NO_NODE;
+    uint32_t low   = 0;
+    uint32_t high  = count;
+    uint32_t mid   = 0;
+
+    while (low < high)
+    {
+        mid = low + ((high - low) / 2);
+        if (labels[mid] < id)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    if ((low < count) && (id == labels[low]))
+    {
+        index = low;
+    }
+
+    return index;
+}
+
+static unsigned bit_width(uint64_t value)
+{
+    unsigned width = 1;
+
+    while ((width < 64) && (0 != (value >> width)))
+    {
+        width++;
+    }
+
+    return width;
+}
+
+/*** end of file ***/
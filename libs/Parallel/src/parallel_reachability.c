@@ -0,0 +1,219 @@
+#include <stdlib.h>
+
+#include "parallel_reachability.h"
+#include "task_group.h"
+#include "utilities.h"
+
+/**
+ * @brief One block of rows and columns of a boolean product
+ */
+typedef struct reach_task
+{
+    const uint64_t * left;       // Left factor
+    const uint64_t * right;      // Right factor
+    uint64_t *       product;    // Product being written
+    size_t           row_count;  // Rows in each matrix
+    size_t           row_words;  // Words per row
+    size_t           first_row;  // First product row of the block
+    size_t           block_rows; // Product rows in the block
+    size_t           first_word; // First product word of the block
+    size_t           word_count; // Product words in the block
+    int              exit_code;  // Result of the kernel
+} reach_task_t;
+
+/**
+ * @brief Computes the product rows and columns of one block.
+ */
+static void * multiply_task_routine(void * data);
+
+/**
+ * @brief Splits a product into strips of columns and, when the strips alone
+ * leave pool workers idle, blocks of rows within each strip.
+ */
+static void plan_tasks(size_t          row_count,
+                       size_t          row_words,
+                       thread_pool_t * thread_pool,
+                       size_t *        strip_count,
+                       size_t *        block_count);
+
+size_t parallel_bitset_task_count(size_t          row_count,
+                                  size_t          row_words,
+                                  thread_pool_t * thread_pool)
+{
+    size_t strip_count = 0;
+    size_t block_count = 0;
+
+    plan_tasks(row_count, row_words, thread_pool, &strip_count, &block_count);
+
+    return strip_count * block_count;
+}
+
+int parallel_bitset_multiply(const uint64_t * left,
+                             const uint64_t * right,
+                             uint64_t *       product,
+                             size_t           row_count,
+                             size_t           row_words,
+                             void *           thread_pool)
+{
+    int            exit_code   = E_FAILURE;
+    task_group_t * group       = NULL;
+    reach_task_t * tasks       = NULL;
+    reach_task_t * task        = NULL;
+    size_t         task_count  = 0;
+    size_t         strip_count = 0;
+    size_t         block_count = 0;
+    size_t         block_rows  = 0;
+
+    if ((NULL == left) || (NULL == right) || (NULL == product))
+    {
+        PRINT_DEBUG("parallel_bitset_multiply(): NULL argument passed.\n");
+        goto END;
+    }
+
+    plan_tasks(row_count, row_words, thread_pool, &strip_count, &block_count);
+    task_count = strip_count * block_count;
+    if (0 == task_count)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    tasks = calloc(task_count, sizeof(reach_task_t));
+    if (NULL == tasks)
+    {
+        PRINT_DEBUG("parallel_bitset_multiply(): CMR failure.\n");
+        goto END;
+    }
+
+    // A single task has nothing to run alongside it
+    group = task_group_create((1 < task_count) ? thread_pool : NULL);
+    if (NULL == group)
+    {
+        PRINT_DEBUG("parallel_bitset_multiply(): Unable to create group.\n");
+        goto END;
+    }
+
+    block_rows = (row_count + block_count - 1) / block_count;
+    for (size_t idx = 0; idx < task_count; idx++)
+    {
+        task             = &tasks[idx];
+        task->left       = left;
+        task->right      = right;
+        task->product    = product;
+        task->row_count  = row_count;
+        task->row_words  = row_words;
+        task->first_row  = (idx % block_count) * block_rows;
+        task->block_rows = row_count - task->first_row;
+        task->first_word = (idx / block_count) * PARALLEL_REACH_STRIP_WORDS;
+        task->word_count = row_words - task->first_word;
+        task->exit_code  = E_FAILURE;
+        if (task->block_rows > block_rows)
+        {
+            task->block_rows = block_rows;
+        }
+        if (task->word_count > PARALLEL_REACH_STRIP_WORDS)
+        {
+            task->word_count = PARALLEL_REACH_STRIP_WORDS;
+        }
+
+        if (E_SUCCESS != task_group_submit(group, multiply_task_routine, task))
+        {
+            PRINT_DEBUG(
+                "parallel_bitset_multiply(): Unable to submit task.\n");
+            task_group_wait(group);
+            goto END;
+        }
+    }
+
+    exit_code = task_group_wait(group);
+    for (size_t idx = 0; (E_SUCCESS == exit_code) && (idx < task_count); idx++)
+    {
+        exit_code = tasks[idx].exit_code;
+    }
+
+END:
+    task_group_destroy(&group);
+    free(tasks);
+    return exit_code;
+}
+
+int parallel_matrix_reachability(thread_pool_t *  thread_pool,
+                                 const matrix_t * graph,
+                                 size_t           hops,
+                                 uint64_t **      reach)
+{
+    int exit_code = E_FAILURE;
+
+    if ((NULL == graph) || (NULL == reach))
+    {
+        PRINT_DEBUG("parallel_matrix_reachability(): NULL argument passed.\n");
+        goto END;
+    }
+
+    exit_code = matrix_reachability_with(
+        graph, hops, parallel_bitset_multiply, thread_pool, reach);
+END:
+    return exit_code;
+}
+
+int parallel_matrix_transitive_closure(thread_pool_t *  thread_pool,
+                                       const matrix_t * graph,
+                                       uint64_t **      closure)
+{
+    return parallel_matrix_reachability(thread_pool, graph, SIZE_MAX, closure);
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static void * multiply_task_routine(void * data)
+{
+    reach_task_t * task = (reach_task_t *)data;
+
+    task->exit_code = matrix_bitset_multiply(task->left,
+                                             task->right,
+                                             task->product,
+                                             task->row_count,
+                                             task->row_words,
+                                             task->first_row,
+                                             task->block_rows,
+                                             task->first_word,
+                                             task->word_count);
+
+    return NULL;
+}
+
+static void plan_tasks(size_t          row_count,
+                       size_t          row_words,
+                       thread_pool_t * thread_pool,
+                       size_t *        strip_count,
+                       size_t *        block_count)
+{
+    size_t workers    = 0;
+    size_t max_blocks = row_count / PARALLEL_REACH_MIN_ROWS;
+
+    *strip_count = (row_words + PARALLEL_REACH_STRIP_WORDS - 1) /
+                   PARALLEL_REACH_STRIP_WORDS;
+    *block_count = 1;
+
+    if ((NULL == thread_pool) || (0 == *strip_count))
+    {
+        goto END;
+    }
+
+    workers = thread_pool_get_thread_count(thread_pool);
+    if (*strip_count < workers)
+    {
+        *block_count = (workers + *strip_count - 1) / *strip_count;
+        if (*block_count > max_blocks)
+        {
+            *block_count = (0 == max_blocks) ? 1 : max_blocks;
+        }
+    }
+
+END:
+    return;
+}
+
+/*** end of file ***/
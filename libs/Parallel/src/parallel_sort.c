@@ -0,0 +1,1133 @@
+#include <stdbool.h>
+#include <string.h> // memcpy(), strcmp()
+
+#include "parallel_sort.h"
+#include "task_group.h"
+#include "utilities.h"
+
+#define MIN_CHUNK_SIZE      4096 // Smallest slice of the input given to a task
+#define INSERTION_THRESHOLD 32   // Runs at or below this use insertion sort
+#define RADIX_BITS          8
+#define RADIX_BUCKETS       (1 << RADIX_BITS)
+#define RADIX_PASSES        (64 / RADIX_BITS)
+#define RADIX_MASK          ((uint64_t)RADIX_BUCKETS - 1)
+#define STRING_MAX_DEPTH    64 // Deeper string buckets fall back to merge sort
+
+// Index of a bucket count in the [chunk][pass][bucket] histogram table
+#define HISTOGRAM_INDEX(chunk, pass, bucket) \
+    ((((chunk) * RADIX_PASSES + (pass)) * RADIX_BUCKETS) + (bucket))
+
+/**
+ * @brief An element pointer paired with its extracted radix key
+ */
+typedef struct radix_entry
+{
+    uint64_t key;
+    void *   item;
+} radix_entry_t;
+
+/**
+ * @brief Sorts one run of the input in place
+ */
+typedef struct run_task
+{
+    void ** items;        // Array holding the run
+    void ** scratch;      // Scratch space of the same size as 'items'
+    size_t  count;        // Number of elements in the run
+    CMP_F   compare_func; // Comparison function
+} run_task_t;
+
+/**
+ * @brief Merges a slice of two sorted runs into the destination array
+ */
+typedef struct merge_task
+{
+    void ** first;        // First sorted input
+    size_t  first_count;  // Number of elements in 'first'
+    void ** second;       // Second sorted input
+    size_t  second_count; // Number of elements in 'second'
+    void ** destination;  // Output, sized first_count + second_count
+    CMP_F   compare_func; // Comparison function
+} merge_task_t;
+
+/**
+ * @brief The phases of a parallel LSD radix sort
+ */
+typedef enum
+{
+    RADIX_LOAD,    // Extract keys and count every digit of the chunk
+    RADIX_COUNT,   // Count the current digit of the chunk
+    RADIX_SCATTER, // Move the chunk into its buckets
+    RADIX_STORE    // Write the sorted element pointers back
+} radix_phase_t;
+
+/**
+ * @brief State shared by all tasks of a radix sort
+ */
+typedef struct radix_context
+{
+    void **         items;       // Caller's array
+    radix_entry_t * source;      // Entries being read in the current pass
+    radix_entry_t * destination; // Entries being written in the current pass
+    size_t          count;       // Number of elements
+    size_t          num_chunks;  // Number of tasks per phase
+    size_t *        histograms;  // [num_chunks][RADIX_PASSES][RADIX_BUCKETS]
+    size_t *        offsets;     // [num_chunks][RADIX_BUCKETS]
+    SORT_KEY_F      key_func;    // Key extraction function
+    radix_phase_t   phase;       // Phase currently being executed
+    size_t          pass;        // Digit currently being sorted on
+} radix_context_t;
+
+/**
+ * @brief One chunk of a radix sort phase
+ */
+typedef struct radix_task
+{
+    radix_context_t * context; // Shared state
+    size_t            chunk;   // Index of the chunk handled by this task
+} radix_task_t;
+
+/**
+ * @brief Sorts one first-byte bucket of a string sort
+ */
+typedef struct string_task
+{
+    void ** items;   // Strings in the bucket
+    void ** scratch; // Scratch space of the same size as 'items'
+    size_t  count;   // Number of strings in the bucket
+} string_task_t;
+
+/**
+ * @brief Chooses how many tasks to split an input of 'count' elements into.
+ *
+ * @param thread_pool The pool that will run the tasks (may be NULL).
+ * @param count Number of elements.
+ * @return The number of tasks, at least 1.
+ */
+static size_t choose_task_count(thread_pool_t * thread_pool, size_t count);
+
+/**
+ * @brief Stable merge of two sorted arrays.
+ */
+static void merge_runs(void ** first,
+                       size_t  first_count,
+                       void ** second,
+                       size_t  second_count,
+                       void ** destination,
+                       CMP_F   compare_func);
+
+/**
+ * @brief Stable bottom-up merge sort; the result is left in 'items'.
+ */
+static void sequential_merge_sort(void ** items,
+                                  void ** scratch,
+                                  size_t  count,
+                                  CMP_F   compare_func);
+
+/**
+ * @brief Finds how many of the first 'rank' merged outputs come from 'first'.
+ *
+ * Used to split one merge into independent slices (merge path partitioning).
+ */
+static size_t co_rank(size_t  rank,
+                      void ** first,
+                      size_t  first_count,
+                      void ** second,
+                      size_t  second_count,
+                      CMP_F   compare_func);
+
+/**
+ * @brief Sequential MSD radix sort of strings that share 'depth' leading bytes.
+ */
+static void string_radix_sort(void ** items,
+                              void ** scratch,
+                              size_t  count,
+                              size_t  depth);
+
+/**
+ * @brief Runs one phase of a radix sort across every chunk and waits for it.
+ *
+ * @return E_SUCCESS on success, E_FAILURE if a task could not be submitted.
+ */
+static int run_radix_phase(task_group_t *    group,
+                           radix_task_t *    tasks,
+                           radix_context_t * context,
+                           radix_phase_t     phase);
+
+/**
+ * @brief Stable insertion sort, used for short runs.
+ */
+static void insertion_sort(void ** items, size_t count, CMP_F compare_func);
+
+/**
+ * @brief Orders two NUL-terminated strings with strcmp().
+ */
+static comp_rtns_t string_compare(void * first, void * second);
+
+static void * run_task_routine(void * data);
+static void * merge_task_routine(void * data);
+static void * radix_task_routine(void * data);
+static void * string_task_routine(void * data);
+
+/**
+ * @brief Gathers the data pointers of a list into a new array.
+ */
+static void ** list_to_array(list_t * list);
+
+/**
+ * @brief Writes an array of data pointers back into the nodes of a list.
+ */
+static void array_to_list(list_t * list, void ** items);
+
+int parallel_sort_array(thread_pool_t * thread_pool,
+                        void **         items,
+                        size_t          count,
+                        CMP_F           compare_func)
+{
+    int            exit_code    = E_FAILURE;
+    void **        scratch      = NULL;
+    void **        source       = NULL;
+    void **        destination  = NULL;
+    void **        swap         = NULL;
+    size_t *       bounds       = NULL;
+    run_task_t *   run_tasks    = NULL;
+    merge_task_t * merge_tasks  = NULL;
+    task_group_t * group        = NULL;
+    size_t         num_runs     = 0;
+    size_t         num_merges   = 0;
+    size_t         piece_length = 0;
+
+    if ((NULL == items) || (NULL == compare_func))
+    {
+        PRINT_DEBUG("parallel_sort_array(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (2 > count)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    scratch = calloc(count, sizeof(void *));
+    if (NULL == scratch)
+    {
+        PRINT_DEBUG("parallel_sort_array(): CMR failure - scratch.\n");
+        goto END;
+    }
+
+    num_runs = choose_task_count(thread_pool, count);
+    if (1 == num_runs)
+    {
+        sequential_merge_sort(items, scratch, count, compare_func);
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    bounds      = calloc(num_runs + 1, sizeof(size_t));
+    run_tasks   = calloc(num_runs, sizeof(run_task_t));
+    merge_tasks = calloc((num_runs * 2) + 4, sizeof(merge_task_t));
+    group       = task_group_create(thread_pool);
+    if ((NULL == bounds) || (NULL == run_tasks) || (NULL == merge_tasks) ||
+        (NULL == group))
+    {
+        PRINT_DEBUG("parallel_sort_array(): CMR failure.\n");
+        goto END;
+    }
+
+    // Phase 1: sort one run per task
+    for (size_t run = 0; run <= num_runs; run++)
+    {
+        bounds[run] = (count * run) / num_runs;
+    }
+
+    for (size_t run = 0; run < num_runs; run++)
+    {
+        run_tasks[run].items        = &items[bounds[run]];
+        run_tasks[run].scratch      = &scratch[bounds[run]];
+        run_tasks[run].count        = bounds[run + 1] - bounds[run];
+        run_tasks[run].compare_func = compare_func;
+
+        if (E_SUCCESS !=
+            task_group_submit(group, run_task_routine, &run_tasks[run]))
+        {
+            PRINT_DEBUG("parallel_sort_array(): Unable to submit run.\n");
+            goto END;
+        }
+    }
+    task_group_wait(group);
+
+    // Phase 2: merge adjacent runs, splitting each merge across tasks
+    piece_length = count / choose_task_count(thread_pool, count);
+    source       = items;
+    destination  = scratch;
+
+    while (1 < num_runs)
+    {
+        size_t task_count = 0;
+
+        for (size_t run = 0; run < num_runs; run += 2)
+        {
+            size_t low    = bounds[run];
+            size_t middle = bounds[run + 1];
+            size_t high   = bounds[(run + 2 <= num_runs) ? run + 2 : num_runs];
+            size_t length = high - low;
+            size_t pieces = (length + piece_length - 1) / piece_length;
+
+            // An odd run out has middle == high and is copied through
+
+            for (size_t piece = 0; piece < pieces; piece++)
+            {
+                merge_task_t * task        = &merge_tasks[task_count++];
+                size_t         start_rank  = (length * piece) / pieces;
+                size_t         end_rank    = (length * (piece + 1)) / pieces;
+                size_t         first_start = 0;
+                size_t         first_end   = 0;
+
+                first_start = co_rank(start_rank,
+                                      &source[low],
+                                      middle - low,
+                                      &source[middle],
+                                      high - middle,
+                                      compare_func);
+                first_end   = co_rank(end_rank,
+                                    &source[low],
+                                    middle - low,
+                                    &source[middle],
+                                    high - middle,
+                                    compare_func);
+
+                task->first        = &source[low + first_start];
+                task->first_count  = first_end - first_start;
+                task->second       = &source[middle + start_rank - first_start];
+                task->second_count = (end_rank - first_end) -
+                                     (start_rank - first_start);
+                task->destination  = &destination[low + start_rank];
+                task->compare_func = compare_func;
+            }
+        }
+
+        for (size_t idx = 0; idx < task_count; idx++)
+        {
+            if (E_SUCCESS != task_group_submit(
+                                 group, merge_task_routine, &merge_tasks[idx]))
+            {
+                PRINT_DEBUG("parallel_sort_array(): Unable to submit merge.\n");
+                goto END;
+            }
+        }
+        task_group_wait(group);
+
+        // Collapse the run boundaries for the next round
+        num_merges = 0;
+        for (size_t run = 0; run < num_runs; run += 2)
+        {
+            bounds[num_merges++] = bounds[run];
+        }
+        bounds[num_merges] = count;
+        num_runs           = num_merges;
+
+        swap        = source;
+        source      = destination;
+        destination = swap;
+    }
+
+    if (source != items)
+    {
+        memcpy(items, source, count * sizeof(void *));
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    task_group_destroy(&group);
+    free(merge_tasks);
+    free(run_tasks);
+    free(bounds);
+    free(scratch);
+    return exit_code;
+}
+
+int parallel_radix_sort_array(thread_pool_t * thread_pool,
+                              void **         items,
+                              size_t          count,
+                              SORT_KEY_F      key_func)
+{
+    int             exit_code  = E_FAILURE;
+    radix_context_t context    = { 0 };
+    radix_entry_t * entries    = NULL;
+    radix_entry_t * scratch    = NULL;
+    radix_entry_t * swap       = NULL;
+    radix_task_t *  tasks      = NULL;
+    task_group_t *  group      = NULL;
+    size_t          num_chunks = 0;
+    size_t          running    = 0;
+    size_t          total      = 0;
+    bool            is_trivial = false;
+    bool            is_moved   = false;
+
+    if ((NULL == items) || (NULL == key_func))
+    {
+        PRINT_DEBUG("parallel_radix_sort_array(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (2 > count)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    num_chunks = choose_task_count(thread_pool, count);
+
+    entries            = calloc(count, sizeof(radix_entry_t));
+    scratch            = calloc(count, sizeof(radix_entry_t));
+    tasks              = calloc(num_chunks, sizeof(radix_task_t));
+    context.histograms = calloc(num_chunks * RADIX_PASSES * RADIX_BUCKETS,
+                                sizeof(size_t));
+    context.offsets    = calloc(num_chunks * RADIX_BUCKETS, sizeof(size_t));
+    group              = task_group_create(thread_pool);
+    if ((NULL == entries) || (NULL == scratch) || (NULL == tasks) ||
+        (NULL == context.histograms) || (NULL == context.offsets) ||
+        (NULL == group))
+    {
+        PRINT_DEBUG("parallel_radix_sort_array(): CMR failure.\n");
+        goto END;
+    }
+
+    context.items       = items;
+    context.source      = entries;
+    context.destination = scratch;
+    context.count       = count;
+    context.num_chunks  = num_chunks;
+    context.key_func    = key_func;
+
+    for (size_t chunk = 0; chunk < num_chunks; chunk++)
+    {
+        tasks[chunk].context = &context;
+        tasks[chunk].chunk   = chunk;
+    }
+
+    if (E_SUCCESS != run_radix_phase(group, tasks, &context, RADIX_LOAD))
+    {
+        goto END;
+    }
+
+    for (size_t pass = 0; pass < RADIX_PASSES; pass++)
+    {
+        context.pass = pass;
+
+        // Skip digits on which every key agrees; the totals from the load
+        // phase are valid for any layout of the keys
+        is_trivial = false;
+        for (size_t bucket = 0; (bucket < RADIX_BUCKETS) && !is_trivial;
+             bucket++)
+        {
+            total = 0;
+            for (size_t chunk = 0; chunk < num_chunks; chunk++)
+            {
+                total += context.histograms[HISTOGRAM_INDEX(
+                    chunk, pass, bucket)];
+            }
+            is_trivial = (count == total);
+        }
+
+        if (is_trivial)
+        {
+            continue;
+        }
+
+        // Per-chunk counts from the load phase only match the initial layout
+        if (is_moved &&
+            (E_SUCCESS != run_radix_phase(group, tasks, &context, RADIX_COUNT)))
+        {
+            goto END;
+        }
+
+        // Bucket-major, chunk-minor offsets keep the sort stable
+        running = 0;
+        for (size_t bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+        {
+            for (size_t chunk = 0; chunk < num_chunks; chunk++)
+            {
+                context.offsets[(chunk * RADIX_BUCKETS) + bucket] = running;
+                running +=
+                    context.histograms[HISTOGRAM_INDEX(chunk, pass, bucket)];
+            }
+        }
+
+        if (E_SUCCESS != run_radix_phase(group, tasks, &context, RADIX_SCATTER))
+        {
+            goto END;
+        }
+
+        swap                = context.source;
+        context.source      = context.destination;
+        context.destination = swap;
+        is_moved            = true;
+    }
+
+    if (E_SUCCESS != run_radix_phase(group, tasks, &context, RADIX_STORE))
+    {
+        goto END;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    task_group_destroy(&group);
+    free(context.offsets);
+    free(context.histograms);
+    free(tasks);
+    free(scratch);
+    free(entries);
+    return exit_code;
+}
+
+int parallel_string_sort_array(thread_pool_t * thread_pool,
+                               void **         items,
+                               size_t          count)
+{
+    int             exit_code             = E_FAILURE;
+    void **         scratch               = NULL;
+    task_group_t *  group                 = NULL;
+    string_task_t   tasks[RADIX_BUCKETS]  = { 0 };
+    size_t          counts[RADIX_BUCKETS] = { 0 };
+    size_t          starts[RADIX_BUCKETS] = { 0 };
+    size_t          running               = 0;
+    unsigned char   first_byte            = 0;
+
+    if (NULL == items)
+    {
+        PRINT_DEBUG("parallel_string_sort_array(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (2 > count)
+    {
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    scratch = calloc(count, sizeof(void *));
+    if (NULL == scratch)
+    {
+        PRINT_DEBUG("parallel_string_sort_array(): CMR failure.\n");
+        goto END;
+    }
+
+    if (1 == choose_task_count(thread_pool, count))
+    {
+        string_radix_sort(items, scratch, count, 0);
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    group = task_group_create(thread_pool);
+    if (NULL == group)
+    {
+        PRINT_DEBUG("parallel_string_sort_array(): Unable to create group.\n");
+        goto END;
+    }
+
+    // Distribute on the first byte, then sort each bucket as its own task
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        counts[*(unsigned char *)items[idx]]++;
+    }
+
+    for (size_t bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+    {
+        starts[bucket] = running;
+        running += counts[bucket];
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        first_byte                    = *(unsigned char *)items[idx];
+        scratch[starts[first_byte]++] = items[idx];
+    }
+    memcpy(items, scratch, count * sizeof(void *));
+
+    // Bucket 0 holds empty strings, which are already in order
+    running = counts[0];
+    for (size_t bucket = 1; bucket < RADIX_BUCKETS; bucket++)
+    {
+        if (1 < counts[bucket])
+        {
+            tasks[bucket].items   = &items[running];
+            tasks[bucket].scratch = &scratch[running];
+            tasks[bucket].count   = counts[bucket];
+
+            if (E_SUCCESS !=
+                task_group_submit(group, string_task_routine, &tasks[bucket]))
+            {
+                PRINT_DEBUG(
+                    "parallel_string_sort_array(): Unable to submit task.\n");
+                goto END;
+            }
+        }
+        running += counts[bucket];
+    }
+
+    exit_code = task_group_wait(group);
+END:
+    task_group_destroy(&group);
+    free(scratch);
+    return exit_code;
+}
+
+int parallel_vector_sort(thread_pool_t * thread_pool, vector_t * vector)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == vector)
+    {
+        PRINT_DEBUG("parallel_vector_sort(): NULL argument passed.\n");
+        goto END;
+    }
+
+    exit_code = parallel_sort_array(thread_pool,
+                                    vector->elements,
+                                    (size_t)vector->size,
+                                    vector->compare_func);
+END:
+    return exit_code;
+}
+
+int parallel_vector_radix_sort(thread_pool_t * thread_pool,
+                               vector_t *      vector,
+                               SORT_KEY_F      key_func)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == vector)
+    {
+        PRINT_DEBUG("parallel_vector_radix_sort(): NULL argument passed.\n");
+        goto END;
+    }
+
+    exit_code = parallel_radix_sort_array(
+        thread_pool, vector->elements, (size_t)vector->size, key_func);
+END:
+    return exit_code;
+}
+
+int parallel_vector_string_sort(thread_pool_t * thread_pool,
+                                vector_t *      vector)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == vector)
+    {
+        PRINT_DEBUG("parallel_vector_string_sort(): NULL argument passed.\n");
+        goto END;
+    }
+
+    exit_code = parallel_string_sort_array(
+        thread_pool, vector->elements, (size_t)vector->size);
+END:
+    return exit_code;
+}
+
+int parallel_list_sort(thread_pool_t * thread_pool, list_t * list)
+{
+    int     exit_code = E_FAILURE;
+    void ** items     = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("parallel_list_sort(): NULL argument passed.\n");
+        goto END;
+    }
+
+    items = list_to_array(list);
+    if ((NULL == items) && (0 < list->size))
+    {
+        PRINT_DEBUG("parallel_list_sort(): Unable to gather list.\n");
+        goto END;
+    }
+
+    exit_code =
+        parallel_sort_array(thread_pool, items, list->size, list->compare_func);
+    if (E_SUCCESS == exit_code)
+    {
+        array_to_list(list, items);
+    }
+
+END:
+    free(items);
+    return exit_code;
+}
+
+int parallel_list_radix_sort(thread_pool_t * thread_pool,
+                             list_t *        list,
+                             SORT_KEY_F      key_func)
+{
+    int     exit_code = E_FAILURE;
+    void ** items     = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("parallel_list_radix_sort(): NULL argument passed.\n");
+        goto END;
+    }
+
+    items = list_to_array(list);
+    if ((NULL == items) && (0 < list->size))
+    {
+        PRINT_DEBUG("parallel_list_radix_sort(): Unable to gather list.\n");
+        goto END;
+    }
+
+    exit_code =
+        parallel_radix_sort_array(thread_pool, items, list->size, key_func);
+    if (E_SUCCESS == exit_code)
+    {
+        array_to_list(list, items);
+    }
+
+END:
+    free(items);
+    return exit_code;
+}
+
+int parallel_list_string_sort(thread_pool_t * thread_pool, list_t * list)
+{
+    int     exit_code = E_FAILURE;
+    void ** items     = NULL;
+
+    if (NULL == list)
+    {
+        PRINT_DEBUG("parallel_list_string_sort(): NULL argument passed.\n");
+        goto END;
+    }
+
+    items = list_to_array(list);
+    if ((NULL == items) && (0 < list->size))
+    {
+        PRINT_DEBUG("parallel_list_string_sort(): Unable to gather list.\n");
+        goto END;
+    }
+
+    exit_code = parallel_string_sort_array(thread_pool, items, list->size);
+    if (E_SUCCESS == exit_code)
+    {
+        array_to_list(list, items);
+    }
+
+END:
+    free(items);
+    return exit_code;
+}
+
+uint64_t sort_key_int(const void * data)
+{
+    // Flip the sign bit so negative values order before positive ones
+    return (uint64_t)(int64_t)(*(const int *)data) ^ ((uint64_t)1 << 63);
+}
+
+uint64_t sort_key_size(const void * data)
+{
+    return (uint64_t)(*(const size_t *)data);
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static size_t choose_task_count(thread_pool_t * thread_pool, size_t count)
+{
+    size_t task_count = 1;
+
+    if ((NULL == thread_pool) || (PARALLEL_SORT_THRESHOLD > count))
+    {
+        goto END;
+    }
+
+    task_count = thread_pool_get_thread_count(thread_pool);
+    while ((1 < task_count) && (MIN_CHUNK_SIZE > (count / task_count)))
+    {
+        task_count--;
+    }
+
+    if (0 == task_count)
+    {
+        task_count = 1;
+    }
+
+END:
+    return task_count;
+}
+
+static int run_radix_phase(task_group_t *    group,
+                           radix_task_t *    tasks,
+                           radix_context_t * context,
+                           radix_phase_t     phase)
+{
+    int exit_code = E_FAILURE;
+
+    context->phase = phase;
+    for (size_t chunk = 0; chunk < context->num_chunks; chunk++)
+    {
+        if (E_SUCCESS !=
+            task_group_submit(group, radix_task_routine, &tasks[chunk]))
+        {
+            PRINT_DEBUG("run_radix_phase(): Unable to submit task.\n");
+            task_group_wait(group);
+            goto END;
+        }
+    }
+
+    exit_code = task_group_wait(group);
+END:
+    return exit_code;
+}
+
+static void insertion_sort(void ** items, size_t count, CMP_F compare_func)
+{
+    void * key      = NULL;
+    size_t position = 0;
+
+    for (size_t idx = 1; idx < count; idx++)
+    {
+        key      = items[idx];
+        position = idx;
+
+        while ((0 < position) &&
+               (LESS_THAN == compare_func(key, items[position - 1])))
+        {
+            items[position] = items[position - 1];
+            position--;
+        }
+        items[position] = key;
+    }
+}
+
+static void merge_runs(void ** first,
+                       size_t  first_count,
+                       void ** second,
+                       size_t  second_count,
+                       void ** destination,
+                       CMP_F   compare_func)
+{
+    size_t first_idx  = 0;
+    size_t second_idx = 0;
+    size_t out_idx    = 0;
+
+    while ((first_idx < first_count) && (second_idx < second_count))
+    {
+        // Take from 'second' only when strictly smaller to stay stable
+        if (LESS_THAN == compare_func(second[second_idx], first[first_idx]))
+        {
+            destination[out_idx++] = second[second_idx++];
+        }
+        else
+        {
+            destination[out_idx++] = first[first_idx++];
+        }
+    }
+
+    if (first_idx < first_count)
+    {
+        memcpy(&destination[out_idx],
+               &first[first_idx],
+               (first_count - first_idx) * sizeof(void *));
+    }
+
+    if (second_idx < second_count)
+    {
+        memcpy(&destination[out_idx],
+               &second[second_idx],
+               (second_count - second_idx) * sizeof(void *));
+    }
+}
+
+static void sequential_merge_sort(void ** items,
+                                  void ** scratch,
+                                  size_t  count,
+                                  CMP_F   compare_func)
+{
+    void ** source      = items;
+    void ** destination = scratch;
+    void ** swap        = NULL;
+    size_t  middle      = 0;
+    size_t  high        = 0;
+
+    for (size_t low = 0; low < count; low += INSERTION_THRESHOLD)
+    {
+        high = (low + INSERTION_THRESHOLD < count) ? INSERTION_THRESHOLD
+                                                   : count - low;
+        insertion_sort(&items[low], high, compare_func);
+    }
+
+    for (size_t width = INSERTION_THRESHOLD; width < count; width *= 2)
+    {
+        for (size_t low = 0; low < count; low += 2 * width)
+        {
+            middle = (low + width < count) ? low + width : count;
+            high   = (low + (2 * width) < count) ? low + (2 * width) : count;
+            merge_runs(&source[low],
+                       middle - low,
+                       &source[middle],
+                       high - middle,
+                       &destination[low],
+                       compare_func);
+        }
+
+        swap        = source;
+        source      = destination;
+        destination = swap;
+    }
+
+    if (source != items)
+    {
+        memcpy(items, source, count * sizeof(void *));
+    }
+}
+
+static size_t co_rank(size_t  rank,
+                      void ** first,
+                      size_t  first_count,
+                      void ** second,
+                      size_t  second_count,
+                      CMP_F   compare_func)
+{
+    size_t first_idx  = (rank < first_count) ? rank : first_count;
+    size_t second_idx = rank - first_idx;
+    size_t first_low  = (rank > second_count) ? rank - second_count : 0;
+    size_t second_low = 0;
+    size_t delta      = 0;
+
+    for (;;)
+    {
+        if ((0 < first_idx) && (second_idx < second_count) &&
+            (LESS_THAN ==
+             compare_func(second[second_idx], first[first_idx - 1])))
+        {
+            // Too many taken from 'first'
+            delta = ((first_idx - first_low) + 1) / 2;
+            second_low = second_idx;
+            first_idx -= delta;
+            second_idx += delta;
+        }
+        else if ((0 < second_idx) && (first_idx < first_count) &&
+                 (LESS_THAN !=
+                  compare_func(second[second_idx - 1], first[first_idx])))
+        {
+            // Too many taken from 'second'
+            delta = ((second_idx - second_low) + 1) / 2;
+            first_low = first_idx;
+            first_idx += delta;
+            second_idx -= delta;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return first_idx;
+}
+
+static comp_rtns_t string_compare(void * first, void * second)
+{
+    int result = strcmp((const char *)first, (const char *)second);
+
+    if (0 == result)
+    {
+        return EQUAL;
+    }
+
+    return (0 > result) ? LESS_THAN : GREATER_THAN;
+}
+
+static void string_radix_sort(void ** items,
+                              void ** scratch,
+                              size_t  count,
+                              size_t  depth)
+{
+    size_t        counts[RADIX_BUCKETS] = { 0 };
+    size_t        starts[RADIX_BUCKETS] = { 0 };
+    size_t        running               = 0;
+    unsigned char byte                  = 0;
+
+    if (2 > count)
+    {
+        return;
+    }
+
+    // Every string here shares its first 'depth' bytes, so a full strcmp
+    // orders them correctly
+    if ((INSERTION_THRESHOLD >= count) || (STRING_MAX_DEPTH < depth))
+    {
+        sequential_merge_sort(items, scratch, count, string_compare);
+        return;
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        counts[((unsigned char *)items[idx])[depth]]++;
+    }
+
+    for (size_t bucket = 0; bucket < RADIX_BUCKETS; bucket++)
+    {
+        starts[bucket] = running;
+        running += counts[bucket];
+    }
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        byte                    = ((unsigned char *)items[idx])[depth];
+        scratch[starts[byte]++] = items[idx];
+    }
+    memcpy(items, scratch, count * sizeof(void *));
+
+    // Bucket 0 holds strings that ended at 'depth' and are all equal
+    running = counts[0];
+    for (size_t bucket = 1; bucket < RADIX_BUCKETS; bucket++)
+    {
+        string_radix_sort(
+            &items[running], &scratch[running], counts[bucket], depth + 1);
+        running += counts[bucket];
+    }
+}
+
+static void * run_task_routine(void * data)
+{
+    run_task_t * task = (run_task_t *)data;
+
+    sequential_merge_sort(
+        task->items, task->scratch, task->count, task->compare_func);
+
+    return NULL;
+}
+
+static void * merge_task_routine(void * data)
+{
+    merge_task_t * task = (merge_task_t *)data;
+
+    merge_runs(task->first,
+               task->first_count,
+               task->second,
+               task->second_count,
+               task->destination,
+               task->compare_func);
+
+    return NULL;
+}
+
+static void * radix_task_routine(void * data)
+{
+    radix_task_t *    task      = (radix_task_t *)data;
+    radix_context_t * context   = task->context;
+    size_t            low       = 0;
+    size_t            high      = 0;
+    size_t *          histogram = NULL;
+    size_t *          offsets   = NULL;
+    size_t            shift     = context->pass * RADIX_BITS;
+    radix_entry_t     entry     = { 0 };
+
+    low  = (context->count * task->chunk) / context->num_chunks;
+    high = (context->count * (task->chunk + 1)) / context->num_chunks;
+    histogram = &context->histograms[HISTOGRAM_INDEX(task->chunk, 0, 0)];
+    offsets   = &context->offsets[task->chunk * RADIX_BUCKETS];
+
+    switch (context->phase)
+    {
+        case RADIX_LOAD:
+            for (size_t idx = low; idx < high; idx++)
+            {
+                entry.item = context->items[idx];
+                entry.key  = context->key_func(entry.item);
+                context->source[idx] = entry;
+
+                for (size_t pass = 0; pass < RADIX_PASSES; pass++)
+                {
+                    histogram[(pass * RADIX_BUCKETS) +
+                              ((entry.key >> (pass * RADIX_BITS)) &
+                               RADIX_MASK)]++;
+                }
+            }
+            break;
+
+        case RADIX_COUNT:
+            histogram = &histogram[context->pass * RADIX_BUCKETS];
+            memset(histogram, 0, RADIX_BUCKETS * sizeof(size_t));
+            for (size_t idx = low; idx < high; idx++)
+            {
+                histogram[(context->source[idx].key >> shift) & RADIX_MASK]++;
+            }
+            break;
+
+        case RADIX_SCATTER:
+            for (size_t idx = low; idx < high; idx++)
+            {
+                entry = context->source[idx];
+                context->destination[offsets[(entry.key >> shift) &
+                                             RADIX_MASK]++] = entry;
+            }
+            break;
+
+        case RADIX_STORE:
+            for (size_t idx = low; idx < high; idx++)
+            {
+                context->items[idx] = context->source[idx].item;
+            }
+            break;
+
+        default:
+            PRINT_DEBUG("radix_task_routine(): Invalid phase.\n");
+            break;
+    }
+
+    return NULL;
+}
+
+static void * string_task_routine(void * data)
+{
+    string_task_t * task = (string_task_t *)data;
+
+    string_radix_sort(task->items, task->scratch, task->count, 1);
+
+    return NULL;
+}
+
+static void ** list_to_array(list_t * list)
+{
+    void **       items   = NULL;
+    list_node_t * current = NULL;
+    size_t        idx     = 0;
+
+    if (0 == list->size)
+    {
+        goto END;
+    }
+
+    items = calloc(list->size, sizeof(void *));
+    if (NULL == items)
+    {
+        PRINT_DEBUG("list_to_array(): CMR failure.\n");
+        goto END;
+    }
+
+    for (current = list->head; NULL != current; current = current->next)
+    {
+        items[idx++] = current->data;
+    }
+
+END:
+    return items;
+}
+
+static void array_to_list(list_t * list, void ** items)
+{
+    list_node_t * current = list->head;
+    size_t        idx     = 0;
+
+    while (NULL != current)
+    {
+        current->data = items[idx++];
+        current       = current->next;
+    }
+}
+
+/*** end of file ***/
@@ -0,0 +1,213 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adjacency_list.h"
+#include "comparisons.h"
+#include "graph_csr.h"
+#include "parallel_bfs.h"
+#include "signal_handler.h"
+#include "utilities.h"
+
+#define BFS_THREADS      4
+#define BFS_NODE_COUNT   600
+#define BFS_CHAIN        500
+#define RANDOM_NODES     50021 // Not a multiple of the bitmap word size
+#define RANDOM_EDGES     400000
+#define RANDOM_STARTS    4
+
+static thread_pool_t * bfs_pool  = NULL;
+static graph_t *       bfs_graph = NULL;
+static graph_csr_t *   bfs_csr   = NULL;
+static uint32_t *      expected  = NULL;
+static uint32_t *      actual    = NULL;
+static int             bfs_data[BFS_NODE_COUNT];
+
+static void bfs_no_free(void * data)
+{
+    (void)data;
+}
+
+static int bfs_init_suite(void)
+{
+    srand(11);
+    bfs_pool = thread_pool_create(BFS_THREADS);
+    return (NULL == bfs_pool) ? E_FAILURE : E_SUCCESS;
+}
+
+static int bfs_clean_suite(void)
+{
+    signal_flag = SHUTDOWN;
+    thread_pool_destroy(&bfs_pool);
+    signal_flag = ACTIVE;
+    return E_SUCCESS;
+}
+
+static void bfs_setup(void)
+{
+    bfs_graph = graph_create(bfs_no_free, int_comp);
+    for (int idx = 0; idx < BFS_NODE_COUNT; idx++)
+    {
+        bfs_data[idx] = idx;
+        graph_add_node(bfs_graph, &bfs_data[idx]);
+    }
+
+    expected = calloc(RANDOM_NODES, sizeof(uint32_t));
+    actual   = calloc(RANDOM_NODES, sizeof(uint32_t));
+}
+
+static void bfs_teardown(void)
+{
+    if (NULL != bfs_csr)
+    {
+        graph_csr_destroy(&bfs_csr);
+    }
+    graph_destroy(&bfs_graph);
+    free(expected);
+    free(actual);
+    expected = NULL;
+    actual   = NULL;
+}
+
+/*
+ * Builds a random one-way snapshot directly, which is much quicker than
+ * building and freezing a graph large enough to split levels across the pool.
+ */
+static graph_csr_t * build_random_csr(void)
+{
+    graph_csr_t * csr     = calloc(1, sizeof(graph_csr_t));
+    uint32_t *    sources = calloc(RANDOM_EDGES, sizeof(uint32_t));
+    uint32_t *    targets = calloc(RANDOM_EDGES, sizeof(uint32_t));
+    size_t *      cursor  = calloc(RANDOM_NODES + 1, sizeof(size_t));
+
+    csr->node_count = RANDOM_NODES;
+    csr->edge_count = RANDOM_EDGES;
+    csr->offsets    = calloc(RANDOM_NODES + 1, sizeof(size_t));
+    csr->neighbors  = calloc(RANDOM_EDGES, sizeof(uint32_t));
+    csr->weights    = calloc(RANDOM_EDGES, sizeof(size_t));
+
+    for (size_t edge = 0; edge < RANDOM_EDGES; edge++)
+    {
+        sources[edge] = (uint32_t)rand() % RANDOM_NODES;
+        targets[edge] = (uint32_t)rand() % RANDOM_NODES;
+        csr->offsets[sources[edge] + 1]++;
+    }
+    for (size_t node = 0; node < RANDOM_NODES; node++)
+    {
+        csr->offsets[node + 1] += csr->offsets[node];
+        cursor[node] = csr->offsets[node];
+    }
+    for (size_t edge = 0; edge < RANDOM_EDGES; edge++)
+    {
+        csr->neighbors[cursor[sources[edge]]++] = targets[edge];
+    }
+
+    free(sources);
+    free(targets);
+    free(cursor);
+    return csr;
+}
+
+static void check_against_serial(uint32_t start)
+{
+    parallel_bfs_t * pooled  = NULL;
+    parallel_bfs_t * inlined = NULL;
+    size_t           reached = 0;
+    size_t           count   = 0;
+
+    pooled  = parallel_bfs_create(bfs_pool, bfs_csr);
+    inlined = parallel_bfs_create(NULL, bfs_csr);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pooled);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(inlined);
+
+    CU_ASSERT_EQUAL(graph_csr_bfs_hops(bfs_csr, start, expected), E_SUCCESS);
+    for (uint32_t node = 0; node < bfs_csr->node_count; node++)
+    {
+        count += (PARALLEL_BFS_UNREACHED != expected[node]);
+    }
+
+    CU_ASSERT_EQUAL(parallel_bfs_run(pooled, start, actual, &reached),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(reached, count);
+    CU_ASSERT_EQUAL(
+        memcmp(expected, actual, bfs_csr->node_count * sizeof(uint32_t)), 0);
+
+    CU_ASSERT_EQUAL(parallel_bfs_run(inlined, start, actual, NULL),
+                    E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        memcmp(expected, actual, bfs_csr->node_count * sizeof(uint32_t)), 0);
+
+    parallel_bfs_destroy(&pooled);
+    parallel_bfs_destroy(&inlined);
+    CU_ASSERT_PTR_NULL(pooled);
+}
+
+static void test_parallel_bfs_random_graph(void)
+{
+    // Dense enough for the middle levels to run bottom-up
+    bfs_csr = build_random_csr();
+    CU_ASSERT_PTR_NOT_NULL_FATAL(bfs_csr);
+
+    for (int idx = 0; idx < RANDOM_STARTS; idx++)
+    {
+        check_against_serial((uint32_t)rand() % RANDOM_NODES);
+    }
+}
+
+static void test_parallel_bfs_long_chain(void)
+{
+    // One node per level, plus a shortcut and an unreachable tail
+    for (int idx = 0; (idx + 1) < BFS_CHAIN; idx++)
+    {
+        graph_add_edge(
+            bfs_graph, &bfs_data[idx], &bfs_data[idx + 1], 1, false);
+    }
+    graph_add_edge(bfs_graph, &bfs_data[0], &bfs_data[BFS_CHAIN / 2], 1, false);
+
+    bfs_csr = graph_freeze(bfs_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(bfs_csr);
+
+    check_against_serial(graph_csr_node_index(bfs_csr, &bfs_data[0]));
+    check_against_serial(
+        graph_csr_node_index(bfs_csr, &bfs_data[BFS_CHAIN - 1]));
+}
+
+static void test_parallel_bfs_invalid_args(void)
+{
+    parallel_bfs_t * bfs = NULL;
+
+    bfs_csr = graph_freeze(bfs_graph);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(bfs_csr);
+
+    CU_ASSERT_PTR_NULL(parallel_bfs_create(bfs_pool, NULL));
+
+    bfs = parallel_bfs_create(bfs_pool, bfs_csr);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(bfs);
+    CU_ASSERT_EQUAL(parallel_bfs_run(bfs, 0, NULL, NULL), E_FAILURE);
+    CU_ASSERT_EQUAL(
+        parallel_bfs_run(bfs, BFS_NODE_COUNT, actual, NULL), E_FAILURE);
+    parallel_bfs_destroy(&bfs);
+
+    CU_ASSERT_EQUAL(parallel_csr_bfs(bfs_pool, bfs_csr, 0, actual), E_SUCCESS);
+    CU_ASSERT_EQUAL(actual[0], 0);
+    CU_ASSERT_EQUAL(actual[1], PARALLEL_BFS_UNREACHED);
+}
+
+static CU_TestInfo parallel_bfs_tests[] = {
+    { "parallel_bfs_random_graph", test_parallel_bfs_random_graph },
+    { "parallel_bfs_long_chain", test_parallel_bfs_long_chain },
+    { "parallel_bfs_invalid_args", test_parallel_bfs_invalid_args },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo parallel_bfs_test_suite = {
+    "Parallel BFS Tests",
+    bfs_init_suite,    // Suite initialization function
+    bfs_clean_suite,   // Suite cleanup function
+    bfs_setup,         // Suite setup function
+    bfs_teardown,      // Suite teardown function
+    parallel_bfs_tests // The combined array of all tests
+};
+
+/*** end of file ***/
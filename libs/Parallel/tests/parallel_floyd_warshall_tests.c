@@ -0,0 +1,142 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdlib.h>
+
+#include "adjacency_list.h"
+#include "comparisons.h"
+#include "parallel_floyd_warshall.h"
+#include "signal_handler.h"
+#include "utilities.h"
+
+#define FW_THREADS    4
+#define FW_NODE_COUNT 150 // Not a multiple of the tile size
+#define FW_EDGE_COUNT 600
+#define FW_MAX_WEIGHT 100
+
+static thread_pool_t * fw_pool  = NULL;
+static graph_t *       fw_graph = NULL;
+static int             fw_data[FW_NODE_COUNT];
+
+static void fw_no_free(void * data)
+{
+    (void)data;
+}
+
+static int fw_init_suite(void)
+{
+    srand(7);
+    fw_pool = thread_pool_create(FW_THREADS);
+    return (NULL == fw_pool) ? E_FAILURE : E_SUCCESS;
+}
+
+static int fw_clean_suite(void)
+{
+    signal_flag = SHUTDOWN;
+    thread_pool_destroy(&fw_pool);
+    signal_flag = ACTIVE;
+    return E_SUCCESS;
+}
+
+// Random mix of one-way and two-way edges, including parallel edges
+static void fw_setup(void)
+{
+    int first  = 0;
+    int second = 0;
+
+    fw_graph = graph_create(fw_no_free, int_comp);
+    for (int idx = 0; idx < FW_NODE_COUNT; idx++)
+    {
+        fw_data[idx] = idx;
+        graph_add_node(fw_graph, &fw_data[idx]);
+    }
+
+    for (int idx = 0; idx < FW_EDGE_COUNT; idx++)
+    {
+        first  = rand() % FW_NODE_COUNT;
+        second = rand() % FW_NODE_COUNT;
+        graph_add_edge(fw_graph,
+                       &fw_data[first],
+                       &fw_data[second],
+                       (size_t)(rand() % FW_MAX_WEIGHT),
+                       (0 == (idx % 3)));
+    }
+}
+
+static void fw_teardown(void)
+{
+    graph_destroy(&fw_graph);
+}
+
+static void test_parallel_floyd_warshall_matches_serial(void)
+{
+    size_t * expected = NULL;
+    size_t * pooled   = NULL;
+    size_t * inlined  = NULL;
+    size_t   total    = FW_NODE_COUNT * FW_NODE_COUNT;
+
+    CU_ASSERT_EQUAL_FATAL(graph_floyd_warshall(fw_graph, &expected),
+                          E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        parallel_graph_floyd_warshall(fw_pool, fw_graph, &pooled), E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        parallel_graph_floyd_warshall(NULL, fw_graph, &inlined), E_SUCCESS);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pooled);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(inlined);
+
+    for (size_t idx = 0; idx < total; idx++)
+    {
+        if ((expected[idx] != pooled[idx]) || (expected[idx] != inlined[idx]))
+        {
+            CU_FAIL("distance mismatch");
+            break;
+        }
+    }
+
+    free(expected);
+    free(pooled);
+    free(inlined);
+}
+
+static void test_parallel_floyd_warshall_saturates(void)
+{
+    size_t inf          = GRAPH_DISTANCE_INFINITY;
+    size_t distances[9] = { 0, inf - 1, inf, inf, 0, 5, inf, inf, 0 };
+
+    // 0 -> 1 -> 2 would overflow, so 0 -> 2 must stay unreachable
+    CU_ASSERT_EQUAL(parallel_floyd_warshall(fw_pool, distances, 3), E_SUCCESS);
+    CU_ASSERT_EQUAL(distances[1], inf - 1);
+    CU_ASSERT_EQUAL(distances[2], inf);
+    CU_ASSERT_EQUAL(distances[5], 5);
+}
+
+static void test_parallel_floyd_warshall_invalid_args(void)
+{
+    size_t * distances = NULL;
+
+    CU_ASSERT_EQUAL(parallel_floyd_warshall(fw_pool, NULL, 1), E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_graph_floyd_warshall(fw_pool, NULL, &distances),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_graph_floyd_warshall(fw_pool, fw_graph, NULL),
+                    E_FAILURE);
+}
+
+static CU_TestInfo parallel_floyd_warshall_tests[] = {
+    { "parallel_floyd_warshall_matches_serial",
+      test_parallel_floyd_warshall_matches_serial },
+    { "parallel_floyd_warshall_saturates",
+      test_parallel_floyd_warshall_saturates },
+    { "parallel_floyd_warshall_invalid_args",
+      test_parallel_floyd_warshall_invalid_args },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo parallel_floyd_warshall_test_suite = {
+    "Parallel Floyd-Warshall Tests",
+    fw_init_suite,                // Suite initialization function
+    fw_clean_suite,               // Suite cleanup function
+    fw_setup,                     // Suite setup function
+    fw_teardown,                  // Suite teardown function
+    parallel_floyd_warshall_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -0,0 +1,302 @@
+// NOLINTNEXTLINE
+#define _GNU_SOURCE // mkstemp()
+
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "parallel_graph_load.h"
+#include "signal_handler.h"
+#include "utilities.h"
+
+#define LOAD_THREADS     4
+#define RANDOM_EDGES     300000
+#define RANDOM_DENSE_IDS 40000
+#define RANDOM_WEIGHTS   50
+
+static thread_pool_t * load_pool = NULL;
+static char            load_path[] = "/tmp/parallel_graph_load_XXXXXX";
+
+typedef struct
+{
+    uint32_t source;
+    uint32_t target;
+    uint32_t weight;
+} test_edge_t;
+
+static int load_init_suite(void)
+{
+    int file_fd = -1;
+
+    srand(13);
+    file_fd = mkstemp(load_path);
+    if (0 > file_fd)
+    {
+        return E_FAILURE;
+    }
+    close(file_fd);
+
+    load_pool = thread_pool_create(LOAD_THREADS);
+    return (NULL == load_pool) ? E_FAILURE : E_SUCCESS;
+}
+
+static int load_clean_suite(void)
+{
+    unlink(load_path);
+    signal_flag = SHUTDOWN;
+    thread_pool_destroy(&load_pool);
+    signal_flag = ACTIVE;
+    return E_SUCCESS;
+}
+
+static void write_file(const void * contents, size_t size)
+{
+    FILE * file = fopen(load_path, "wb");
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(file);
+    CU_ASSERT_EQUAL(fwrite(contents, 1, size, file), size);
+    fclose(file);
+}
+
+static graph_csr_t * load_text(const char * text, bool undirected)
+{
+    parallel_load_options_t options = { PARALLEL_LOAD_TEXT, undirected };
+
+    write_file(text, strlen(text));
+    return parallel_graph_load(load_pool, load_path, &options);
+}
+
+static uint32_t label_of(const graph_csr_t * csr, uint32_t index)
+{
+    return *(const uint32_t *)csr->node_data[index];
+}
+
+static int edge_comp(const void * first, const void * second)
+{
+    const test_edge_t * lhs = first;
+    const test_edge_t * rhs = second;
+
+    if (lhs->source != rhs->source)
+    {
+        return (lhs->source < rhs->source) ? -1 : 1;
+    }
+    if (lhs->target != rhs->target)
+    {
+        return (lhs->target < rhs->target) ? -1 : 1;
+    }
+    return (lhs->weight < rhs->weight) ? -1 : (lhs->weight > rhs->weight);
+}
+
+// Checks a snapshot against a sorted list of edges, keeping the lightest
+static void check_against_sorted(const graph_csr_t * csr,
+                                 const test_edge_t * edges,
+                                 size_t              count)
+{
+    size_t   written = 0;
+    uint32_t source  = 0;
+
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        if ((0 != idx) && (edges[idx].source == edges[idx - 1].source) &&
+            (edges[idx].target == edges[idx - 1].target))
+        {
+            continue;
+        }
+
+        source = parallel_graph_load_index(csr, edges[idx].source);
+        if ((GRAPH_CSR_NO_NODE == source) ||
+            (written < csr->offsets[source]) ||
+            (written >= csr->offsets[source + 1]) ||
+            (edges[idx].target != label_of(csr, csr->neighbors[written])) ||
+            (edges[idx].weight != csr->weights[written]))
+        {
+            CU_FAIL("edge mismatch");
+            return;
+        }
+        written++;
+    }
+
+    CU_ASSERT_EQUAL(csr->edge_count, written);
+}
+
+static void test_parallel_graph_load_text(void)
+{
+    graph_csr_t * csr = NULL;
+
+    // Sparse IDs, comments, CRLF, default weights and a lighter duplicate
+    csr = load_text("# source target weight\n"
+                    "% another comment\n"
+                    "\n"
+                    "7 1000000 4\r\n"
+                    "  10\t7 2\n"
+                    "7 1000000 3\n"
+                    "7 1000000 9\n"
+                    "7 10\n"
+                    "1000000 1000000 5",
+                    false);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+
+    CU_ASSERT_EQUAL(csr->node_count, 3);
+    CU_ASSERT_EQUAL(csr->edge_count, 4);
+    CU_ASSERT_EQUAL(label_of(csr, 0), 7);
+    CU_ASSERT_EQUAL(label_of(csr, 1), 10);
+    CU_ASSERT_EQUAL(label_of(csr, 2), 1000000);
+    CU_ASSERT_EQUAL(parallel_graph_load_index(csr, 1000000), 2);
+    CU_ASSERT_EQUAL(parallel_graph_load_index(csr, 8), GRAPH_CSR_NO_NODE);
+    CU_ASSERT_EQUAL(graph_csr_node_index(csr, csr->node_data[1]), 1);
+
+    // 7 -> 10 (1), 7 -> 1000000 (3)
+    CU_ASSERT_EQUAL(csr->offsets[1] - csr->offsets[0], 2);
+    CU_ASSERT_EQUAL(csr->neighbors[0], 1);
+    CU_ASSERT_EQUAL(csr->weights[0], 1);
+    CU_ASSERT_EQUAL(csr->neighbors[1], 2);
+    CU_ASSERT_EQUAL(csr->weights[1], 3);
+
+    // 10 -> 7 (2), then the self-loop on 1000000
+    CU_ASSERT_EQUAL(csr->neighbors[2], 0);
+    CU_ASSERT_EQUAL(csr->weights[2], 2);
+    CU_ASSERT_EQUAL(csr->offsets[2], 3);
+    CU_ASSERT_EQUAL(csr->neighbors[3], 2);
+    CU_ASSERT_EQUAL(csr->offsets[3], 4);
+
+    graph_csr_destroy(&csr);
+    CU_ASSERT_PTR_NULL(csr);
+}
+
+static void test_parallel_graph_load_binary_undirected(void)
+{
+    parallel_load_options_t options    = { PARALLEL_LOAD_BINARY, true };
+    parallel_edge_record_t  records[3] = { { 2, 0, 6 },
+                                           { 0, 1, 5 },
+                                           { 1, 0, 8 } };
+    graph_csr_t *           csr        = NULL;
+
+    write_file(records, sizeof(records));
+    csr = parallel_graph_load(NULL, load_path, &options);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+
+    // 0: 1 (5), 2 (6); 1: 0 (5); 2: 0 (6)
+    CU_ASSERT_EQUAL(csr->node_count, 3);
+    CU_ASSERT_EQUAL(csr->edge_count, 4);
+    CU_ASSERT_EQUAL(csr->offsets[1], 2);
+    CU_ASSERT_EQUAL(csr->offsets[2], 3);
+    CU_ASSERT_EQUAL(csr->neighbors[0], 1);
+    CU_ASSERT_EQUAL(csr->weights[0], 5);
+    CU_ASSERT_EQUAL(csr->neighbors[1], 2);
+    CU_ASSERT_EQUAL(csr->weights[1], 6);
+    CU_ASSERT_EQUAL(csr->neighbors[2], 0);
+    CU_ASSERT_EQUAL(csr->weights[2], 5);
+    CU_ASSERT_EQUAL(csr->neighbors[3], 0);
+
+    graph_csr_destroy(&csr);
+}
+
+static void check_random(uint32_t id_range, parallel_load_format_t format)
+{
+    parallel_load_options_t options = { format, false };
+    test_edge_t *           edges   = NULL;
+    FILE *                  file    = NULL;
+    graph_csr_t *           pooled  = NULL;
+    graph_csr_t *           inlined = NULL;
+
+    edges = calloc(RANDOM_EDGES, sizeof(test_edge_t));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(edges);
+
+    file = fopen(load_path, "wb");
+    CU_ASSERT_PTR_NOT_NULL_FATAL(file);
+    for (size_t idx = 0; idx < RANDOM_EDGES; idx++)
+    {
+        edges[idx].source = (uint32_t)rand() % id_range;
+        edges[idx].target = (uint32_t)rand() % id_range;
+        edges[idx].weight = (uint32_t)rand() % RANDOM_WEIGHTS;
+        if (PARALLEL_LOAD_TEXT == format)
+        {
+            fprintf(file,
+                    "%u %u %u\n",
+                    edges[idx].source,
+                    edges[idx].target,
+                    edges[idx].weight);
+        }
+        else
+        {
+            fwrite(&edges[idx], sizeof(test_edge_t), 1, file);
+        }
+    }
+    fclose(file);
+
+    pooled  = parallel_graph_load(load_pool, load_path, &options);
+    inlined = parallel_graph_load(NULL, load_path, &options);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pooled);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(inlined);
+
+    qsort(edges, RANDOM_EDGES, sizeof(test_edge_t), edge_comp);
+    check_against_sorted(pooled, edges, RANDOM_EDGES);
+    check_against_sorted(inlined, edges, RANDOM_EDGES);
+
+    graph_csr_destroy(&pooled);
+    graph_csr_destroy(&inlined);
+    free(edges);
+}
+
+static void test_parallel_graph_load_random(void)
+{
+    // Dense IDs are renumbered through a table, sparse ones by sorting
+    check_random(RANDOM_DENSE_IDS, PARALLEL_LOAD_TEXT);
+    check_random(UINT32_MAX, PARALLEL_LOAD_BINARY);
+}
+
+static void test_parallel_graph_load_invalid_input(void)
+{
+    parallel_load_options_t options = { PARALLEL_LOAD_BINARY, false };
+    graph_csr_t *           csr     = NULL;
+    const char *            bad[]   = { "1 2 x\n", "1\n",       "-1 2\n",
+                                        "1 2 3 4\n", "12 4294967296\n",
+                                        "1,2\n" };
+
+    for (size_t idx = 0; idx < (sizeof(bad) / sizeof(bad[0])); idx++)
+    {
+        CU_ASSERT_PTR_NULL(load_text(bad[idx], false));
+    }
+
+    // Not a whole number of records
+    write_file("12345", 5);
+    CU_ASSERT_PTR_NULL(parallel_graph_load(load_pool, load_path, &options));
+
+    CU_ASSERT_PTR_NULL(parallel_graph_load(load_pool, NULL, &options));
+    CU_ASSERT_PTR_NULL(parallel_graph_load(load_pool, load_path, NULL));
+    CU_ASSERT_PTR_NULL(
+        parallel_graph_load(load_pool, "/nonexistent/edges.txt", &options));
+    CU_ASSERT_EQUAL(parallel_graph_load_index(NULL, 0), GRAPH_CSR_NO_NODE);
+
+    // An empty file is an empty graph
+    csr = load_text("", true);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(csr);
+    CU_ASSERT_EQUAL(csr->node_count, 0);
+    CU_ASSERT_EQUAL(csr->edge_count, 0);
+    CU_ASSERT_EQUAL(parallel_graph_load_index(csr, 0), GRAPH_CSR_NO_NODE);
+    graph_csr_destroy(&csr);
+}
+
+static CU_TestInfo parallel_graph_load_tests[] = {
+    { "parallel_graph_load_text", test_parallel_graph_load_text },
+    { "parallel_graph_load_binary_undirected",
+      test_parallel_graph_load_binary_undirected },
+    { "parallel_graph_load_random", test_parallel_graph_load_random },
+    { "parallel_graph_load_invalid_input",
+      test_parallel_graph_load_invalid_input },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo parallel_graph_load_test_suite = {
+    "Parallel Graph Load Tests",
+    load_init_suite,          // Suite initialization function
+    load_clean_suite,         // Suite cleanup function
+    NULL,                     // Suite setup function
+    NULL,                     // Suite teardown function
+    parallel_graph_load_tests // The combined array of all tests
+};
+
+/*** end of file ***/
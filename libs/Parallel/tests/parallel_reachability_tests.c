@@ -0,0 +1,194 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adjacency_matrix.h"
+#include "comparisons.h"
+#include "parallel_reachability.h"
+#include "signal_handler.h"
+#include "utilities.h"
+
+#define REACH_THREADS     4
+#define REACH_NODE_COUNT  700 // Two strips of columns, the last one partial
+#define REACH_SMALL_COUNT 300 // One strip, cut into blocks of rows
+#define REACH_OUT_EDGES   2   // Long paths, and pairs that cannot reach
+
+static thread_pool_t * reach_pool  = NULL;
+static matrix_t *      reach_graph = NULL;
+
+static void reach_no_free(void * data)
+{
+    (void)data;
+}
+
+static int reach_init_suite(void)
+{
+    srand(17);
+    reach_pool = thread_pool_create(REACH_THREADS);
+    return (NULL == reach_pool) ? E_FAILURE : E_SUCCESS;
+}
+
+static int reach_clean_suite(void)
+{
+    signal_flag = SHUTDOWN;
+    thread_pool_destroy(&reach_pool);
+    signal_flag = ACTIVE;
+    return E_SUCCESS;
+}
+
+static void reach_setup(void)
+{
+    reach_graph = matrix_init_weighted(REACH_NODE_COUNT,
+                                       true,
+                                       MATRIX_WEIGHT_NONE,
+                                       int_comp,
+                                       reach_no_free);
+    for (size_t src = 0; src < REACH_NODE_COUNT; src++)
+    {
+        for (int edge = 0; edge < REACH_OUT_EDGES; edge++)
+        {
+            matrix_add_edge_by_index(
+                reach_graph, src, (size_t)rand() % REACH_NODE_COUNT, 1);
+        }
+    }
+}
+
+static void reach_teardown(void)
+{
+    matrix_destroy(&reach_graph);
+}
+
+static void check_matches_serial(matrix_t * graph, size_t count, size_t hops)
+{
+    uint64_t * expected = NULL;
+    uint64_t * pooled   = NULL;
+    uint64_t * inlined  = NULL;
+    size_t     size     = 0;
+
+    size = count * matrix_bitset_words(graph) * sizeof(uint64_t);
+    CU_ASSERT_EQUAL_FATAL(matrix_reachability(graph, hops, &expected),
+                          E_SUCCESS);
+    CU_ASSERT_EQUAL(
+        parallel_matrix_reachability(reach_pool, graph, hops, &pooled),
+        E_SUCCESS);
+    CU_ASSERT_EQUAL(parallel_matrix_reachability(NULL, graph, hops, &inlined),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(pooled);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(inlined);
+
+    CU_ASSERT_EQUAL(memcmp(expected, pooled, size), 0);
+    CU_ASSERT_EQUAL(memcmp(expected, inlined, size), 0);
+
+    free(expected);
+    free(pooled);
+    free(inlined);
+}
+
+static void test_parallel_reachability_matches_serial(void)
+{
+    check_matches_serial(reach_graph, REACH_NODE_COUNT, 0);
+    check_matches_serial(reach_graph, REACH_NODE_COUNT, 1);
+    check_matches_serial(reach_graph, REACH_NODE_COUNT, 6);
+    check_matches_serial(reach_graph, REACH_NODE_COUNT, SIZE_MAX);
+}
+
+static void test_parallel_reachability_small_graph(void)
+{
+    matrix_t * graph = NULL;
+    size_t     words = 0;
+
+    graph = matrix_init_weighted(
+        REACH_SMALL_COUNT, true, MATRIX_WEIGHT_NONE, int_comp, reach_no_free);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(graph);
+    for (size_t src = 0; src < REACH_SMALL_COUNT; src++)
+    {
+        matrix_add_edge_by_index(
+            graph, src, (size_t)rand() % REACH_SMALL_COUNT, 1);
+    }
+
+    // A single strip of columns still spreads over the pool by rows
+    words = matrix_bitset_words(graph);
+    CU_ASSERT_TRUE(
+        1 < parallel_bitset_task_count(REACH_SMALL_COUNT, words, reach_pool));
+    CU_ASSERT_EQUAL(
+        parallel_bitset_task_count(REACH_SMALL_COUNT, words, NULL), 1);
+    CU_ASSERT_EQUAL(parallel_bitset_task_count(REACH_NODE_COUNT,
+                                               matrix_bitset_words(reach_graph),
+                                               reach_pool),
+                    REACH_THREADS);
+
+    check_matches_serial(graph, REACH_SMALL_COUNT, 3);
+    check_matches_serial(graph, REACH_SMALL_COUNT, SIZE_MAX);
+    matrix_destroy(&graph);
+}
+
+static void test_parallel_transitive_closure(void)
+{
+    uint64_t * closure = NULL;
+    size_t     words   = matrix_bitset_words(reach_graph);
+
+    // A cycle through every node lets each node reach all of them
+    for (size_t node = 0; node < REACH_NODE_COUNT; node++)
+    {
+        matrix_add_edge_by_index(
+            reach_graph, node, (node + 1) % REACH_NODE_COUNT, 1);
+    }
+
+    CU_ASSERT_EQUAL_FATAL(
+        parallel_matrix_transitive_closure(reach_pool, reach_graph, &closure),
+        E_SUCCESS);
+    for (size_t row = 0; row < REACH_NODE_COUNT; row++)
+    {
+        for (size_t idx = 0; idx < (REACH_NODE_COUNT / 64); idx++)
+        {
+            CU_ASSERT_EQUAL(closure[(row * words) + idx], UINT64_MAX);
+        }
+        CU_ASSERT_EQUAL(closure[(row * words) + (REACH_NODE_COUNT / 64)],
+                        ((uint64_t)1 << (REACH_NODE_COUNT % 64)) - 1);
+        for (size_t idx = (REACH_NODE_COUNT / 64) + 1; idx < words; idx++)
+        {
+            CU_ASSERT_EQUAL(closure[(row * words) + idx], 0);
+        }
+    }
+
+    free(closure);
+}
+
+static void test_parallel_reachability_invalid_args(void)
+{
+    uint64_t * reach = NULL;
+    uint64_t   bits  = 0;
+
+    CU_ASSERT_EQUAL(parallel_matrix_reachability(reach_pool, NULL, 1, &reach),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(
+        parallel_matrix_reachability(reach_pool, reach_graph, 1, NULL),
+        E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_matrix_transitive_closure(reach_pool, NULL, NULL),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_bitset_multiply(&bits, &bits, NULL, 1, 1, NULL),
+                    E_FAILURE);
+}
+
+static CU_TestInfo parallel_reachability_tests[] = {
+    { "parallel_reachability_matches_serial",
+      test_parallel_reachability_matches_serial },
+    { "parallel_reachability_small_graph",
+      test_parallel_reachability_small_graph },
+    { "parallel_transitive_closure", test_parallel_transitive_closure },
+    { "parallel_reachability_invalid_args",
+      test_parallel_reachability_invalid_args },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo parallel_reachability_test_suite = {
+    "Parallel Reachability Tests",
+    reach_init_suite,           // Suite initialization function
+    reach_clean_suite,          // Suite cleanup function
+    reach_setup,                // Suite setup function
+    reach_teardown,             // Suite teardown function
+    parallel_reachability_tests // The combined array of all tests
+};
+
+/*** end of file ***/
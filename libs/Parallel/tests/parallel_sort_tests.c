@@ -0,0 +1,296 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parallel_sort.h"
+#include "signal_handler.h"
+#include "utilities.h"
+
+#define NUM_THREADS   4
+#define LARGE_LENGTH  100000
+#define SMALL_LENGTH  100
+#define KEY_RANGE     1000
+#define STRING_LENGTH 24
+
+typedef struct
+{
+    int key;      // Sort key
+    int sequence; // Original position, used to check stability
+} record_t;
+
+thread_pool_t * pool    = NULL;
+record_t *      records = NULL;
+void **         items   = NULL;
+
+comp_rtns_t record_compare(void * first, void * second)
+{
+    record_t * lhs = (record_t *)first;
+    record_t * rhs = (record_t *)second;
+
+    if (lhs->key == rhs->key)
+    {
+        return EQUAL;
+    }
+
+    return (lhs->key < rhs->key) ? LESS_THAN : GREATER_THAN;
+}
+
+uint64_t record_key(const void * data)
+{
+    return sort_key_int(&((const record_t *)data)->key);
+}
+
+// Records are owned by the test arrays, not the containers
+void no_free(void * data)
+{
+    (void)data;
+}
+
+int qsort_strcmp(const void * first, const void * second)
+{
+    return strcmp(*(char * const *)first, *(char * const *)second);
+}
+
+void fill_records(size_t count, int sign)
+{
+    for (size_t idx = 0; idx < count; idx++)
+    {
+        records[idx].key      = sign * (rand() % KEY_RANGE);
+        records[idx].sequence = (int)idx;
+        items[idx]            = &records[idx];
+    }
+}
+
+bool is_sorted_and_stable(void ** array, size_t count)
+{
+    record_t * previous = NULL;
+    record_t * current  = NULL;
+
+    for (size_t idx = 1; idx < count; idx++)
+    {
+        previous = (record_t *)array[idx - 1];
+        current  = (record_t *)array[idx];
+
+        if ((previous->key > current->key) ||
+            ((previous->key == current->key) &&
+             (previous->sequence > current->sequence)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int init_suite(void)
+{
+    srand(42);
+    pool = thread_pool_create(NUM_THREADS);
+    return (NULL == pool) ? E_FAILURE : E_SUCCESS;
+}
+
+int clean_suite(void)
+{
+    signal_flag = SHUTDOWN;
+    thread_pool_destroy(&pool);
+    signal_flag = ACTIVE;
+    return E_SUCCESS;
+}
+
+void setup(void)
+{
+    records = calloc(LARGE_LENGTH, sizeof(record_t));
+    items   = calloc(LARGE_LENGTH, sizeof(void *));
+}
+
+void teardown(void)
+{
+    free(records);
+    free(items);
+    records = NULL;
+    items   = NULL;
+}
+
+void test_parallel_sort_array(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(items);
+
+    fill_records(LARGE_LENGTH, 1);
+    CU_ASSERT_EQUAL(
+        parallel_sort_array(pool, items, LARGE_LENGTH, record_compare),
+        E_SUCCESS);
+    CU_ASSERT_TRUE(is_sorted_and_stable(items, LARGE_LENGTH));
+
+    // Small inputs and a NULL pool take the sequential path
+    fill_records(SMALL_LENGTH, 1);
+    CU_ASSERT_EQUAL(
+        parallel_sort_array(NULL, items, SMALL_LENGTH, record_compare),
+        E_SUCCESS);
+    CU_ASSERT_TRUE(is_sorted_and_stable(items, SMALL_LENGTH));
+}
+
+void test_parallel_radix_sort_array(void)
+{
+    CU_ASSERT_PTR_NOT_NULL_FATAL(items);
+
+    // Mixed signs exercise the sign-flipped key
+    fill_records(LARGE_LENGTH, 1);
+    for (size_t idx = 0; idx < LARGE_LENGTH; idx += 2)
+    {
+        records[idx].key = -records[idx].key;
+    }
+
+    CU_ASSERT_EQUAL(
+        parallel_radix_sort_array(pool, items, LARGE_LENGTH, record_key),
+        E_SUCCESS);
+    CU_ASSERT_TRUE(is_sorted_and_stable(items, LARGE_LENGTH));
+
+    fill_records(SMALL_LENGTH, -1);
+    CU_ASSERT_EQUAL(
+        parallel_radix_sort_array(NULL, items, SMALL_LENGTH, record_key),
+        E_SUCCESS);
+    CU_ASSERT_TRUE(is_sorted_and_stable(items, SMALL_LENGTH));
+}
+
+void test_parallel_string_sort_array(void)
+{
+    char *  strings  = NULL;
+    char ** expected = NULL;
+    size_t  length   = 0;
+
+    strings  = calloc(LARGE_LENGTH, STRING_LENGTH);
+    expected = calloc(LARGE_LENGTH, sizeof(char *));
+    CU_ASSERT_PTR_NOT_NULL_FATAL(strings);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(expected);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(items);
+
+    // Short alphabets and shared prefixes force deep buckets
+    for (size_t idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        char * current = &strings[idx * STRING_LENGTH];
+
+        length = (size_t)rand() % (STRING_LENGTH - 1);
+        for (size_t pos = 0; pos < length; pos++)
+        {
+            current[pos] = (pos < 4) ? 'p' : (char)('a' + (rand() % 3));
+        }
+        items[idx]    = current;
+        expected[idx] = current;
+    }
+
+    qsort(expected, LARGE_LENGTH, sizeof(char *), qsort_strcmp);
+
+    CU_ASSERT_EQUAL(parallel_string_sort_array(pool, items, LARGE_LENGTH),
+                    E_SUCCESS);
+    for (size_t idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        if (0 != strcmp((char *)items[idx], expected[idx]))
+        {
+            CU_FAIL("String order does not match qsort()");
+            break;
+        }
+    }
+
+    free(expected);
+    free(strings);
+}
+
+void test_parallel_vector_sort(void)
+{
+    vector_t * vector = NULL;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(items);
+    fill_records(LARGE_LENGTH, 1);
+
+    vector = vector_new(no_free, record_compare, LARGE_LENGTH);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(vector);
+    for (size_t idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        vector_append(vector, items[idx]);
+    }
+
+    CU_ASSERT_EQUAL(parallel_vector_sort(pool, vector), E_SUCCESS);
+    CU_ASSERT_EQUAL(vector_size(vector), LARGE_LENGTH);
+    CU_ASSERT_TRUE(is_sorted_and_stable(vector->elements, LARGE_LENGTH));
+
+    fill_records(LARGE_LENGTH, -1);
+    for (size_t idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        vector_set_element(vector, items[idx], (int)idx);
+    }
+
+    CU_ASSERT_EQUAL(parallel_vector_radix_sort(pool, vector, record_key),
+                    E_SUCCESS);
+    CU_ASSERT_TRUE(is_sorted_and_stable(vector->elements, LARGE_LENGTH));
+
+    vector_delete(&vector);
+}
+
+void test_parallel_list_sort(void)
+{
+    list_t *      list    = NULL;
+    list_node_t * current = NULL;
+    size_t        idx     = 0;
+
+    CU_ASSERT_PTR_NOT_NULL_FATAL(items);
+    fill_records(LARGE_LENGTH, 1);
+
+    list = list_new(no_free, record_compare);
+    CU_ASSERT_PTR_NOT_NULL_FATAL(list);
+    for (idx = 0; idx < LARGE_LENGTH; idx++)
+    {
+        list_push_tail(list, items[idx]);
+    }
+
+    CU_ASSERT_EQUAL(parallel_list_sort(pool, list), E_SUCCESS);
+    CU_ASSERT_EQUAL(list->size, LARGE_LENGTH);
+
+    idx = 0;
+    for (current = list->head; NULL != current; current = current->next)
+    {
+        items[idx++] = current->data;
+    }
+    CU_ASSERT_EQUAL(idx, LARGE_LENGTH);
+    CU_ASSERT_TRUE(is_sorted_and_stable(items, LARGE_LENGTH));
+
+    CU_ASSERT_EQUAL(parallel_list_radix_sort(pool, list, record_key),
+                    E_SUCCESS);
+    CU_ASSERT_PTR_EQUAL(list->tail->prev->next, list->tail);
+
+    list_delete(&list);
+}
+
+void test_parallel_sort_invalid_args(void)
+{
+    CU_ASSERT_EQUAL(parallel_sort_array(pool, NULL, 1, record_compare),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_sort_array(pool, items, 1, NULL), E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_radix_sort_array(pool, items, 1, NULL),
+                    E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_string_sort_array(pool, NULL, 1), E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_vector_sort(pool, NULL), E_FAILURE);
+    CU_ASSERT_EQUAL(parallel_list_sort(pool, NULL), E_FAILURE);
+}
+
+static CU_TestInfo parallel_sort_tests[] = {
+    { "parallel_sort_array", test_parallel_sort_array },
+    { "parallel_radix_sort_array", test_parallel_radix_sort_array },
+    { "parallel_string_sort_array", test_parallel_string_sort_array },
+    { "parallel_vector_sort", test_parallel_vector_sort },
+    { "parallel_list_sort", test_parallel_list_sort },
+    { "parallel_sort_invalid_args", test_parallel_sort_invalid_args },
+    CU_TEST_INFO_NULL
+};
+
+CU_SuiteInfo parallel_sort_test_suite = {
+    "Parallel Sort Tests",
+    init_suite,         // Suite initialization function
+    clean_suite,        // Suite cleanup function
+    setup,              // Suite setup function
+    teardown,           // Suite teardown function
+    parallel_sort_tests // The combined array of all tests
+};
+
+/*** end of file ***/
@@ -0,0 +1,30 @@
+#include <CUnit/Basic.h>
+#include <CUnit/CUnit.h>
+
+int main(void)
+{
+    CU_basic_set_mode(CU_BRM_VERBOSE);
+
+    extern CU_SuiteInfo parallel_sort_test_suite;
+    extern CU_SuiteInfo parallel_floyd_warshall_test_suite;
+    extern CU_SuiteInfo parallel_bfs_test_suite;
+    extern CU_SuiteInfo parallel_graph_load_test_suite;
+    extern CU_SuiteInfo parallel_reachability_test_suite;
+
+    CU_SuiteInfo suites[] = { parallel_sort_test_suite,
+                              parallel_floyd_warshall_test_suite,
+                              parallel_bfs_test_suite,
+                              parallel_graph_load_test_suite,
+                              parallel_reachability_test_suite,
+                              CU_SUITE_INFO_NULL };
+
+    CU_initialize_registry();
+
+    CU_register_suites(suites);
+
+    CU_basic_run_tests();
+
+    CU_cleanup_registry();
+}
+
+/*** end of file ***/
@@ -0,0 +1,60 @@
+#ifndef _TASK_GROUP_H
+#define _TASK_GROUP_H
+
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "thread_pool.h"
+
+/**
+ * @brief Opaque structure tracking a batch of tasks submitted to a pool.
+ *
+ * A task group lets a caller fan work out to a `thread_pool_t` and block until
+ * every task in the batch has finished, which the pool itself does not
+ * provide.
+ */
+typedef struct task_group task_group_t;
+
+/**
+ * @brief Create a task group bound to a thread pool.
+ *
+ * @param thread_pool The pool that will execute submitted tasks. May be NULL,
+ *                    in which case tasks run inline in the submitting thread.
+ *
+ * @return A pointer to a new task group on success, or NULL on failure.
+ */
+task_group_t * task_group_create(thread_pool_t * thread_pool);
+
+/**
+ * @brief Submit a task to the group's pool.
+ *
+ * @param group The task group.
+ * @param task The function to execute. Must not be NULL.
+ * @param arg The argument passed to the task. Ownership stays with the caller.
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int task_group_submit(task_group_t * group, task_function_t task, void * arg);
+
+/**
+ * @brief Block until every task submitted to the group has completed.
+ *
+ * @param group The task group.
+ *
+ * @note Must not be called from a worker thread of the same pool, as the
+ *       waiting worker could be the one needed to run the remaining tasks.
+ *
+ * @return E_SUCCESS on success, E_FAILURE on failure.
+ */
+int task_group_wait(task_group_t * group);
+
+/**
+ * @brief Wait for outstanding tasks and free the task group.
+ *
+ * @param group Pointer to the task group pointer. Will be set to NULL.
+ */
+void task_group_destroy(task_group_t ** group);
+
+#endif /* _TASK_GROUP_H */
+
+/*** end of file ***/
@@ -65,6 +65,15 @@ int thread_pool_shutdown(thread_pool_t * thread_pool);
  */
 int thread_pool_destroy(thread_pool_t ** thread_pool);
 
+/**
+ * @brief Get the number of worker threads in the pool.
+ *
+ * @param thread_pool The thread pool to query.
+ *
+ * @return The number of worker threads, or 0 if thread_pool is NULL.
+ */
+size_t thread_pool_get_thread_count(thread_pool_t * thread_pool);
+
 /**
  * @brief Submit a new task to the thread pool.
  *
@@ -0,0 +1,200 @@
+#include <pthread.h>
+#include <stdio.h>
+
+#include "task_group.h"
+#include "utilities.h"
+
+/**
+ * @brief A struct for a task group
+ *
+ */
+struct task_group
+{
+    thread_pool_t * thread_pool; // Pool executing the tasks (NULL = inline)
+    size_t          pending;     // Tasks submitted but not yet finished
+    pthread_mutex_t mutex;       // Protects 'pending'
+    pthread_cond_t  done;        // Signaled when 'pending' drops to zero
+};
+
+/**
+ * @brief Per-task wrapper handed to the pool
+ *
+ */
+typedef struct group_task
+{
+    task_group_t *  group; // Owning group
+    task_function_t task;  // The user task
+    void *          arg;   // The user argument
+} group_task_t;
+
+/**
+ * @brief Runs the wrapped task, then marks it complete in its group
+ *
+ * @param data Pointer to a group_task_t
+ * @return void* Always returns NULL
+ */
+static void * group_task_routine(void * data);
+
+task_group_t * task_group_create(thread_pool_t * thread_pool)
+{
+    task_group_t * group = NULL;
+
+    group = calloc(1, sizeof(task_group_t));
+    if (NULL == group)
+    {
+        PRINT_DEBUG("task_group_create(): CMR failure.\n");
+        goto END;
+    }
+
+    if (E_SUCCESS != pthread_mutex_init(&group->mutex, NULL))
+    {
+        PRINT_DEBUG("task_group_create(): Unable to initialize mutex.\n");
+        goto CLEANUP_GROUP;
+    }
+
+    if (E_SUCCESS != pthread_cond_init(&group->done, NULL))
+    {
+        PRINT_DEBUG("task_group_create(): Unable to initialize condition.\n");
+        goto CLEANUP_MUTEX;
+    }
+
+    group->thread_pool = thread_pool;
+    group->pending     = 0;
+
+    goto END;
+
+CLEANUP_MUTEX:
+    pthread_mutex_destroy(&group->mutex);
+CLEANUP_GROUP:
+    free(group);
+    group = NULL;
+END:
+    return group;
+}
+
+int task_group_submit(task_group_t * group, task_function_t task, void * arg)
+{
+    int            exit_code    = E_FAILURE;
+    group_task_t * wrapped_task = NULL;
+
+    if ((NULL == group) || (NULL == task))
+    {
+        PRINT_DEBUG("task_group_submit(): NULL argument passed.\n");
+        goto END;
+    }
+
+    if (NULL == group->thread_pool)
+    {
+        task(arg);
+        exit_code = E_SUCCESS;
+        goto END;
+    }
+
+    wrapped_task = calloc(1, sizeof(group_task_t));
+    if (NULL == wrapped_task)
+    {
+        PRINT_DEBUG("task_group_submit(): CMR failure.\n");
+        goto END;
+    }
+
+    wrapped_task->group = group;
+    wrapped_task->task  = task;
+    wrapped_task->arg   = arg;
+
+    pthread_mutex_lock(&group->mutex);
+    group->pending++;
+    pthread_mutex_unlock(&group->mutex);
+
+    exit_code = thread_pool_add_task(
+        group->thread_pool, group_task_routine, free, wrapped_task);
+    if (E_SUCCESS != exit_code)
+    {
+        PRINT_DEBUG("task_group_submit(): Unable to add task to pool.\n");
+        pthread_mutex_lock(&group->mutex);
+        group->pending--;
+        pthread_cond_broadcast(&group->done);
+        pthread_mutex_unlock(&group->mutex);
+        free(wrapped_task);
+        wrapped_task = NULL;
+        goto END;
+    }
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+int task_group_wait(task_group_t * group)
+{
+    int exit_code = E_FAILURE;
+
+    if (NULL == group)
+    {
+        PRINT_DEBUG("task_group_wait(): NULL argument passed.\n");
+        goto END;
+    }
+
+    pthread_mutex_lock(&group->mutex);
+    while (0 < group->pending)
+    {
+        pthread_cond_wait(&group->done, &group->mutex);
+    }
+    pthread_mutex_unlock(&group->mutex);
+
+    exit_code = E_SUCCESS;
+END:
+    return exit_code;
+}
+
+void task_group_destroy(task_group_t ** group)
+{
+    if (NULL == group)
+    {
+        PRINT_DEBUG("task_group_destroy(): NULL argument passed.\n");
+        return;
+    }
+
+    if (NULL == *group)
+    {
+        return;
+    }
+
+    task_group_wait(*group);
+
+    pthread_cond_destroy(&(*group)->done);
+    pthread_mutex_destroy(&(*group)->mutex);
+    free(*group);
+    *group = NULL;
+}
+
+/***********************************************************************
+ * NOTE: STATIC FUNCTIONS LISTED BELOW
+ ***********************************************************************/
+
+static void * group_task_routine(void * data)
+{
+    group_task_t * wrapped_task = (group_task_t *)data;
+    task_group_t * group        = NULL;
+
+    if (NULL == wrapped_task)
+    {
+        PRINT_DEBUG("group_task_routine(): NULL argument passed.\n");
+        goto END;
+    }
+
+    group = wrapped_task->group;
+    wrapped_task->task(wrapped_task->arg);
+
+    pthread_mutex_lock(&group->mutex);
+    group->pending--;
+    if (0 == group->pending)
+    {
+        pthread_cond_broadcast(&group->done);
+    }
+    pthread_mutex_unlock(&group->mutex);
+
+END:
+    return NULL;
+}
+
+/*** end of file ***/
@@ -157,6 +157,21 @@ END:
     return exit_code;
 }
 
+size_t thread_pool_get_thread_count(thread_pool_t * thread_pool)
+{
+    size_t thread_count = 0;
+
+    if (NULL == thread_pool)
+    {
+        PRINT_DEBUG("thread_pool_get_thread_count(): NULL argument passed.\n");
+        goto END;
+    }
+
+    thread_count = thread_pool->thread_count;
+END:
+    return thread_count;
+}
+
 int thread_pool_shutdown(thread_pool_t * thread_pool)
 {
     int exit_code = E_FAILURE;